@@ -0,0 +1,102 @@
+#!/bin/bash
+
+# Cross-compiles SDL2 and testautomation from x86 Linux to ARM Linux with
+#  NEON, and runs the tests that compare SDL's NEON code paths with its C
+#  code under qemu user mode emulation. No display or sound card is needed.
+
+# You need cmake, qemu-user and a cross compiler; on Debian or Ubuntu that
+#  is gcc-aarch64-linux-gnu for "aarch64" (the default) or
+#  gcc-arm-linux-gnueabihf for "armhf" (ARMv7 with NEON).
+
+#  ./build-scripts/arm-simd-check.sh [aarch64|armhf] [builddir]
+
+ARCH="$1"
+if [ -z $1 ]; then
+    ARCH=aarch64
+fi
+
+case "$ARCH" in
+    aarch64)
+        HOST=aarch64-linux-gnu
+        PROCESSOR=aarch64
+        QEMU=qemu-aarch64
+        CFLAGS=""
+        ;;
+    armhf)
+        HOST=arm-linux-gnueabihf
+        PROCESSOR=armv7l
+        QEMU=qemu-arm
+        CFLAGS="-march=armv7-a -mfpu=neon -mfloat-abi=hard"
+        ;;
+    *)
+        echo "Usage: $0 [aarch64|armhf] [builddir]" 1>&2
+        exit 1
+        ;;
+esac
+
+BUILDDIR="$2"
+if [ -z $2 ]; then
+    BUILDDIR="arm-simd-$ARCH"
+fi
+
+# Each of these runs with SDL_HINT_CPU_DISABLE_FEATURES set to "all" and
+#  unset, and fails if the results differ.
+TESTS="surface_testBlitAlphaSIMD surface_testBlitAutoSIMD surface_testSoftStretchLinear"
+TESTS="$TESTS audio_resampleQuality"
+TESTS="$TESTS audio_mixerStreamsSIMD audio_mixAudioFormatSIMD"
+TESTS="$TESTS pixels_convertYUVToRGB pixels_convertRGBToYUV"
+
+OSTYPE=`uname -s`
+if [ "$OSTYPE" != "Linux" ]; then
+    echo "This only works on Linux at the moment." 1>&2
+    exit 1
+fi
+
+if [ "x$MAKE" == "x" ]; then
+    NCPU=`cat /proc/cpuinfo |grep ^processor |wc -l`
+    let NCPU=$NCPU+1
+    MAKE="make -j$NCPU"
+fi
+
+SRCDIR=`cd \`dirname $0\`/.. && pwd`
+
+set -e
+set -x
+rm -rf $BUILDDIR
+mkdir -p $BUILDDIR
+pushd $BUILDDIR
+
+# Only look for libraries built for the target, so that none of the
+#  optional video and audio backends get picked up from the host.
+export PKG_CONFIG_LIBDIR=/usr/lib/$HOST/pkgconfig
+cmake "$SRCDIR" \
+    -DCMAKE_SYSTEM_NAME=Linux \
+    -DCMAKE_SYSTEM_PROCESSOR=$PROCESSOR \
+    -DCMAKE_C_COMPILER=$HOST-gcc \
+    -DCMAKE_C_FLAGS="$CFLAGS" \
+    -DCMAKE_FIND_ROOT_PATH=/usr/$HOST \
+    -DCMAKE_FIND_ROOT_PATH_MODE_PROGRAM=NEVER \
+    -DCMAKE_FIND_ROOT_PATH_MODE_LIBRARY=ONLY \
+    -DCMAKE_FIND_ROOT_PATH_MODE_INCLUDE=ONLY \
+    -DCMAKE_BUILD_TYPE=Release \
+    -DSDL_TEST=ON \
+    -DVIDEO_OPENGL=OFF \
+    -DVIDEO_OPENGLES=OFF
+$MAKE
+
+cd test
+set +x
+FAILED=""
+for TEST in $TESTS; do
+    echo "Running $TEST under $QEMU ..."
+    if ! SDL_VIDEODRIVER=dummy SDL_AUDIODRIVER=dummy $QEMU -L /usr/$HOST ./testautomation --filter $TEST; then
+        FAILED="$FAILED $TEST"
+    fi
+done
+popd
+
+if [ "x$FAILED" != "x" ]; then
+    echo "Failed on $ARCH:$FAILED" 1>&2
+    exit 1
+fi
+echo "All NEON code paths matched the C code on $ARCH."
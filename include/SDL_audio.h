@@ -419,6 +419,26 @@ extern DECLSPEC void SDLCALL SDL_PauseAudioDevice(SDL_AudioDeviceID dev,
                                                   int pause_on);
 /* @} *//* Pause audio functions */
 
+/**
+ *  Play or capture a number of device buffers on a device that runs on the
+ *  app's clock instead of its own, and wait until they're done.
+ *
+ *  Only the disk audio driver can do this, when ::SDL_HINT_AUDIO_DISK_TIMING
+ *  is "manual". Such a device doesn't do anything until it is advanced, so
+ *  every buffer it writes or reads matches one call of this function, no
+ *  matter how fast or slow the app runs. Unpause the device first, or it
+ *  advances through silence.
+ *
+ *  Don't call this with the device locked, the device thread needs the lock
+ *  to call the audio callback.
+ *
+ *  \param dev The device ID to advance.
+ *  \param buffers The number of device buffers (the obtained spec's samples
+ *                 frames each) to play or capture.
+ *  \return 0 on success, or -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_AdvanceAudioDevice(SDL_AudioDeviceID dev, int buffers);
+
 /**
  *  \brief Load the audio data of a WAVE file into memory
  *
@@ -489,6 +509,87 @@ extern DECLSPEC SDL_AudioSpec *SDLCALL SDL_LoadWAV_RW(SDL_RWops * src,
  */
 extern DECLSPEC void SDLCALL SDL_FreeWAV(Uint8 * audio_buf);
 
+/* Incremental WAVE decoding */
+struct _SDL_WAVStream;
+typedef struct _SDL_WAVStream SDL_WAVStream;
+
+/**
+ *  \brief Open a WAVE file for decoding on demand
+ *
+ *  Unlike SDL_LoadWAV_RW(), this only reads the headers of the file. The audio
+ *  data is read and decoded in small pieces by SDL_WAVStreamRead(), so memory
+ *  use does not grow with the length of the file. ADPCM files are decoded one
+ *  block at a time and all other formats a few thousand sample frames at a
+ *  time. The supported formats, the hints, and the format written to \c spec
+ *  are the same as with SDL_LoadWAV_RW().
+ *
+ *  The data source is read from until the stream is closed and must support
+ *  seeking. If \c freesrc is non-zero, it gets closed and freed along with the
+ *  stream, or before the function returns on failure.
+ *
+ *  \param src The data source with the WAVE data
+ *  \param freesrc A integer value that makes the stream close the data source if non-zero
+ *  \param spec A pointer filled with the audio format of the decoded data
+ *  \return the new stream, or NULL on error.
+ *
+ *  \sa SDL_WAVStreamRead
+ *  \sa SDL_WAVStreamSeek
+ *  \sa SDL_CloseWAVStream
+ */
+extern DECLSPEC SDL_WAVStream *SDLCALL SDL_OpenWAVStream_RW(SDL_RWops * src,
+                                                            int freesrc,
+                                                            SDL_AudioSpec * spec);
+
+/**
+ *  Read decoded audio data from the stream
+ *
+ *  \param stream The stream to read from
+ *  \param buf A buffer to fill with audio data in the format of the spec
+ *  \param len The maximum number of bytes to fill
+ *  \return The number of bytes read, 0 at the end of the data, or -1 on error.
+ *
+ *  \sa SDL_OpenWAVStream_RW
+ */
+extern DECLSPEC int SDLCALL SDL_WAVStreamRead(SDL_WAVStream *stream, void *buf, int len);
+
+/**
+ *  Move the read position of the stream to a sample frame
+ *
+ *  ADPCM data is decoded from the start of the block that contains the frame.
+ *
+ *  \param stream The stream to seek in
+ *  \param frame The sample frame, between zero and SDL_WAVStreamLength()
+ *  \return 0 on success, or -1 on error.
+ *
+ *  \sa SDL_WAVStreamTell
+ */
+extern DECLSPEC int SDLCALL SDL_WAVStreamSeek(SDL_WAVStream *stream, Sint64 frame);
+
+/**
+ *  Get the sample frame the next call to SDL_WAVStreamRead() starts at
+ *
+ *  \param stream The stream to query
+ *  \return The sample frame, or -1 on error.
+ */
+extern DECLSPEC Sint64 SDLCALL SDL_WAVStreamTell(SDL_WAVStream *stream);
+
+/**
+ *  Get the number of sample frames in the stream
+ *
+ *  This can shrink while reading if the file turns out to be truncated.
+ *
+ *  \param stream The stream to query
+ *  \return The number of sample frames, or -1 on error.
+ */
+extern DECLSPEC Sint64 SDLCALL SDL_WAVStreamLength(SDL_WAVStream *stream);
+
+/**
+ *  Close a stream opened with SDL_OpenWAVStream_RW()
+ *
+ *  \param stream The stream to close
+ */
+extern DECLSPEC void SDLCALL SDL_CloseWAVStream(SDL_WAVStream *stream);
+
 /**
  *  This function takes a source format and rate and a destination format
  *  and rate, and initializes the \c cvt structure with information needed
@@ -646,6 +747,143 @@ extern DECLSPEC void SDLCALL SDL_AudioStreamClear(SDL_AudioStream *stream);
  */
 extern DECLSPEC void SDLCALL SDL_FreeAudioStream(SDL_AudioStream *stream);
 
+/**
+ *  The speed/quality tradeoffs available when a stream resamples audio.
+ *
+ *  \sa SDL_AudioStreamSetResampleQuality
+ *  \sa SDL_HINT_AUDIO_RESAMPLE_QUALITY
+ */
+typedef enum
+{
+    SDL_AUDIO_RESAMPLE_NEAREST,         /**< Repeat or skip samples, cheapest and noisiest */
+    SDL_AUDIO_RESAMPLE_LINEAR,          /**< Linear interpolation between two samples */
+    SDL_AUDIO_RESAMPLE_CUBIC,           /**< Cubic interpolation between four samples */
+    SDL_AUDIO_RESAMPLE_BANDLIMITED,     /**< Windowed sinc filter over 12 samples (the default) */
+    SDL_AUDIO_RESAMPLE_BANDLIMITED_HQ   /**< Windowed sinc filter over 32 samples, with a steeper cutoff */
+} SDL_AudioResampleQuality;
+
+/**
+ *  Change how a stream resamples audio. New streams start with the quality
+ *  set by ::SDL_HINT_AUDIO_RESAMPLE_QUALITY.
+ *
+ *  This is best done right after creating the stream, there may be a short
+ *  glitch if it has already been resampling with libsamplerate.
+ *  Streams that don't change the sample rate ignore this.
+ *
+ *  \param stream The stream to change
+ *  \param quality The resampling quality to use from now on
+ *  \return 0 on success, or -1 on error.
+ *
+ *  \sa SDL_NewAudioStream
+ *  \sa SDL_AudioResampleQuality
+ */
+extern DECLSPEC int SDLCALL SDL_AudioStreamSetResampleQuality(SDL_AudioStream *stream, SDL_AudioResampleQuality quality);
+
+/*
+ *  SDL_AudioMixer adds up any number of audio streams into one output, for
+ *  apps that play several sounds at once through one device.
+ *    - each stream converts its own audio to float at the mixer's channel
+ *      count and rate, so the sounds can all be in different formats.
+ *    - every stream is scaled by its gain and accumulated into one float
+ *      buffer, which is clipped and converted to the output format once,
+ *      no matter how many streams there are.
+ *    - streams that run out of data just stop contributing; the rest of
+ *      the output is silence.
+ *
+ *  To play the mixer through a device, open it with SDL_AudioMixerCallback
+ *  as the callback and the mixer as the userdata, using the obtained spec
+ *  to create the mixer. The callback runs on the audio thread, so
+ *  lock the device with SDL_LockAudioDevice() around any other call on the
+ *  mixer or its streams, including SDL_AudioStreamPut().
+ */
+/* this is opaque to the outside world. */
+struct _SDL_AudioMixer;
+typedef struct _SDL_AudioMixer SDL_AudioMixer;
+
+/**
+ *  Create a new audio mixer
+ *
+ *  \param format The format of the mixed output
+ *  \param channels The number of channels of the mixed output
+ *  \param rate The sampling rate of the mixed output
+ *  \return The new mixer, or NULL on error.
+ *
+ *  \sa SDL_AudioMixerNewStream
+ *  \sa SDL_AudioMixerGet
+ *  \sa SDL_AudioMixerCallback
+ *  \sa SDL_FreeAudioMixer
+ */
+extern DECLSPEC SDL_AudioMixer * SDLCALL SDL_NewAudioMixer(const SDL_AudioFormat format,
+                                           const Uint8 channels,
+                                           const int rate);
+
+/**
+ *  Create a new stream that feeds the mixer, at full gain. Put audio into it
+ *  with SDL_AudioStreamPut(); the mixer gets the converted audio out of it.
+ *  The mixer owns the stream: free it with SDL_AudioMixerFreeStream() or
+ *  SDL_FreeAudioMixer(), never with SDL_FreeAudioStream().
+ *
+ *  \param mixer The mixer the stream is added to
+ *  \param src_format The format of the audio put into the stream
+ *  \param src_channels The number of channels of the audio put into the stream
+ *  \param src_rate The sampling rate of the audio put into the stream
+ *  \return The new stream, or NULL on error.
+ *
+ *  \sa SDL_AudioMixerSetGain
+ *  \sa SDL_AudioMixerFreeStream
+ */
+extern DECLSPEC SDL_AudioStream * SDLCALL SDL_AudioMixerNewStream(SDL_AudioMixer *mixer,
+                                           const SDL_AudioFormat src_format,
+                                           const Uint8 src_channels,
+                                           const int src_rate);
+
+/**
+ *  Set how much of a stream goes into the mix
+ *
+ *  \param mixer The mixer that owns the stream
+ *  \param stream The stream to change
+ *  \param gain The factor to scale the stream's samples by; 1.0f is unchanged
+ *  \return 0 on success, or -1 on error.
+ *
+ *  \sa SDL_AudioMixerNewStream
+ */
+extern DECLSPEC int SDLCALL SDL_AudioMixerSetGain(SDL_AudioMixer *mixer, SDL_AudioStream *stream, float gain);
+
+/**
+ *  Remove a stream from the mixer and free it
+ *
+ *  \sa SDL_AudioMixerNewStream
+ */
+extern DECLSPEC void SDLCALL SDL_AudioMixerFreeStream(SDL_AudioMixer *mixer, SDL_AudioStream *stream);
+
+/**
+ *  Mix the streams into a buffer in the mixer's output format. This always
+ *  fills the whole buffer, with silence where no stream had any audio.
+ *
+ *  \param mixer The mixer to get audio from
+ *  \param buf A buffer to fill with audio data
+ *  \param len The number of bytes to fill, a multiple of the output frame size
+ *  \return The number of bytes written to the buffer, or -1 on error
+ *
+ *  \sa SDL_AudioMixerCallback
+ */
+extern DECLSPEC int SDLCALL SDL_AudioMixerGet(SDL_AudioMixer *mixer, void *buf, int len);
+
+/**
+ *  An SDL_AudioCallback that calls SDL_AudioMixerGet(), with the mixer
+ *  passed as the userdata.
+ *
+ *  \sa SDL_OpenAudioDevice
+ */
+extern DECLSPEC void SDLCALL SDL_AudioMixerCallback(void *userdata, Uint8 *stream, int len);
+
+/**
+ *  Free an audio mixer, and all of its streams
+ *
+ *  \sa SDL_NewAudioMixer
+ */
+extern DECLSPEC void SDLCALL SDL_FreeAudioMixer(SDL_AudioMixer *mixer);
+
 #define SDL_MIX_MAXVOLUME 128
 /**
  *  This takes two audio buffers of the playing audio format and mixes
@@ -827,6 +1065,83 @@ extern DECLSPEC Uint32 SDLCALL SDL_GetQueuedAudioSize(SDL_AudioDeviceID dev);
 extern DECLSPEC void SDLCALL SDL_ClearQueuedAudio(SDL_AudioDeviceID dev);
 
 
+/**
+ *  \name Audio device statistics
+ *
+ *  The thread of every open device keeps track of how long each period takes.
+ *  These are the user callback (the buffer queue for devices that use
+ *  SDL_QueueAudio() or SDL_DequeueAudio()), conversion between the callback's
+ *  format and the device's, and waiting on the device. It also counts the
+ *  periods that couldn't be filled or emptied in time.
+ *
+ *  The hint SDL_HINT_AUDIO_DEVICE_STATS_LOG makes the device thread log a
+ *  summary through SDL_Log at a regular interval, too.
+ */
+/* @{ */
+#define SDL_AUDIO_STATS_BUCKETS 16
+
+/**
+ *  Durations of one part of the audio thread's work, in microseconds.
+ *
+ *  histogram[0] counts durations below 32 microseconds, each of the following
+ *  buckets covers twice the range of the one before it, and the last one
+ *  counts everything longer.
+ */
+typedef struct SDL_AudioTimingStats
+{
+    Uint32 count;       /**< Number of durations measured */
+    Uint64 total_us;    /**< Sum of all durations */
+    Uint32 max_us;      /**< Longest duration */
+    Uint32 histogram[SDL_AUDIO_STATS_BUCKETS];
+} SDL_AudioTimingStats;
+
+typedef struct SDL_AudioDeviceStats
+{
+    Uint32 periods;     /**< Device buffers played or captured */
+    SDL_AudioTimingStats callback;      /**< Every call of the callback */
+    SDL_AudioTimingStats conversion;    /**< Conversion per period, only for devices that convert */
+    SDL_AudioTimingStats wait;          /**< Playing and waiting for, or capturing, a device buffer */
+
+    /**
+     *  Playback periods whose callbacks and conversion took longer than the
+     *  period itself, plus the times the SDL_QueueAudio() data ran out while
+     *  playing.
+     */
+    Uint32 underruns;
+
+    /** Capture periods whose conversion and callbacks took longer than the period itself */
+    Uint32 overruns;
+
+    int stream_queued;      /**< Bytes left in the conversion stream after the last period */
+    int stream_queued_max;  /**< Most bytes ever left in the conversion stream */
+    Uint32 direct_puts;     /**< Playback callbacks written straight into the conversion stream */
+    Uint32 copied_puts;     /**< Playback callbacks that had to be copied into the conversion stream */
+} SDL_AudioDeviceStats;
+
+/**
+ *  Get the statistics of an open audio device.
+ *
+ *  \param dev The device ID to query.
+ *  \param stats Filled with the statistics since the device was opened or
+ *               SDL_ResetAudioDeviceStats() was called.
+ *  \return 0 on success, or -1 on error.
+ *
+ *  \sa SDL_ResetAudioDeviceStats
+ */
+extern DECLSPEC int SDLCALL SDL_GetAudioDeviceStats(SDL_AudioDeviceID dev, SDL_AudioDeviceStats *stats);
+
+/**
+ *  Start the statistics of an open audio device over.
+ *
+ *  \param dev The device ID to reset.
+ *  \return 0 on success, or -1 on error.
+ *
+ *  \sa SDL_GetAudioDeviceStats
+ */
+extern DECLSPEC int SDLCALL SDL_ResetAudioDeviceStats(SDL_AudioDeviceID dev);
+/* @} *//* Audio device statistics */
+
+
 /**
  *  \name Audio lock functions
  *
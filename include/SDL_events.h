@@ -682,6 +682,15 @@ extern DECLSPEC int SDLCALL SDL_PeepEvents(SDL_Event * events, int numevents,
 extern DECLSPEC SDL_bool SDLCALL SDL_HasEvent(Uint32 type);
 extern DECLSPEC SDL_bool SDLCALL SDL_HasEvents(Uint32 minType, Uint32 maxType);
 
+/**
+ *  \brief Get the number of motion events that were merged into earlier
+ *         events instead of being queued, since the event subsystem was
+ *         initialized.
+ *
+ *  \sa SDL_HINT_EVENT_COALESCE_MOTION
+ */
+extern DECLSPEC int SDLCALL SDL_GetNumCoalescedEvents(void);
+
 /**
  *  This function clears events from the event queue
  *  This function only affects currently queued events. If you want to make
@@ -701,6 +710,29 @@ extern DECLSPEC void SDLCALL SDL_FlushEvents(Uint32 minType, Uint32 maxType);
  */
 extern DECLSPEC int SDLCALL SDL_PollEvent(SDL_Event * event);
 
+/**
+ *  \brief Polls for a batch of currently pending events.
+ *
+ *  Up to \c numevents events at the front of the event queue are removed
+ *  and stored in \c events, taking the event queue lock at most once, so
+ *  draining a burst of events costs about the same as a single poll.
+ *
+ *  Event filters and watchers are run when events are pushed on the queue,
+ *  so they apply to these events just like with SDL_PollEvent().
+ *
+ *  \return The number of events stored, or -1 if there was an error.
+ *
+ *  \param events An array of at least \c numevents events.
+ *  \param numevents The maximum number of events to return.
+ *  \param pump If SDL_TRUE, SDL_PumpEvents() is called once before the
+ *              queue is read.
+ *
+ *  \sa SDL_PollEvent()
+ *  \sa SDL_PeepEvents()
+ */
+extern DECLSPEC int SDLCALL SDL_PollEvents(SDL_Event * events, int numevents,
+                                           SDL_bool pump);
+
 /**
  *  \brief Waits indefinitely for the next available event.
  *
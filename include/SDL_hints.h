@@ -1309,6 +1309,29 @@ extern "C" {
  */
 #define SDL_HINT_AUDIO_RESAMPLING_MODE   "SDL_AUDIO_RESAMPLING_MODE"
 
+/**
+ *  \brief  A variable controlling the resampling quality of new audio streams.
+ *
+ *  This is the default for SDL_NewAudioStream(), including the streams SDL
+ *  creates to convert audio for a device. It can be changed for a single
+ *  stream with SDL_AudioStreamSetResampleQuality(). SDL_AudioCVT always uses
+ *  the bandlimited filter.
+ *
+ *  If libsamplerate is in use (see SDL_HINT_AUDIO_RESAMPLING_MODE), it
+ *  replaces the "bandlimited" setting.
+ *
+ *  This hint is checked when a stream is created.
+ *
+ *  This variable can be set to the following values:
+ *
+ *    "0" or "nearest"        - Repeat or skip samples, cheapest and noisiest
+ *    "1" or "linear"         - Linear interpolation
+ *    "2" or "cubic"          - Cubic interpolation
+ *    "3" or "bandlimited"    - Windowed sinc filter (default)
+ *    "4" or "bandlimited_hq" - Longer windowed sinc filter, highest quality
+ */
+#define SDL_HINT_AUDIO_RESAMPLE_QUALITY   "SDL_AUDIO_RESAMPLE_QUALITY"
+
 /**
  *  \brief  A variable controlling the audio category on iOS and Mac OS X
  *
@@ -1346,6 +1369,43 @@ extern "C" {
  */
 #define SDL_HINT_RENDER_BATCHING  "SDL_RENDER_BATCHING"
 
+/**
+ *  \brief  A variable controlling how many threads the software renderer uses.
+ *
+ *  This variable can be set to the following values:
+ *
+ *    "0" or "1" - Render everything on the calling thread (default)
+ *    "N"        - Split the render target into N horizontal bands and replay
+ *                 each batch of commands on all of them in parallel
+ *
+ *  The output is identical to rendering on a single thread. Batches that
+ *  contain lines or scaled copies are always rendered on the calling thread,
+ *  and textures used in threaded batches don't use RLE acceleration.
+ *
+ *  This hint is read when the software renderer is created.
+ */
+#define SDL_HINT_RENDER_SOFTWARE_THREADS  "SDL_RENDER_SOFTWARE_THREADS"
+
+/**
+ *  \brief  A variable controlling how many threads SDL_ConvertPixels() uses.
+ *
+ *  Large conversions can be split into horizontal bands that are converted
+ *  in parallel. Each band has at least a quarter of a million pixels, so
+ *  small images are always converted on the calling thread. This applies to
+ *  conversions between RGB formats, between RGB and YUV formats, and between
+ *  YUV formats unless both are planar, and also to SDL_ConvertSurface() when
+ *  it can use SDL_ConvertPixels().
+ *
+ *  This variable can be set to the following values:
+ *
+ *    "0" or "1" - Convert everything on the calling thread (default)
+ *    "N"        - Convert with up to N threads, including the calling thread
+ *    "auto"     - Convert with up to as many threads as SDL_GetCPUCount()
+ *
+ *  The output is identical in all cases.
+ */
+#define SDL_HINT_CONVERT_PIXELS_THREADS  "SDL_CONVERT_PIXELS_THREADS"
+
 
 /**
  *  \brief  A variable controlling whether SDL updates joystick state when getting input events
@@ -1394,6 +1454,44 @@ extern "C" {
  */
 #define SDL_HINT_EVENT_LOGGING   "SDL_EVENT_LOGGING"
 
+/**
+ *  \brief  A variable controlling whether consecutive motion events are merged in the event queue.
+ *
+ *  This variable can be set to the following values:
+ *
+ *    "0"     - Every motion event is queued separately (default)
+ *    "1"     - A mouse or finger motion event for the same window and device
+ *              as the event at the end of the queue is merged into it
+ *
+ *  When events are merged, the position (and pressure, for fingers) comes
+ *  from the newest event and the relative motion is accumulated, so apps
+ *  that only care about the latest position or the total motion per frame
+ *  process fewer events, and a flood of motion doesn't fill up the queue.
+ *  Event filters and watchers still see every event.
+ *
+ *  The number of merged events can be queried with SDL_GetNumCoalescedEvents().
+ *
+ *  This hint can be toggled on and off at runtime.
+ */
+#define SDL_HINT_EVENT_COALESCE_MOTION   "SDL_EVENT_COALESCE_MOTION"
+
+/**
+ *  \brief  A variable controlling whether SDL_PushEvent() and SDL_PollEvent() use a lock-free queue.
+ *
+ *  This variable can be set to the following values:
+ *
+ *    "0"     - Every event goes through the event queue's mutex
+ *    "1"     - Events are pushed and polled through a lock-free ring when
+ *              possible (default)
+ *
+ *  The ring is bounded; when it's full, and for operations that need the
+ *  whole queue, like SDL_PeepEvents() or SDL_FlushEvents(), SDL falls back
+ *  to the locked queue. Events are delivered in the same order either way.
+ *
+ *  This hint must be set before the event subsystem is initialized.
+ */
+#define SDL_HINT_EVENT_QUEUE_LOCKFREE   "SDL_EVENT_QUEUE_LOCKFREE"
+
 
 
 /**
@@ -1460,6 +1558,22 @@ extern "C" {
  */
 #define SDL_HINT_WAVE_FACT_CHUNK   "SDL_WAVE_FACT_CHUNK"
 
+/**
+ *  \brief  A variable controlling how many threads decode ADPCM WAVE files.
+ *
+ *  Every block of MS ADPCM and IMA ADPCM data can be decoded on its own, so
+ *  SDL_LoadWAV_RW() can split large files across several threads. Files with
+ *  fewer than a few hundred blocks per thread are decoded on fewer threads.
+ *
+ *  This variable can be set to the following values:
+ *
+ *    "0" or "1" - Decode everything on the calling thread (default)
+ *    "N"        - Decode with up to N threads, including the calling thread
+ *
+ *  The decoded data is identical in all cases.
+ */
+#define SDL_HINT_WAVE_DECODE_THREADS   "SDL_WAVE_DECODE_THREADS"
+
 /**
  *  \brief Override for SDL_GetDisplayUsableBounds()
  *
@@ -1515,6 +1629,48 @@ extern "C" {
  */
 #define SDL_HINT_AUDIO_DEVICE_STREAM_NAME "SDL_AUDIO_DEVICE_STREAM_NAME"
 
+/**
+ *  \brief  A variable that makes audio devices log their statistics.
+ *
+ *  If set to a number of milliseconds, the thread of every audio device
+ *  opened afterwards logs a summary of SDL_GetAudioDeviceStats() through
+ *  SDL_Log at that interval. "0" or unset doesn't log anything (default).
+ */
+#define SDL_HINT_AUDIO_DEVICE_STATS_LOG "SDL_AUDIO_DEVICE_STATS_LOG"
+
+/**
+ *  \brief  A variable controlling how fast the disk audio driver runs.
+ *
+ *  This variable can be set to the following values:
+ *    "realtime" - Play and capture at the speed of the audio, or as set by
+ *                 the SDL_DISKAUDIODELAY environment variable (default)
+ *    "fast"     - Play and capture as fast as the callback can keep up
+ *    "manual"   - Only play or capture when the app calls
+ *                 SDL_AdvanceAudioDevice(), in lock-step with the app
+ *
+ *  The files are the same in every mode, as long as the callback produces
+ *  the same audio. Devices fed with SDL_QueueAudio() are the exception:
+ *  they play silence whenever the queue runs dry, which in "realtime" and
+ *  "fast" depends on how quickly the app queues. Only "manual" gives the
+ *  same file every time for them, when the audio is queued before the
+ *  device is advanced. This is read when a device is opened.
+ */
+#define SDL_HINT_AUDIO_DISK_TIMING "SDL_AUDIO_DISK_TIMING"
+
+/**
+ *  \brief  A variable that makes the disk audio driver use its own format.
+ *
+ *  By default the files have the format, frequency and channels that the
+ *  app opened the device with. This variable can be set to
+ *  "format,frequency,channels", for example "S16LSB,48000,2", and SDL
+ *  converts the app's audio to that, like it does for sound cards that
+ *  don't support what the app asked for. The format is one of the names
+ *  the SDL_AUDIO_FORMAT environment variable takes. Fields that are empty
+ *  are left as the app asked, so "F32" only changes the format. This is
+ *  read when a device is opened.
+ */
+#define SDL_HINT_AUDIO_DISK_SPEC "SDL_AUDIO_DISK_SPEC"
+
 
 /**
  *  \brief Override for SDL_GetPreferredLocales()
@@ -1530,6 +1686,24 @@ extern "C" {
  */
 #define SDL_HINT_PREFERRED_LOCALES "SDL_PREFERRED_LOCALES"
 
+/**
+ *  \brief  A comma separated list of CPU features that SDL's own code shouldn't use.
+ *
+ *  This can be used to compare SDL's SIMD code paths with the plain C code,
+ *  or to work around a problem with one of them. The names are the ones used
+ *  by the SDL_Has*() functions, in lowercase: "mmx", "3dnow", "sse", "sse2",
+ *  "sse3", "sse41", "sse42", "avx", "avx2", "avx512f", "altivec", "armsimd"
+ *  and "neon". "all" disables all of them.
+ *
+ *  For example, "avx2,avx512f" makes SDL use its SSE code paths on CPUs
+ *  that support AVX2.
+ *
+ *  The SDL_Has*() functions still report what the CPU supports. This hint
+ *  is watched while SDL is initialized, and code paths that are picked once
+ *  are picked again when it changes.
+ */
+#define SDL_HINT_CPU_DISABLE_FEATURES "SDL_CPU_DISABLE_FEATURES"
+
 
 /**
  *  \brief  An enumeration of hint priorities
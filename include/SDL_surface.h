@@ -521,7 +521,7 @@ extern DECLSPEC int SDLCALL SDL_SoftStretch(SDL_Surface * src,
 
 /**
  *  \brief Perform a bilinear scaling between two surfaces of the
- *         same pixel format, 32BPP.
+ *         same pixel format, 16 or 32BPP.
  *
  */
 extern DECLSPEC int SDLCALL SDL_SoftStretchLinear(SDL_Surface * src,
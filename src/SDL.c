@@ -48,6 +48,7 @@
 #include "haptic/SDL_haptic_c.h"
 #include "joystick/SDL_joystick_c.h"
 #include "sensor/SDL_sensor_c.h"
+#include "cpuinfo/SDL_cpuinfo_c.h"
 
 #if SDL_THREAD_AMIGAOS4
 #include "thread/amigaos4/SDL_systhread_c.h"
@@ -163,6 +164,8 @@ SDL_InitSubSystem(Uint32 flags)
     OS4_InitThreadSubSystem();
 #endif
 
+    SDL_InitCPUInfo();
+
     if ((flags & SDL_INIT_GAMECONTROLLER)) {
         /* game controller implies joystick */
         flags |= SDL_INIT_JOYSTICK;
@@ -451,6 +454,7 @@ SDL_Quit(void)
 #endif
 
     SDL_ClearHints();
+    SDL_QuitCPUInfo();
     SDL_AssertionsQuit();
     SDL_LogResetPriorities();
 
@@ -38,8 +38,17 @@ struct SDL_DataQueue
     SDL_DataQueuePacket *pool; /* these are unused packets. */
     size_t packet_size;   /* size of new packets */
     size_t queued_bytes;  /* number of bytes of data in the queue. */
+
+    /* single producer/single consumer queues use a fixed ring buffer instead. */
+    Uint8 *ring;           /* NULL for packet queues. */
+    Uint32 ring_size;      /* always a power of two. */
+    SDL_atomic_t ring_read;   /* total bytes read (wraps around); only the reader changes it. */
+    SDL_atomic_t ring_write;  /* total bytes written (wraps around); only the writer changes it. */
 };
 
+/* the read and write counters are 32-bit, so the ring must fit in half of that. */
+#define SDL_DATAQUEUE_MAX_RING_SIZE ((Uint32) 1 << 30)
+
 static void
 SDL_FreeDataQueueList(SDL_DataQueuePacket *packet)
 {
@@ -83,12 +92,145 @@ SDL_NewDataQueue(const size_t _packetlen, const size_t initialslack)
     return queue;
 }
 
+static Uint32
+RingSizeForCapacity(const Uint32 minsize, const size_t capacity)
+{
+    Uint32 size = minsize;
+    while (size < capacity) {
+        size *= 2;
+    }
+    return size;
+}
+
+SDL_DataQueue *
+SDL_NewSPSCDataQueue(const size_t capacity)
+{
+    SDL_DataQueue *queue;
+    Uint32 size;
+
+    if (capacity > SDL_DATAQUEUE_MAX_RING_SIZE) {
+        SDL_SetError("Data queue capacity is too large");
+        return NULL;
+    }
+
+    size = RingSizeForCapacity(1024, capacity);
+    queue = (SDL_DataQueue *) SDL_calloc(1, sizeof (SDL_DataQueue));
+    if (queue) {
+        queue->ring = (Uint8 *) SDL_malloc(size);
+    }
+
+    if (!queue || !queue->ring) {
+        SDL_free(queue);
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    queue->ring_size = size;
+    return queue;
+}
+
+/* Only called from the writer: the reader can only make the free space
+   larger while this runs, so there's always at least (len) to write into. */
+static int
+WriteToRing(SDL_DataQueue *queue, const Uint8 *data, const size_t len)
+{
+    const Uint32 write = (Uint32) SDL_AtomicGet(&queue->ring_write);
+    const Uint32 read = (Uint32) SDL_AtomicGet(&queue->ring_read);
+    const Uint32 pos = write & (queue->ring_size - 1);
+    size_t cpy;
+
+    if (len > (size_t) (queue->ring_size - (write - read))) {
+        return SDL_SetError("Data queue is full");
+    }
+
+    cpy = SDL_min(len, (size_t) (queue->ring_size - pos));
+    SDL_memcpy(queue->ring + pos, data, cpy);
+    SDL_memcpy(queue->ring, data + cpy, len - cpy);
+
+    /* the reader may see the new data as soon as this is set. */
+    SDL_AtomicSet(&queue->ring_write, (int) (write + (Uint32) len));
+    return 0;
+}
+
+/* Only called from the reader, which is symmetrical to WriteToRing(). */
+static size_t
+ReadFromRing(SDL_DataQueue *queue, Uint8 *buf, const size_t len, const SDL_bool consume)
+{
+    const Uint32 read = (Uint32) SDL_AtomicGet(&queue->ring_read);
+    const Uint32 write = (Uint32) SDL_AtomicGet(&queue->ring_write);
+    const Uint32 pos = read & (queue->ring_size - 1);
+    const size_t total = SDL_min(len, (size_t) (write - read));
+    const size_t cpy = SDL_min(total, (size_t) (queue->ring_size - pos));
+
+    SDL_memcpy(buf, queue->ring + pos, cpy);
+    SDL_memcpy(buf + cpy, queue->ring, total - cpy);
+
+    if (consume) {
+        /* the writer may reuse the space as soon as this is set. */
+        SDL_AtomicSet(&queue->ring_read, (int) (read + (Uint32) total));
+    }
+    return total;
+}
+
+int
+SDL_GrowDataQueue(SDL_DataQueue *queue, const size_t capacity)
+{
+    Uint8 *ring;
+    Uint32 size, read, queued, done;
+
+    if (!queue) {
+        return SDL_InvalidParamError("queue");
+    } else if (!queue->ring) {
+        return SDL_SetError("Only single producer/single consumer data queues have a capacity");
+    } else if (capacity <= queue->ring_size) {
+        return 0;
+    } else if (capacity > SDL_DATAQUEUE_MAX_RING_SIZE) {
+        return SDL_SetError("Data queue capacity is too large");
+    }
+
+    size = RingSizeForCapacity(queue->ring_size * 2, capacity);
+    ring = (Uint8 *) SDL_malloc(size);
+    if (!ring) {
+        return SDL_OutOfMemory();
+    }
+
+    /* the reader and writer are stopped, but other threads may still count
+       the queue. Put every byte at the same counter position in the new
+       ring, so the counters stay as they are and (write - read) stays valid. */
+    read = (Uint32) SDL_AtomicGet(&queue->ring_read);
+    queued = (Uint32) SDL_AtomicGet(&queue->ring_write) - read;
+    for (done = 0; done < queued; ) {
+        const Uint32 src = (read + done) & (queue->ring_size - 1);
+        const Uint32 dst = (read + done) & (size - 1);
+        const Uint32 cpy = SDL_min(queued - done, SDL_min(queue->ring_size - src, size - dst));
+        SDL_memcpy(ring + dst, queue->ring + src, cpy);
+        done += cpy;
+    }
+
+    SDL_free(queue->ring);
+    queue->ring = ring;
+    queue->ring_size = size;
+    return 0;
+}
+
+size_t
+SDL_CountFreeSpaceInDataQueue(SDL_DataQueue *queue)
+{
+    if (!queue) {
+        return 0;
+    } else if (!queue->ring) {
+        return ~((size_t) 0);  /* packet queues grow as needed. */
+    }
+    return (size_t) (queue->ring_size - SDL_CountDataQueue(queue));
+}
+
 void
 SDL_FreeDataQueue(SDL_DataQueue *queue)
 {
     if (queue) {
         SDL_FreeDataQueueList(queue->head);
         SDL_FreeDataQueueList(queue->pool);
+        SDL_free(queue->ring);
         SDL_free(queue);
     }
 }
@@ -96,16 +238,22 @@ SDL_FreeDataQueue(SDL_DataQueue *queue)
 void
 SDL_ClearDataQueue(SDL_DataQueue *queue, const size_t slack)
 {
-    const size_t packet_size = queue ? queue->packet_size : 1;
-    const size_t slackpackets = (slack + (packet_size-1)) / packet_size;
+    size_t packet_size, slackpackets;
     SDL_DataQueuePacket *packet;
     SDL_DataQueuePacket *prev = NULL;
     size_t i;
 
     if (!queue) {
         return;
+    } else if (queue->ring) {
+        /* the ring never shrinks, so there's no slack to trim, and it has
+           no packets, so packet_size is zero. */
+        SDL_AtomicSet(&queue->ring_read, SDL_AtomicGet(&queue->ring_write));
+        return;
     }
 
+    packet_size = queue->packet_size;
+    slackpackets = (slack + (packet_size-1)) / packet_size;
     packet = queue->head;
 
     /* merge the available pool and the current queue into one list. */
@@ -183,6 +331,8 @@ SDL_WriteToDataQueue(SDL_DataQueue *queue, const void *_data, const size_t _len)
 
     if (!queue) {
         return SDL_InvalidParamError("queue");
+    } else if (queue->ring) {
+        return WriteToRing(queue, data, len);
     }
 
     orighead = queue->head;
@@ -234,6 +384,8 @@ SDL_PeekIntoDataQueue(SDL_DataQueue *queue, void *_buf, const size_t _len)
 
     if (!queue) {
         return 0;
+    } else if (queue->ring) {
+        return ReadFromRing(queue, buf, len, SDL_FALSE);
     }
 
     for (packet = queue->head; len && packet; packet = packet->next) {
@@ -259,6 +411,8 @@ SDL_ReadFromDataQueue(SDL_DataQueue *queue, void *_buf, const size_t _len)
 
     if (!queue) {
         return 0;
+    } else if (queue->ring) {
+        return ReadFromRing(queue, buf, len, SDL_TRUE);
     }
 
     while ((len > 0) && ((packet = queue->head) != NULL)) {
@@ -292,7 +446,13 @@ SDL_ReadFromDataQueue(SDL_DataQueue *queue, void *_buf, const size_t _len)
 size_t
 SDL_CountDataQueue(SDL_DataQueue *queue)
 {
-    return queue ? queue->queued_bytes : 0;
+    if (!queue) {
+        return 0;
+    } else if (queue->ring) {
+        const Uint32 read = (Uint32) SDL_AtomicGet(&queue->ring_read);
+        return (size_t) ((Uint32) SDL_AtomicGet(&queue->ring_write) - read);
+    }
+    return queue->queued_bytes;
 }
 
 void *
@@ -306,6 +466,9 @@ SDL_ReserveSpaceInDataQueue(SDL_DataQueue *queue, const size_t len)
     } else if (len == 0) {
         SDL_InvalidParamError("len");
         return NULL;
+    } else if (queue->ring) {
+        SDL_SetError("Can't reserve space in a single producer/single consumer data queue");
+        return NULL;
     } else if (len > queue->packet_size) {
         SDL_SetError("len is larger than packet size");
         return NULL;
@@ -34,6 +34,18 @@ size_t SDL_ReadFromDataQueue(SDL_DataQueue *queue, void *buf, const size_t len);
 size_t SDL_PeekIntoDataQueue(SDL_DataQueue *queue, void *buf, const size_t len);
 size_t SDL_CountDataQueue(SDL_DataQueue *queue);
 
+/* this makes a queue for exactly one writer thread and one reader thread, which
+   need no lock between them: the data lives in a preallocated ring buffer of at
+   least (capacity) bytes, so reading and writing never allocate memory. A write
+   that doesn't fit fails without queueing anything. Writes, reads, peeks and
+   counts can run at the same time from the two threads, but clearing the queue
+   or growing it with SDL_GrowDataQueue() needs both of them out of the way.
+   Counting is safe from any thread, even while the queue grows or clears.
+   SDL_ReserveSpaceInDataQueue() isn't supported on these queues. */
+SDL_DataQueue *SDL_NewSPSCDataQueue(const size_t capacity);
+int SDL_GrowDataQueue(SDL_DataQueue *queue, const size_t capacity);
+size_t SDL_CountFreeSpaceInDataQueue(SDL_DataQueue *queue);
+
 /* this sets a section of the data queue aside (possibly allocating memory for it)
    as if it's been written to, but returns a pointer to that space. You may write
    to this space until a read would consume it. Writes (and other calls to this
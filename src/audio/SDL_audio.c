@@ -291,6 +291,12 @@ SDL_AudioFreeDeviceHandle_Default(void *handle)
 {                               /* no-op. */
 }
 
+static int
+SDL_AudioAdvanceDevice_Default(_THIS, int buffers)
+{
+    return SDL_Unsupported();
+}
+
 
 static int
 SDL_AudioOpenDevice_Default(_THIS, void *handle, const char *devname, int iscapture)
@@ -369,6 +375,7 @@ finish_audio_entry_points_init(void)
     FILL_STUB(LockDevice);
     FILL_STUB(UnlockDevice);
     FILL_STUB(FreeDeviceHandle);
+    FILL_STUB(AdvanceDevice);
     FILL_STUB(Deinitialize);
 #undef FILL_STUB
 }
@@ -561,12 +568,154 @@ SDL_RemoveAudioDevice(const int iscapture, void *handle)
 
 
 
+/* device thread statistics... */
+
+static void
+AddAudioTiming(SDL_AudioDevice *device, SDL_AudioTimingStats *timing, Uint64 ticks)
+{
+    const Uint64 us = (ticks * 1000000) / device->stats_frequency;
+    const Uint32 us32 = (us > SDL_MAX_UINT32) ? SDL_MAX_UINT32 : (Uint32) us;
+    int bucket = 0;
+
+    while ((bucket < (SDL_AUDIO_STATS_BUCKETS - 1)) && (us32 >= (32u << bucket))) {
+        bucket++;
+    }
+
+    timing->count++;
+    timing->total_us += us;
+    timing->max_us = SDL_max(timing->max_us, us32);
+    timing->histogram[bucket]++;
+}
+
+static Uint32
+AverageAudioTiming(const SDL_AudioTimingStats *timing)
+{
+    return timing->count ? (Uint32) (timing->total_us / timing->count) : 0;
+}
+
+static void
+LogAudioStats(SDL_AudioDevice *device)
+{
+    SDL_AudioDeviceStats stats;
+
+    SDL_AtomicLock(&device->stats_lock);
+    stats = device->stats;
+    SDL_AtomicUnlock(&device->stats_lock);
+
+    /* like SDL_HINT_EVENT_LOGGING, this goes to SDL_Log so it shows up without
+       changing the log priorities. */
+    SDL_Log("SDL AUDIO DEVICE %u: %u periods, %u underruns, %u overruns, "
+            "callback %u/%u us, conversion %u/%u us, wait %u/%u us (average/max), "
+            "%d bytes in stream (max %d)",
+            (unsigned int) device->id, (unsigned int) stats.periods,
+            (unsigned int) stats.underruns, (unsigned int) stats.overruns,
+            (unsigned int) AverageAudioTiming(&stats.callback), (unsigned int) stats.callback.max_us,
+            (unsigned int) AverageAudioTiming(&stats.conversion), (unsigned int) stats.conversion.max_us,
+            (unsigned int) AverageAudioTiming(&stats.wait), (unsigned int) stats.wait.max_us,
+            stats.stream_queued, stats.stream_queued_max);
+}
+
+static void
+InitAudioStats(SDL_AudioDevice *device)
+{
+    device->stats_frequency = SDL_GetPerformanceFrequency();
+    device->stats_period = (device->spec.samples * device->stats_frequency) / device->spec.freq;
+    if (device->stats_log_interval) {
+        device->stats_next_log = SDL_GetTicks() + device->stats_log_interval;
+    }
+}
+
+static void
+UpdateCallbackStats(SDL_AudioDevice *device, Uint64 ticks)
+{
+    SDL_AtomicLock(&device->stats_lock);
+    AddAudioTiming(device, &device->stats.callback, ticks);
+    SDL_AtomicUnlock(&device->stats_lock);
+}
+
+/* Called by the device thread after every period, with the time spent in
+   each part of it in performance counter ticks. A period is late when the
+   callbacks and conversion took longer than the device takes to play it. */
+static void
+UpdateAudioStats(SDL_AudioDevice *device, Uint64 callback, Uint64 conversion,
+                 Uint64 wait, Uint32 direct_puts, Uint32 copied_puts)
+{
+    const SDL_bool late = ((callback + conversion) > device->stats_period) ? SDL_TRUE : SDL_FALSE;
+    SDL_AudioDeviceStats *stats = &device->stats;
+    const int queued = device->stream ? SDL_AudioStreamAvailable(device->stream) : 0;
+
+    SDL_AtomicLock(&device->stats_lock);
+    stats->periods++;
+    if (device->stream) {
+        AddAudioTiming(device, &stats->conversion, conversion);
+    }
+    AddAudioTiming(device, &stats->wait, wait);
+    if (late) {
+        if (device->iscapture) {
+            stats->overruns++;
+        } else {
+            stats->underruns++;
+        }
+    }
+    stats->stream_queued = queued;
+    stats->stream_queued_max = SDL_max(stats->stream_queued_max, queued);
+    stats->direct_puts += direct_puts;
+    stats->copied_puts += copied_puts;
+    SDL_AtomicUnlock(&device->stats_lock);
+
+    if (device->stats_log_interval && SDL_TICKS_PASSED(SDL_GetTicks(), device->stats_next_log)) {
+        LogAudioStats(device);
+        device->stats_next_log = SDL_GetTicks() + device->stats_log_interval;
+    }
+}
+
+int
+SDL_GetAudioDeviceStats(SDL_AudioDeviceID devid, SDL_AudioDeviceStats *stats)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+
+    if (!device) {
+        return -1;  /* get_audio_device() will have set the error state */
+    } else if (!stats) {
+        return SDL_InvalidParamError("stats");
+    }
+
+    SDL_AtomicLock(&device->stats_lock);
+    *stats = device->stats;
+    SDL_AtomicUnlock(&device->stats_lock);
+
+    return 0;
+}
+
+int
+SDL_ResetAudioDeviceStats(SDL_AudioDeviceID devid)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+
+    if (!device) {
+        return -1;  /* get_audio_device() will have set the error state */
+    }
+
+    SDL_AtomicLock(&device->stats_lock);
+    SDL_zero(device->stats);
+    SDL_AtomicUnlock(&device->stats_lock);
+
+    return 0;
+}
+
+
 /* buffer queueing support... */
 
 static void SDLCALL
 SDL_BufferQueueDrainCallback(void *userdata, Uint8 *stream, int len)
 {
-    /* this function always holds the mixer lock before being called. */
+    /* this function always holds the mixer lock before being called. The
+       queue is a single producer/single consumer ring: SDL_QueueAudio()
+       writes to it without the mixer lock, and this is its only reader, so
+       it never allocates. The app only takes the mixer lock, stopping this
+       reader, when SDL_QueueAudio() grows the ring or SDL_ClearQueuedAudio()
+       empties it; both also hold buffer_queue_lock to stop the writer, since
+       each moves the ring's counters from the app thread. */
     SDL_AudioDevice *device = (SDL_AudioDevice *) userdata;
     size_t dequeued;
 
@@ -579,9 +728,16 @@ SDL_BufferQueueDrainCallback(void *userdata, Uint8 *stream, int len)
     len -= (int) dequeued;
 
     if (len > 0) {  /* fill any remaining space in the stream with silence. */
-        SDL_assert(SDL_CountDataQueue(device->buffer_queue) == 0);
         SDL_memset(stream, device->callbackspec.silence, len);
+
+        /* the app didn't keep up with what was playing. */
+        if (device->stats_queue_playing) {
+            SDL_AtomicLock(&device->stats_lock);
+            device->stats.underruns++;
+            SDL_AtomicUnlock(&device->stats_lock);
+        }
     }
+    device->stats_queue_playing = (len == 0) ? SDL_TRUE : SDL_FALSE;
 }
 
 static void SDLCALL
@@ -615,9 +771,19 @@ SDL_QueueAudio(SDL_AudioDeviceID devid, const void *data, Uint32 len)
     }
 
     if (len > 0) {
-        current_audio.impl.LockDevice(device);
-        rc = SDL_WriteToDataQueue(device->buffer_queue, data, len);
-        current_audio.impl.UnlockDevice(device);
+        SDL_LockMutex(device->buffer_queue_lock);
+        if (SDL_CountFreeSpaceInDataQueue(device->buffer_queue) < len) {
+            /* growing the ring moves the data, so the audio thread has to
+               stay out of it; this is the only time we block it. */
+            const size_t needed = SDL_CountDataQueue(device->buffer_queue) + len;
+            current_audio.impl.LockDevice(device);
+            rc = SDL_GrowDataQueue(device->buffer_queue, needed);
+            current_audio.impl.UnlockDevice(device);
+        }
+        if (rc == 0) {
+            rc = SDL_WriteToDataQueue(device->buffer_queue, data, len);
+        }
+        SDL_UnlockMutex(device->buffer_queue_lock);
     }
 
     return rc;
@@ -652,10 +818,11 @@ SDL_GetQueuedAudioSize(SDL_AudioDeviceID devid)
         return 0;
     }
 
-    /* Nothing to do unless we're set up for queueing. */
-    if (device->callbackspec.callback == SDL_BufferQueueDrainCallback ||
-        device->callbackspec.callback == SDL_BufferQueueFillCallback)
-    {
+    /* Nothing to do unless we're set up for queueing. Playback queues can
+       be counted from any thread without a lock. */
+    if (device->callbackspec.callback == SDL_BufferQueueDrainCallback) {
+        retval = (Uint32) SDL_CountDataQueue(device->buffer_queue);
+    } else if (device->callbackspec.callback == SDL_BufferQueueFillCallback) {
         current_audio.impl.LockDevice(device);
         retval = (Uint32) SDL_CountDataQueue(device->buffer_queue);
         current_audio.impl.UnlockDevice(device);
@@ -673,13 +840,20 @@ SDL_ClearQueuedAudio(SDL_AudioDeviceID devid)
         return;  /* nothing to do. */
     }
 
-    /* Blank out the device and release the mutex. Free it afterwards. */
+    /* Blank out the device and release the mutex. Free it afterwards.
+       Clearing a playback ring needs both its reader and writer stopped. */
+    if (device->buffer_queue_lock) {
+        SDL_LockMutex(device->buffer_queue_lock);
+    }
     current_audio.impl.LockDevice(device);
 
     /* Keep up to two packets in the pool to reduce future malloc pressure. */
     SDL_ClearDataQueue(device->buffer_queue, SDL_AUDIOBUFFERQUEUE_PACKETLEN * 2);
 
     current_audio.impl.UnlockDevice(device);
+    if (device->buffer_queue_lock) {
+        SDL_UnlockMutex(device->buffer_queue_lock);
+    }
 }
 
 
@@ -692,6 +866,7 @@ SDL_RunAudio(void *devicep)
     SDL_AudioCallback callback = device->callbackspec.callback;
     int data_len = 0;
     Uint8 *data;
+    Uint64 start, callback_ticks, wait_ticks;
 
     SDL_assert(!device->iscapture);
 
@@ -709,14 +884,93 @@ SDL_RunAudio(void *devicep)
     /* Perform any thread setup */
     device->threadid = SDL_ThreadID();
     current_audio.impl.ThreadInit(device);
+    InitAudioStats(device);
 
     /* Loop, filling the audio buffers */
     while (!SDL_AtomicGet(&device->shutdown)) {
         current_audio.impl.BeginLoopIteration(device);
         data_len = device->callbackspec.size;
+        callback_ticks = wait_ticks = 0;
+
+        if (device->stream) {
+            /* Pull just enough callbacks through the stream to fill one device
+               buffer. The callback writes straight into the stream's work
+               buffer and the conversion straight into the device buffer,
+               unless the stream needs the input staged. If the device isn't
+               enabled, the output goes to work_buffer and is thrown away, so
+               it can share work_buffer with the callback. */
+            Uint8 *output = SDL_AtomicGet(&device->enabled) ? current_audio.impl.GetDeviceBuf(device) : NULL;
+            const int output_len = device->spec.size;
+            Uint64 conversion_ticks = 0;
+            Uint32 direct_puts = 0, copied_puts = 0;
+            int filled;
+
+            data = output;
+            if (output == NULL) {
+                output = device->work_buffer;
+            }
+
+            /* What the last period left over comes first. */
+            start = SDL_GetPerformanceCounter();
+            filled = SDL_AudioStreamGet(device->stream, output, output_len);
+            conversion_ticks += SDL_GetPerformanceCounter() - start;
+
+            while ((filled >= 0) && (filled < output_len)) {
+                Uint8 *input = SDL_AudioStreamBeginPut(device->stream, data_len);
+                Uint64 now;
+                int got;
+
+                start = SDL_GetPerformanceCounter();
+
+                /* !!! FIXME: this should be LockDevice. */
+                SDL_LockMutex(device->mixer_lock);
+                if (SDL_AtomicGet(&device->paused)) {
+                    SDL_memset(input ? input : device->work_buffer, device->callbackspec.silence, data_len);
+                } else {
+                    callback(udata, input ? input : device->work_buffer, data_len);
+                }
+                SDL_UnlockMutex(device->mixer_lock);
+
+                now = SDL_GetPerformanceCounter();
+                UpdateCallbackStats(device, now - start);
+                callback_ticks += now - start;
+                start = now;
+
+                if (input) {
+                    got = SDL_AudioStreamEndPut(device->stream, data_len, output + filled, output_len - filled);
+                    direct_puts++;
+                } else if (SDL_AudioStreamPut(device->stream, device->work_buffer, data_len) == 0) {
+                    got = SDL_AudioStreamGet(device->stream, output + filled, output_len - filled);
+                    copied_puts++;
+                } else {
+                    got = -1;
+                }
+
+                conversion_ticks += SDL_GetPerformanceCounter() - start;
+
+                /* if this fails...oh well. We'll play silence here. */
+                filled = (got < 0) ? -1 : filled + got;
+            }
+
+            start = SDL_GetPerformanceCounter();
+            if (data == NULL) {  /* device is having issues... */
+                const Uint32 delay = ((device->spec.samples * 1000) / device->spec.freq);
+                SDL_Delay(delay);  /* wait for as long as this buffer would have played. Maybe device recovers later? */
+            } else {
+                if (filled != output_len) {
+                    SDL_memset(data, device->spec.silence, output_len);
+                }
+                current_audio.impl.PlayDevice(device);
+                current_audio.impl.WaitDevice(device);
+            }
+            wait_ticks = SDL_GetPerformanceCounter() - start;
+
+            UpdateAudioStats(device, callback_ticks, conversion_ticks, wait_ticks, direct_puts, copied_puts);
+            continue;
+        }
 
         /* Fill the current buffer with sound */
-        if (!device->stream && SDL_AtomicGet(&device->enabled)) {
+        if (SDL_AtomicGet(&device->enabled)) {
             SDL_assert(data_len == device->spec.size);
             data = current_audio.impl.GetDeviceBuf(device);
         } else {
@@ -724,8 +978,7 @@ SDL_RunAudio(void *devicep)
                work_buffer, so the app's callback will fire with
                a regular frequency, in case they depend on that
                for timing or progress. They can use hotplug
-               now to know if the device failed.
-               Streaming playback uses work_buffer, too. */
+               now to know if the device failed. */
             data = NULL;
         }
 
@@ -733,6 +986,8 @@ SDL_RunAudio(void *devicep)
             data = device->work_buffer;
         }
 
+        start = SDL_GetPerformanceCounter();
+
         /* !!! FIXME: this should be LockDevice. */
         SDL_LockMutex(device->mixer_lock);
         if (SDL_AtomicGet(&device->paused)) {
@@ -742,29 +997,11 @@ SDL_RunAudio(void *devicep)
         }
         SDL_UnlockMutex(device->mixer_lock);
 
-        if (device->stream) {
-            /* Stream available audio to device, converting/resampling. */
-            /* if this fails...oh well. We'll play silence here. */
-            SDL_AudioStreamPut(device->stream, data, data_len);
-
-            while (SDL_AudioStreamAvailable(device->stream) >= ((int) device->spec.size)) {
-                int got;
-                data = SDL_AtomicGet(&device->enabled) ? current_audio.impl.GetDeviceBuf(device) : NULL;
-                got = SDL_AudioStreamGet(device->stream, data ? data : device->work_buffer, device->spec.size);
-                SDL_assert((got < 0) || (got == device->spec.size));
+        callback_ticks = SDL_GetPerformanceCounter() - start;
+        UpdateCallbackStats(device, callback_ticks);
+        start += callback_ticks;
 
-                if (data == NULL) {  /* device is having issues... */
-                    const Uint32 delay = ((device->spec.samples * 1000) / device->spec.freq);
-                    SDL_Delay(delay);  /* wait for as long as this buffer would have played. Maybe device recovers later? */
-                } else {
-                    if (got != device->spec.size) {
-                        SDL_memset(data, device->spec.silence, device->spec.size);
-                    }
-                    current_audio.impl.PlayDevice(device);
-                    current_audio.impl.WaitDevice(device);
-                }
-            }
-        } else if (data == device->work_buffer) {
+        if (data == device->work_buffer) {
             /* nothing to do; pause like we queued a buffer to play. */
             const Uint32 delay = ((device->spec.samples * 1000) / device->spec.freq);
             SDL_Delay(delay);
@@ -773,6 +1010,9 @@ SDL_RunAudio(void *devicep)
             current_audio.impl.PlayDevice(device);
             current_audio.impl.WaitDevice(device);
         }
+        wait_ticks = SDL_GetPerformanceCounter() - start;
+
+        UpdateAudioStats(device, callback_ticks, 0, wait_ticks, 0, 0);
     }
 
     current_audio.impl.PrepareToClose(device);
@@ -797,6 +1037,7 @@ SDL_CaptureAudio(void *devicep)
     Uint8 *data;
     void *udata = device->callbackspec.userdata;
     SDL_AudioCallback callback = device->callbackspec.callback;
+    Uint64 start, now, callback_ticks, conversion_ticks, wait_ticks;
 
     SDL_assert(device->iscapture);
 
@@ -814,6 +1055,7 @@ SDL_CaptureAudio(void *devicep)
     /* Perform any thread setup */
     device->threadid = SDL_ThreadID();
     current_audio.impl.ThreadInit(device);
+    InitAudioStats(device);
 
     /* Loop, filling the audio buffers */
     while (!SDL_AtomicGet(&device->shutdown)) {
@@ -844,6 +1086,7 @@ SDL_CaptureAudio(void *devicep)
            and block when there isn't data so this thread isn't eating CPU.
            But we don't process it further or call the app's callback. */
 
+        start = SDL_GetPerformanceCounter();
         if (!SDL_AtomicGet(&device->enabled)) {
             SDL_Delay(delay);  /* try to keep callback firing at normal pace. */
         } else {
@@ -860,12 +1103,17 @@ SDL_CaptureAudio(void *devicep)
             }
         }
 
+        wait_ticks = SDL_GetPerformanceCounter() - start;
+        callback_ticks = conversion_ticks = 0;
+
         if (still_need > 0) {
             /* Keep any data we already read, silence the rest. */
             SDL_memset(ptr, silence, still_need);
         }
 
         if (device->stream) {
+            start = SDL_GetPerformanceCounter();
+
             /* if this fails...oh well. */
             SDL_AudioStreamPut(device->stream, data, data_len);
 
@@ -876,21 +1124,39 @@ SDL_CaptureAudio(void *devicep)
                     SDL_memset(device->work_buffer, device->spec.silence, device->callbackspec.size);
                 }
 
+                now = SDL_GetPerformanceCounter();
+                conversion_ticks += now - start;
+                start = now;
+
                 /* !!! FIXME: this should be LockDevice. */
                 SDL_LockMutex(device->mixer_lock);
                 if (!SDL_AtomicGet(&device->paused)) {
                     callback(udata, device->work_buffer, device->callbackspec.size);
                 }
                 SDL_UnlockMutex(device->mixer_lock);
+
+                now = SDL_GetPerformanceCounter();
+                UpdateCallbackStats(device, now - start);
+                callback_ticks += now - start;
+                start = now;
             }
+
+            conversion_ticks += SDL_GetPerformanceCounter() - start;
         } else {  /* feeding user callback directly without streaming. */
+            start = SDL_GetPerformanceCounter();
+
             /* !!! FIXME: this should be LockDevice. */
             SDL_LockMutex(device->mixer_lock);
             if (!SDL_AtomicGet(&device->paused)) {
                 callback(udata, data, device->callbackspec.size);
             }
             SDL_UnlockMutex(device->mixer_lock);
+
+            callback_ticks = SDL_GetPerformanceCounter() - start;
+            UpdateCallbackStats(device, callback_ticks);
         }
+
+        UpdateAudioStats(device, callback_ticks, conversion_ticks, wait_ticks, 0, 0);
     }
 
     current_audio.impl.FlushCapture(device);
@@ -901,7 +1167,7 @@ SDL_CaptureAudio(void *devicep)
 }
 
 
-static SDL_AudioFormat
+SDL_AudioFormat
 SDL_ParseAudioFormat(const char *string)
 {
 #define CHECK_FMT_STRING(x) if (SDL_strcmp(string, #x) == 0) return AUDIO_##x
@@ -1150,6 +1416,9 @@ close_audio_device(SDL_AudioDevice * device)
     }
 
     SDL_FreeDataQueue(device->buffer_queue);
+    if (device->buffer_queue_lock != NULL) {
+        SDL_DestroyMutex(device->buffer_queue_lock);
+    }
 
     SDL_free(device);
 }
@@ -1228,6 +1497,7 @@ open_audio_device(const char *devname, int iscapture,
     SDL_AudioSpec _obtained;
     SDL_AudioDevice *device;
     SDL_bool build_stream;
+    const char *stats_hint;
     void *handle = NULL;
     int i = 0;
 
@@ -1342,6 +1612,11 @@ open_audio_device(const char *devname, int iscapture,
     SDL_AtomicSet(&device->paused, 1);
     SDL_AtomicSet(&device->enabled, 1);
 
+    stats_hint = SDL_GetHint(SDL_HINT_AUDIO_DEVICE_STATS_LOG);
+    if (stats_hint && (SDL_atoi(stats_hint) > 0)) {
+        device->stats_log_interval = (Uint32) SDL_atoi(stats_hint);
+    }
+
     /* Create a mutex for locking the sound buffers */
     if (!current_audio.impl.SkipMixerLock) {
         device->mixer_lock = SDL_CreateMutex();
@@ -1414,9 +1689,18 @@ open_audio_device(const char *devname, int iscapture,
     }
 
     if (device->spec.callback == NULL) {  /* use buffer queueing? */
-        /* pool a few packets to start. Enough for two callbacks. */
-        device->buffer_queue = SDL_NewDataQueue(SDL_AUDIOBUFFERQUEUE_PACKETLEN, obtained->size * 2);
-        if (!device->buffer_queue) {
+        /* Enough space for two callbacks to start. Playback uses a ring that
+           the audio thread can drain without locking or allocating; it grows
+           from SDL_QueueAudio() if the app queues more than fits. Capture
+           keeps the packet queue, since the audio thread would otherwise
+           have to drop data when the app falls behind. */
+        if (iscapture) {
+            device->buffer_queue = SDL_NewDataQueue(SDL_AUDIOBUFFERQUEUE_PACKETLEN, obtained->size * 2);
+        } else {
+            device->buffer_queue = SDL_NewSPSCDataQueue(obtained->size * 2);
+            device->buffer_queue_lock = SDL_CreateMutex();
+        }
+        if (!device->buffer_queue || (!iscapture && !device->buffer_queue_lock)) {
             close_audio_device(device);
             SDL_SetError("Couldn't create audio buffer queue");
             return 0;
@@ -1547,6 +1831,20 @@ SDL_PauseAudio(int pause_on)
     SDL_PauseAudioDevice(1, pause_on);
 }
 
+int
+SDL_AdvanceAudioDevice(SDL_AudioDeviceID devid, int buffers)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+
+    if (!device) {
+        return -1;  /* get_audio_device() will have set the error state */
+    } else if (buffers < 0) {
+        return SDL_InvalidParamError("buffers");
+    }
+
+    return current_audio.impl.AdvanceDevice(device, buffers);
+}
+
 
 void
 SDL_LockAudioDevice(SDL_AudioDeviceID devid)
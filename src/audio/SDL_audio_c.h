@@ -55,6 +55,9 @@ extern SDL_AudioFormat SDL_NextAudioFormat(void);
 extern Uint8 SDL_SilenceValueForFormat(const SDL_AudioFormat format);
 extern void SDL_CalculateAudioSpec(SDL_AudioSpec * spec);
 
+/* Parses a format name like "S16LSB" or "F32", 0 if it isn't one */
+extern SDL_AudioFormat SDL_ParseAudioFormat(const char *string);
+
 /* Choose the audio filter functions below */
 extern void SDL_ChooseAudioConverters(void);
 
@@ -72,9 +75,17 @@ extern SDL_AudioFilter SDL_Convert_F32_to_S32;
 
 /* You need to call SDL_PrepareResampleFilter() before using the internal resampler.
    SDL_AudioQuit() calls SDL_FreeResamplerFilter(), you should never call it yourself. */
-extern int SDL_PrepareResampleFilter(void);
+extern int SDL_PrepareResampleFilter(const SDL_AudioResampleQuality quality);
 extern void SDL_FreeResampleFilter(void);
 
+/* Zero-copy puts for the audio thread. SDL_AudioStreamBeginPut() returns where
+   len bytes of input can be written directly, or NULL if they have to go
+   through SDL_AudioStreamPut() instead. SDL_AudioStreamEndPut() converts them,
+   fills dst with up to dstlen bytes of output and queues the rest. It returns
+   the number of bytes written to dst, or -1 on error. */
+extern Uint8 *SDL_AudioStreamBeginPut(SDL_AudioStream *stream, int len);
+extern int SDL_AudioStreamEndPut(SDL_AudioStream *stream, int len, Uint8 *dst, int dstlen);
+
 #endif /* SDL_audio_c_h_ */
 
 /* vi: set ts=4 sw=4 expandtab: */
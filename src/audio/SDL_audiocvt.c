@@ -32,6 +32,8 @@
 #include "SDL_loadso.h"
 #include "../SDL_dataqueue.h"
 #include "SDL_cpuinfo.h"
+#include "../cpuinfo/SDL_cpuinfo_c.h"
+#include "../cpuinfo/SDL_simd.h"
 
 #define DEBUG_AUDIOSTREAM 0
 
@@ -374,12 +376,14 @@ SDL_Convert51To71(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 }
 
 /* SDL's resampler uses a "bandlimited interpolation" algorithm:
-     https://ccrma.stanford.edu/~jos/resample/ */
+     https://ccrma.stanford.edu/~jos/resample/
+   Streams can also use cheaper interpolation, see SDL_AudioResampleQuality. */
 
 #define RESAMPLER_ZERO_CROSSINGS 5
+#define RESAMPLER_HQ_ZERO_CROSSINGS 15
 #define RESAMPLER_BITS_PER_SAMPLE 16
 #define RESAMPLER_SAMPLES_PER_ZERO_CROSSING  (1 << ((RESAMPLER_BITS_PER_SAMPLE / 2) + 1))
-#define RESAMPLER_FILTER_SIZE ((RESAMPLER_SAMPLES_PER_ZERO_CROSSING * RESAMPLER_ZERO_CROSSINGS) + 1)
+#define RESAMPLER_FILTER_SIZE(zero_crossings) ((RESAMPLER_SAMPLES_PER_ZERO_CROSSING * (zero_crossings)) + 1)
 
 /* This is a "modified" bessel function, so you can't use POSIX j0() */
 static double
@@ -426,34 +430,63 @@ kaiser_and_sinc(float *table, float *diffs, const int tablelen, const double bet
 }
 
 
+/* The filter for SDL_AUDIO_RESAMPLE_BANDLIMITED, and the longer one with
+   more stopband attenuation for SDL_AUDIO_RESAMPLE_BANDLIMITED_HQ. */
+typedef struct
+{
+    int zero_crossings;
+    double dB;
+    float *filter;
+    float *difference;
+} SDL_ResamplerFilter;
+
 static SDL_SpinLock ResampleFilterSpinlock = 0;
-static float *ResamplerFilter = NULL;
-static float *ResamplerFilterDifference = NULL;
+static SDL_ResamplerFilter ResamplerFilters[] = {
+    { RESAMPLER_ZERO_CROSSINGS, 80.0, NULL, NULL },
+    { RESAMPLER_HQ_ZERO_CROSSINGS, 120.0, NULL, NULL }
+};
+
+static SDL_ResamplerFilter *
+GetResamplerFilter(const SDL_AudioResampleQuality quality)
+{
+    switch (quality) {
+        case SDL_AUDIO_RESAMPLE_BANDLIMITED: return &ResamplerFilters[0];
+        case SDL_AUDIO_RESAMPLE_BANDLIMITED_HQ: return &ResamplerFilters[1];
+        default: break;
+    }
+
+    return NULL;
+}
 
 int
-SDL_PrepareResampleFilter(void)
+SDL_PrepareResampleFilter(const SDL_AudioResampleQuality quality)
 {
+    SDL_ResamplerFilter *rf = GetResamplerFilter(quality);
+
+    if (!rf) {
+        return 0;  /* this one doesn't need a filter table. */
+    }
+
     SDL_AtomicLock(&ResampleFilterSpinlock);
-    if (!ResamplerFilter) {
+    if (!rf->filter) {
         /* if dB > 50, beta=(0.1102 * (dB - 8.7)), according to Matlab. */
-        const double dB = 80.0;
-        const double beta = 0.1102 * (dB - 8.7);
-        const size_t alloclen = RESAMPLER_FILTER_SIZE * sizeof (float);
+        const double beta = 0.1102 * (rf->dB - 8.7);
+        const size_t alloclen = RESAMPLER_FILTER_SIZE(rf->zero_crossings) * sizeof (float);
 
-        ResamplerFilter = (float *) SDL_malloc(alloclen);
-        if (!ResamplerFilter) {
+        rf->filter = (float *) SDL_malloc(alloclen);
+        if (!rf->filter) {
             SDL_AtomicUnlock(&ResampleFilterSpinlock);
             return SDL_OutOfMemory();
         }
 
-        ResamplerFilterDifference = (float *) SDL_malloc(alloclen);
-        if (!ResamplerFilterDifference) {
-            SDL_free(ResamplerFilter);
-            ResamplerFilter = NULL;
+        rf->difference = (float *) SDL_malloc(alloclen);
+        if (!rf->difference) {
+            SDL_free(rf->filter);
+            rf->filter = NULL;
             SDL_AtomicUnlock(&ResampleFilterSpinlock);
             return SDL_OutOfMemory();
         }
-        kaiser_and_sinc(ResamplerFilter, ResamplerFilterDifference, RESAMPLER_FILTER_SIZE, beta);
+        kaiser_and_sinc(rf->filter, rf->difference, RESAMPLER_FILTER_SIZE(rf->zero_crossings), beta);
     }
     SDL_AtomicUnlock(&ResampleFilterSpinlock);
     return 0;
@@ -462,10 +495,14 @@ SDL_PrepareResampleFilter(void)
 void
 SDL_FreeResampleFilter(void)
 {
-    SDL_free(ResamplerFilter);
-    SDL_free(ResamplerFilterDifference);
-    ResamplerFilter = NULL;
-    ResamplerFilterDifference = NULL;
+    int i;
+
+    for (i = 0; i < SDL_arraysize(ResamplerFilters); i++) {
+        SDL_free(ResamplerFilters[i].filter);
+        SDL_free(ResamplerFilters[i].difference);
+        ResamplerFilters[i].filter = NULL;
+        ResamplerFilters[i].difference = NULL;
+    }
 }
 
 static int
@@ -479,60 +516,425 @@ ResamplerPadding(const int inrate, const int outrate)
     return RESAMPLER_SAMPLES_PER_ZERO_CROSSING;
 }
 
+/* The filters compute each output frame from (taps) input frames: the one at
+   or before it and (taps / 2 - 1) frames before that (the left wing), and
+   the (taps / 2) frames after it (the right wing). Taps the filter doesn't
+   reach get a coefficient of zero. The SIMD code wants multiples of 4. */
+#define RESAMPLER_CUBIC_TAPS 4
+#define RESAMPLER_TAPS ((RESAMPLER_ZERO_CROSSINGS + 1) * 2)
+#define RESAMPLER_MAX_TAPS ((RESAMPLER_HQ_ZERO_CROSSINGS + 1) * 2)
+
+/* The most coefficient sets we precompute, for rate ratios with larger
+   terms they are computed for every output frame instead. */
+#define RESAMPLER_MAX_PHASES 1024
+
+/* Output frame i is at input frame (i * step / phases), so the filter
+   coefficients only depend on (i * step) % phases. */
+typedef struct
+{
+    SDL_AudioResampleQuality quality;
+    int taps;
+    int phases;
+    int step;
+    float *coefs;  /* (taps) coefficients for each phase, or NULL. */
+} SDL_ResamplerTable;
+
+/* Cubic coefficients come from a formula, the filter tables are linearly
+   interpolated between their entries. */
+static void
+ResamplerCoefficients(const SDL_ResamplerTable *table, float *coefs, const int phase)
+{
+    const double t = ((double) phase) / ((double) table->phases);
+    const SDL_ResamplerFilter *rf = GetResamplerFilter(table->quality);
+
+    if (!rf) {
+        /* Catmull-Rom spline through the 4 frames around the output frame. */
+        SDL_assert(table->taps == RESAMPLER_CUBIC_TAPS);
+        coefs[0] = (float) (((-t + 2.0) * t - 1.0) * t * 0.5);
+        coefs[1] = (float) ((((3.0 * t) - 5.0) * t * t + 2.0) * 0.5);
+        coefs[2] = (float) ((((-3.0 * t) + 4.0) * t + 1.0) * t * 0.5);
+        coefs[3] = (float) ((t - 1.0) * t * t * 0.5);
+    } else {
+        const int zero_crossings = rf->zero_crossings;
+        const int filtersize = RESAMPLER_FILTER_SIZE(zero_crossings);
+        const double position1 = t * RESAMPLER_SAMPLES_PER_ZERO_CROSSING;
+        const int filterindex1 = (int) position1;
+        const double interpolation1 = position1 - filterindex1;
+        const double position2 = RESAMPLER_SAMPLES_PER_ZERO_CROSSING - position1;
+        const int filterindex2 = (int) position2;
+        const double interpolation2 = position2 - filterindex2;
+        int j;
+
+        SDL_assert(table->taps == (zero_crossings + 1) * 2);
+        for (j = 0; j <= zero_crossings; j++) {
+            const int index1 = filterindex1 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING);
+            const int index2 = filterindex2 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING);
+            coefs[zero_crossings - j] = (index1 < filtersize) ? (float) (rf->filter[index1] + (interpolation1 * rf->difference[index1])) : 0.0f;
+            coefs[zero_crossings + 1 + j] = (index2 < filtersize) ? (float) (rf->filter[index2] + (interpolation2 * rf->difference[index2])) : 0.0f;
+        }
+    }
+}
+
+/* SDL_PrepareResampleFilter(quality) must have succeeded. The coefficients
+   are only precomputed if there are more output frames than phases,
+   otherwise (or if the table can't be allocated) they are computed as
+   needed. */
+static void
+SDL_InitResamplerTable(SDL_ResamplerTable *table, const SDL_AudioResampleQuality quality,
+                       const int inrate, const int outrate, const int outframes)
+{
+    const SDL_ResamplerFilter *rf = GetResamplerFilter(quality);
+    int a = inrate, b = outrate;
+    int phase;
+
+    while (b) {
+        const int r = a % b;
+        a = b;
+        b = r;
+    }
+
+    table->quality = quality;
+    table->taps = rf ? ((rf->zero_crossings + 1) * 2) : (quality == SDL_AUDIO_RESAMPLE_CUBIC) ? RESAMPLER_CUBIC_TAPS : 0;
+    table->phases = outrate / a;
+    table->step = inrate / a;
+    table->coefs = NULL;
+
+    if (table->taps && (table->phases <= RESAMPLER_MAX_PHASES) && (table->phases < outframes)) {
+        table->coefs = (float *) SDL_malloc(table->phases * table->taps * sizeof (float));
+        if (table->coefs) {
+            for (phase = 0; phase < table->phases; phase++) {
+                ResamplerCoefficients(table, table->coefs + (phase * table->taps), phase);
+            }
+        }
+    }
+}
+
+static void
+SDL_FreeResamplerTable(SDL_ResamplerTable *table)
+{
+    SDL_free(table->coefs);
+    table->coefs = NULL;
+}
+
+/* Computes one output frame from the (taps) input frames at (src). */
+typedef void (*SDL_ResampleFrameFunc)(const int chans, const int taps, const float *coefs, const float *src, float *dst);
+
+static void
+SDL_ResampleFrame_Scalar(const int chans, const int taps, const float *coefs, const float *src, float *dst)
+{
+    int chan, i;
+
+    for (chan = 0; chan < chans; chan++) {
+        float outsample = 0.0f;
+        for (i = 0; i < taps; i++) {
+            outsample += coefs[i] * src[(i * chans) + chan];
+        }
+        dst[chan] = outsample;
+    }
+}
+
+/* The SIMD versions work across taps for mono and stereo, and across
+   channels for everything else. */
+#if SDL_SSE2_INTRINSICS
+static void
+SDL_ResampleFrame_SSE2(const int chans, const int taps, const float *coefs, const float *src, float *dst)
+{
+    int chan = 0;
+    int i;
+
+    if (chans == 1) {
+        __m128 sum = _mm_setzero_ps();
+        for (i = 0; i < taps; i += 4) {
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(coefs + i), _mm_loadu_ps(src + i)));
+        }
+        sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+        _mm_store_ss(dst, _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1))));
+        return;
+    } else if (chans == 2) {
+        __m128 sum = _mm_setzero_ps();
+        for (i = 0; i < taps; i += 4) {
+            const __m128 c = _mm_loadu_ps(coefs + i);
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_unpacklo_ps(c, c), _mm_loadu_ps(src + (i * 2))));
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_unpackhi_ps(c, c), _mm_loadu_ps(src + (i * 2) + 4)));
+        }
+        _mm_storel_pi((__m64 *) dst, _mm_add_ps(sum, _mm_movehl_ps(sum, sum)));
+        return;
+    }
+
+    for (; chan + 4 <= chans; chan += 4) {
+        __m128 sum = _mm_setzero_ps();
+        for (i = 0; i < taps; i++) {
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(coefs[i]), _mm_loadu_ps(src + (i * chans) + chan)));
+        }
+        _mm_storeu_ps(dst + chan, sum);
+    }
+
+    for (; chan < chans; chan++) {
+        float outsample = 0.0f;
+        for (i = 0; i < taps; i++) {
+            outsample += coefs[i] * src[(i * chans) + chan];
+        }
+        dst[chan] = outsample;
+    }
+}
+#endif
+
+#if SDL_AVX2_INTRINSICS
+static void SDL_TARGETING("avx2")
+SDL_ResampleFrame_AVX2(const int chans, const int taps, const float *coefs, const float *src, float *dst)
+{
+    int chan = 0;
+    int i;
+
+    if (chans == 1) {
+        __m256 sum8 = _mm256_setzero_ps();
+        __m128 sum;
+        for (i = 0; i + 8 <= taps; i += 8) {
+            sum8 = _mm256_add_ps(sum8, _mm256_mul_ps(_mm256_loadu_ps(coefs + i), _mm256_loadu_ps(src + i)));
+        }
+        sum = _mm_add_ps(_mm256_castps256_ps128(sum8), _mm256_extractf128_ps(sum8, 1));
+        if (i < taps) {
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(coefs + i), _mm_loadu_ps(src + i)));
+        }
+        sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+        _mm_store_ss(dst, _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1))));
+        return;
+    } else if (chans == 2) {
+        __m256 sum8 = _mm256_setzero_ps();
+        __m128 sum;
+        for (i = 0; i < taps; i += 4) {
+            const __m128 c = _mm_loadu_ps(coefs + i);
+            const __m256 cc = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_unpacklo_ps(c, c)), _mm_unpackhi_ps(c, c), 1);
+            sum8 = _mm256_add_ps(sum8, _mm256_mul_ps(cc, _mm256_loadu_ps(src + (i * 2))));
+        }
+        sum = _mm_add_ps(_mm256_castps256_ps128(sum8), _mm256_extractf128_ps(sum8, 1));
+        _mm_storel_pi((__m64 *) dst, _mm_add_ps(sum, _mm_movehl_ps(sum, sum)));
+        return;
+    }
+
+    for (; chan + 8 <= chans; chan += 8) {
+        __m256 sum = _mm256_setzero_ps();
+        for (i = 0; i < taps; i++) {
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_set1_ps(coefs[i]), _mm256_loadu_ps(src + (i * chans) + chan)));
+        }
+        _mm256_storeu_ps(dst + chan, sum);
+    }
+
+    for (; chan + 4 <= chans; chan += 4) {
+        __m128 sum = _mm_setzero_ps();
+        for (i = 0; i < taps; i++) {
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(coefs[i]), _mm_loadu_ps(src + (i * chans) + chan)));
+        }
+        _mm_storeu_ps(dst + chan, sum);
+    }
+
+    for (; chan < chans; chan++) {
+        float outsample = 0.0f;
+        for (i = 0; i < taps; i++) {
+            outsample += coefs[i] * src[(i * chans) + chan];
+        }
+        dst[chan] = outsample;
+    }
+}
+#endif
+
+#if SDL_NEON_INTRINSICS
+static void
+SDL_ResampleFrame_NEON(const int chans, const int taps, const float *coefs, const float *src, float *dst)
+{
+    int chan = 0;
+    int i;
+
+    if (chans == 1) {
+        float32x4_t sum = vdupq_n_f32(0.0f);
+        float32x2_t sum2;
+        for (i = 0; i < taps; i += 4) {
+            sum = vmlaq_f32(sum, vld1q_f32(coefs + i), vld1q_f32(src + i));
+        }
+        sum2 = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+        dst[0] = vget_lane_f32(vpadd_f32(sum2, sum2), 0);
+        return;
+    } else if (chans == 2) {
+        float32x4_t sum = vdupq_n_f32(0.0f);
+        for (i = 0; i < taps; i += 4) {
+            const float32x4_t c = vld1q_f32(coefs + i);
+            const float32x4x2_t cc = vzipq_f32(c, c);
+            sum = vmlaq_f32(sum, cc.val[0], vld1q_f32(src + (i * 2)));
+            sum = vmlaq_f32(sum, cc.val[1], vld1q_f32(src + (i * 2) + 4));
+        }
+        vst1_f32(dst, vadd_f32(vget_low_f32(sum), vget_high_f32(sum)));
+        return;
+    }
+
+    for (; chan + 4 <= chans; chan += 4) {
+        float32x4_t sum = vdupq_n_f32(0.0f);
+        for (i = 0; i < taps; i++) {
+            sum = vmlaq_n_f32(sum, vld1q_f32(src + (i * chans) + chan), coefs[i]);
+        }
+        vst1q_f32(dst + chan, sum);
+    }
+
+    for (; chan < chans; chan++) {
+        float outsample = 0.0f;
+        for (i = 0; i < taps; i++) {
+            outsample += coefs[i] * src[(i * chans) + chan];
+        }
+        dst[chan] = outsample;
+    }
+}
+#endif
+
+static SDL_ResampleFrameFunc
+ChooseResampleFrameFunc(void)
+{
+#if SDL_AVX2_INTRINSICS
+    if (SDL_CPUFeatureEnabled(CPU_HAS_AVX2)) {
+        return SDL_ResampleFrame_AVX2;
+    }
+#endif
+#if SDL_SSE2_INTRINSICS
+    if (SDL_CPUFeatureEnabled(CPU_HAS_SSE2)) {
+        return SDL_ResampleFrame_SSE2;
+    }
+#endif
+#if SDL_NEON_INTRINSICS
+    if (SDL_CPUFeatureEnabled(CPU_HAS_NEON)) {
+        return SDL_ResampleFrame_NEON;
+    }
+#endif
+    return SDL_ResampleFrame_Scalar;
+}
+
+/* Picks the kernel again only after SDL_HINT_CPU_DISABLE_FEATURES changed.
+   Several audio threads can get here at once, so the kernel and the
+   generation it was picked in are only used under the lock. */
+static SDL_ResampleFrameFunc
+GetResampleFrameFunc(void)
+{
+    static SDL_ResampleFrameFunc resample_frame = SDL_ResampleFrame_Scalar;
+    static int resample_frame_generation = -1;
+    static SDL_SpinLock resample_frame_lock = 0;
+    const int generation = SDL_GetCPUFeaturesGeneration();
+    SDL_ResampleFrameFunc func;
+
+    SDL_AtomicLock(&resample_frame_lock);
+    if (generation != resample_frame_generation) {
+        resample_frame = ChooseResampleFrameFunc();
+        resample_frame_generation = generation;
+    }
+    func = resample_frame;
+    SDL_AtomicUnlock(&resample_frame_lock);
+    return func;
+}
+
 /* lpadding and rpadding are expected to be buffers of (ResamplePadding(inrate, outrate) * chans * sizeof (float)) bytes. */
 static int
 SDL_ResampleAudio(const int chans, const int inrate, const int outrate,
+                        const SDL_ResamplerTable *table,
                         const float *lpadding, const float *rpadding,
                         const float *inbuf, const int inbuflen,
                         float *outbuf, const int outbuflen)
 {
-    const double finrate = (double) inrate;
-    const double outtimeincr = 1.0 / ((float) outrate);
-    const double  ratio = ((float) outrate) / ((float) inrate);
+    const SDL_ResampleFrameFunc resample_frame = GetResampleFrameFunc();
     const int paddinglen = ResamplerPadding(inrate, outrate);
+    const int taps = table->taps;
+    const int phases = table->phases;
+    const int wholestep = table->step / phases;
+    const int fracstep = table->step % phases;
     const int framelen = chans * (int)sizeof (float);
     const int inframes = inbuflen / framelen;
-    const int wantedoutframes = (int) ((inbuflen / framelen) * ratio);  /* outbuflen isn't total to write, it's total available. */
+    const int wantedoutframes = (int) ((((Sint64) inframes) * phases) / table->step);  /* outbuflen isn't total to write, it's total available. */
     const int maxoutframes = outbuflen / framelen;
     const int outframes = SDL_min(wantedoutframes, maxoutframes);
+    float window[RESAMPLER_MAX_TAPS * 8];
+    float coefs[RESAMPLER_MAX_TAPS];
     float *dst = outbuf;
-    double outtime = 0.0;
+    int srcindex = 0;
+    int phase = 0;
     int i, j, chan;
 
-    for (i = 0; i < outframes; i++) {
-        const int srcindex = (int) (outtime * inrate);
-        const double intime = ((double) srcindex) / finrate;
-        const double innexttime = ((double) (srcindex + 1)) / finrate;
-        const double interpolation1 = 1.0 - ((innexttime - outtime) / (innexttime - intime));
-        const int filterindex1 = (int) (interpolation1 * RESAMPLER_SAMPLES_PER_ZERO_CROSSING);
-        const double interpolation2 = 1.0 - interpolation1;
-        const int filterindex2 = (int) (interpolation2 * RESAMPLER_SAMPLES_PER_ZERO_CROSSING);
-
-        for (chan = 0; chan < chans; chan++) {
-            float outsample = 0.0f;
-
-            /* do this twice to calculate the sample, once for the "left wing" and then same for the right. */
-            /* !!! FIXME: do both wings in one loop */
-            for (j = 0; (filterindex1 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)) < RESAMPLER_FILTER_SIZE; j++) {
-                const int srcframe = srcindex - j;
-                /* !!! FIXME: we can bubble this conditional out of here by doing a pre loop. */
-                const float insample = (srcframe < 0) ? lpadding[((paddinglen + srcframe) * chans) + chan] : inbuf[(srcframe * chans) + chan];
-                outsample += (float)(insample * (ResamplerFilter[filterindex1 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)] + (interpolation1 * ResamplerFilterDifference[filterindex1 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)])));
+    SDL_assert(chans <= 8);
+
+    switch (table->quality) {
+    case SDL_AUDIO_RESAMPLE_NEAREST:
+        for (i = 0; i < outframes; i++) {
+            const float *src = inbuf + (srcindex * chans);
+            for (chan = 0; chan < chans; chan++) {
+                dst[chan] = src[chan];
             }
+            dst += chans;
 
-            for (j = 0; (filterindex2 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)) < RESAMPLER_FILTER_SIZE; j++) {
-                const int srcframe = srcindex + 1 + j;
-                /* !!! FIXME: we can bubble this conditional out of here by doing a post loop. */
-                const float insample = (srcframe >= inframes) ? rpadding[((srcframe - inframes) * chans) + chan] : inbuf[(srcframe * chans) + chan];
-                outsample += (float)(insample * (ResamplerFilter[filterindex2 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)] + (interpolation2 * ResamplerFilterDifference[filterindex2 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)])));
+            srcindex += wholestep;
+            phase += fracstep;
+            if (phase >= phases) {
+                phase -= phases;
+                srcindex++;
             }
-            *(dst++) = outsample;
         }
+        break;
+
+    case SDL_AUDIO_RESAMPLE_LINEAR:
+        for (i = 0; i < outframes; i++) {
+            const float *src1 = inbuf + (srcindex * chans);
+            const float *src2 = (srcindex + 1 < inframes) ? (src1 + chans) : rpadding;
+            const float t = ((float) phase) / ((float) phases);
+            for (chan = 0; chan < chans; chan++) {
+                dst[chan] = src1[chan] + (t * (src2[chan] - src1[chan]));
+            }
+            dst += chans;
+
+            srcindex += wholestep;
+            phase += fracstep;
+            if (phase >= phases) {
+                phase -= phases;
+                srcindex++;
+            }
+        }
+        break;
+
+    default:
+        for (i = 0; i < outframes; i++) {
+            const int firstframe = srcindex - ((taps / 2) - 1);
+            const float *src;
+
+            if ((firstframe >= 0) && ((firstframe + taps) <= inframes)) {
+                src = inbuf + (firstframe * chans);
+            } else {
+                /* near the ends of the buffer, gather the frames from the padding first. */
+                for (j = 0; j < taps; j++) {
+                    const int srcframe = firstframe + j;
+                    const float *frame;
+                    if (srcframe < 0) {
+                        frame = lpadding + ((paddinglen + srcframe) * chans);
+                    } else if (srcframe >= inframes) {
+                        frame = rpadding + ((srcframe - inframes) * chans);
+                    } else {
+                        frame = inbuf + (srcframe * chans);
+                    }
+                    SDL_memcpy(window + (j * chans), frame, framelen);
+                }
+                src = window;
+            }
+
+            if (table->coefs) {
+                resample_frame(chans, taps, table->coefs + (phase * taps), src, dst);
+            } else {
+                ResamplerCoefficients(table, coefs, phase);
+                resample_frame(chans, taps, coefs, src, dst);
+            }
+            dst += chans;
 
-        outtime += outtimeincr;
+            srcindex += wholestep;
+            phase += fracstep;
+            if (phase >= phases) {
+                phase -= phases;
+                srcindex++;
+            }
+        }
+        break;
     }
 
-    return outframes * chans * sizeof (float);
+    return outframes * framelen;
 }
 
 int
@@ -718,6 +1120,7 @@ SDL_ResampleCVT(SDL_AudioCVT *cvt, const int chans, const SDL_AudioFormat format
     float *dst = (float *) (cvt->buf + srclen);
     const int dstlen = (cvt->len * cvt->len_mult) - srclen;
     const int requestedpadding = ResamplerPadding(inrate, outrate);
+    SDL_ResamplerTable table;
     int paddingsamples;
     float *padding;
 
@@ -735,8 +1138,11 @@ SDL_ResampleCVT(SDL_AudioCVT *cvt, const int chans, const SDL_AudioFormat format
         return;
     }
 
-    cvt->len_cvt = SDL_ResampleAudio(chans, inrate, outrate, padding, padding, src, srclen, dst, dstlen);
+    SDL_InitResamplerTable(&table, SDL_AUDIO_RESAMPLE_BANDLIMITED, inrate, outrate, (int) ((((Sint64) srclen) * outrate) / (((Sint64) inrate) * chans * sizeof (float))));
 
+    cvt->len_cvt = SDL_ResampleAudio(chans, inrate, outrate, &table, padding, padding, src, srclen, dst, dstlen);
+
+    SDL_FreeResamplerTable(&table);
     SDL_free(padding);
 
     SDL_memmove(cvt->buf, dst, cvt->len_cvt);  /* !!! FIXME: remove this if we can get the resampler to work in-place again. */
@@ -792,7 +1198,7 @@ SDL_BuildAudioResampleCVT(SDL_AudioCVT * cvt, const int dst_channels,
         return SDL_SetError("No conversion available for these rates");
     }
 
-    if (SDL_PrepareResampleFilter() < 0) {
+    if (SDL_PrepareResampleFilter(SDL_AUDIO_RESAMPLE_BANDLIMITED) < 0) {
         return -1;
     }
 
@@ -1047,7 +1453,7 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
             SDL_AudioFilter filter = NULL;
 
             #if HAVE_SSE3_INTRINSICS
-            if (SDL_HasSSE3()) {
+            if (SDL_CPUFeatureEnabled(CPU_HAS_SSE3)) {
                 filter = SDL_ConvertStereoToMono_SSE3;
             }
             #endif
@@ -1114,6 +1520,7 @@ struct _SDL_AudioStream
     int resampler_padding_samples;
     float *resampler_padding;
     void *resampler_state;
+    SDL_ResamplerTable resampler_table;
     SDL_ResampleAudioStreamFunc resampler_func;
     SDL_ResetAudioStreamResamplerFunc reset_resampler_func;
     SDL_CleanupAudioStreamResamplerFunc cleanup_resampler_func;
@@ -1243,7 +1650,7 @@ SDL_ResampleAudioStream(SDL_AudioStream *stream, const void *_inbuf, const int i
 
     SDL_assert(inbuf != ((const float *) outbuf));  /* SDL_AudioStreamPut() shouldn't allow in-place resamples. */
 
-    retval = SDL_ResampleAudio(chans, inrate, outrate, lpadding, rpadding, inbuf, inbuflen, outbuf, outbuflen);
+    retval = SDL_ResampleAudio(chans, inrate, outrate, &stream->resampler_table, lpadding, rpadding, inbuf, inbuflen, outbuf, outbuflen);
 
     /* update our left padding with end of current input, for next run. */
     SDL_memcpy((lpadding + paddingsamples) - (cpy / sizeof (float)), inbufend - cpy, cpy);
@@ -1261,9 +1668,53 @@ SDL_ResetAudioStreamResampler(SDL_AudioStream *stream)
 static void
 SDL_CleanupAudioStreamResampler(SDL_AudioStream *stream)
 {
+    SDL_FreeResamplerTable(&stream->resampler_table);
     SDL_free(stream->resampler_state);
 }
 
+/* SDL_PrepareResampleFilter(quality) must have succeeded. This replaces
+   libsamplerate, if the stream was using it. */
+static int
+SetupInternalResampling(SDL_AudioStream *stream, const SDL_AudioResampleQuality quality)
+{
+    float *lpadding = (float *) SDL_calloc(stream->resampler_padding_samples, sizeof (float));
+    if (!lpadding) {
+        return SDL_OutOfMemory();
+    }
+
+    if (stream->cleanup_resampler_func) {
+        stream->cleanup_resampler_func(stream);
+    }
+
+    SDL_InitResamplerTable(&stream->resampler_table, quality, stream->src_rate, stream->dst_rate, SDL_MAX_SINT32);
+
+    stream->resampler_state = lpadding;
+    stream->resampler_func = SDL_ResampleAudioStream;
+    stream->reset_resampler_func = SDL_ResetAudioStreamResampler;
+    stream->cleanup_resampler_func = SDL_CleanupAudioStreamResampler;
+    return 0;
+}
+
+static SDL_AudioResampleQuality
+GetDefaultResampleQuality(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_AUDIO_RESAMPLE_QUALITY);
+
+    if (hint) {
+        if (*hint == '0' || SDL_strcasecmp(hint, "nearest") == 0) {
+            return SDL_AUDIO_RESAMPLE_NEAREST;
+        } else if (*hint == '1' || SDL_strcasecmp(hint, "linear") == 0) {
+            return SDL_AUDIO_RESAMPLE_LINEAR;
+        } else if (*hint == '2' || SDL_strcasecmp(hint, "cubic") == 0) {
+            return SDL_AUDIO_RESAMPLE_CUBIC;
+        } else if (*hint == '4' || SDL_strcasecmp(hint, "bandlimited_hq") == 0) {
+            return SDL_AUDIO_RESAMPLE_BANDLIMITED_HQ;
+        }
+    }
+
+    return SDL_AUDIO_RESAMPLE_BANDLIMITED;
+}
+
 SDL_AudioStream *
 SDL_NewAudioStream(const SDL_AudioFormat src_format,
                    const Uint8 src_channels,
@@ -1273,6 +1724,7 @@ SDL_NewAudioStream(const SDL_AudioFormat src_format,
                    const int dst_rate)
 {
     const int packetlen = 4096;  /* !!! FIXME: good enough for now. */
+    const SDL_AudioResampleQuality quality = GetDefaultResampleQuality();
     Uint8 pre_resample_channels;
     SDL_AudioStream *retval;
 
@@ -1334,27 +1786,16 @@ SDL_NewAudioStream(const SDL_AudioFormat src_format,
         }
 
 #ifdef HAVE_LIBSAMPLERATE_H
-        SetupLibSampleRateResampling(retval);
+        if (quality == SDL_AUDIO_RESAMPLE_BANDLIMITED) {
+            SetupLibSampleRateResampling(retval);
+        }
 #endif
 
         if (!retval->resampler_func) {
-            retval->resampler_state = SDL_calloc(retval->resampler_padding_samples, sizeof (float));
-            if (!retval->resampler_state) {
+            if ((SDL_PrepareResampleFilter(quality) < 0) || (SetupInternalResampling(retval, quality) < 0)) {
                 SDL_FreeAudioStream(retval);
-                SDL_OutOfMemory();
                 return NULL;
             }
-
-            if (SDL_PrepareResampleFilter() < 0) {
-                SDL_free(retval->resampler_state);
-                retval->resampler_state = NULL;
-                SDL_FreeAudioStream(retval);
-                return NULL;
-            }
-
-            retval->resampler_func = SDL_ResampleAudioStream;
-            retval->reset_resampler_func = SDL_ResetAudioStreamResampler;
-            retval->cleanup_resampler_func = SDL_CleanupAudioStreamResampler;
         }
 
         /* Convert us to the final format after resampling. */
@@ -1373,14 +1814,27 @@ SDL_NewAudioStream(const SDL_AudioFormat src_format,
     return retval;
 }
 
+/* Space the resampler needs for the output of len bytes of input. */
 static int
-SDL_AudioStreamPutInternal(SDL_AudioStream *stream, const void *buf, int len, int *maxputbytes)
+GetResampleBufferLength(SDL_AudioStream *stream, int len)
+{
+    const int framesize = stream->pre_resample_channels * sizeof (float);
+    int frames = len;
+    if (stream->cvt_before_resampling.needed) {
+        frames *= stream->cvt_before_resampling.len_mult;
+    }
+    frames /= framesize;
+    return ((int) SDL_ceil(frames * stream->rate_incr)) * framesize;
+}
+
+/* Makes sure the work buffer can hold len bytes of input and everything they
+   get converted to, and returns where the input goes. */
+static Uint8 *
+SDL_AudioStreamPrepareInput(SDL_AudioStream *stream, int len)
 {
     int buflen = len;
     int workbuflen;
     Uint8 *workbuf;
-    Uint8 *resamplebuf = NULL;
-    int resamplebuflen = 0;
     int neededpaddingbytes;
     int paddingbytes;
 
@@ -1395,7 +1849,6 @@ SDL_AudioStreamPutInternal(SDL_AudioStream *stream, const void *buf, int len, in
     /* no padding prepended on first run. */
     neededpaddingbytes = stream->resampler_padding_samples * sizeof (float);
     paddingbytes = stream->first_run ? 0 : neededpaddingbytes;
-    stream->first_run = SDL_FALSE;
 
     /* Make sure the work buffer can hold all the data we need at once... */
     workbuflen = buflen;
@@ -1405,9 +1858,7 @@ SDL_AudioStreamPutInternal(SDL_AudioStream *stream, const void *buf, int len, in
 
     if (stream->dst_rate != stream->src_rate) {
         /* resamples can't happen in place, so make space for second buf. */
-        const int framesize = stream->pre_resample_channels * sizeof (float);
-        const int frames = workbuflen / framesize;
-        resamplebuflen = ((int) SDL_ceil(frames * stream->rate_incr)) * framesize;
+        const int resamplebuflen = GetResampleBufferLength(stream, len);
         #if DEBUG_AUDIOSTREAM
         printf("AUDIOSTREAM: will resample %d bytes to %d (ratio=%.6f)\n", workbuflen, resamplebuflen, stream->rate_incr);
         #endif
@@ -1427,12 +1878,36 @@ SDL_AudioStreamPutInternal(SDL_AudioStream *stream, const void *buf, int len, in
 
     workbuf = EnsureStreamBufferSize(stream, workbuflen);
     if (!workbuf) {
-        return -1;  /* probably out of memory. */
+        return NULL;  /* probably out of memory. */
     }
 
-    resamplebuf = workbuf;  /* default if not resampling. */
+    return workbuf + paddingbytes;
+}
+
+/* Converts the len bytes of input that were written to where
+   SDL_AudioStreamPrepareInput() said. Up to dstlen bytes of the output go
+   to dst, the rest is queued. Returns the number of bytes written to dst. */
+static int
+SDL_AudioStreamConvertInput(SDL_AudioStream *stream, int len, int *maxputbytes, Uint8 *dst, int dstlen)
+{
+    int buflen = len;
+    Uint8 *workbuf = EnsureStreamBufferSize(stream, 0);  /* SDL_AudioStreamPrepareInput() made it big enough. */
+    Uint8 *resamplebuf = NULL;
+    int resamplebuflen = 0;
+    int neededpaddingbytes;
+    int paddingbytes;
+    int dstbytes = 0;
+
+    /* no padding prepended on first run. */
+    neededpaddingbytes = stream->resampler_padding_samples * sizeof (float);
+    paddingbytes = stream->first_run ? 0 : neededpaddingbytes;
+    stream->first_run = SDL_FALSE;
 
-    SDL_memcpy(workbuf + paddingbytes, buf, buflen);
+    if (stream->dst_rate != stream->src_rate) {
+        resamplebuflen = GetResampleBufferLength(stream, len);
+    }
+
+    resamplebuf = workbuf;  /* default if not resampling. */
 
     if (stream->cvt_before_resampling.needed) {
         stream->cvt_before_resampling.buf = workbuf + paddingbytes;
@@ -1498,8 +1973,61 @@ SDL_AudioStreamPutInternal(SDL_AudioStream *stream, const void *buf, int len, in
         *maxputbytes -= buflen;
     }
 
+    /* Output only skips the queue if nothing is waiting in it, to keep it in order. */
+    if (dst && (SDL_CountDataQueue(stream->queue) == 0)) {
+        dstbytes = SDL_min(buflen, dstlen);
+        SDL_memcpy(dst, resamplebuf, dstbytes);
+    }
+
     /* resamplebuf holds the final output, even if we didn't resample. */
-    return buflen ? SDL_WriteToDataQueue(stream->queue, resamplebuf, buflen) : 0;
+    if ((buflen > dstbytes) && (SDL_WriteToDataQueue(stream->queue, resamplebuf + dstbytes, buflen - dstbytes) < 0)) {
+        return -1;
+    }
+
+    if (dst && (dstbytes < dstlen)) {
+        dstbytes += (int) SDL_ReadFromDataQueue(stream->queue, dst + dstbytes, dstlen - dstbytes);
+    }
+
+    return dstbytes;
+}
+
+static int
+SDL_AudioStreamPutInternal(SDL_AudioStream *stream, const void *buf, int len, int *maxputbytes)
+{
+    Uint8 *input = SDL_AudioStreamPrepareInput(stream, len);
+    if (!input) {
+        return -1;
+    }
+    SDL_memcpy(input, buf, len);
+    return SDL_AudioStreamConvertInput(stream, len, maxputbytes, NULL, 0);
+}
+
+Uint8 *
+SDL_AudioStreamBeginPut(SDL_AudioStream *stream, int len)
+{
+    SDL_assert(stream != NULL);
+
+    /* Partial input, or input that has to wait in the staging buffer for
+       more, needs SDL_AudioStreamPut(). So does input that isn't converted,
+       there's no work buffer to write it to then. */
+    if ((len <= 0) || ((len % stream->src_sample_frame_size) != 0) ||
+        stream->staging_buffer_filled || (len < stream->staging_buffer_size)) {
+        return NULL;
+    } else if (!stream->cvt_before_resampling.needed &&
+               (stream->dst_rate == stream->src_rate) &&
+               !stream->cvt_after_resampling.needed) {
+        return NULL;
+    }
+
+    return SDL_AudioStreamPrepareInput(stream, len);
+}
+
+int
+SDL_AudioStreamEndPut(SDL_AudioStream *stream, int len, Uint8 *dst, int dstlen)
+{
+    SDL_assert(stream != NULL);
+    SDL_assert((dstlen % stream->dst_sample_frame_size) == 0);
+    return SDL_AudioStreamConvertInput(stream, len, NULL, dst, dstlen);
 }
 
 int
@@ -1662,6 +2190,31 @@ SDL_AudioStreamClear(SDL_AudioStream *stream)
     }
 }
 
+int
+SDL_AudioStreamSetResampleQuality(SDL_AudioStream *stream, SDL_AudioResampleQuality quality)
+{
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if ((quality < SDL_AUDIO_RESAMPLE_NEAREST) || (quality > SDL_AUDIO_RESAMPLE_BANDLIMITED_HQ)) {
+        return SDL_InvalidParamError("quality");
+    } else if (stream->src_rate == stream->dst_rate) {
+        return 0;  /* not resampling, nothing to do. */
+    } else if (SDL_PrepareResampleFilter(quality) < 0) {
+        return -1;
+    }
+
+    if (stream->resampler_func == SDL_ResampleAudioStream) {
+        /* the padding is the same for every quality, only the table changes. */
+        SDL_FreeResamplerTable(&stream->resampler_table);
+        SDL_InitResamplerTable(&stream->resampler_table, quality, stream->src_rate, stream->dst_rate, SDL_MAX_SINT32);
+        return 0;
+    } else if (quality == SDL_AUDIO_RESAMPLE_BANDLIMITED) {
+        return 0;  /* libsamplerate is already standing in for this one. */
+    }
+
+    return SetupInternalResampling(stream, quality);
+}
+
 /* dispose of a stream */
 void
 SDL_FreeAudioStream(SDL_AudioStream *stream)
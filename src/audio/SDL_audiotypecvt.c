@@ -23,6 +23,7 @@
 #include "SDL_audio.h"
 #include "SDL_audio_c.h"
 #include "SDL_cpuinfo.h"
+#include "../cpuinfo/SDL_cpuinfo_c.h"
 
 #ifdef __ARM_NEON
 #define HAVE_NEON_INTRINSICS 1
@@ -1404,14 +1405,14 @@ void SDL_ChooseAudioConverters(void)
         converters_chosen = SDL_TRUE
 
 #if HAVE_SSE2_INTRINSICS
-    if (SDL_HasSSE2()) {
+    if (SDL_CPUFeatureEnabled(CPU_HAS_SSE2)) {
         SET_CONVERTER_FUNCS(SSE2);
         return;
     }
 #endif
 
 #if HAVE_NEON_INTRINSICS
-    if (SDL_HasNEON()) {
+    if (SDL_CPUFeatureEnabled(CPU_HAS_NEON)) {
         SET_CONVERTER_FUNCS(NEON);
         return;
     }
@@ -22,10 +22,14 @@
 
 /* This provides the default mixing callback for the SDL audio routines */
 
+#include "SDL_atomic.h"
 #include "SDL_cpuinfo.h"
 #include "SDL_timer.h"
 #include "SDL_audio.h"
 #include "SDL_sysaudio.h"
+#include "SDL_audio_c.h"
+#include "../cpuinfo/SDL_cpuinfo_c.h"
+#include "../cpuinfo/SDL_simd.h"
 
 /* This table is used to add two sound values together and pin
  * the value to avoid overflow.  (used with permission from ARDI)
@@ -85,6 +89,501 @@ static const Uint8 mix8[] = {
 #define ADJUST_VOLUME(s, v) (s = (s*v)/SDL_MIX_MAXVOLUME)
 #define ADJUST_VOLUME_U8(s, v)  (s = (((s-128)*v)/SDL_MIX_MAXVOLUME)+128)
 
+/* The SIMD versions mix as many whole vectors as they can and return how
+   many bytes that was, leaving the rest to the scalar code. They match the
+   scalar code bit for bit (mix8[] is clamp(x - 128, 0, 254)), but only
+   for volumes up to SDL_MIX_MAXVOLUME. */
+typedef Uint32 (*SDL_MixAudioFunc)(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format, Uint32 len, int volume);
+
+static SDL_bool
+MixNeedsSwap(const SDL_AudioFormat format)
+{
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+    return SDL_AUDIO_ISBIGENDIAN(format) ? SDL_TRUE : SDL_FALSE;
+#else
+    return SDL_AUDIO_ISBIGENDIAN(format) ? SDL_FALSE : SDL_TRUE;
+#endif
+}
+
+#if SDL_SSE2_INTRINSICS
+static __m128i
+MixSwap16_SSE2(const __m128i x)
+{
+    return _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+}
+
+static __m128i
+MixSwap32_SSE2(const __m128i x)
+{
+    return MixSwap16_SSE2(_mm_shufflehi_epi16(_mm_shufflelo_epi16(x, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1)));
+}
+
+/* ADJUST_VOLUME for unsigned 16-bit lanes: the low 16 bits of the 32-bit product shifted right by 7. */
+static __m128i
+MixScaleU16_SSE2(const __m128i s, const __m128i volume)
+{
+    return _mm_or_si128(_mm_srli_epi16(_mm_mullo_epi16(s, volume), 7), _mm_slli_epi16(_mm_mulhi_epu16(s, volume), 9));
+}
+
+/* ADJUST_VOLUME for signed 16-bit lanes, which rounds toward zero, so scale the magnitude. */
+static __m128i
+MixScaleS16_SSE2(const __m128i s, const __m128i volume)
+{
+    const __m128i sign = _mm_srai_epi16(s, 15);
+    const __m128i scaled = MixScaleU16_SSE2(_mm_sub_epi16(_mm_xor_si128(s, sign), sign), volume);
+    return _mm_sub_epi16(_mm_xor_si128(scaled, sign), sign);
+}
+
+/* Mixes the low two lanes of S32 samples through doubles, which hold all the intermediate values exactly. */
+static __m128i
+MixS32Half_SSE2(const __m128i s, const __m128i d, const __m128d volume)
+{
+    const __m128d minval = _mm_set1_pd(-2147483648.0);
+    const __m128d maxval = _mm_set1_pd(2147483647.0);
+    const __m128d src1 = _mm_cvtepi32_pd(_mm_cvttpd_epi32(_mm_mul_pd(_mm_cvtepi32_pd(s), volume)));
+    const __m128d sum = _mm_add_pd(src1, _mm_cvtepi32_pd(d));
+    return _mm_cvttpd_epi32(_mm_min_pd(_mm_max_pd(sum, minval), maxval));
+}
+
+static Uint32
+SDL_MixAudio_SSE2(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format, Uint32 len, int volume)
+{
+    const SDL_bool swap = MixNeedsSwap(format);
+    const __m128i zero = _mm_setzero_si128();
+    Uint32 i = 0;
+
+    switch (format) {
+    case AUDIO_U8:
+        {
+            const __m128i vol = _mm_set1_epi16(volume);
+            const __m128i bias = _mm_set1_epi16(128);
+            const __m128i maxval = _mm_set1_epi16(254);
+            for (; i + 16 <= len; i += 16) {
+                const __m128i s = _mm_loadu_si128((const __m128i *) (src + i));
+                const __m128i d = _mm_loadu_si128((const __m128i *) (dst + i));
+                __m128i lo = MixScaleS16_SSE2(_mm_sub_epi16(_mm_unpacklo_epi8(s, zero), bias), vol);
+                __m128i hi = MixScaleS16_SSE2(_mm_sub_epi16(_mm_unpackhi_epi8(s, zero), bias), vol);
+                lo = _mm_min_epi16(_mm_add_epi16(_mm_unpacklo_epi8(d, zero), lo), maxval);
+                hi = _mm_min_epi16(_mm_add_epi16(_mm_unpackhi_epi8(d, zero), hi), maxval);
+                _mm_storeu_si128((__m128i *) (dst + i), _mm_packus_epi16(lo, hi));
+            }
+        }
+        break;
+
+    case AUDIO_S8:
+        {
+            const __m128i vol = _mm_set1_epi16(volume);
+            for (; i + 16 <= len; i += 16) {
+                const __m128i s = _mm_loadu_si128((const __m128i *) (src + i));
+                const __m128i d = _mm_loadu_si128((const __m128i *) (dst + i));
+                const __m128i lo = MixScaleS16_SSE2(_mm_srai_epi16(_mm_unpacklo_epi8(s, s), 8), vol);
+                const __m128i hi = MixScaleS16_SSE2(_mm_srai_epi16(_mm_unpackhi_epi8(s, s), 8), vol);
+                _mm_storeu_si128((__m128i *) (dst + i), _mm_adds_epi8(d, _mm_packs_epi16(lo, hi)));
+            }
+        }
+        break;
+
+    case AUDIO_S16LSB:
+    case AUDIO_S16MSB:
+    case AUDIO_U16LSB:
+    case AUDIO_U16MSB:
+        {
+            const __m128i vol = _mm_set1_epi16(volume);
+            const SDL_bool issigned = SDL_AUDIO_ISSIGNED(format) ? SDL_TRUE : SDL_FALSE;
+            for (; i + 16 <= len; i += 16) {
+                __m128i s = _mm_loadu_si128((const __m128i *) (src + i));
+                __m128i d = _mm_loadu_si128((const __m128i *) (dst + i));
+                if (swap) {
+                    s = MixSwap16_SSE2(s);
+                    d = MixSwap16_SSE2(d);
+                }
+                if (issigned) {
+                    d = _mm_adds_epi16(d, MixScaleS16_SSE2(s, vol));
+                } else {
+                    d = _mm_adds_epu16(d, MixScaleU16_SSE2(s, vol));
+                }
+                if (swap) {
+                    d = MixSwap16_SSE2(d);
+                }
+                _mm_storeu_si128((__m128i *) (dst + i), d);
+            }
+        }
+        break;
+
+    case AUDIO_S32LSB:
+    case AUDIO_S32MSB:
+        {
+            const __m128d vol = _mm_set1_pd(volume / (double) SDL_MIX_MAXVOLUME);
+            for (; i + 16 <= len; i += 16) {
+                __m128i s = _mm_loadu_si128((const __m128i *) (src + i));
+                __m128i d = _mm_loadu_si128((const __m128i *) (dst + i));
+                if (swap) {
+                    s = MixSwap32_SSE2(s);
+                    d = MixSwap32_SSE2(d);
+                }
+                d = _mm_unpacklo_epi64(MixS32Half_SSE2(s, d, vol),
+                                       MixS32Half_SSE2(_mm_shuffle_epi32(s, _MM_SHUFFLE(1, 0, 3, 2)),
+                                                       _mm_shuffle_epi32(d, _MM_SHUFFLE(1, 0, 3, 2)), vol));
+                if (swap) {
+                    d = MixSwap32_SSE2(d);
+                }
+                _mm_storeu_si128((__m128i *) (dst + i), d);
+            }
+        }
+        break;
+
+    case AUDIO_F32LSB:
+    case AUDIO_F32MSB:
+        {
+            const __m128 fvolume = _mm_set1_ps((float) volume);
+            const __m128 fmaxvolume = _mm_set1_ps(1.0f / ((float) SDL_MIX_MAXVOLUME));
+            const __m128 maxval = _mm_set1_ps(3.402823466e+38F);
+            const __m128 minval = _mm_set1_ps(-3.402823466e+38F);
+            for (; i + 16 <= len; i += 16) {
+                __m128i s = _mm_loadu_si128((const __m128i *) (src + i));
+                __m128i d = _mm_loadu_si128((const __m128i *) (dst + i));
+                __m128 sum;
+                if (swap) {
+                    s = MixSwap32_SSE2(s);
+                    d = MixSwap32_SSE2(d);
+                }
+                sum = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(_mm_castsi128_ps(s), fvolume), fmaxvolume), _mm_castsi128_ps(d));
+                /* the limits go first, so NaNs pass through like in the scalar code. */
+                d = _mm_castps_si128(_mm_max_ps(minval, _mm_min_ps(maxval, sum)));
+                if (swap) {
+                    d = MixSwap32_SSE2(d);
+                }
+                _mm_storeu_si128((__m128i *) (dst + i), d);
+            }
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    return i;
+}
+#endif
+
+#if SDL_AVX2_INTRINSICS
+static __m256i SDL_TARGETING("avx2")
+MixSwap16_AVX2(const __m256i x)
+{
+    return _mm256_or_si256(_mm256_slli_epi16(x, 8), _mm256_srli_epi16(x, 8));
+}
+
+static __m256i SDL_TARGETING("avx2")
+MixSwap32_AVX2(const __m256i x)
+{
+    const __m256i shuffle = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                             3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    return _mm256_shuffle_epi8(x, shuffle);
+}
+
+static __m256i SDL_TARGETING("avx2")
+MixScaleU16_AVX2(const __m256i s, const __m256i volume)
+{
+    return _mm256_or_si256(_mm256_srli_epi16(_mm256_mullo_epi16(s, volume), 7), _mm256_slli_epi16(_mm256_mulhi_epu16(s, volume), 9));
+}
+
+static __m256i SDL_TARGETING("avx2")
+MixScaleS16_AVX2(const __m256i s, const __m256i volume)
+{
+    const __m256i sign = _mm256_srai_epi16(s, 15);
+    const __m256i scaled = MixScaleU16_AVX2(_mm256_sub_epi16(_mm256_xor_si256(s, sign), sign), volume);
+    return _mm256_sub_epi16(_mm256_xor_si256(scaled, sign), sign);
+}
+
+static __m128i SDL_TARGETING("avx2")
+MixS32Half_AVX2(const __m128i s, const __m128i d, const __m256d volume)
+{
+    const __m256d minval = _mm256_set1_pd(-2147483648.0);
+    const __m256d maxval = _mm256_set1_pd(2147483647.0);
+    const __m256d src1 = _mm256_cvtepi32_pd(_mm256_cvttpd_epi32(_mm256_mul_pd(_mm256_cvtepi32_pd(s), volume)));
+    const __m256d sum = _mm256_add_pd(src1, _mm256_cvtepi32_pd(d));
+    return _mm256_cvttpd_epi32(_mm256_min_pd(_mm256_max_pd(sum, minval), maxval));
+}
+
+static Uint32 SDL_TARGETING("avx2")
+SDL_MixAudio_AVX2(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format, Uint32 len, int volume)
+{
+    const SDL_bool swap = MixNeedsSwap(format);
+    const __m256i zero = _mm256_setzero_si256();
+    Uint32 i = 0;
+
+    /* the unpacks and packs work within 128-bit lanes, so they keep the sample order. */
+    switch (format) {
+    case AUDIO_U8:
+        {
+            const __m256i vol = _mm256_set1_epi16(volume);
+            const __m256i bias = _mm256_set1_epi16(128);
+            const __m256i maxval = _mm256_set1_epi16(254);
+            for (; i + 32 <= len; i += 32) {
+                const __m256i s = _mm256_loadu_si256((const __m256i *) (src + i));
+                const __m256i d = _mm256_loadu_si256((const __m256i *) (dst + i));
+                __m256i lo = MixScaleS16_AVX2(_mm256_sub_epi16(_mm256_unpacklo_epi8(s, zero), bias), vol);
+                __m256i hi = MixScaleS16_AVX2(_mm256_sub_epi16(_mm256_unpackhi_epi8(s, zero), bias), vol);
+                lo = _mm256_min_epi16(_mm256_add_epi16(_mm256_unpacklo_epi8(d, zero), lo), maxval);
+                hi = _mm256_min_epi16(_mm256_add_epi16(_mm256_unpackhi_epi8(d, zero), hi), maxval);
+                _mm256_storeu_si256((__m256i *) (dst + i), _mm256_packus_epi16(lo, hi));
+            }
+        }
+        break;
+
+    case AUDIO_S8:
+        {
+            const __m256i vol = _mm256_set1_epi16(volume);
+            for (; i + 32 <= len; i += 32) {
+                const __m256i s = _mm256_loadu_si256((const __m256i *) (src + i));
+                const __m256i d = _mm256_loadu_si256((const __m256i *) (dst + i));
+                const __m256i lo = MixScaleS16_AVX2(_mm256_srai_epi16(_mm256_unpacklo_epi8(s, s), 8), vol);
+                const __m256i hi = MixScaleS16_AVX2(_mm256_srai_epi16(_mm256_unpackhi_epi8(s, s), 8), vol);
+                _mm256_storeu_si256((__m256i *) (dst + i), _mm256_adds_epi8(d, _mm256_packs_epi16(lo, hi)));
+            }
+        }
+        break;
+
+    case AUDIO_S16LSB:
+    case AUDIO_S16MSB:
+    case AUDIO_U16LSB:
+    case AUDIO_U16MSB:
+        {
+            const __m256i vol = _mm256_set1_epi16(volume);
+            const SDL_bool issigned = SDL_AUDIO_ISSIGNED(format) ? SDL_TRUE : SDL_FALSE;
+            for (; i + 32 <= len; i += 32) {
+                __m256i s = _mm256_loadu_si256((const __m256i *) (src + i));
+                __m256i d = _mm256_loadu_si256((const __m256i *) (dst + i));
+                if (swap) {
+                    s = MixSwap16_AVX2(s);
+                    d = MixSwap16_AVX2(d);
+                }
+                if (issigned) {
+                    d = _mm256_adds_epi16(d, MixScaleS16_AVX2(s, vol));
+                } else {
+                    d = _mm256_adds_epu16(d, MixScaleU16_AVX2(s, vol));
+                }
+                if (swap) {
+                    d = MixSwap16_AVX2(d);
+                }
+                _mm256_storeu_si256((__m256i *) (dst + i), d);
+            }
+        }
+        break;
+
+    case AUDIO_S32LSB:
+    case AUDIO_S32MSB:
+        {
+            const __m256d vol = _mm256_set1_pd(volume / (double) SDL_MIX_MAXVOLUME);
+            for (; i + 32 <= len; i += 32) {
+                __m256i s = _mm256_loadu_si256((const __m256i *) (src + i));
+                __m256i d = _mm256_loadu_si256((const __m256i *) (dst + i));
+                if (swap) {
+                    s = MixSwap32_AVX2(s);
+                    d = MixSwap32_AVX2(d);
+                }
+                d = _mm256_inserti128_si256(_mm256_castsi128_si256(MixS32Half_AVX2(_mm256_castsi256_si128(s), _mm256_castsi256_si128(d), vol)),
+                                            MixS32Half_AVX2(_mm256_extracti128_si256(s, 1), _mm256_extracti128_si256(d, 1), vol), 1);
+                if (swap) {
+                    d = MixSwap32_AVX2(d);
+                }
+                _mm256_storeu_si256((__m256i *) (dst + i), d);
+            }
+        }
+        break;
+
+    case AUDIO_F32LSB:
+    case AUDIO_F32MSB:
+        {
+            const __m256 fvolume = _mm256_set1_ps((float) volume);
+            const __m256 fmaxvolume = _mm256_set1_ps(1.0f / ((float) SDL_MIX_MAXVOLUME));
+            const __m256 maxval = _mm256_set1_ps(3.402823466e+38F);
+            const __m256 minval = _mm256_set1_ps(-3.402823466e+38F);
+            for (; i + 32 <= len; i += 32) {
+                __m256i s = _mm256_loadu_si256((const __m256i *) (src + i));
+                __m256i d = _mm256_loadu_si256((const __m256i *) (dst + i));
+                __m256 sum;
+                if (swap) {
+                    s = MixSwap32_AVX2(s);
+                    d = MixSwap32_AVX2(d);
+                }
+                sum = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(_mm256_castsi256_ps(s), fvolume), fmaxvolume), _mm256_castsi256_ps(d));
+                d = _mm256_castps_si256(_mm256_max_ps(minval, _mm256_min_ps(maxval, sum)));
+                if (swap) {
+                    d = MixSwap32_AVX2(d);
+                }
+                _mm256_storeu_si256((__m256i *) (dst + i), d);
+            }
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    return i;
+}
+#endif
+
+#if SDL_NEON_INTRINSICS
+/* ADJUST_VOLUME for signed 16-bit lanes; negative products get 127 added so the shift rounds toward zero. */
+static int16x8_t
+MixScaleS16_NEON(const int16x8_t s, const int16_t volume)
+{
+    int32x4_t lo = vmull_n_s16(vget_low_s16(s), volume);
+    int32x4_t hi = vmull_n_s16(vget_high_s16(s), volume);
+    lo = vaddq_s32(lo, vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_s32(vshrq_n_s32(lo, 31)), 25)));
+    hi = vaddq_s32(hi, vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_s32(vshrq_n_s32(hi, 31)), 25)));
+    return vcombine_s16(vshrn_n_s32(lo, 7), vshrn_n_s32(hi, 7));
+}
+
+static uint16x8_t
+MixScaleU16_NEON(const uint16x8_t s, const uint16_t volume)
+{
+    return vcombine_u16(vshrn_n_u32(vmull_n_u16(vget_low_u16(s), volume), 7),
+                        vshrn_n_u32(vmull_n_u16(vget_high_u16(s), volume), 7));
+}
+
+static int32x2_t
+MixS32Half_NEON(const int32x2_t s, const int32x2_t d, const int32_t volume)
+{
+    int64x2_t src1 = vmull_n_s32(s, volume);
+    src1 = vaddq_s64(src1, vreinterpretq_s64_u64(vshrq_n_u64(vreinterpretq_u64_s64(vshrq_n_s64(src1, 63)), 57)));
+    return vqmovn_s64(vaddq_s64(vshrq_n_s64(src1, 7), vmovl_s32(d)));
+}
+
+static uint8x16_t
+MixSwap_NEON(const uint8x16_t x, const int bits)
+{
+    return (bits == 16) ? vrev16q_u8(x) : vrev32q_u8(x);
+}
+
+static Uint32
+SDL_MixAudio_NEON(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format, Uint32 len, int volume)
+{
+    const SDL_bool swap = MixNeedsSwap(format);
+    const int bits = SDL_AUDIO_BITSIZE(format);
+    Uint32 i = 0;
+
+    switch (format) {
+    case AUDIO_U8:
+        {
+            const int16x8_t bias = vdupq_n_s16(128);
+            const int16x8_t maxval = vdupq_n_s16(254);
+            for (; i + 16 <= len; i += 16) {
+                const uint8x16_t s = vld1q_u8(src + i);
+                const uint8x16_t d = vld1q_u8(dst + i);
+                int16x8_t lo = MixScaleS16_NEON(vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(s))), bias), (int16_t) volume);
+                int16x8_t hi = MixScaleS16_NEON(vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(s))), bias), (int16_t) volume);
+                lo = vminq_s16(vaddq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(d))), lo), maxval);
+                hi = vminq_s16(vaddq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(d))), hi), maxval);
+                vst1q_u8(dst + i, vcombine_u8(vqmovun_s16(lo), vqmovun_s16(hi)));
+            }
+        }
+        break;
+
+    case AUDIO_S8:
+        for (; i + 16 <= len; i += 16) {
+            const int8x16_t s = vld1q_s8((const int8_t *) (src + i));
+            const int8x16_t d = vld1q_s8((const int8_t *) (dst + i));
+            const int16x8_t lo = MixScaleS16_NEON(vmovl_s8(vget_low_s8(s)), (int16_t) volume);
+            const int16x8_t hi = MixScaleS16_NEON(vmovl_s8(vget_high_s8(s)), (int16_t) volume);
+            vst1q_s8((int8_t *) (dst + i), vqaddq_s8(d, vcombine_s8(vmovn_s16(lo), vmovn_s16(hi))));
+        }
+        break;
+
+    case AUDIO_S16LSB:
+    case AUDIO_S16MSB:
+    case AUDIO_U16LSB:
+    case AUDIO_U16MSB:
+    case AUDIO_S32LSB:
+    case AUDIO_S32MSB:
+    case AUDIO_F32LSB:
+    case AUDIO_F32MSB:
+        {
+            const float32x4_t fvolume = vdupq_n_f32((float) volume);
+            const float32x4_t fmaxvolume = vdupq_n_f32(1.0f / ((float) SDL_MIX_MAXVOLUME));
+            const float32x4_t maxval = vdupq_n_f32(3.402823466e+38F);
+            const float32x4_t minval = vdupq_n_f32(-3.402823466e+38F);
+            for (; i + 16 <= len; i += 16) {
+                uint8x16_t s = vld1q_u8(src + i);
+                uint8x16_t d = vld1q_u8(dst + i);
+                if (swap) {
+                    s = MixSwap_NEON(s, bits);
+                    d = MixSwap_NEON(d, bits);
+                }
+                if (format == AUDIO_S16LSB || format == AUDIO_S16MSB) {
+                    d = vreinterpretq_u8_s16(vqaddq_s16(vreinterpretq_s16_u8(d), MixScaleS16_NEON(vreinterpretq_s16_u8(s), (int16_t) volume)));
+                } else if (format == AUDIO_U16LSB || format == AUDIO_U16MSB) {
+                    d = vreinterpretq_u8_u16(vqaddq_u16(vreinterpretq_u16_u8(d), MixScaleU16_NEON(vreinterpretq_u16_u8(s), (uint16_t) volume)));
+                } else if (format == AUDIO_S32LSB || format == AUDIO_S32MSB) {
+                    const int32x4_t s32 = vreinterpretq_s32_u8(s);
+                    const int32x4_t d32 = vreinterpretq_s32_u8(d);
+                    d = vreinterpretq_u8_s32(vcombine_s32(MixS32Half_NEON(vget_low_s32(s32), vget_low_s32(d32), volume),
+                                                          MixS32Half_NEON(vget_high_s32(s32), vget_high_s32(d32), volume)));
+                } else {
+                    const float32x4_t sum = vaddq_f32(vmulq_f32(vmulq_f32(vreinterpretq_f32_u8(s), fvolume), fmaxvolume), vreinterpretq_f32_u8(d));
+                    d = vreinterpretq_u8_f32(vmaxq_f32(vminq_f32(sum, maxval), minval));
+                }
+                if (swap) {
+                    d = MixSwap_NEON(d, bits);
+                }
+                vst1q_u8(dst + i, d);
+            }
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    return i;
+}
+#endif
+
+static SDL_MixAudioFunc
+ChooseMixAudioFunc(void)
+{
+#if SDL_AVX2_INTRINSICS
+    if (SDL_CPUFeatureEnabled(CPU_HAS_AVX2)) {
+        return SDL_MixAudio_AVX2;
+    }
+#endif
+#if SDL_SSE2_INTRINSICS
+    if (SDL_CPUFeatureEnabled(CPU_HAS_SSE2)) {
+        return SDL_MixAudio_SSE2;
+    }
+#endif
+#if SDL_NEON_INTRINSICS
+    if (SDL_CPUFeatureEnabled(CPU_HAS_NEON)) {
+        return SDL_MixAudio_NEON;
+    }
+#endif
+    return NULL;
+}
+
+/* Picks the kernel again only after SDL_HINT_CPU_DISABLE_FEATURES changed.
+   Several audio threads can get here at once, so the kernel and the
+   generation it was picked in are only used under the lock. */
+static SDL_MixAudioFunc
+GetMixAudioFunc(void)
+{
+    static SDL_MixAudioFunc mix_audio = NULL;
+    static int mix_audio_generation = -1;
+    static SDL_SpinLock mix_audio_lock = 0;
+    const int generation = SDL_GetCPUFeaturesGeneration();
+    SDL_MixAudioFunc func;
+
+    SDL_AtomicLock(&mix_audio_lock);
+    if (generation != mix_audio_generation) {
+        mix_audio = ChooseMixAudioFunc();
+        mix_audio_generation = generation;
+    }
+    func = mix_audio;
+    SDL_AtomicUnlock(&mix_audio_lock);
+    return func;
+}
+
 
 void
 SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
@@ -94,6 +593,16 @@ SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
         return;
     }
 
+    if (volume > 0 && volume <= SDL_MIX_MAXVOLUME) {
+        const SDL_MixAudioFunc mix_simd = GetMixAudioFunc();
+        if (mix_simd) {
+            const Uint32 done = mix_simd(dst, src, format, len, volume);
+            dst += done;
+            src += done;
+            len -= done;
+        }
+    }
+
     switch (format) {
 
     case AUDIO_U8:
@@ -366,4 +875,299 @@ SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
     }
 }
 
+
+/* SDL_AudioMixer: streams are pulled as float, scaled and summed into one
+   float bus, and the bus is clipped and converted to the output once. */
+
+typedef struct
+{
+    SDL_AudioStream *stream;
+    float gain;
+} SDL_AudioMixerInput;
+
+struct _SDL_AudioMixer
+{
+    SDL_AudioFormat format;
+    Uint8 channels;
+    int rate;
+    int framesize;   /* bytes per output frame. */
+    SDL_AudioCVT cvt;  /* float bus to output format; unused for AUDIO_F32SYS. */
+    SDL_AudioMixerInput *inputs;
+    int num_inputs;
+    int max_inputs;
+    float *bus;
+    float *scratch;
+    int buflen;  /* bytes allocated for each of bus and scratch. */
+};
+
+typedef void (*SDL_MixFloatFunc)(float *dst, const float *src, const int num, const float gain);
+
+static void
+SDL_MixFloat_Scalar(float *dst, const float *src, const int num, const float gain)
+{
+    int i;
+    for (i = 0; i < num; i++) {
+        dst[i] += src[i] * gain;
+    }
+}
+
+#if SDL_SSE2_INTRINSICS
+static void
+SDL_MixFloat_SSE2(float *dst, const float *src, const int num, const float gain)
+{
+    const __m128 g = _mm_set1_ps(gain);
+    int i = 0;
+
+    for (; i + 8 <= num; i += 8) {
+        const __m128 a = _mm_add_ps(_mm_loadu_ps(dst + i), _mm_mul_ps(_mm_loadu_ps(src + i), g));
+        const __m128 b = _mm_add_ps(_mm_loadu_ps(dst + i + 4), _mm_mul_ps(_mm_loadu_ps(src + i + 4), g));
+        _mm_storeu_ps(dst + i, a);
+        _mm_storeu_ps(dst + i + 4, b);
+    }
+    SDL_MixFloat_Scalar(dst + i, src + i, num - i, gain);
+}
+#endif
+
+#if SDL_NEON_INTRINSICS
+static void
+SDL_MixFloat_NEON(float *dst, const float *src, const int num, const float gain)
+{
+    const float32x4_t g = vdupq_n_f32(gain);
+    int i = 0;
+
+    for (; i + 8 <= num; i += 8) {
+        vst1q_f32(dst + i, vmlaq_f32(vld1q_f32(dst + i), vld1q_f32(src + i), g));
+        vst1q_f32(dst + i + 4, vmlaq_f32(vld1q_f32(dst + i + 4), vld1q_f32(src + i + 4), g));
+    }
+    SDL_MixFloat_Scalar(dst + i, src + i, num - i, gain);
+}
+#endif
+
+static SDL_MixFloatFunc
+ChooseMixFloatFunc(void)
+{
+#if SDL_SSE2_INTRINSICS
+    if (SDL_CPUFeatureEnabled(CPU_HAS_SSE2)) {
+        return SDL_MixFloat_SSE2;
+    }
+#endif
+#if SDL_NEON_INTRINSICS
+    if (SDL_CPUFeatureEnabled(CPU_HAS_NEON)) {
+        return SDL_MixFloat_NEON;
+    }
+#endif
+    return SDL_MixFloat_Scalar;
+}
+
+/* Picks the kernel again only after SDL_HINT_CPU_DISABLE_FEATURES changed.
+   Each mixer runs on its own device's thread, so the kernel and the
+   generation it was picked in are only used under the lock. */
+static SDL_MixFloatFunc
+GetMixFloatFunc(void)
+{
+    static SDL_MixFloatFunc mix_float = SDL_MixFloat_Scalar;
+    static int mix_float_generation = -1;
+    static SDL_SpinLock mix_float_lock = 0;
+    const int generation = SDL_GetCPUFeaturesGeneration();
+    SDL_MixFloatFunc func;
+
+    SDL_AtomicLock(&mix_float_lock);
+    if (generation != mix_float_generation) {
+        mix_float = ChooseMixFloatFunc();
+        mix_float_generation = generation;
+    }
+    func = mix_float;
+    SDL_AtomicUnlock(&mix_float_lock);
+    return func;
+}
+
+SDL_AudioMixer *
+SDL_NewAudioMixer(const SDL_AudioFormat format, const Uint8 channels, const int rate)
+{
+    SDL_AudioMixer *mixer;
+    SDL_AudioCVT cvt;
+
+    /* this also checks that the output format is something we can make. */
+    if (SDL_BuildAudioCVT(&cvt, AUDIO_F32SYS, channels, rate, format, channels, rate) < 0) {
+        return NULL;
+    }
+
+    mixer = (SDL_AudioMixer *) SDL_calloc(1, sizeof (SDL_AudioMixer));
+    if (!mixer) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    mixer->format = format;
+    mixer->channels = channels;
+    mixer->rate = rate;
+    mixer->framesize = (SDL_AUDIO_BITSIZE(format) / 8) * channels;
+    mixer->cvt = cvt;
+    return mixer;
+}
+
+static SDL_AudioMixerInput *
+FindAudioMixerInput(SDL_AudioMixer *mixer, SDL_AudioStream *stream)
+{
+    int i;
+    for (i = 0; i < mixer->num_inputs; i++) {
+        if (mixer->inputs[i].stream == stream) {
+            return &mixer->inputs[i];
+        }
+    }
+    return NULL;
+}
+
+SDL_AudioStream *
+SDL_AudioMixerNewStream(SDL_AudioMixer *mixer, const SDL_AudioFormat src_format,
+                        const Uint8 src_channels, const int src_rate)
+{
+    SDL_AudioStream *stream;
+
+    if (!mixer) {
+        SDL_InvalidParamError("mixer");
+        return NULL;
+    }
+
+    if (mixer->num_inputs == mixer->max_inputs) {
+        const int max_inputs = mixer->max_inputs ? (mixer->max_inputs * 2) : 16;
+        SDL_AudioMixerInput *inputs = (SDL_AudioMixerInput *) SDL_realloc(mixer->inputs, max_inputs * sizeof (SDL_AudioMixerInput));
+        if (!inputs) {
+            SDL_OutOfMemory();
+            return NULL;
+        }
+        mixer->inputs = inputs;
+        mixer->max_inputs = max_inputs;
+    }
+
+    stream = SDL_NewAudioStream(src_format, src_channels, src_rate, AUDIO_F32SYS, mixer->channels, mixer->rate);
+    if (stream) {
+        mixer->inputs[mixer->num_inputs].stream = stream;
+        mixer->inputs[mixer->num_inputs].gain = 1.0f;
+        mixer->num_inputs++;
+    }
+    return stream;
+}
+
+int
+SDL_AudioMixerSetGain(SDL_AudioMixer *mixer, SDL_AudioStream *stream, float gain)
+{
+    SDL_AudioMixerInput *input;
+
+    if (!mixer) {
+        return SDL_InvalidParamError("mixer");
+    }
+
+    input = FindAudioMixerInput(mixer, stream);
+    if (!input) {
+        return SDL_SetError("Stream doesn't belong to this mixer");
+    }
+
+    input->gain = gain;
+    return 0;
+}
+
+void
+SDL_AudioMixerFreeStream(SDL_AudioMixer *mixer, SDL_AudioStream *stream)
+{
+    SDL_AudioMixerInput *input = mixer ? FindAudioMixerInput(mixer, stream) : NULL;
+
+    if (input) {
+        const int index = (int) (input - mixer->inputs);
+        SDL_FreeAudioStream(stream);
+        /* keep the order, so the mix adds up the same way every time. */
+        SDL_memmove(input, input + 1, (mixer->num_inputs - index - 1) * sizeof (SDL_AudioMixerInput));
+        mixer->num_inputs--;
+    }
+}
+
+int
+SDL_AudioMixerGet(SDL_AudioMixer *mixer, void *buf, int len)
+{
+    const SDL_MixFloatFunc mix_float = GetMixFloatFunc();
+    int floatlen, num, i;
+
+    if (!mixer) {
+        return SDL_InvalidParamError("mixer");
+    } else if (!buf) {
+        return SDL_InvalidParamError("buf");
+    } else if (len <= 0) {
+        return 0;
+    } else if ((len % mixer->framesize) != 0) {
+        return SDL_SetError("Can't request partial sample frames");
+    }
+
+    num = (len / mixer->framesize) * mixer->channels;
+    floatlen = num * (int) sizeof (float);
+
+    if (floatlen > mixer->buflen) {
+        float *bus = (float *) SDL_realloc(mixer->bus, floatlen);
+        float *scratch;
+        if (!bus) {
+            return SDL_OutOfMemory();
+        }
+        mixer->bus = bus;
+        scratch = (float *) SDL_realloc(mixer->scratch, floatlen);
+        if (!scratch) {
+            return SDL_OutOfMemory();
+        }
+        mixer->scratch = scratch;
+        mixer->buflen = floatlen;
+    }
+
+    SDL_memset(mixer->bus, '\0', floatlen);
+
+    for (i = 0; i < mixer->num_inputs; i++) {
+        const SDL_AudioMixerInput *input = &mixer->inputs[i];
+        const int got = SDL_AudioStreamGet(input->stream, mixer->scratch, floatlen);
+        if (got > 0) {
+            mix_float(mixer->bus, mixer->scratch, got / (int) sizeof (float), input->gain);
+        }
+    }
+
+    if (mixer->format == AUDIO_F32SYS) {
+        float *dst = (float *) buf;
+        for (i = 0; i < num; i++) {
+            const float sample = mixer->bus[i];
+            dst[i] = (sample > 1.0f) ? 1.0f : ((sample < -1.0f) ? -1.0f : sample);
+        }
+    } else {
+        /* the converters clip as they go, and never need more room than
+           the float data takes. */
+        mixer->cvt.buf = (Uint8 *) mixer->bus;
+        mixer->cvt.len = floatlen;
+        if (SDL_ConvertAudio(&mixer->cvt) < 0) {
+            return -1;
+        }
+        SDL_assert(mixer->cvt.len_cvt == len);
+        SDL_memcpy(buf, mixer->bus, len);
+    }
+
+    return len;
+}
+
+void SDLCALL
+SDL_AudioMixerCallback(void *userdata, Uint8 *stream, int len)
+{
+    SDL_AudioMixer *mixer = (SDL_AudioMixer *) userdata;
+    if (SDL_AudioMixerGet(mixer, stream, len) < 0) {
+        SDL_memset(stream, mixer ? SDL_SilenceValueForFormat(mixer->format) : 0, len);
+    }
+}
+
+void
+SDL_FreeAudioMixer(SDL_AudioMixer *mixer)
+{
+    if (mixer) {
+        int i;
+        for (i = 0; i < mixer->num_inputs; i++) {
+            SDL_FreeAudioStream(mixer->inputs[i].stream);
+        }
+        SDL_free(mixer->inputs);
+        SDL_free(mixer->bus);
+        SDL_free(mixer->scratch);
+        SDL_free(mixer);
+    }
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
@@ -79,6 +79,7 @@ typedef struct SDL_AudioDriverImpl
     void (*LockDevice) (_THIS);
     void (*UnlockDevice) (_THIS);
     void (*FreeDeviceHandle) (void *handle);  /**< SDL is done with handle from SDL_AddAudioDevice() */
+    int (*AdvanceDevice) (_THIS, int buffers);  /**< For devices that run on the app's clock */
     void (*Deinitialize) (void);
 
     /* !!! FIXME: add pause(), so we can optimize instead of mixing silence. */
@@ -155,6 +156,16 @@ struct SDL_AudioDevice
     /* Size, in bytes, of work_buffer. */
     Uint32 work_buffer_len;
 
+    /* Statistics of the device thread, see SDL_GetAudioDeviceStats().
+       stats_lock guards stats, the rest is only used by the device thread. */
+    SDL_AudioDeviceStats stats;
+    SDL_SpinLock stats_lock;
+    Uint64 stats_frequency;   /* SDL_GetPerformanceFrequency() */
+    Uint64 stats_period;      /* Length of a device buffer in performance counter ticks */
+    Uint32 stats_log_interval;
+    Uint32 stats_next_log;
+    SDL_bool stats_queue_playing;
+
     /* A mutex for locking the mixing buffers */
     SDL_mutex *mixer_lock;
 
@@ -162,8 +173,11 @@ struct SDL_AudioDevice
     SDL_Thread *thread;
     SDL_threadID threadid;
 
-    /* Queued buffers (if app not using callback). */
+    /* Queued buffers (if app not using callback). For playback this is a
+       lock-free ring that the audio thread reads without waiting on anyone;
+       buffer_queue_lock only keeps app threads from writing at once. */
     SDL_DataQueue *buffer_queue;
+    SDL_mutex *buffer_queue_lock;
 
     /* * * */
     /* Data private to this driver */
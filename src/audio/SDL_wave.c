@@ -37,6 +37,11 @@
 #include "SDL_audio.h"
 #include "SDL_wave.h"
 #include "SDL_audio_c.h"
+#include "../thread/SDL_systhread.h"
+
+/* Don't give a decoding thread fewer ADPCM blocks than this */
+#define WAVE_MIN_BLOCKS_PER_THREAD 256
+#define WAVE_MAX_DECODE_THREADS    16
 
 /* Reads the value stored at the location of the f1 pointer, multiplies it
  * with the second argument and then stores the result to f1.
@@ -636,6 +641,134 @@ MS_ADPCM_DecodeBlockData(ADPCM_DecoderState *state)
     return 0;
 }
 
+static int
+MS_ADPCM_DecodeBlock(ADPCM_DecoderState *state)
+{
+    if (MS_ADPCM_DecodeBlockHeader(state) == -1) {
+        return -1;
+    }
+    return MS_ADPCM_DecodeBlockData(state);
+}
+
+#if !SDL_THREADS_DISABLED
+/* A range of complete ADPCM blocks, decoded by one thread into its own part of
+ * the output.
+ */
+typedef struct ADPCM_BlockRange
+{
+    ADPCM_DecoderState state;
+    int (*decodeblock)(ADPCM_DecoderState *state);
+    size_t blocks;
+    int result;
+    SDL_Thread *thread;
+    MS_ADPCM_ChannelState cstate[255]; /* Also big enough for IMA ADPCM. */
+} ADPCM_BlockRange;
+
+static void
+ADPCM_SetupBlockRange(ADPCM_BlockRange *range, const ADPCM_DecoderState *state,
+                      int (*decodeblock)(ADPCM_DecoderState *), size_t first, size_t end)
+{
+    range->blocks = end - first;
+    range->decodeblock = decodeblock;
+    range->state = *state;
+    range->state.cstate = range->cstate;
+    range->state.input.pos += first * state->blocksize;
+    range->state.output.pos += first * state->samplesperblock * state->channels;
+    range->state.framesleft = (Sint64)(range->blocks * state->samplesperblock);
+}
+
+static int SDLCALL
+ADPCM_DecodeBlockRange(void *data)
+{
+    ADPCM_BlockRange *range = (ADPCM_BlockRange *)data;
+    ADPCM_DecoderState *state = &range->state;
+    size_t i;
+
+    range->result = 0;
+    for (i = 0; i < range->blocks; i++) {
+        state->block.data = state->input.data + state->input.pos;
+        state->block.size = state->blocksize;
+        state->block.pos = 0;
+
+        if (range->decodeblock(state) == -1) {
+            range->result = -1;
+            break;
+        }
+
+        state->input.pos += state->blocksize;
+    }
+
+    return range->result;
+}
+#endif /* !SDL_THREADS_DISABLED */
+
+/* Every ADPCM block starts over with the header, so the complete blocks that
+ * are fully used can be decoded in parallel, each writing to the output at
+ * block * samplesperblock sample frames. This decodes those at the start of
+ * the input with up to numthreads threads and advances state past them. The
+ * rest, including any truncated block, is left to the serial decoder.
+ */
+static int
+ADPCM_DecodeBlocksThreaded(ADPCM_DecoderState *state, int (*decodeblock)(ADPCM_DecoderState *), int numthreads)
+{
+#if !SDL_THREADS_DISABLED
+    const size_t blocksleft = (state->input.size - state->input.pos) / state->blocksize;
+    const size_t blockframes = (size_t)(state->framesleft / state->samplesperblock);
+    const size_t blocks = SDL_min(blocksleft, blockframes);
+    const size_t blocksamples = state->samplesperblock * state->channels;
+    ADPCM_BlockRange *ranges;
+    int i, numranges;
+
+    numranges = (int)SDL_min((size_t)SDL_min(numthreads, WAVE_MAX_DECODE_THREADS), blocks / WAVE_MIN_BLOCKS_PER_THREAD);
+    if (numranges < 2) {
+        return 0;
+    }
+
+    ranges = (ADPCM_BlockRange *)SDL_calloc(numranges, sizeof(ADPCM_BlockRange));
+    if (ranges == NULL) {
+        /* Not fatal, the serial decoder will do all the work. */
+        return 0;
+    }
+
+    for (i = 0; i < numranges; i++) {
+        ADPCM_SetupBlockRange(&ranges[i], state, decodeblock, blocks * i / numranges, blocks * (i + 1) / numranges);
+    }
+
+    /* The first range runs on this thread. */
+    for (i = 1; i < numranges; i++) {
+        ranges[i].thread = SDL_CreateThreadInternal(ADPCM_DecodeBlockRange, "SDLWaveDecode", 0, &ranges[i]);
+    }
+    ADPCM_DecodeBlockRange(&ranges[0]);
+    for (i = 1; i < numranges; i++) {
+        if (ranges[i].thread) {
+            SDL_WaitThread(ranges[i].thread, NULL);
+        } else {
+            ADPCM_DecodeBlockRange(&ranges[i]);
+        }
+    }
+
+    for (i = 0; i < numranges; i++) {
+        if (ranges[i].result == -1) {
+            /* The error message is per thread, decode again here to set it. */
+            if (ranges[i].thread) {
+                ADPCM_SetupBlockRange(&ranges[i], state, decodeblock, blocks * i / numranges, blocks * (i + 1) / numranges);
+                ADPCM_DecodeBlockRange(&ranges[i]);
+            }
+            SDL_free(ranges);
+            return -1;
+        }
+    }
+
+    SDL_free(ranges);
+
+    state->input.pos += blocks * state->blocksize;
+    state->output.pos += blocks * blocksamples;
+    state->framesleft -= (Sint64)(blocks * state->samplesperblock);
+#endif /* !SDL_THREADS_DISABLED */
+
+    return 0;
+}
+
 static int
 MS_ADPCM_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
 {
@@ -692,6 +825,11 @@ MS_ADPCM_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
 
     state.cstate = cstate;
 
+    if (ADPCM_DecodeBlocksThreaded(&state, MS_ADPCM_DecodeBlock, file->decodethreads) == -1) {
+        SDL_free(state.output.data);
+        return -1;
+    }
+
     /* Decode block by block. A truncated block will stop the decoding. */
     bytesleft = state.input.size - state.input.pos;
     while (state.framesleft > 0 && bytesleft >= state.blockheadersize) {
@@ -1032,6 +1170,13 @@ IMA_ADPCM_DecodeBlockData(ADPCM_DecoderState *state)
     return retval;
 }
 
+static int
+IMA_ADPCM_DecodeBlock(ADPCM_DecoderState *state)
+{
+    IMA_ADPCM_DecodeBlockHeader(state);
+    return IMA_ADPCM_DecodeBlockData(state);
+}
+
 static int
 IMA_ADPCM_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
 {
@@ -1090,6 +1235,12 @@ IMA_ADPCM_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
     }
     state.cstate = cstate;
 
+    if (ADPCM_DecodeBlocksThreaded(&state, IMA_ADPCM_DecodeBlock, file->decodethreads) == -1) {
+        SDL_free(state.output.data);
+        SDL_free(cstate);
+        return -1;
+    }
+
     /* Decode block by block. A truncated block will stop the decoding. */
     bytesleft = state.input.size - state.input.pos;
     while (state.framesleft > 0 && bytesleft >= state.blockheadersize) {
@@ -1165,8 +1316,11 @@ LAW_Init(WaveFile *file, size_t datalength)
     return 0;
 }
 
+/* Expands count companded samples from src to dst. Works backwards, so src
+ * and dst may start at the same address for in-place expansion.
+ */
 static int
-LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
+LAW_DecodeSamples(Uint16 encoding, const Uint8 *src, Sint16 *dst, size_t count)
 {
 #ifdef SDL_WAVE_LAW_LUT
     const Sint16 alaw_lut[256] = {
@@ -1206,54 +1360,9 @@ LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
         112, 104, 96, 88, 80, 72, 64, 56, 48, 40, 32, 24, 16, 8, 0
     };
 #endif
+    size_t i = count;
 
-    WaveFormat *format = &file->format;
-    WaveChunk *chunk = &file->chunk;
-    size_t i, sample_count, expanded_len;
-    Uint8 *src;
-    Sint16 *dst;
-
-    if (chunk->length != chunk->size) {
-        file->sampleframes = WaveAdjustToFactValue(file, chunk->size / format->blockalign);
-        if (file->sampleframes < 0) {
-            return -1;
-        }
-    }
-
-    /* Nothing to decode, nothing to return. */
-    if (file->sampleframes == 0) {
-        *audio_buf = NULL;
-        *audio_len = 0;
-        return 0;
-    }
-
-    sample_count = (size_t)file->sampleframes;
-    if (SafeMult(&sample_count, format->channels)) {
-        return SDL_OutOfMemory();
-    }
-
-    expanded_len = sample_count;
-    if (SafeMult(&expanded_len, sizeof(Sint16))) {
-        return SDL_OutOfMemory();
-    } else if (expanded_len > SDL_MAX_UINT32 || file->sampleframes > SIZE_MAX) {
-        return SDL_SetError("WAVE file too big");
-    }
-
-    /* 1 to avoid allocating zero bytes, to keep static analysis happy. */
-    src = (Uint8 *)SDL_realloc(chunk->data, expanded_len ? expanded_len : 1);
-    if (src == NULL) {
-        return SDL_OutOfMemory();
-    }
-    chunk->data = NULL;
-    chunk->size = 0;
-
-    dst = (Sint16 *)src;
-
-    /* Work backwards, since we're expanding in-place. SDL_AudioSpec.format will
-     * inform the caller about the byte order.
-     */
-    i = sample_count;
-    switch (file->format.encoding) {
+    switch (encoding) {
 #ifdef SDL_WAVE_LAW_LUT
     case ALAW_CODE:
         while (i--) {
@@ -1298,10 +1407,65 @@ LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
         break;
 #endif
     default:
-        SDL_free(src);
         return SDL_SetError("Unknown companded encoding");
     }
 
+    return 0;
+}
+
+static int
+LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
+{
+    WaveFormat *format = &file->format;
+    WaveChunk *chunk = &file->chunk;
+    size_t sample_count, expanded_len;
+    Uint8 *src;
+    Sint16 *dst;
+
+    if (chunk->length != chunk->size) {
+        file->sampleframes = WaveAdjustToFactValue(file, chunk->size / format->blockalign);
+        if (file->sampleframes < 0) {
+            return -1;
+        }
+    }
+
+    /* Nothing to decode, nothing to return. */
+    if (file->sampleframes == 0) {
+        *audio_buf = NULL;
+        *audio_len = 0;
+        return 0;
+    }
+
+    sample_count = (size_t)file->sampleframes;
+    if (SafeMult(&sample_count, format->channels)) {
+        return SDL_OutOfMemory();
+    }
+
+    expanded_len = sample_count;
+    if (SafeMult(&expanded_len, sizeof(Sint16))) {
+        return SDL_OutOfMemory();
+    } else if (expanded_len > SDL_MAX_UINT32 || file->sampleframes > SIZE_MAX) {
+        return SDL_SetError("WAVE file too big");
+    }
+
+    /* 1 to avoid allocating zero bytes, to keep static analysis happy. */
+    src = (Uint8 *)SDL_realloc(chunk->data, expanded_len ? expanded_len : 1);
+    if (src == NULL) {
+        return SDL_OutOfMemory();
+    }
+    chunk->data = NULL;
+    chunk->size = 0;
+
+    dst = (Sint16 *)src;
+
+    /* Expand in-place. SDL_AudioSpec.format will inform the caller about the
+     * byte order.
+     */
+    if (LAW_DecodeSamples(format->encoding, src, dst, sample_count) < 0) {
+        SDL_free(src);
+        return -1;
+    }
+
     *audio_buf = src;
     *audio_len = (Uint32)expanded_len;
 
@@ -1352,12 +1516,37 @@ PCM_Init(WaveFile *file, size_t datalength)
     return 0;
 }
 
+/* Shifts sample_count 24-bit samples in ptr to 32 bits in-place. The buffer
+ * must have room for the expanded samples.
+ */
+static void
+PCM_ExpandSint24ToSint32(Uint8 *ptr, size_t sample_count)
+{
+    size_t i;
+
+    /* work from end to start, since we're expanding in-place. */
+    for (i = sample_count; i > 0; i--) {
+        const size_t o = i - 1;
+        uint8_t b[4];
+
+        b[0] = 0;
+        b[1] = ptr[o * 3];
+        b[2] = ptr[o * 3 + 1];
+        b[3] = ptr[o * 3 + 2];
+
+        ptr[o * 4 + 0] = b[0];
+        ptr[o * 4 + 1] = b[1];
+        ptr[o * 4 + 2] = b[2];
+        ptr[o * 4 + 3] = b[3];
+    }
+}
+
 static int
 PCM_ConvertSint24ToSint32(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
 {
     WaveFormat *format = &file->format;
     WaveChunk *chunk = &file->chunk;
-    size_t i, expanded_len, sample_count;
+    size_t expanded_len, sample_count;
     Uint8 *ptr;
 
     sample_count = (size_t)file->sampleframes;
@@ -1385,21 +1574,7 @@ PCM_ConvertSint24ToSint32(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
     *audio_buf = ptr;
     *audio_len = (Uint32)expanded_len;
 
-    /* work from end to start, since we're expanding in-place. */
-    for (i = sample_count; i > 0; i--) {
-        const size_t o = i - 1;
-        uint8_t b[4];
-
-        b[0] = 0;
-        b[1] = ptr[o * 3];
-        b[2] = ptr[o * 3 + 1];
-        b[3] = ptr[o * 3 + 2];
-
-        ptr[o * 4 + 0] = b[0];
-        ptr[o * 4 + 1] = b[1];
-        ptr[o * 4 + 2] = b[2];
-        ptr[o * 4 + 3] = b[3];
-    }
+    PCM_ExpandSint24ToSint32(ptr, sample_count);
 
     return 0;
 }
@@ -1507,6 +1682,18 @@ WaveGetFactChunkHint()
     return FactNoHint;
 }
 
+static int
+WaveGetDecodeThreadsHint()
+{
+    const char *hint = SDL_GetHint(SDL_HINT_WAVE_DECODE_THREADS);
+
+    if (hint != NULL) {
+        return SDL_atoi(hint);
+    }
+
+    return 0;
+}
+
 static void
 WaveFreeChunkData(WaveChunk *chunk)
 {
@@ -1783,8 +1970,16 @@ WaveCheckFormat(WaveFile *file, size_t datalength)
     return 0;
 }
 
+/* Finds the fmt and data chunks, reads the format and initializes the decoder.
+ * On success, file->chunk describes the data chunk without any of its data
+ * read and endposition is set to where the WAVE file ends in src.
+ *
+ * With clampdata set, the length passed to the decoder initialization is
+ * limited to what src can actually provide, for callers that never read the
+ * whole data chunk up front to find out.
+ */
 static int
-WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
+WaveLoadHeaders(SDL_RWops *src, WaveFile *file, Sint64 *endposition, SDL_bool clampdata)
 {
     int result;
     Uint32 chunkcount = 0;
@@ -1792,7 +1987,7 @@ WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf,
     char *envchunkcountlimit;
     Sint64 RIFFstart, RIFFend, lastchunkpos;
     SDL_bool RIFFlengthknown = SDL_FALSE;
-    WaveFormat *format = &file->format;
+    size_t datalength;
     WaveChunk *chunk = &file->chunk;
     WaveChunk RIFFchunk;
     WaveChunk fmtchunk;
@@ -1984,7 +2179,21 @@ WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf,
         return SDL_SetError("Could not read data of WAVE fmt chunk");
     } else if (WaveReadFormat(file) < 0) {
         return -1;
-    } else if (WaveCheckFormat(file, (size_t)datachunk.length) < 0) {
+    }
+
+    datalength = (size_t)datachunk.length;
+    if (clampdata) {
+        const Sint64 srcsize = SDL_RWsize(src);
+        if (srcsize >= 0 && srcsize - datachunk.position < (Sint64)datalength) {
+            /* I/O issues or corrupt file. */
+            if (file->trunchint == TruncVeryStrict || file->trunchint == TruncStrict) {
+                return SDL_SetError("Could not read data of WAVE data chunk");
+            }
+            datalength = srcsize > datachunk.position ? (size_t)(srcsize - datachunk.position) : 0;
+        }
+    }
+
+    if (WaveCheckFormat(file, datalength) < 0) {
         return -1;
     }
 
@@ -1997,9 +2206,79 @@ WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf,
 
     WaveFreeChunkData(chunk);
 
-    /* Process data chunk. */
     *chunk = datachunk;
 
+    /* Report the end position back to the caller. */
+    if (RIFFlengthknown) {
+        *endposition = RIFFend;
+    } else {
+        *endposition = lastchunkpos;
+    }
+
+    return 0;
+}
+
+/* Sets up the SDL_AudioSpec for the decoded data. All unsupported formats
+ * were filtered out by WaveCheckFormat.
+ */
+static int
+WaveSetupSpec(WaveFile *file, SDL_AudioSpec *spec)
+{
+    WaveFormat *format = &file->format;
+
+    SDL_zerop(spec);
+    spec->freq = format->frequency;
+    spec->channels = (Uint8)format->channels;
+    spec->samples = 4096;       /* Good default buffer size */
+
+    switch (format->encoding) {
+    case MS_ADPCM_CODE:
+    case IMA_ADPCM_CODE:
+    case ALAW_CODE:
+    case MULAW_CODE:
+        /* These can be easily stored in the byte order of the system. */
+        spec->format = AUDIO_S16SYS;
+        break;
+    case IEEE_FLOAT_CODE:
+        spec->format = AUDIO_F32LSB;
+        break;
+    case PCM_CODE:
+        switch (format->bitspersample) {
+        case 8:
+            spec->format = AUDIO_U8;
+            break;
+        case 16:
+            spec->format = AUDIO_S16LSB;
+            break;
+        case 24: /* Has been shifted to 32 bits. */
+        case 32:
+            spec->format = AUDIO_S32LSB;
+            break;
+        default:
+            /* Just in case something unexpected happened in the checks. */
+            return SDL_SetError("Unexpected %u-bit PCM data format", (unsigned int)format->bitspersample);
+        }
+        break;
+    }
+
+    spec->silence = SDL_SilenceValueForFormat(spec->format);
+
+    return 0;
+}
+
+static int
+WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
+{
+    int result;
+    Sint64 endposition;
+    WaveFormat *format = &file->format;
+    WaveChunk *chunk = &file->chunk;
+
+    if (WaveLoadHeaders(src, file, &endposition, SDL_FALSE) < 0) {
+        return -1;
+    }
+
+    /* Process data chunk. */
     if (chunk->length > 0) {
         result = WaveReadChunkData(src, chunk);
         if (result == -1) {
@@ -2043,52 +2322,12 @@ WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf,
         break;
     }
 
-    /* Setting up the SDL_AudioSpec. All unsupported formats were filtered out
-     * by checks earlier in this function.
-     */
-    SDL_zerop(spec);
-    spec->freq = format->frequency;
-    spec->channels = (Uint8)format->channels;
-    spec->samples = 4096;       /* Good default buffer size */
-
-    switch (format->encoding) {
-    case MS_ADPCM_CODE:
-    case IMA_ADPCM_CODE:
-    case ALAW_CODE:
-    case MULAW_CODE:
-        /* These can be easily stored in the byte order of the system. */
-        spec->format = AUDIO_S16SYS;
-        break;
-    case IEEE_FLOAT_CODE:
-        spec->format = AUDIO_F32LSB;
-        break;
-    case PCM_CODE:
-        switch (format->bitspersample) {
-        case 8:
-            spec->format = AUDIO_U8;
-            break;
-        case 16:
-            spec->format = AUDIO_S16LSB;
-            break;
-        case 24: /* Has been shifted to 32 bits. */
-        case 32:
-            spec->format = AUDIO_S32LSB;
-            break;
-        default:
-            /* Just in case something unexpected happened in the checks. */
-            return SDL_SetError("Unexpected %u-bit PCM data format", (unsigned int)format->bitspersample);
-        }
-        break;
+    if (WaveSetupSpec(file, spec) < 0) {
+        return -1;
     }
 
-    spec->silence = SDL_SilenceValueForFormat(spec->format);
-
     /* Report the end position back to the cleanup code. */
-    if (RIFFlengthknown) {
-        chunk->position = RIFFend;
-    } else {
-        chunk->position = lastchunkpos;
-    }
+    chunk->position = endposition;
 
     return 0;
 }
@@ -2122,6 +2361,7 @@ SDL_LoadWAV_RW(SDL_RWops *src, int freesrc, SDL_AudioSpec *spec, Uint8 **audio_b
     file.riffhint = WaveGetRiffSizeHint();
     file.trunchint = WaveGetTruncationHint();
     file.facthint = WaveGetFactChunkHint();
+    file.decodethreads = WaveGetDecodeThreadsHint();
 
     result = WaveLoad(src, &file, spec, audio_buf, audio_len);
     if (result < 0) {
@@ -2152,4 +2392,341 @@ SDL_FreeWAV(Uint8 *audio_buf)
     SDL_free(audio_buf);
 }
 
+/* Number of sample frames decoded at once for the formats without blocks. */
+#define WAVE_STREAM_FRAMES 4096
+
+struct _SDL_WAVStream
+{
+    SDL_RWops *src;
+    int freesrc;
+    WaveFile file;
+    Sint64 endposition;     /* Position after the WAVE file in src. */
+    Sint64 datastart;       /* Position of the data chunk data in src. */
+    size_t framesize;       /* Size of a decoded sample frame in bytes. */
+    size_t blockframes;     /* Number of sample frames decoded at once. */
+    size_t blocksize;       /* Size of the data for blockframes in src. */
+    Sint64 nextframe;       /* First sample frame after the decoded data. */
+    Uint8 *input;           /* ADPCM block. The other formats decode in output. */
+    Uint8 *output;          /* Decoded sample frames. */
+    size_t outputsize;
+    size_t outputpos;
+    void *cstate;           /* ADPCM decoding state for each channel. */
+};
+
+static SDL_bool
+WaveIsADPCM(WaveFormat *format)
+{
+    return (format->encoding == MS_ADPCM_CODE || format->encoding == IMA_ADPCM_CODE) ? SDL_TRUE : SDL_FALSE;
+}
+
+/* Decodes the ADPCM block in stream->input with the decoders of the whole file
+ * path. Returns the number of sample frames decoded or -1 on error.
+ */
+static Sint64
+WAVStreamDecodeADPCMBlock(SDL_WAVStream *stream, size_t blocksize, Sint64 framesleft)
+{
+    WaveFile *file = &stream->file;
+    const SDL_bool msadpcm = file->format.encoding == MS_ADPCM_CODE ? SDL_TRUE : SDL_FALSE;
+    ADPCM_DecoderState state;
+    int result = -1;
+
+    SDL_zero(state);
+    state.channels = file->format.channels;
+    state.blocksize = file->format.blockalign;
+    state.blockheadersize = (size_t)state.channels * (msadpcm ? 7 : 4);
+    state.samplesperblock = file->format.samplesperblock;
+    state.framesize = state.channels * sizeof(Sint16);
+    state.ddata = file->decoderdata;
+    state.framestotal = file->sampleframes;
+    state.framesleft = framesleft;
+    state.cstate = stream->cstate;
+
+    state.block.data = stream->input;
+    state.block.size = blocksize;
+    state.block.pos = 0;
+
+    state.output.data = (Sint16 *)stream->output;
+    state.output.size = stream->blockframes * state.channels;
+    state.output.pos = 0;
+
+    if (blocksize >= state.blockheadersize) {
+        if (msadpcm) {
+            if (MS_ADPCM_DecodeBlockHeader(&state) == -1) {
+                return -1;
+            }
+            result = MS_ADPCM_DecodeBlockData(&state);
+        } else {
+            IMA_ADPCM_DecodeBlockHeader(&state);
+            result = IMA_ADPCM_DecodeBlockData(&state);
+        }
+    }
+
+    if (result == -1) {
+        /* Unexpected end. Return partial data if necessary. */
+        if (file->trunchint == TruncVeryStrict || file->trunchint == TruncStrict) {
+            return SDL_SetError("Truncated data chunk");
+        } else if (file->trunchint != TruncDropFrame) {
+            return 0;
+        }
+    }
+
+    /* The MS ADPCM block header always provides two sample frames. */
+    return SDL_min((Sint64)(state.output.pos / state.channels), framesleft);
+}
+
+/* Reads and decodes the block starting at stream->nextframe. Leaves an empty
+ * output at the end of the data.
+ */
+static int
+WAVStreamDecodeBlock(SDL_WAVStream *stream)
+{
+    WaveFile *file = &stream->file;
+    WaveFormat *format = &file->format;
+    const Sint64 framesleft = file->sampleframes - stream->nextframe;
+    size_t blocksize = stream->blocksize;
+    size_t readsize;
+    Sint64 position, frames;
+
+    stream->outputsize = 0;
+    stream->outputpos = 0;
+
+    if (framesleft <= 0) {
+        return 0;
+    }
+
+    if (WaveIsADPCM(format)) {
+        position = stream->datastart + stream->nextframe / stream->blockframes * format->blockalign;
+    } else {
+        position = stream->datastart + stream->nextframe * format->blockalign;
+        if (framesleft < (Sint64)stream->blockframes) {
+            blocksize = (size_t)framesleft * format->blockalign;
+        }
+    }
+
+    if (SDL_RWseek(stream->src, position, RW_SEEK_SET) != position) {
+        return SDL_SetError("Could not seek data of WAVE data chunk");
+    }
+
+    if (WaveIsADPCM(format)) {
+        readsize = SDL_RWread(stream->src, stream->input, 1, blocksize);
+        frames = WAVStreamDecodeADPCMBlock(stream, readsize, framesleft);
+        if (frames < 0) {
+            return -1;
+        }
+    } else {
+        readsize = SDL_RWread(stream->src, stream->output, 1, blocksize);
+        if (readsize != blocksize && (file->trunchint == TruncVeryStrict || file->trunchint == TruncStrict)) {
+            return SDL_SetError("Truncated data chunk");
+        }
+        frames = (Sint64)(readsize / format->blockalign);
+
+        /* Expand in-place like the whole file decoders. */
+        if (format->encoding == ALAW_CODE || format->encoding == MULAW_CODE) {
+            if (LAW_DecodeSamples(format->encoding, stream->output, (Sint16 *)stream->output, (size_t)frames * format->channels) < 0) {
+                return -1;
+            }
+        } else if (format->encoding == PCM_CODE && format->bitspersample == 24) {
+            PCM_ExpandSint24ToSint32(stream->output, (size_t)frames * format->channels);
+        }
+    }
+
+    if (readsize != blocksize) {
+        /* I/O issues or corrupt file. Nothing follows the partial data. */
+        file->sampleframes = stream->nextframe + frames;
+    }
+
+    stream->outputsize = (size_t)frames * stream->framesize;
+    stream->nextframe += frames;
+
+    return 0;
+}
+
+static void
+WAVStreamFree(SDL_WAVStream *stream)
+{
+    if (stream->freesrc) {
+        SDL_RWclose(stream->src);
+    } else {
+        SDL_RWseek(stream->src, stream->endposition, RW_SEEK_SET);
+    }
+    WaveFreeChunkData(&stream->file.chunk);
+    SDL_free(stream->file.decoderdata);
+    SDL_free(stream->input);
+    SDL_free(stream->output);
+    SDL_free(stream->cstate);
+    SDL_free(stream);
+}
+
+SDL_WAVStream *
+SDL_OpenWAVStream_RW(SDL_RWops *src, int freesrc, SDL_AudioSpec *spec)
+{
+    SDL_WAVStream *stream;
+    WaveFormat *format;
+    size_t outputsize;
+
+    /* Make sure we are passed a valid data source */
+    if (src == NULL) {
+        /* Error may come from RWops. */
+        return NULL;
+    } else if (spec == NULL) {
+        SDL_InvalidParamError("spec");
+        return NULL;
+    }
+
+    stream = (SDL_WAVStream *)SDL_calloc(1, sizeof(SDL_WAVStream));
+    if (stream == NULL) {
+        SDL_OutOfMemory();
+        if (freesrc) {
+            SDL_RWclose(src);
+        }
+        return NULL;
+    }
+
+    stream->src = src;
+    stream->freesrc = freesrc;
+    stream->file.riffhint = WaveGetRiffSizeHint();
+    stream->file.trunchint = WaveGetTruncationHint();
+    stream->file.facthint = WaveGetFactChunkHint();
+    format = &stream->file.format;
+
+    if (WaveLoadHeaders(src, &stream->file, &stream->endposition, SDL_TRUE) < 0 || WaveSetupSpec(&stream->file, spec) < 0) {
+        stream->endposition = stream->file.chunk.position;
+        WAVStreamFree(stream);
+        return NULL;
+    }
+
+    stream->datastart = stream->file.chunk.position;
+
+    if (WaveIsADPCM(format)) {
+        stream->framesize = (size_t)format->channels * sizeof(Sint16);
+        stream->blockframes = format->samplesperblock;
+        stream->blocksize = format->blockalign;
+        outputsize = stream->blockframes * stream->framesize;
+        stream->input = (Uint8 *)SDL_malloc(stream->blocksize);
+        /* Big enough for the state of either ADPCM decoder. */
+        stream->cstate = SDL_calloc(format->channels, sizeof(MS_ADPCM_ChannelState));
+        if (stream->input == NULL || stream->cstate == NULL) {
+            SDL_OutOfMemory();
+            WAVStreamFree(stream);
+            return NULL;
+        }
+    } else {
+        if (format->encoding == PCM_CODE && format->bitspersample == 24) {
+            stream->framesize = (size_t)format->channels * sizeof(Sint32);
+        } else if (format->encoding == ALAW_CODE || format->encoding == MULAW_CODE) {
+            stream->framesize = (size_t)format->channels * sizeof(Sint16);
+        } else {
+            stream->framesize = format->blockalign;
+        }
+        stream->blockframes = WAVE_STREAM_FRAMES;
+        stream->blocksize = stream->blockframes * format->blockalign;
+        outputsize = SDL_max(stream->blocksize, stream->blockframes * stream->framesize);
+    }
+
+    stream->output = (Uint8 *)SDL_malloc(outputsize);
+    if (stream->output == NULL) {
+        SDL_OutOfMemory();
+        WAVStreamFree(stream);
+        return NULL;
+    }
+
+    return stream;
+}
+
+int
+SDL_WAVStreamRead(SDL_WAVStream *stream, void *buf, int len)
+{
+    Uint8 *dst = (Uint8 *)buf;
+    int total = 0;
+
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (!buf) {
+        return SDL_InvalidParamError("buf");
+    } else if (len < 0) {
+        return SDL_InvalidParamError("len");
+    }
+
+    while (len > 0) {
+        size_t cpy = stream->outputsize - stream->outputpos;
+        if (cpy == 0) {
+            if (WAVStreamDecodeBlock(stream) < 0) {
+                return -1;
+            } else if (stream->outputsize == 0) {
+                break;  /* End of the data. */
+            }
+            cpy = stream->outputsize;
+        }
+
+        if (cpy > (size_t)len) {
+            cpy = (size_t)len;
+        }
+        SDL_memcpy(dst, stream->output + stream->outputpos, cpy);
+        stream->outputpos += cpy;
+        dst += cpy;
+        len -= (int)cpy;
+        total += (int)cpy;
+    }
+
+    return total;
+}
+
+int
+SDL_WAVStreamSeek(SDL_WAVStream *stream, Sint64 frame)
+{
+    Sint64 blockframe = frame;
+    size_t skip;
+
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (frame < 0 || frame > stream->file.sampleframes) {
+        return SDL_SetError("Seek position outside of the WAVE data");
+    }
+
+    /* ADPCM can only start decoding at the beginning of a block. */
+    if (WaveIsADPCM(&stream->file.format)) {
+        blockframe -= frame % stream->blockframes;
+    }
+
+    stream->nextframe = blockframe;
+    stream->outputsize = 0;
+    stream->outputpos = 0;
+
+    if (frame > blockframe) {
+        if (WAVStreamDecodeBlock(stream) < 0) {
+            return -1;
+        }
+        skip = (size_t)(frame - blockframe) * stream->framesize;
+        stream->outputpos = SDL_min(skip, stream->outputsize);
+    }
+
+    return 0;
+}
+
+Sint64
+SDL_WAVStreamTell(SDL_WAVStream *stream)
+{
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    }
+    return stream->nextframe - (Sint64)((stream->outputsize - stream->outputpos) / stream->framesize);
+}
+
+Sint64
+SDL_WAVStreamLength(SDL_WAVStream *stream)
+{
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    }
+    return stream->file.sampleframes;
+}
+
+void
+SDL_CloseWAVStream(SDL_WAVStream *stream)
+{
+    if (stream) {
+        WAVStreamFree(stream);
+    }
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
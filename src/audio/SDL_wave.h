@@ -144,6 +144,8 @@ typedef struct WaveFile
     WaveRiffSizeHint riffhint;
     WaveTruncationHint trunchint;
     WaveFactChunkHint facthint;
+
+    int decodethreads;   /* Maximum number of threads for decoding ADPCM blocks. */
 } WaveFile;
 
 /* vi: set ts=4 sw=4 expandtab: */
@@ -31,6 +31,7 @@
 #include "SDL_rwops.h"
 #include "SDL_timer.h"
 #include "SDL_audio.h"
+#include "SDL_hints.h"
 #include "../SDL_audio_c.h"
 #include "SDL_diskaudio.h"
 
@@ -42,19 +43,69 @@
 #define DISKDEFAULT_INFILE      "sdlaudio-in.raw"
 #define DISKENVR_IODELAY      "SDL_DISKAUDIODELAY"
 
+/* How often threads waiting on the app check whether to give up. */
+#define DISKAUDIO_POLL_MS     10
+
+static void
+DISKAUDIO_BeginLoopIteration(_THIS)
+{
+    struct SDL_PrivateAudioData *h = this->hidden;
+
+    if (h->timing == DISKAUDIO_TIMING_REALTIME) {
+        return;
+    } else if (h->timing == DISKAUDIO_TIMING_FAST) {
+        /* Time only passes for the file once the app starts the device, so
+           there's no silence in front of its audio. */
+        if (!h->started) {
+            while (SDL_AtomicGet(&this->paused) && !SDL_AtomicGet(&this->shutdown)) {
+                SDL_Delay(DISKAUDIO_POLL_MS);
+            }
+            h->started = SDL_TRUE;
+        }
+        return;
+    }
+
+    /* Done with the last buffer, the callback has seen all of it by now. */
+    if (h->granted) {
+        h->granted = SDL_FALSE;
+        SDL_SemPost(h->done);
+    }
+
+    /* Wait for the app to advance us. */
+    while (!SDL_AtomicGet(&this->shutdown)) {
+        if (SDL_SemWaitTimeout(h->ticks, DISKAUDIO_POLL_MS) == 0) {
+            h->granted = SDL_TRUE;
+            break;
+        }
+    }
+}
+
 /* This function waits until it is possible to write a full sound buffer */
 static void
 DISKAUDIO_WaitDevice(_THIS)
 {
-    SDL_Delay(this->hidden->io_delay);
+    if (this->hidden->io_delay) {
+        SDL_Delay(this->hidden->io_delay);
+    }
 }
 
 static void
 DISKAUDIO_PlayDevice(_THIS)
 {
-    const size_t written = SDL_RWwrite(this->hidden->io,
-                                       this->hidden->mixbuf,
-                                       1, this->spec.size);
+    size_t written;
+
+    /* Faster than realtime, leave out the buffer played while closing the
+       device, which the app never asked for, so the file is the same every
+       time. Closing pauses the device at the same time it shuts it down. */
+    if (this->hidden->timing != DISKAUDIO_TIMING_REALTIME) {
+        if (SDL_AtomicGet(&this->shutdown)) {
+            return;
+        } else if ((this->hidden->timing == DISKAUDIO_TIMING_MANUAL) && !this->hidden->granted) {
+            return;
+        }
+    }
+
+    written = SDL_RWwrite(this->hidden->io, this->hidden->mixbuf, 1, this->spec.size);
 
     /* If we couldn't write, assume fatal error for now */
     if (written != this->spec.size) {
@@ -77,9 +128,11 @@ DISKAUDIO_CaptureFromDevice(_THIS, void *buffer, int buflen)
     struct SDL_PrivateAudioData *h = this->hidden;
     const int origbuflen = buflen;
 
-    SDL_Delay(h->io_delay);
+    if (h->io_delay) {
+        SDL_Delay(h->io_delay);
+    }
 
-    if (h->io) {
+    if (h->io && ((h->timing != DISKAUDIO_TIMING_MANUAL) || h->granted)) {
         const size_t br = SDL_RWread(h->io, buffer, 1, buflen);
         buflen -= (int) br;
         buffer = ((Uint8 *) buffer) + br;
@@ -102,12 +155,44 @@ DISKAUDIO_FlushCapture(_THIS)
 }
 
 
+static int
+DISKAUDIO_AdvanceDevice(_THIS, int buffers)
+{
+    struct SDL_PrivateAudioData *h = this->hidden;
+    int i;
+
+    if (h->timing != DISKAUDIO_TIMING_MANUAL) {
+        return SDL_SetError("Disk audio device runs on its own clock, see SDL_HINT_AUDIO_DISK_TIMING");
+    }
+
+    for (i = 0; i < buffers; i++) {
+        SDL_SemPost(h->ticks);
+    }
+
+    for (i = 0; i < buffers; i++) {
+        while (SDL_SemWaitTimeout(h->done, DISKAUDIO_POLL_MS) != 0) {
+            if (!SDL_AtomicGet(&this->enabled)) {
+                return SDL_SetError("Disk audio device was lost");
+            }
+        }
+    }
+
+    return 0;
+}
+
+
 static void
 DISKAUDIO_CloseDevice(_THIS)
 {
     if (this->hidden->io != NULL) {
         SDL_RWclose(this->hidden->io);
     }
+    if (this->hidden->ticks != NULL) {
+        SDL_DestroySemaphore(this->hidden->ticks);
+    }
+    if (this->hidden->done != NULL) {
+        SDL_DestroySemaphore(this->hidden->done);
+    }
     SDL_free(this->hidden->mixbuf);
     SDL_free(this->hidden);
 }
@@ -125,12 +210,56 @@ get_filename(const int iscapture, const char *devname)
     return devname;
 }
 
+/* Takes the format, frequency and channels from SDL_HINT_AUDIO_DISK_SPEC
+   where it has them, so SDL converts to what the file holds. */
+static int
+DISKAUDIO_ChooseSpec(_THIS, const char *hint)
+{
+    const char *field = hint;
+    const char *comma = SDL_strchr(field, ',');
+    const size_t len = comma ? (size_t) (comma - field) : SDL_strlen(field);
+
+    if (len > 0) {
+        char name[16];
+        SDL_AudioFormat format = 0;
+        if (len < sizeof(name)) {
+            SDL_memcpy(name, field, len);
+            name[len] = '\0';
+            format = SDL_ParseAudioFormat(name);
+        }
+        if (!format) {
+            return SDL_SetError("Unknown audio format in %s: %s", SDL_HINT_AUDIO_DISK_SPEC, hint);
+        }
+        this->spec.format = format;
+    }
+
+    if (comma) {
+        field = comma + 1;
+        comma = SDL_strchr(field, ',');
+        if (*field && (*field != ',')) {
+            this->spec.freq = SDL_atoi(field);
+        }
+        if (comma && comma[1]) {
+            this->spec.channels = (Uint8) SDL_atoi(comma + 1);
+        }
+    }
+
+    if ((this->spec.freq <= 0) || (this->spec.channels == 0)) {
+        return SDL_SetError("Invalid %s: %s", SDL_HINT_AUDIO_DISK_SPEC, hint);
+    }
+
+    SDL_CalculateAudioSpec(&this->spec);
+    return 0;
+}
+
 static int
 DISKAUDIO_OpenDevice(_THIS, void *handle, const char *devname, int iscapture)
 {
     /* handle != NULL means "user specified the placeholder name on the fake detected device list" */
     const char *fname = get_filename(iscapture, handle ? NULL : devname);
     const char *envr = SDL_getenv(DISKENVR_IODELAY);
+    const char *timing = SDL_GetHint(SDL_HINT_AUDIO_DISK_TIMING);
+    const char *spec = SDL_GetHint(SDL_HINT_AUDIO_DISK_SPEC);
 
     this->hidden = (struct SDL_PrivateAudioData *)
         SDL_malloc(sizeof(*this->hidden));
@@ -139,12 +268,29 @@ DISKAUDIO_OpenDevice(_THIS, void *handle, const char *devname, int iscapture)
     }
     SDL_zerop(this->hidden);
 
+    if (spec && *spec && (DISKAUDIO_ChooseSpec(this, spec) < 0)) {
+        return -1;
+    }
+
     if (envr != NULL) {
         this->hidden->io_delay = SDL_atoi(envr);
     } else {
         this->hidden->io_delay = ((this->spec.samples * 1000) / this->spec.freq);
     }
 
+    if (timing && SDL_strcasecmp(timing, "fast") == 0) {
+        this->hidden->timing = DISKAUDIO_TIMING_FAST;
+        this->hidden->io_delay = 0;
+    } else if (timing && SDL_strcasecmp(timing, "manual") == 0) {
+        this->hidden->timing = DISKAUDIO_TIMING_MANUAL;
+        this->hidden->io_delay = 0;
+        this->hidden->ticks = SDL_CreateSemaphore(0);
+        this->hidden->done = SDL_CreateSemaphore(0);
+        if (!this->hidden->ticks || !this->hidden->done) {
+            return -1;
+        }
+    }
+
     /* Open the audio device */
     this->hidden->io = SDL_RWFromFile(fname, iscapture ? "rb" : "wb");
     if (this->hidden->io == NULL) {
@@ -182,11 +328,13 @@ DISKAUDIO_Init(SDL_AudioDriverImpl * impl)
 {
     /* Set the function pointers */
     impl->OpenDevice = DISKAUDIO_OpenDevice;
+    impl->BeginLoopIteration = DISKAUDIO_BeginLoopIteration;
     impl->WaitDevice = DISKAUDIO_WaitDevice;
     impl->PlayDevice = DISKAUDIO_PlayDevice;
     impl->GetDeviceBuf = DISKAUDIO_GetDeviceBuf;
     impl->CaptureFromDevice = DISKAUDIO_CaptureFromDevice;
     impl->FlushCapture = DISKAUDIO_FlushCapture;
+    impl->AdvanceDevice = DISKAUDIO_AdvanceDevice;
 
     impl->CloseDevice = DISKAUDIO_CloseDevice;
     impl->DetectDevices = DISKAUDIO_DetectDevices;
@@ -24,17 +24,35 @@
 #define SDL_diskaudio_h_
 
 #include "SDL_rwops.h"
+#include "SDL_mutex.h"
 #include "../SDL_sysaudio.h"
 
 /* Hidden "this" pointer for the audio functions */
 #define _THIS   SDL_AudioDevice *this
 
+/* How the device is paced, from SDL_HINT_AUDIO_DISK_TIMING. */
+typedef enum
+{
+    DISKAUDIO_TIMING_REALTIME,
+    DISKAUDIO_TIMING_FAST,
+    DISKAUDIO_TIMING_MANUAL
+} DiskAudioTiming;
+
 struct SDL_PrivateAudioData
 {
     /* The file descriptor for the audio device */
     SDL_RWops *io;
     Uint32 io_delay;
     Uint8 *mixbuf;
+    DiskAudioTiming timing;
+    SDL_bool started;
+
+    /* With DISKAUDIO_TIMING_MANUAL, SDL_AdvanceAudioDevice() posts a tick
+       for every buffer, and the device thread posts done when it's finished
+       with one. granted is set while it works on a buffer. */
+    SDL_sem *ticks;
+    SDL_sem *done;
+    SDL_bool granted;
 };
 
 #endif /* SDL_diskaudio_h_ */
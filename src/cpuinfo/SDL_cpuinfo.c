@@ -40,6 +40,9 @@
 
 #include "SDL_cpuinfo.h"
 #include "SDL_assert.h"
+#include "SDL_atomic.h"
+#include "SDL_hints.h"
+#include "SDL_cpuinfo_c.h"
 
 #ifdef HAVE_SYSCONF
 #include <unistd.h>
@@ -105,21 +108,6 @@
 #include <swis.h>
 #endif
 
-#define CPU_HAS_RDTSC   (1 << 0)
-#define CPU_HAS_ALTIVEC (1 << 1)
-#define CPU_HAS_MMX     (1 << 2)
-#define CPU_HAS_3DNOW   (1 << 3)
-#define CPU_HAS_SSE     (1 << 4)
-#define CPU_HAS_SSE2    (1 << 5)
-#define CPU_HAS_SSE3    (1 << 6)
-#define CPU_HAS_SSE41   (1 << 7)
-#define CPU_HAS_SSE42   (1 << 8)
-#define CPU_HAS_AVX     (1 << 9)
-#define CPU_HAS_AVX2    (1 << 10)
-#define CPU_HAS_NEON    (1 << 11)
-#define CPU_HAS_AVX512F (1 << 12)
-#define CPU_HAS_ARM_SIMD (1 << 13)
-
 #if SDL_ALTIVEC_BLITTERS && HAVE_SETJMP && !__MACOSX__ && !__OpenBSD__
 /* This is the brute force way of detecting instruction sets...
    the idea is borrowed from the libmpeg2 library - thanks!
@@ -814,6 +802,92 @@ SDL_GetCPUFeatures(void)
     return SDL_CPUFeatures;
 }
 
+#ifndef TEST_MAIN
+/* Features listed in SDL_HINT_CPU_DISABLE_FEATURES, parsed when the hint
+   changes. The hint is only watched on the main thread, since hints have no
+   lock, while the mask is read by whatever thread picks a SIMD path. */
+static SDL_atomic_t SDL_DisabledCPUFeatures;
+static SDL_atomic_t SDL_CPUFeaturesGeneration;
+static SDL_bool SDL_CPUFeaturesHintWatched = SDL_FALSE;
+
+static void SDLCALL
+SDL_CPUDisableFeaturesChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    static const struct {
+        const char *name;
+        Uint32 flag;
+    } features[] = {
+        { "altivec", CPU_HAS_ALTIVEC },
+        { "mmx", CPU_HAS_MMX },
+        { "3dnow", CPU_HAS_3DNOW },
+        { "sse", CPU_HAS_SSE },
+        { "sse2", CPU_HAS_SSE2 },
+        { "sse3", CPU_HAS_SSE3 },
+        { "sse41", CPU_HAS_SSE41 },
+        { "sse42", CPU_HAS_SSE42 },
+        { "avx", CPU_HAS_AVX },
+        { "avx2", CPU_HAS_AVX2 },
+        { "neon", CPU_HAS_NEON },
+        { "avx512f", CPU_HAS_AVX512F },
+        { "armsimd", CPU_HAS_ARM_SIMD },
+        { "all", ~CPU_HAS_RDTSC }
+    };
+    Uint32 disabled = 0;
+
+    while (hint && *hint) {
+        const char *end = SDL_strchr(hint, ',');
+        size_t len = end ? (size_t)(end - hint) : SDL_strlen(hint);
+        int i;
+
+        for (i = 0; i < SDL_arraysize(features); ++i) {
+            if (SDL_strlen(features[i].name) == len && SDL_strncasecmp(features[i].name, hint, len) == 0) {
+                disabled |= features[i].flag;
+                break;
+            }
+        }
+        hint = end ? end + 1 : NULL;
+    }
+
+    SDL_AtomicSet(&SDL_DisabledCPUFeatures, (int) disabled);
+    SDL_AtomicIncRef(&SDL_CPUFeaturesGeneration);
+}
+
+void
+SDL_InitCPUInfo(void)
+{
+    /* detect the features here, rather than on whichever thread asks first. */
+    SDL_GetCPUFeatures();
+
+    if (!SDL_CPUFeaturesHintWatched) {
+        /* this parses the current value right away. */
+        SDL_AddHintCallback(SDL_HINT_CPU_DISABLE_FEATURES, SDL_CPUDisableFeaturesChanged, NULL);
+        SDL_CPUFeaturesHintWatched = SDL_TRUE;
+    }
+}
+
+void
+SDL_QuitCPUInfo(void)
+{
+    /* SDL_ClearHints() dropped our callback along with the hint's value. */
+    SDL_CPUFeaturesHintWatched = SDL_FALSE;
+    SDL_AtomicSet(&SDL_DisabledCPUFeatures, 0);
+    SDL_AtomicIncRef(&SDL_CPUFeaturesGeneration);
+}
+
+SDL_bool
+SDL_CPUFeatureEnabled(Uint32 feature)
+{
+    const Uint32 disabled = (Uint32) SDL_AtomicGet(&SDL_DisabledCPUFeatures);
+    return (SDL_GetCPUFeatures() & ~disabled & feature) ? SDL_TRUE : SDL_FALSE;
+}
+
+int
+SDL_GetCPUFeaturesGeneration(void)
+{
+    return SDL_AtomicGet(&SDL_CPUFeaturesGeneration);
+}
+#endif /* !TEST_MAIN */
+
 #define CPU_FEATURE_AVAILABLE(f) ((SDL_GetCPUFeatures() & f) ? SDL_TRUE : SDL_FALSE)
 
 SDL_bool SDL_HasRDTSC(void)
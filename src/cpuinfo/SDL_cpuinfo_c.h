@@ -0,0 +1,62 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2020 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL_cpuinfo_c_h_
+#define SDL_cpuinfo_c_h_
+
+/* Useful functions and variables from SDL_cpuinfo.c */
+
+#include "SDL_cpuinfo.h"
+
+#define CPU_HAS_RDTSC   (1 << 0)
+#define CPU_HAS_ALTIVEC (1 << 1)
+#define CPU_HAS_MMX     (1 << 2)
+#define CPU_HAS_3DNOW   (1 << 3)
+#define CPU_HAS_SSE     (1 << 4)
+#define CPU_HAS_SSE2    (1 << 5)
+#define CPU_HAS_SSE3    (1 << 6)
+#define CPU_HAS_SSE41   (1 << 7)
+#define CPU_HAS_SSE42   (1 << 8)
+#define CPU_HAS_AVX     (1 << 9)
+#define CPU_HAS_AVX2    (1 << 10)
+#define CPU_HAS_NEON    (1 << 11)
+#define CPU_HAS_AVX512F (1 << 12)
+#define CPU_HAS_ARM_SIMD (1 << 13)
+
+/* Called by SDL_InitSubSystem() and SDL_Quit() on the main thread. While SDL
+   is initialized, SDL_HINT_CPU_DISABLE_FEATURES is watched. */
+extern void SDL_InitCPUInfo(void);
+extern void SDL_QuitCPUInfo(void);
+
+/* Whether SDL's own code may use one of the CPU_HAS_* features: the CPU has
+   it, and it isn't listed in SDL_HINT_CPU_DISABLE_FEATURES. The SDL_Has*()
+   functions only report what the CPU has. Safe to call from any thread. */
+extern SDL_bool SDL_CPUFeatureEnabled(Uint32 feature);
+
+/* Changes every time SDL_HINT_CPU_DISABLE_FEATURES changes what
+   SDL_CPUFeatureEnabled() reports. Code that picks a SIMD path once keeps
+   the generation it picked it in, and picks again when this no longer
+   matches. */
+extern int SDL_GetCPUFeaturesGeneration(void);
+
+#endif /* SDL_cpuinfo_c_h_ */
+
+/* vi: set ts=4 sw=4 expandtab: */
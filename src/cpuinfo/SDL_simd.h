@@ -0,0 +1,59 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2020 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#ifndef SDL_simd_h_
+#define SDL_simd_h_
+
+/* Which SIMD code paths can be compiled in, to be picked at runtime with
+   SDL_CPUFeatureEnabled(), see SDL_cpuinfo_c.h.
+
+   SSE2 and NEON code is only built when the compiler targets them already.
+   SSE4.1 and AVX2 code is built for any x86 target with a compiler that can
+   enable it for a single function, which SDL_TARGETING() does.
+ */
+
+#include "SDL_cpuinfo.h"
+
+#if defined(__GNUC__) || defined(__clang__)
+#define SDL_TARGETING(x) __attribute__((target(x)))
+#else
+#define SDL_TARGETING(x)
+#endif
+
+#if defined(__SSE2__)
+#define SDL_SSE2_INTRINSICS 1
+#endif
+
+#if defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H) && \
+    (defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)) && \
+    (defined(__clang__) || (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))) || \
+     (defined(_MSC_VER) && _MSC_VER >= 1700))
+#define SDL_AVX2_INTRINSICS 1
+#define SDL_SSE4_1_INTRINSICS 1
+#endif
+
+/* TODO: this didn't compile on Window10 universal package last time it was tried, see SDL_stretch.c */
+#if defined(__ARM_NEON) && !defined(__WINRT__)
+#define SDL_NEON_INTRINSICS 1
+#endif
+
+#endif /* SDL_simd_h_ */
+
+/* vi: set ts=4 sw=4 expandtab: */
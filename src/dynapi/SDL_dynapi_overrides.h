@@ -793,3 +793,22 @@
 #define SDL_lround SDL_lround_REAL
 #define SDL_lroundf SDL_lroundf_REAL
 #define SDL_SoftStretchLinear SDL_SoftStretchLinear_REAL
+#define SDL_PollEvents SDL_PollEvents_REAL
+#define SDL_GetNumCoalescedEvents SDL_GetNumCoalescedEvents_REAL
+#define SDL_AudioStreamSetResampleQuality SDL_AudioStreamSetResampleQuality_REAL
+#define SDL_NewAudioMixer SDL_NewAudioMixer_REAL
+#define SDL_AudioMixerNewStream SDL_AudioMixerNewStream_REAL
+#define SDL_AudioMixerSetGain SDL_AudioMixerSetGain_REAL
+#define SDL_AudioMixerFreeStream SDL_AudioMixerFreeStream_REAL
+#define SDL_AudioMixerGet SDL_AudioMixerGet_REAL
+#define SDL_AudioMixerCallback SDL_AudioMixerCallback_REAL
+#define SDL_FreeAudioMixer SDL_FreeAudioMixer_REAL
+#define SDL_OpenWAVStream_RW SDL_OpenWAVStream_RW_REAL
+#define SDL_WAVStreamRead SDL_WAVStreamRead_REAL
+#define SDL_WAVStreamSeek SDL_WAVStreamSeek_REAL
+#define SDL_WAVStreamTell SDL_WAVStreamTell_REAL
+#define SDL_WAVStreamLength SDL_WAVStreamLength_REAL
+#define SDL_CloseWAVStream SDL_CloseWAVStream_REAL
+#define SDL_GetAudioDeviceStats SDL_GetAudioDeviceStats_REAL
+#define SDL_ResetAudioDeviceStats SDL_ResetAudioDeviceStats_REAL
+#define SDL_AdvanceAudioDevice SDL_AdvanceAudioDevice_REAL
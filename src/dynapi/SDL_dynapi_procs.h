@@ -854,3 +854,22 @@ SDL_DYNAPI_PROC(float,SDL_roundf,(float a),(a),return)
 SDL_DYNAPI_PROC(long,SDL_lround,(double a),(a),return)
 SDL_DYNAPI_PROC(long,SDL_lroundf,(float a),(a),return)
 SDL_DYNAPI_PROC(int,SDL_SoftStretchLinear,(SDL_Surface *a, const SDL_Rect *b, SDL_Surface *c, const SDL_Rect *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(int,SDL_PollEvents,(SDL_Event *a, int b, SDL_bool c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_GetNumCoalescedEvents,(void),(),return)
+SDL_DYNAPI_PROC(int,SDL_AudioStreamSetResampleQuality,(SDL_AudioStream *a, SDL_AudioResampleQuality b),(a,b),return)
+SDL_DYNAPI_PROC(SDL_AudioMixer*,SDL_NewAudioMixer,(const SDL_AudioFormat a, const Uint8 b, const int c),(a,b,c),return)
+SDL_DYNAPI_PROC(SDL_AudioStream*,SDL_AudioMixerNewStream,(SDL_AudioMixer *a, const SDL_AudioFormat b, const Uint8 c, const int d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(int,SDL_AudioMixerSetGain,(SDL_AudioMixer *a, SDL_AudioStream *b, float c),(a,b,c),return)
+SDL_DYNAPI_PROC(void,SDL_AudioMixerFreeStream,(SDL_AudioMixer *a, SDL_AudioStream *b),(a,b),)
+SDL_DYNAPI_PROC(int,SDL_AudioMixerGet,(SDL_AudioMixer *a, void *b, int c),(a,b,c),return)
+SDL_DYNAPI_PROC(void,SDL_AudioMixerCallback,(void *a, Uint8 *b, int c),(a,b,c),)
+SDL_DYNAPI_PROC(void,SDL_FreeAudioMixer,(SDL_AudioMixer *a),(a),)
+SDL_DYNAPI_PROC(SDL_WAVStream*,SDL_OpenWAVStream_RW,(SDL_RWops *a, int b, SDL_AudioSpec *c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_WAVStreamRead,(SDL_WAVStream *a, void *b, int c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_WAVStreamSeek,(SDL_WAVStream *a, Sint64 b),(a,b),return)
+SDL_DYNAPI_PROC(Sint64,SDL_WAVStreamTell,(SDL_WAVStream *a),(a),return)
+SDL_DYNAPI_PROC(Sint64,SDL_WAVStreamLength,(SDL_WAVStream *a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_CloseWAVStream,(SDL_WAVStream *a),(a),)
+SDL_DYNAPI_PROC(int,SDL_GetAudioDeviceStats,(SDL_AudioDeviceID a, SDL_AudioDeviceStats *b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_ResetAudioDeviceStats,(SDL_AudioDeviceID a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_AdvanceAudioDevice,(SDL_AudioDeviceID a, int b),(a,b),return)
@@ -26,6 +26,7 @@
 #include "SDL_events.h"
 #include "SDL_thread.h"
 #include "SDL_events_c.h"
+#include "../SDL_hints_c.h"
 #include "../timer/SDL_timer_c.h"
 #if !SDL_JOYSTICK_DISABLED
 #include "../joystick/SDL_joystick_c.h"
@@ -82,14 +83,111 @@ static struct
 {
     SDL_mutex *lock;
     SDL_atomic_t active;
-    SDL_atomic_t count;
+    SDL_atomic_t count;     /* events in the list and the ring */
+    SDL_atomic_t listed;    /* events in the list */
+    SDL_atomic_t coalesced; /* motion events merged into the list tail */
     int max_events_seen;
     SDL_EventEntry *head;
     SDL_EventEntry *tail;
     SDL_EventEntry *free;
     SDL_SysWMEntry *wmmsg_used;
     SDL_SysWMEntry *wmmsg_free;
-} SDL_EventQ = { NULL, { 1 }, { 0 }, 0, NULL, NULL, NULL, NULL, NULL };
+} SDL_EventQ = { NULL, { 1 }, { 0 }, { 0 }, { 0 }, 0, NULL, NULL, NULL, NULL, NULL };
+
+/* Bounded lock-free ring used by SDL_PushEvent() and SDL_PollEvent().
+
+   Any thread can push without taking SDL_EventQ.lock or allocating memory.
+   Only one thread at a time pops, while holding SDL_EventRing.lock.
+
+   Events that don't fit in the ring (it's full, it's an SDL_SYSWMEVENT
+   that needs its message copied, or it's motion that may be merged into
+   the previous event) are appended to the SDL_EventQ list
+   instead, after moving everything out of the ring, so the list always
+   holds events older than the ones in the ring. Anything that needs to look
+   at the whole queue (peeking, type ranges, filtering) takes the queue lock
+   and moves the ring into the list first.
+
+   Each slot's sequence counts laps around the ring: it is the lap base when
+   the slot is free to write, lap base + 1 once an event has been published
+   in it, and the next lap base after that event has been consumed.
+ */
+#define SDL_EVENT_RING_SIZE 1024    /* must be a power of two */
+#define SDL_EVENT_RING_MASK (SDL_EVENT_RING_SIZE - 1)
+
+typedef struct
+{
+    SDL_atomic_t sequence;
+    SDL_Event event;
+} SDL_EventRingSlot;
+
+static struct
+{
+    SDL_bool enabled;
+
+    /* Data used by the producers */
+    SDL_atomic_t enqueue_pos;
+
+    /* Padding to separate cache lines between threads */
+    char cache_pad[SDL_CACHELINE_SIZE];
+
+    /* Data used by the consumer */
+    SDL_SpinLock lock;
+    Uint32 dequeue_pos;
+
+    char cache_pad2[SDL_CACHELINE_SIZE];
+
+    SDL_EventRingSlot slots[SDL_EVENT_RING_SIZE];
+} SDL_EventRing;
+
+/* Publish an event in the ring, returns 0 if the ring is full */
+static int
+SDL_PushEventRing(const SDL_Event * event)
+{
+    SDL_EventRingSlot *slot;
+    Uint32 pos = (Uint32)SDL_AtomicGet(&SDL_EventRing.enqueue_pos);
+    Uint32 lap;
+    Sint32 diff;
+
+    for ( ; ; ) {
+        lap = (pos & ~SDL_EVENT_RING_MASK);
+        slot = &SDL_EventRing.slots[pos & SDL_EVENT_RING_MASK];
+        diff = (Sint32)((Uint32)SDL_AtomicGet(&slot->sequence) - lap);
+        if (diff == 0) {
+            if (SDL_AtomicCAS(&SDL_EventRing.enqueue_pos, (int)pos, (int)(pos + 1))) {
+                break;
+            }
+        } else if (diff < 0) {
+            /* The slot still holds an event from the previous lap */
+            return 0;
+        }
+        pos = (Uint32)SDL_AtomicGet(&SDL_EventRing.enqueue_pos);
+    }
+
+    slot->event = *event;
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicSet(&slot->sequence, (int)(lap + 1));
+    return 1;
+}
+
+/* Take the oldest event out of the ring -- called with the ring locked */
+static int
+SDL_PopEventRing(SDL_Event * event)
+{
+    const Uint32 pos = SDL_EventRing.dequeue_pos;
+    const Uint32 lap = (pos & ~SDL_EVENT_RING_MASK);
+    SDL_EventRingSlot *slot = &SDL_EventRing.slots[pos & SDL_EVENT_RING_MASK];
+
+    if ((Uint32)SDL_AtomicGet(&slot->sequence) != (lap + 1)) {
+        /* Empty, or the producer hasn't finished writing the event yet */
+        return 0;
+    }
+    SDL_MemoryBarrierAcquire();
+
+    *event = slot->event;
+    SDL_AtomicSet(&slot->sequence, (int)(lap + SDL_EVENT_RING_SIZE));
+    SDL_EventRing.dequeue_pos = pos + 1;
+    return 1;
+}
 
 
 #if !SDL_JOYSTICK_DISABLED
@@ -149,6 +247,14 @@ SDL_EventLoggingChanged(void *userdata, const char *name, const char *oldValue,
     SDL_DoEventLogging = (hint && *hint) ? SDL_max(SDL_min(SDL_atoi(hint), 2), 0) : 0;
 }
 
+static SDL_bool SDL_CoalesceMotion = SDL_FALSE;
+
+static void SDLCALL
+SDL_CoalesceMotionChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    SDL_CoalesceMotion = SDL_GetStringBoolean(hint, SDL_FALSE);
+}
+
 static void
 SDL_LogEvent(const SDL_Event *event)
 {
@@ -398,6 +504,7 @@ SDL_StopEventLoop(void)
     int i;
     SDL_EventEntry *entry;
     SDL_SysWMEntry *wmmsg;
+    SDL_Event event;
 
     if (SDL_EventQ.lock) {
         SDL_LockMutex(SDL_EventQ.lock);
@@ -408,9 +515,17 @@ SDL_StopEventLoop(void)
     if (report && SDL_atoi(report)) {
         SDL_Log("SDL EVENT QUEUE: Maximum events in-flight: %d\n",
                 SDL_EventQ.max_events_seen);
+        SDL_Log("SDL EVENT QUEUE: Coalesced motion events: %d\n",
+                SDL_AtomicGet(&SDL_EventQ.coalesced));
     }
 
     /* Clean out EventQ */
+    SDL_AtomicLock(&SDL_EventRing.lock);
+    while (SDL_PopEventRing(&event)) {
+        continue;
+    }
+    SDL_AtomicUnlock(&SDL_EventRing.lock);
+
     for (entry = SDL_EventQ.head; entry; ) {
         SDL_EventEntry *next = entry->next;
         SDL_free(entry);
@@ -433,6 +548,8 @@ SDL_StopEventLoop(void)
     }
 
     SDL_AtomicSet(&SDL_EventQ.count, 0);
+    SDL_AtomicSet(&SDL_EventQ.listed, 0);
+    SDL_AtomicSet(&SDL_EventQ.coalesced, 0);
     SDL_EventQ.max_events_seen = 0;
     SDL_EventQ.head = NULL;
     SDL_EventQ.tail = NULL;
@@ -500,24 +617,28 @@ SDL_StartEventLoop(void)
     SDL_EventState(SDL_DROPTEXT, SDL_DISABLE);
 #endif
 
+    SDL_EventRing.enabled = SDL_GetHintBoolean(SDL_HINT_EVENT_QUEUE_LOCKFREE, SDL_TRUE);
+
     SDL_AtomicSet(&SDL_EventQ.active, 1);
 
     return 0;
 }
 
 
-/* Add an event to the event queue -- called with the queue locked */
+/* Note the high water mark of the queue, this is only for statistics */
+static void
+SDL_UpdateMaxEventsSeen(int count)
+{
+    if (count > SDL_EventQ.max_events_seen) {
+        SDL_EventQ.max_events_seen = count;
+    }
+}
+
+/* Append an event to the list -- called with the queue and the ring locked */
 static int
-SDL_AddEvent(SDL_Event * event)
+SDL_AppendEvent(const SDL_Event * event)
 {
     SDL_EventEntry *entry;
-    const int initial_count = SDL_AtomicGet(&SDL_EventQ.count);
-    int final_count;
-
-    if (initial_count >= SDL_MAX_QUEUED_EVENTS) {
-        SDL_SetError("Event queue is full (%d events)", initial_count);
-        return 0;
-    }
 
     if (SDL_EventQ.free == NULL) {
         entry = (SDL_EventEntry *)SDL_malloc(sizeof(*entry));
@@ -529,10 +650,6 @@ SDL_AddEvent(SDL_Event * event)
         SDL_EventQ.free = entry->next;
     }
 
-    if (SDL_DoEventLogging) {
-        SDL_LogEvent(event);
-    }
-
     entry->event = *event;
     if (event->type == SDL_SYSWMEVENT) {
         entry->msg = *event->syswm.msg;
@@ -552,10 +669,152 @@ SDL_AddEvent(SDL_Event * event)
         entry->next = NULL;
     }
 
-    final_count = SDL_AtomicAdd(&SDL_EventQ.count, 1) + 1;
-    if (final_count > SDL_EventQ.max_events_seen) {
-        SDL_EventQ.max_events_seen = final_count;
+    SDL_AtomicAdd(&SDL_EventQ.listed, 1);
+
+    return 1;
+}
+
+/* Move the contents of the ring to the end of the list -- called with the queue and the ring locked.
+
+   This stops at the first slot that has been claimed by a producer that
+   hasn't finished writing it yet, unless wait is set, in which case every
+   slot claimed before this call is moved to the list. Producers need that
+   before appending to the list, so their own earlier events stay in front.
+ */
+static void
+SDL_MoveEventRingToList(SDL_bool wait)
+{
+    const Uint32 end = (Uint32)SDL_AtomicGet(&SDL_EventRing.enqueue_pos);
+    SDL_Event event;
+
+    for ( ; ; ) {
+        if (SDL_PopEventRing(&event)) {
+            if (!SDL_AppendEvent(&event)) {
+                /* Out of memory, drop it */
+                SDL_AtomicAdd(&SDL_EventQ.count, -1);
+            }
+        } else if (wait && (Sint32)(end - SDL_EventRing.dequeue_pos) > 0) {
+            /* Let the producer finish writing its event */
+            SDL_AtomicUnlock(&SDL_EventRing.lock);
+            SDL_Delay(0);
+            SDL_AtomicLock(&SDL_EventRing.lock);
+        } else {
+            break;
+        }
     }
+}
+
+/* Move the contents of the ring to the end of the list -- called with the queue locked */
+static void
+SDL_DrainEventRing(void)
+{
+    SDL_AtomicLock(&SDL_EventRing.lock);
+    SDL_MoveEventRingToList(SDL_FALSE);
+    SDL_AtomicUnlock(&SDL_EventRing.lock);
+}
+
+/* Merge a motion event into the event at the end of the list, if it's
+   motion for the same window and device -- called with the queue and the ring locked.
+ */
+static SDL_bool
+SDL_CoalesceEvent(const SDL_Event * event)
+{
+    SDL_Event *last;
+
+    if (!SDL_EventQ.tail) {
+        return SDL_FALSE;
+    }
+
+    last = &SDL_EventQ.tail->event;
+    if (last->type != event->type) {
+        return SDL_FALSE;
+    }
+
+    switch (event->type) {
+    case SDL_MOUSEMOTION:
+        if (last->motion.windowID != event->motion.windowID ||
+            last->motion.which != event->motion.which ||
+            last->motion.state != event->motion.state) {
+            return SDL_FALSE;
+        }
+        last->motion.timestamp = event->motion.timestamp;
+        last->motion.x = event->motion.x;
+        last->motion.y = event->motion.y;
+        last->motion.xrel += event->motion.xrel;
+        last->motion.yrel += event->motion.yrel;
+        break;
+    case SDL_FINGERMOTION:
+        if (last->tfinger.windowID != event->tfinger.windowID ||
+            last->tfinger.touchId != event->tfinger.touchId ||
+            last->tfinger.fingerId != event->tfinger.fingerId) {
+            return SDL_FALSE;
+        }
+        last->tfinger.timestamp = event->tfinger.timestamp;
+        last->tfinger.x = event->tfinger.x;
+        last->tfinger.y = event->tfinger.y;
+        last->tfinger.dx += event->tfinger.dx;
+        last->tfinger.dy += event->tfinger.dy;
+        last->tfinger.pressure = event->tfinger.pressure;
+        break;
+    default:
+        return SDL_FALSE;
+    }
+
+    SDL_AtomicAdd(&SDL_EventQ.coalesced, 1);
+    return SDL_TRUE;
+}
+
+/* Add an event to the event queue, this doesn't need the queue lock
+   unless the event can't go in the ring, in which case it is taken here.
+ */
+static int
+SDL_AddEvent(SDL_Event * event)
+{
+    const int initial_count = SDL_AtomicAdd(&SDL_EventQ.count, 1);
+    /* Motion is merged into the end of the list, so it needs the lock */
+    const SDL_bool coalesce = SDL_CoalesceMotion &&
+        (event->type == SDL_MOUSEMOTION || event->type == SDL_FINGERMOTION);
+    SDL_bool coalesced = SDL_FALSE;
+    int added = 0;
+
+    /* The slot is reserved before the event is published, so the count
+       never drops below the number of events actually queued. */
+    if (initial_count >= SDL_MAX_QUEUED_EVENTS) {
+        SDL_AtomicAdd(&SDL_EventQ.count, -1);
+        SDL_SetError("Event queue is full (%d events)", initial_count);
+        return 0;
+    }
+
+    if (SDL_DoEventLogging) {
+        SDL_LogEvent(event);
+    }
+
+    if (SDL_EventRing.enabled && event->type != SDL_SYSWMEVENT && !coalesce) {
+        added = SDL_PushEventRing(event);
+    }
+
+    if (!added) {
+        if (!SDL_EventQ.lock || SDL_LockMutex(SDL_EventQ.lock) == 0) {
+            SDL_AtomicLock(&SDL_EventRing.lock);
+            SDL_MoveEventRingToList(SDL_TRUE);
+            if (coalesce && SDL_CoalesceEvent(event)) {
+                coalesced = SDL_TRUE;
+                added = 1;
+            } else {
+                added = SDL_AppendEvent(event);
+            }
+            SDL_AtomicUnlock(&SDL_EventRing.lock);
+            if (SDL_EventQ.lock) {
+                SDL_UnlockMutex(SDL_EventQ.lock);
+            }
+        }
+        if (!added || coalesced) {
+            SDL_AtomicAdd(&SDL_EventQ.count, -1);
+            return added;
+        }
+    }
+
+    SDL_UpdateMaxEventsSeen(initial_count + 1);
 
     return 1;
 }
@@ -583,15 +842,47 @@ SDL_CutEvent(SDL_EventEntry *entry)
     entry->next = SDL_EventQ.free;
     SDL_EventQ.free = entry;
     SDL_assert(SDL_AtomicGet(&SDL_EventQ.count) > 0);
+    SDL_AtomicAdd(&SDL_EventQ.listed, -1);
     SDL_AtomicAdd(&SDL_EventQ.count, -1);
 }
 
+/* Get events straight out of the ring without taking the queue lock.
+   This only works while the list is empty, since it holds older events,
+   returns -1 if the caller needs to go through the list instead.
+ */
+static int
+SDL_GetEventsFromRing(SDL_Event * events, int numevents)
+{
+    int used = 0;
+
+    if (SDL_AtomicGet(&SDL_EventQ.listed) != 0) {
+        return -1;
+    }
+
+    SDL_AtomicLock(&SDL_EventRing.lock);
+    /* Nothing is added to the list without holding the ring lock */
+    if (SDL_AtomicGet(&SDL_EventQ.listed) != 0) {
+        used = -1;
+    } else {
+        while (used < numevents && SDL_PopEventRing(&events[used])) {
+            ++used;
+        }
+    }
+    SDL_AtomicUnlock(&SDL_EventRing.lock);
+
+    if (used > 0) {
+        SDL_AtomicAdd(&SDL_EventQ.count, -used);
+    }
+    return used;
+}
+
 /* Lock the event queue, take a peep at it, and unlock it */
 int
 SDL_PeepEvents(SDL_Event * events, int numevents, SDL_eventaction action,
                Uint32 minType, Uint32 maxType)
 {
     int i, used;
+    SDL_bool get_all;
 
     /* Don't look after we've quit */
     if (!SDL_AtomicGet(&SDL_EventQ.active)) {
@@ -601,59 +892,83 @@ SDL_PeepEvents(SDL_Event * events, int numevents, SDL_eventaction action,
         }
         return (-1);
     }
+    if (action == SDL_ADDEVENT) {
+        used = 0;
+        for (i = 0; i < numevents; ++i) {
+            used += SDL_AddEvent(&events[i]);
+        }
+        return (used);
+    }
+
+    /* Fast path for getting any event, this is what SDL_PollEvent() does */
+    get_all = (action == SDL_GETEVENT && events &&
+               minType <= SDL_FIRSTEVENT && maxType >= SDL_LASTEVENT);
+    if (get_all && numevents > 0) {
+        used = SDL_GetEventsFromRing(events, numevents);
+        if (used >= 0) {
+            return (used);
+        }
+    }
+
     /* Lock the event queue */
     used = 0;
     if (!SDL_EventQ.lock || SDL_LockMutex(SDL_EventQ.lock) == 0) {
-        if (action == SDL_ADDEVENT) {
-            for (i = 0; i < numevents; ++i) {
-                used += SDL_AddEvent(&events[i]);
-            }
-        } else {
-            SDL_EventEntry *entry, *next;
-            SDL_SysWMEntry *wmmsg, *wmmsg_next;
-            Uint32 type;
-
-            if (action == SDL_GETEVENT) {
-                /* Clean out any used wmmsg data
-                   FIXME: Do we want to retain the data for some period of time?
-                 */
-                for (wmmsg = SDL_EventQ.wmmsg_used; wmmsg; wmmsg = wmmsg_next) {
-                    wmmsg_next = wmmsg->next;
-                    wmmsg->next = SDL_EventQ.wmmsg_free;
-                    SDL_EventQ.wmmsg_free = wmmsg;
-                }
-                SDL_EventQ.wmmsg_used = NULL;
+        SDL_EventEntry *entry, *next;
+        SDL_SysWMEntry *wmmsg, *wmmsg_next;
+        Uint32 type;
+
+        /* When taking everything, the list is emptied first and the rest
+           comes straight from the ring, otherwise the whole queue is needed. */
+        if (!get_all) {
+            SDL_DrainEventRing();
+        }
+
+        if (action == SDL_GETEVENT) {
+            /* Clean out any used wmmsg data
+               FIXME: Do we want to retain the data for some period of time?
+             */
+            for (wmmsg = SDL_EventQ.wmmsg_used; wmmsg; wmmsg = wmmsg_next) {
+                wmmsg_next = wmmsg->next;
+                wmmsg->next = SDL_EventQ.wmmsg_free;
+                SDL_EventQ.wmmsg_free = wmmsg;
             }
+            SDL_EventQ.wmmsg_used = NULL;
+        }
 
-            for (entry = SDL_EventQ.head; entry && (!events || used < numevents); entry = next) {
-                next = entry->next;
-                type = entry->event.type;
-                if (minType <= type && type <= maxType) {
-                    if (events) {
-                        events[used] = entry->event;
-                        if (entry->event.type == SDL_SYSWMEVENT) {
-                            /* We need to copy the wmmsg somewhere safe.
-                               For now we'll guarantee it's valid at least until
-                               the next call to SDL_PeepEvents()
-                             */
-                            if (SDL_EventQ.wmmsg_free) {
-                                wmmsg = SDL_EventQ.wmmsg_free;
-                                SDL_EventQ.wmmsg_free = wmmsg->next;
-                            } else {
-                                wmmsg = (SDL_SysWMEntry *)SDL_malloc(sizeof(*wmmsg));
-                            }
-                            wmmsg->msg = *entry->event.syswm.msg;
-                            wmmsg->next = SDL_EventQ.wmmsg_used;
-                            SDL_EventQ.wmmsg_used = wmmsg;
-                            events[used].syswm.msg = &wmmsg->msg;
+        for (entry = SDL_EventQ.head; entry && (!events || used < numevents); entry = next) {
+            next = entry->next;
+            type = entry->event.type;
+            if (minType <= type && type <= maxType) {
+                if (events) {
+                    events[used] = entry->event;
+                    if (entry->event.type == SDL_SYSWMEVENT) {
+                        /* We need to copy the wmmsg somewhere safe.
+                           For now we'll guarantee it's valid at least until
+                           the next call to SDL_PeepEvents()
+                         */
+                        if (SDL_EventQ.wmmsg_free) {
+                            wmmsg = SDL_EventQ.wmmsg_free;
+                            SDL_EventQ.wmmsg_free = wmmsg->next;
+                        } else {
+                            wmmsg = (SDL_SysWMEntry *)SDL_malloc(sizeof(*wmmsg));
                         }
+                        wmmsg->msg = *entry->event.syswm.msg;
+                        wmmsg->next = SDL_EventQ.wmmsg_used;
+                        SDL_EventQ.wmmsg_used = wmmsg;
+                        events[used].syswm.msg = &wmmsg->msg;
+                    }
 
-                        if (action == SDL_GETEVENT) {
-                            SDL_CutEvent(entry);
-                        }
+                    if (action == SDL_GETEVENT) {
+                        SDL_CutEvent(entry);
                     }
-                    ++used;
                 }
+                ++used;
+            }
+        }
+        if (get_all && used < numevents) {
+            const int popped = SDL_GetEventsFromRing(&events[used], numevents - used);
+            if (popped > 0) {
+                used += popped;
             }
         }
         if (SDL_EventQ.lock) {
@@ -707,6 +1022,8 @@ SDL_FlushEvents(Uint32 minType, Uint32 maxType)
     if (!SDL_EventQ.lock || SDL_LockMutex(SDL_EventQ.lock) == 0) {
         SDL_EventEntry *entry, *next;
         Uint32 type;
+
+        SDL_DrainEventRing();
         for (entry = SDL_EventQ.head; entry; entry = next) {
             next = entry->next;
             type = entry->event.type;
@@ -759,6 +1076,28 @@ SDL_PollEvent(SDL_Event * event)
     return SDL_WaitEventTimeout(event, 0);
 }
 
+int
+SDL_GetNumCoalescedEvents(void)
+{
+    return SDL_AtomicGet(&SDL_EventQ.coalesced);
+}
+
+int
+SDL_PollEvents(SDL_Event * events, int numevents, SDL_bool pump)
+{
+    if (!events) {
+        return SDL_InvalidParamError("events");
+    }
+    if (numevents <= 0) {
+        return 0;
+    }
+
+    if (pump) {
+        SDL_PumpEvents();
+    }
+    return SDL_PeepEvents(events, numevents, SDL_GETEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT);
+}
+
 int
 SDL_WaitEvent(SDL_Event * event)
 {
@@ -945,6 +1284,8 @@ SDL_FilterEvents(SDL_EventFilter filter, void *userdata)
 {
     if (!SDL_EventQ.lock || SDL_LockMutex(SDL_EventQ.lock) == 0) {
         SDL_EventEntry *entry, *next;
+
+        SDL_DrainEventRing();
         for (entry = SDL_EventQ.head; entry; entry = next) {
             next = entry->next;
             if (!filter(userdata, &entry->event)) {
@@ -1084,7 +1425,9 @@ SDL_EventsInit(void)
     SDL_AddHintCallback(SDL_HINT_AUTO_UPDATE_SENSORS, SDL_AutoUpdateSensorsChanged, NULL);
 #endif
     SDL_AddHintCallback(SDL_HINT_EVENT_LOGGING, SDL_EventLoggingChanged, NULL);
+    SDL_AddHintCallback(SDL_HINT_EVENT_COALESCE_MOTION, SDL_CoalesceMotionChanged, NULL);
     if (SDL_StartEventLoop() < 0) {
+        SDL_DelHintCallback(SDL_HINT_EVENT_COALESCE_MOTION, SDL_CoalesceMotionChanged, NULL);
         SDL_DelHintCallback(SDL_HINT_EVENT_LOGGING, SDL_EventLoggingChanged, NULL);
         return -1;
     }
@@ -1099,6 +1442,7 @@ SDL_EventsQuit(void)
 {
     SDL_QuitQuit();
     SDL_StopEventLoop();
+    SDL_DelHintCallback(SDL_HINT_EVENT_COALESCE_MOTION, SDL_CoalesceMotionChanged, NULL);
     SDL_DelHintCallback(SDL_HINT_EVENT_LOGGING, SDL_EventLoggingChanged, NULL);
 #if !SDL_JOYSTICK_DISABLED
     SDL_DelHintCallback(SDL_HINT_AUTO_UPDATE_JOYSTICKS, SDL_AutoUpdateJoysticksChanged, NULL);
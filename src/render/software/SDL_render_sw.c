@@ -33,9 +33,18 @@
 #include "SDL_drawline.h"
 #include "SDL_drawpoint.h"
 #include "SDL_rotate.h"
+#include "../../thread/SDL_systhread.h"
+#include "../../video/SDL_RLEaccel_c.h"
 
 /* SDL surface based renderer implementation */
 
+/* Don't split the target into bands smaller than this when rendering with threads */
+#define SW_MIN_BAND_HEIGHT  32
+#define SW_MAX_THREADS      16
+
+/* How many rotated versions of a texture are kept around for SW_RenderCopyEx */
+#define SW_ROTATE_CACHE_SIZE 4
+
 typedef struct
 {
     const SDL_Rect *viewport;
@@ -43,10 +52,79 @@ typedef struct
     SDL_bool surface_cliprect_dirty;
 } SW_DrawStateCache;
 
+/* Everything that goes into the surfaces built by SW_RenderCopyEx */
+typedef struct
+{
+    SDL_Rect srcrect;
+    int w, h;
+    double angle;
+    SDL_RendererFlip flip;
+    SDL_ScaleMode scaleMode;
+    SDL_BlendMode blendMode;
+    Uint8 r, g, b, a;           /* only when the modulation is applied before the rotation */
+} SW_RotateKey;
+
+typedef struct
+{
+    SW_RotateKey key;
+    SDL_Surface *rotated;
+    SDL_Surface *mask;          /* only used with the NONE blend mode */
+    Uint32 last_used;
+} SW_RotateCacheEntry;
+
+typedef struct
+{
+    SDL_Surface *surface;
+
+    /* Rotated copies of the surface, dropped whenever the pixels change.
+       The lock is needed because bands may draw the texture in parallel.
+     */
+    SDL_SpinLock lock;
+    Uint32 cache_clock;
+    SW_RotateCacheEntry cache[SW_ROTATE_CACHE_SIZE];
+} SW_TextureData;
+
+/* A batch of commands being replayed, shared by all the bands */
+typedef struct
+{
+    SDL_Renderer *renderer;
+    SDL_RenderCommand *cmd;
+    void *vertices;
+    SDL_Surface *surface;
+    SDL_Surface **textures;     /* texture surfaces used by the batch */
+    int num_textures;
+    int max_textures;
+    int *sources;               /* index in textures of each copy, in command order */
+    int num_sources;
+    int max_sources;
+} SW_RenderPass;
+
+/* One horizontal band of the target, with its own views of the target and
+   texture surfaces so blits on different threads never share surface state.
+ */
 typedef struct
+{
+    struct SW_RenderData *data;
+    SDL_Thread *thread;
+    SDL_sem *start;
+    SDL_Rect rect;
+    SDL_Surface *surface;
+    SDL_Surface **sources;      /* views of the pass textures, created on demand */
+    int max_sources;
+} SW_Band;
+
+typedef struct SW_RenderData
 {
     SDL_Surface *surface;
     SDL_Surface *window;
+
+    /* Multithreaded rendering, see SDL_HINT_RENDER_SOFTWARE_THREADS */
+    int num_threads;
+    SW_Band *bands;
+    int num_workers;
+    SDL_sem *done;
+    SDL_bool quit;
+    SW_RenderPass pass;
 } SW_RenderData;
 
 
@@ -102,9 +180,88 @@ SW_GetOutputSize(SDL_Renderer * renderer, int *w, int *h)
     return -1;
 }
 
+static void
+SW_FlushRotateCache(SW_TextureData *texturedata)
+{
+    int i;
+
+    SDL_AtomicLock(&texturedata->lock);
+    for (i = 0; i < SW_ROTATE_CACHE_SIZE; ++i) {
+        SW_RotateCacheEntry *entry = &texturedata->cache[i];
+        SDL_FreeSurface(entry->rotated);
+        SDL_FreeSurface(entry->mask);
+        SDL_zerop(entry);
+    }
+    SDL_AtomicUnlock(&texturedata->lock);
+}
+
+/* Returns new references to the cached surfaces, if there are any */
+static SDL_bool
+SW_LookupRotateCache(SW_TextureData *texturedata, const SW_RotateKey *key,
+                     SDL_Surface **rotated, SDL_Surface **mask)
+{
+    SDL_bool found = SDL_FALSE;
+    int i;
+
+    SDL_AtomicLock(&texturedata->lock);
+    for (i = 0; i < SW_ROTATE_CACHE_SIZE; ++i) {
+        SW_RotateCacheEntry *entry = &texturedata->cache[i];
+        if (entry->rotated && SDL_memcmp(&entry->key, key, sizeof(*key)) == 0) {
+            entry->last_used = ++texturedata->cache_clock;
+            *rotated = entry->rotated;
+            ++entry->rotated->refcount;
+            *mask = entry->mask;
+            if (entry->mask) {
+                ++entry->mask->refcount;
+            }
+            found = SDL_TRUE;
+            break;
+        }
+    }
+    SDL_AtomicUnlock(&texturedata->lock);
+    return found;
+}
+
+/* Keeps a reference to the surfaces, replacing the least recently used entry */
+static void
+SW_AddRotateCache(SW_TextureData *texturedata, const SW_RotateKey *key,
+                  SDL_Surface *rotated, SDL_Surface *mask)
+{
+    SW_RotateCacheEntry *entry = NULL;
+    int i;
+
+    SDL_AtomicLock(&texturedata->lock);
+    for (i = 0; i < SW_ROTATE_CACHE_SIZE; ++i) {
+        SW_RotateCacheEntry *candidate = &texturedata->cache[i];
+        if (candidate->rotated && SDL_memcmp(&candidate->key, key, sizeof(*key)) == 0) {
+            /* Another band got here first */
+            entry = NULL;
+            break;
+        }
+        if (!entry || !candidate->rotated ||
+            (entry->rotated && candidate->last_used < entry->last_used)) {
+            entry = candidate;
+        }
+    }
+    if (entry) {
+        SDL_FreeSurface(entry->rotated);
+        SDL_FreeSurface(entry->mask);
+        entry->key = *key;
+        entry->rotated = rotated;
+        ++rotated->refcount;
+        entry->mask = mask;
+        if (mask) {
+            ++mask->refcount;
+        }
+        entry->last_used = ++texturedata->cache_clock;
+    }
+    SDL_AtomicUnlock(&texturedata->lock);
+}
+
 static int
 SW_CreateTexture(SDL_Renderer * renderer, SDL_Texture * texture)
 {
+    SW_TextureData *texturedata;
     int bpp;
     Uint32 Rmask, Gmask, Bmask, Amask;
 
@@ -113,23 +270,30 @@ SW_CreateTexture(SDL_Renderer * renderer, SDL_Texture * texture)
         return SDL_SetError("Unknown texture format");
     }
 
-    texture->driverdata =
+    texturedata = (SW_TextureData *) SDL_calloc(1, sizeof(*texturedata));
+    if (!texturedata) {
+        return SDL_OutOfMemory();
+    }
+
+    texturedata->surface =
         SDL_CreateRGBSurface(0, texture->w, texture->h, bpp, Rmask, Gmask,
                              Bmask, Amask);
-    SDL_SetSurfaceColorMod(texture->driverdata, texture->r, texture->g,
+    if (!texturedata->surface) {
+        SDL_free(texturedata);
+        return -1;
+    }
+    texture->driverdata = texturedata;
+
+    SDL_SetSurfaceColorMod(texturedata->surface, texture->r, texture->g,
                            texture->b);
-    SDL_SetSurfaceAlphaMod(texture->driverdata, texture->a);
-    SDL_SetSurfaceBlendMode(texture->driverdata, texture->blendMode);
+    SDL_SetSurfaceAlphaMod(texturedata->surface, texture->a);
+    SDL_SetSurfaceBlendMode(texturedata->surface, texture->blendMode);
 
     /* Only RLE encode textures without an alpha channel since the RLE coder
      * discards the color values of pixels with an alpha value of zero.
      */
     if (texture->access == SDL_TEXTUREACCESS_STATIC && !Amask) {
-        SDL_SetSurfaceRLE(texture->driverdata, 1);
-    }
-
-    if (!texture->driverdata) {
-        return -1;
+        SDL_SetSurfaceRLE(texturedata->surface, 1);
     }
     return 0;
 }
@@ -138,11 +302,14 @@ static int
 SW_UpdateTexture(SDL_Renderer * renderer, SDL_Texture * texture,
                  const SDL_Rect * rect, const void *pixels, int pitch)
 {
-    SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
+    SW_TextureData *texturedata = (SW_TextureData *) texture->driverdata;
+    SDL_Surface *surface = texturedata->surface;
     Uint8 *src, *dst;
     int row;
     size_t length;
 
+    SW_FlushRotateCache(texturedata);
+
     if(SDL_MUSTLOCK(surface))
         SDL_LockSurface(surface);
     src = (Uint8 *) pixels;
@@ -164,7 +331,10 @@ static int
 SW_LockTexture(SDL_Renderer * renderer, SDL_Texture * texture,
                const SDL_Rect * rect, void **pixels, int *pitch)
 {
-    SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
+    SW_TextureData *texturedata = (SW_TextureData *) texture->driverdata;
+    SDL_Surface *surface = texturedata->surface;
+
+    SW_FlushRotateCache(texturedata);
 
     *pixels =
         (void *) ((Uint8 *) surface->pixels + rect->y * surface->pitch +
@@ -189,7 +359,11 @@ SW_SetRenderTarget(SDL_Renderer * renderer, SDL_Texture * texture)
     SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
 
     if (texture) {
-        data->surface = (SDL_Surface *) texture->driverdata;
+        SW_TextureData *texturedata = (SW_TextureData *) texture->driverdata;
+
+        /* Anything drawn from now on changes the texture pixels */
+        SW_FlushRotateCache(texturedata);
+        data->surface = texturedata->surface;
     } else {
         data->surface = data->window;
     }
@@ -333,31 +507,56 @@ SW_QueueCopyEx(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * te
     return 0;
 }
 
-static int
-SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Surface *surface, SDL_Texture * texture,
-                const SDL_Rect * srcrect, const SDL_Rect * final_rect,
-                const double angle, const SDL_FPoint * center, const SDL_RendererFlip flip)
+/* Drops a reference to a surface that may be held by the rotation cache */
+static void
+SW_ReleaseRotated(SW_TextureData *texturedata, SDL_Surface *surface)
 {
-    SDL_Surface *src = (SDL_Surface *) texture->driverdata;
-    SDL_Rect tmp_rect;
-    SDL_Surface *src_clone, *src_rotated, *src_scaled;
-    SDL_Surface *mask = NULL, *mask_rotated = NULL;
-    int retval = 0, dstwidth, dstheight, abscenterx, abscentery;
-    double cangle, sangle, px, py, p1x, p1y, p2x, p2y, p3x, p3y, p4x, p4y;
-    SDL_BlendMode blendmode;
-    Uint8 alphaMod, rMod, gMod, bMod;
-    int applyModulation = SDL_FALSE;
-    int blitRequired = SDL_FALSE;
-    int isOpaque = SDL_FALSE;
+    if (surface) {
+        SDL_AtomicLock(&texturedata->lock);
+        SDL_FreeSurface(surface);
+        SDL_AtomicUnlock(&texturedata->lock);
+    }
+}
 
-    if (!surface) {
-        return -1;
+/* A surface sharing the pixels of a cached one, so bands running in parallel
+   don't share its blit map.
+ */
+static SDL_Surface *
+SW_CreateRotatedView(SDL_Surface *surface)
+{
+    SDL_Surface *view;
+    SDL_BlendMode blendmode;
+    Uint32 colorkey;
+
+    view = SDL_CreateRGBSurfaceWithFormatFrom(surface->pixels, surface->w, surface->h,
+                                              surface->format->BitsPerPixel, surface->pitch,
+                                              surface->format->format);
+    if (view) {
+        if (SDL_GetColorKey(surface, &colorkey) == 0) {
+            SDL_SetColorKey(view, SDL_TRUE, colorkey);
+        }
+        SDL_GetSurfaceBlendMode(surface, &blendmode);
+        SDL_SetSurfaceBlendMode(view, blendmode);
     }
+    return view;
+}
 
-    tmp_rect.x = 0;
-    tmp_rect.y = 0;
-    tmp_rect.w = final_rect->w;
-    tmp_rect.h = final_rect->h;
+/* Scales, modulates and rotates the source as described by the key. The mask needed
+   by the NONE blend mode for non-opaque surfaces gets rotated with the same parameters.
+ */
+static int
+SW_CreateRotatedSurfaces(SDL_Surface *src, const SW_RotateKey *key,
+                         SDL_bool applyModulation, SDL_bool isOpaque,
+                         int dstwidth, int dstheight, double cangle, double sangle,
+                         SDL_Surface **rotated, SDL_Surface **mask_rotated)
+{
+    const SDL_Rect *srcrect = &key->srcrect;
+    SDL_Surface *src_clone, *src_scaled, *mask = NULL;
+    int retval = 0;
+    int blitRequired = SDL_FALSE;
+
+    *rotated = NULL;
+    *mask_rotated = NULL;
 
     /* It is possible to encounter an RLE encoded surface here and locking it is
      * necessary because this code is going to access the pixel buffer directly.
@@ -379,17 +578,13 @@ SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Surface *surface, SDL_Texture * tex
         return -1;
     }
 
-    SDL_GetSurfaceBlendMode(src, &blendmode);
-    SDL_GetSurfaceAlphaMod(src, &alphaMod);
-    SDL_GetSurfaceColorMod(src, &rMod, &gMod, &bMod);
-
     /* SDLgfx_rotateSurface only accepts 32-bit surfaces with a 8888 layout. Everything else has to be converted. */
     if (src->format->BitsPerPixel != 32 || SDL_PIXELLAYOUT(src->format->format) != SDL_PACKEDLAYOUT_8888 || !src->format->Amask) {
         blitRequired = SDL_TRUE;
     }
 
     /* If scaling and cropping is necessary, it has to be taken care of before the rotation. */
-    if (!(srcrect->w == final_rect->w && srcrect->h == final_rect->h && srcrect->x == 0 && srcrect->y == 0)) {
+    if (!(srcrect->w == key->w && srcrect->h == key->h && srcrect->x == 0 && srcrect->y == 0)) {
         blitRequired = SDL_TRUE;
     }
 
@@ -398,23 +593,16 @@ SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Surface *surface, SDL_Texture * tex
         blitRequired = SDL_TRUE;
     }
 
-    /* The color and alpha modulation has to be applied before the rotation when using the NONE, MOD or MUL blend modes. */
-    if ((blendmode == SDL_BLENDMODE_NONE || blendmode == SDL_BLENDMODE_MOD || blendmode == SDL_BLENDMODE_MUL) && (alphaMod & rMod & gMod & bMod) != 255) {
-        applyModulation = SDL_TRUE;
-        SDL_SetSurfaceAlphaMod(src_clone, alphaMod);
-        SDL_SetSurfaceColorMod(src_clone, rMod, gMod, bMod);
-    }
-
-    /* Opaque surfaces are much easier to handle with the NONE blend mode. */
-    if (blendmode == SDL_BLENDMODE_NONE && !src->format->Amask && alphaMod == 255) {
-        isOpaque = SDL_TRUE;
+    if (applyModulation) {
+        SDL_SetSurfaceAlphaMod(src_clone, key->a);
+        SDL_SetSurfaceColorMod(src_clone, key->r, key->g, key->b);
     }
 
     /* The NONE blend mode requires a mask for non-opaque surfaces. This mask will be used
      * to clear the pixels in the destination surface. The other steps are explained below.
      */
-    if (blendmode == SDL_BLENDMODE_NONE && !isOpaque) {
-        mask = SDL_CreateRGBSurface(0, final_rect->w, final_rect->h, 32,
+    if (key->blendMode == SDL_BLENDMODE_NONE && !isOpaque) {
+        mask = SDL_CreateRGBSurface(0, key->w, key->h, 32,
                                     0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
         if (mask == NULL) {
             retval = -1;
@@ -427,8 +615,12 @@ SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Surface *surface, SDL_Texture * tex
      * or modulation is required. It's possible to use the source surface directly otherwise.
      */
     if (!retval && (blitRequired || applyModulation)) {
-        SDL_Rect scale_rect = tmp_rect;
-        src_scaled = SDL_CreateRGBSurface(0, final_rect->w, final_rect->h, 32,
+        SDL_Rect scale_rect;
+        scale_rect.x = 0;
+        scale_rect.y = 0;
+        scale_rect.w = key->w;
+        scale_rect.h = key->h;
+        src_scaled = SDL_CreateRGBSurface(0, key->w, key->h, 32,
                                           0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
         if (src_scaled == NULL) {
             retval = -1;
@@ -442,109 +634,22 @@ SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Surface *surface, SDL_Texture * tex
     }
 
     /* SDLgfx_rotateSurface is going to make decisions depending on the blend mode. */
-    SDL_SetSurfaceBlendMode(src_clone, blendmode);
+    SDL_SetSurfaceBlendMode(src_clone, key->blendMode);
 
     if (!retval) {
-        SDLgfx_rotozoomSurfaceSizeTrig(tmp_rect.w, tmp_rect.h, angle, &dstwidth, &dstheight, &cangle, &sangle);
-        src_rotated = SDLgfx_rotateSurface(src_clone, angle, dstwidth/2, dstheight/2, (texture->scaleMode == SDL_ScaleModeNearest) ? 0 : 1, flip & SDL_FLIP_HORIZONTAL, flip & SDL_FLIP_VERTICAL, dstwidth, dstheight, cangle, sangle);
-        if (src_rotated == NULL) {
+        *rotated = SDLgfx_rotateSurface(src_clone, key->angle, dstwidth/2, dstheight/2, (key->scaleMode == SDL_ScaleModeNearest) ? 0 : 1, key->flip & SDL_FLIP_HORIZONTAL, key->flip & SDL_FLIP_VERTICAL, dstwidth, dstheight, cangle, sangle);
+        if (*rotated == NULL) {
             retval = -1;
         }
         if (!retval && mask != NULL) {
-            /* The mask needed for the NONE blend mode gets rotated with the same parameters. */
-            mask_rotated = SDLgfx_rotateSurface(mask, angle, dstwidth/2, dstheight/2, SDL_FALSE, 0, 0, dstwidth, dstheight, cangle, sangle);
-            if (mask_rotated == NULL) {
+            *mask_rotated = SDLgfx_rotateSurface(mask, key->angle, dstwidth/2, dstheight/2, SDL_FALSE, 0, 0, dstwidth, dstheight, cangle, sangle);
+            if (*mask_rotated == NULL) {
                 retval = -1;
             }
         }
-        if (!retval) {
-            /* Find out where the new origin is by rotating the four final_rect points around the center and then taking the extremes */
-            abscenterx = final_rect->x + (int)center->x;
-            abscentery = final_rect->y + (int)center->y;
-            /* Compensate the angle inversion to match the behaviour of the other backends */
-            sangle = -sangle;
-
-            /* Top Left */
-            px = final_rect->x - abscenterx;
-            py = final_rect->y - abscentery;
-            p1x = px * cangle - py * sangle + abscenterx;
-            p1y = px * sangle + py * cangle + abscentery;
-
-            /* Top Right */
-            px = final_rect->x + final_rect->w - abscenterx;
-            py = final_rect->y - abscentery;
-            p2x = px * cangle - py * sangle + abscenterx;
-            p2y = px * sangle + py * cangle + abscentery;
-
-            /* Bottom Left */
-            px = final_rect->x - abscenterx;
-            py = final_rect->y + final_rect->h - abscentery;
-            p3x = px * cangle - py * sangle + abscenterx;
-            p3y = px * sangle + py * cangle + abscentery;
-
-            /* Bottom Right */
-            px = final_rect->x + final_rect->w - abscenterx;
-            py = final_rect->y + final_rect->h - abscentery;
-            p4x = px * cangle - py * sangle + abscenterx;
-            p4y = px * sangle + py * cangle + abscentery;
-
-            tmp_rect.x = (int)MIN(MIN(p1x, p2x), MIN(p3x, p4x));
-            tmp_rect.y = (int)MIN(MIN(p1y, p2y), MIN(p3y, p4y));
-            tmp_rect.w = dstwidth;
-            tmp_rect.h = dstheight;
-
-            /* The NONE blend mode needs some special care with non-opaque surfaces.
-             * Other blend modes or opaque surfaces can be blitted directly.
-             */
-            if (blendmode != SDL_BLENDMODE_NONE || isOpaque) {
-                if (applyModulation == SDL_FALSE) {
-                    /* If the modulation wasn't already applied, make it happen now. */
-                    SDL_SetSurfaceAlphaMod(src_rotated, alphaMod);
-                    SDL_SetSurfaceColorMod(src_rotated, rMod, gMod, bMod);
-                }
-                retval = SDL_BlitSurface(src_rotated, NULL, surface, &tmp_rect);
-            } else {
-                /* The NONE blend mode requires three steps to get the pixels onto the destination surface.
-                 * First, the area where the rotated pixels will be blitted to get set to zero.
-                 * This is accomplished by simply blitting a mask with the NONE blend mode.
-                 * The colorkey set by the rotate function will discard the correct pixels.
-                 */
-                SDL_Rect mask_rect = tmp_rect;
-                SDL_SetSurfaceBlendMode(mask_rotated, SDL_BLENDMODE_NONE);
-                retval = SDL_BlitSurface(mask_rotated, NULL, surface, &mask_rect);
-                if (!retval) {
-                    /* The next step copies the alpha value. This is done with the BLEND blend mode and
-                     * by modulating the source colors with 0. Since the destination is all zeros, this
-                     * will effectively set the destination alpha to the source alpha.
-                     */
-                    SDL_SetSurfaceColorMod(src_rotated, 0, 0, 0);
-                    mask_rect = tmp_rect;
-                    retval = SDL_BlitSurface(src_rotated, NULL, surface, &mask_rect);
-                    if (!retval) {
-                        /* The last step gets the color values in place. The ADD blend mode simply adds them to
-                         * the destination (where the color values are all zero). However, because the ADD blend
-                         * mode modulates the colors with the alpha channel, a surface without an alpha mask needs
-                         * to be created. This makes all source pixels opaque and the colors get copied correctly.
-                         */
-                        SDL_Surface *src_rotated_rgb;
-                        src_rotated_rgb = SDL_CreateRGBSurfaceFrom(src_rotated->pixels, src_rotated->w, src_rotated->h,
-                                                                   src_rotated->format->BitsPerPixel, src_rotated->pitch,
-                                                                   src_rotated->format->Rmask, src_rotated->format->Gmask,
-                                                                   src_rotated->format->Bmask, 0);
-                        if (src_rotated_rgb == NULL) {
-                            retval = -1;
-                        } else {
-                            SDL_SetSurfaceBlendMode(src_rotated_rgb, SDL_BLENDMODE_ADD);
-                            retval = SDL_BlitSurface(src_rotated_rgb, NULL, surface, &tmp_rect);
-                            SDL_FreeSurface(src_rotated_rgb);
-                        }
-                    }
-                }
-                SDL_FreeSurface(mask_rotated);
-            }
-            if (src_rotated != NULL) {
-                SDL_FreeSurface(src_rotated);
-            }
+        if (retval) {
+            SDL_FreeSurface(*rotated);
+            *rotated = NULL;
         }
     }
 
@@ -560,16 +665,204 @@ SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Surface *surface, SDL_Texture * tex
     return retval;
 }
 
+static int
+SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Surface *surface, SDL_Texture * texture, SDL_Surface *src,
+                const SDL_Rect * srcrect, const SDL_Rect * final_rect,
+                const double angle, const SDL_FPoint * center, const SDL_RendererFlip flip)
+{
+    SW_TextureData *texturedata = (SW_TextureData *) texture->driverdata;
+    SW_RotateKey key;
+    SDL_Rect tmp_rect;
+    SDL_Surface *cached_rotated = NULL, *cached_mask = NULL;
+    SDL_Surface *src_rotated = NULL, *mask_rotated = NULL;
+    int retval = 0, dstwidth, dstheight, abscenterx, abscentery;
+    double cangle, sangle, px, py, p1x, p1y, p2x, p2y, p3x, p3y, p4x, p4y;
+    SDL_BlendMode blendmode;
+    Uint8 alphaMod, rMod, gMod, bMod;
+    int applyModulation = SDL_FALSE;
+    int isOpaque = SDL_FALSE;
+    /* When rendering in bands, src is a view of the texture surface */
+    const SDL_bool shared = (src != texturedata->surface);
+
+    if (!surface) {
+        return -1;
+    }
+
+    tmp_rect.x = 0;
+    tmp_rect.y = 0;
+    tmp_rect.w = final_rect->w;
+    tmp_rect.h = final_rect->h;
+
+    SDL_GetSurfaceBlendMode(src, &blendmode);
+    SDL_GetSurfaceAlphaMod(src, &alphaMod);
+    SDL_GetSurfaceColorMod(src, &rMod, &gMod, &bMod);
+
+    /* The color and alpha modulation has to be applied before the rotation when using the NONE, MOD or MUL blend modes. */
+    if ((blendmode == SDL_BLENDMODE_NONE || blendmode == SDL_BLENDMODE_MOD || blendmode == SDL_BLENDMODE_MUL) && (alphaMod & rMod & gMod & bMod) != 255) {
+        applyModulation = SDL_TRUE;
+    }
+
+    /* Opaque surfaces are much easier to handle with the NONE blend mode. */
+    if (blendmode == SDL_BLENDMODE_NONE && !src->format->Amask && alphaMod == 255) {
+        isOpaque = SDL_TRUE;
+    }
+
+    SDLgfx_rotozoomSurfaceSizeTrig(tmp_rect.w, tmp_rect.h, angle, &dstwidth, &dstheight, &cangle, &sangle);
+
+    /* Sprites are often drawn the same way frame after frame, so the rotated
+     * surfaces are kept with the texture until its pixels change.
+     */
+    SDL_zero(key);
+    key.srcrect = *srcrect;
+    key.w = final_rect->w;
+    key.h = final_rect->h;
+    key.angle = angle;
+    key.flip = flip;
+    key.scaleMode = texture->scaleMode;
+    key.blendMode = blendmode;
+    if (applyModulation) {
+        key.r = rMod;
+        key.g = gMod;
+        key.b = bMod;
+        key.a = alphaMod;
+    } else {
+        key.r = key.g = key.b = key.a = 255;
+    }
+
+    if (!SW_LookupRotateCache(texturedata, &key, &cached_rotated, &cached_mask)) {
+        retval = SW_CreateRotatedSurfaces(src, &key, applyModulation, isOpaque,
+                                          dstwidth, dstheight, cangle, sangle,
+                                          &cached_rotated, &cached_mask);
+        if (!retval) {
+            SW_AddRotateCache(texturedata, &key, cached_rotated, cached_mask);
+        }
+    }
+
+    if (!retval) {
+        if (shared) {
+            src_rotated = SW_CreateRotatedView(cached_rotated);
+            if (src_rotated == NULL) {
+                retval = -1;
+            }
+            if (!retval && cached_mask != NULL) {
+                mask_rotated = SW_CreateRotatedView(cached_mask);
+                if (mask_rotated == NULL) {
+                    retval = -1;
+                }
+            }
+        } else {
+            src_rotated = cached_rotated;
+            mask_rotated = cached_mask;
+        }
+    }
+
+    if (!retval) {
+        /* Find out where the new origin is by rotating the four final_rect points around the center and then taking the extremes */
+        abscenterx = final_rect->x + (int)center->x;
+        abscentery = final_rect->y + (int)center->y;
+        /* Compensate the angle inversion to match the behaviour of the other backends */
+        sangle = -sangle;
+
+        /* Top Left */
+        px = final_rect->x - abscenterx;
+        py = final_rect->y - abscentery;
+        p1x = px * cangle - py * sangle + abscenterx;
+        p1y = px * sangle + py * cangle + abscentery;
+
+        /* Top Right */
+        px = final_rect->x + final_rect->w - abscenterx;
+        py = final_rect->y - abscentery;
+        p2x = px * cangle - py * sangle + abscenterx;
+        p2y = px * sangle + py * cangle + abscentery;
+
+        /* Bottom Left */
+        px = final_rect->x - abscenterx;
+        py = final_rect->y + final_rect->h - abscentery;
+        p3x = px * cangle - py * sangle + abscenterx;
+        p3y = px * sangle + py * cangle + abscentery;
+
+        /* Bottom Right */
+        px = final_rect->x + final_rect->w - abscenterx;
+        py = final_rect->y + final_rect->h - abscentery;
+        p4x = px * cangle - py * sangle + abscenterx;
+        p4y = px * sangle + py * cangle + abscentery;
+
+        tmp_rect.x = (int)MIN(MIN(p1x, p2x), MIN(p3x, p4x));
+        tmp_rect.y = (int)MIN(MIN(p1y, p2y), MIN(p3y, p4y));
+        tmp_rect.w = dstwidth;
+        tmp_rect.h = dstheight;
+
+        /* The NONE blend mode needs some special care with non-opaque surfaces.
+         * Other blend modes or opaque surfaces can be blitted directly.
+         */
+        if (blendmode != SDL_BLENDMODE_NONE || isOpaque) {
+            if (applyModulation == SDL_FALSE) {
+                /* If the modulation wasn't already applied, make it happen now. */
+                SDL_SetSurfaceAlphaMod(src_rotated, alphaMod);
+                SDL_SetSurfaceColorMod(src_rotated, rMod, gMod, bMod);
+            }
+            retval = SDL_BlitSurface(src_rotated, NULL, surface, &tmp_rect);
+        } else {
+            /* The NONE blend mode requires three steps to get the pixels onto the destination surface.
+             * First, the area where the rotated pixels will be blitted to get set to zero.
+             * This is accomplished by simply blitting a mask with the NONE blend mode.
+             * The colorkey set by the rotate function will discard the correct pixels.
+             */
+            SDL_Rect mask_rect = tmp_rect;
+            SDL_SetSurfaceBlendMode(mask_rotated, SDL_BLENDMODE_NONE);
+            retval = SDL_BlitSurface(mask_rotated, NULL, surface, &mask_rect);
+            if (!retval) {
+                /* The next step copies the alpha value. This is done with the BLEND blend mode and
+                 * by modulating the source colors with 0. Since the destination is all zeros, this
+                 * will effectively set the destination alpha to the source alpha.
+                 */
+                SDL_SetSurfaceColorMod(src_rotated, 0, 0, 0);
+                mask_rect = tmp_rect;
+                retval = SDL_BlitSurface(src_rotated, NULL, surface, &mask_rect);
+                if (!retval) {
+                    /* The last step gets the color values in place. The ADD blend mode simply adds them to
+                     * the destination (where the color values are all zero). However, because the ADD blend
+                     * mode modulates the colors with the alpha channel, a surface without an alpha mask needs
+                     * to be created. This makes all source pixels opaque and the colors get copied correctly.
+                     */
+                    SDL_Surface *src_rotated_rgb;
+                    src_rotated_rgb = SDL_CreateRGBSurfaceFrom(src_rotated->pixels, src_rotated->w, src_rotated->h,
+                                                               src_rotated->format->BitsPerPixel, src_rotated->pitch,
+                                                               src_rotated->format->Rmask, src_rotated->format->Gmask,
+                                                               src_rotated->format->Bmask, 0);
+                    if (src_rotated_rgb == NULL) {
+                        retval = -1;
+                    } else {
+                        SDL_SetSurfaceBlendMode(src_rotated_rgb, SDL_BLENDMODE_ADD);
+                        retval = SDL_BlitSurface(src_rotated_rgb, NULL, surface, &tmp_rect);
+                        SDL_FreeSurface(src_rotated_rgb);
+                    }
+                }
+            }
+        }
+    }
+
+    if (shared) {
+        if (src_rotated != NULL) {
+            SDL_FreeSurface(src_rotated);
+        }
+        if (mask_rotated != NULL) {
+            SDL_FreeSurface(mask_rotated);
+        }
+    }
+    SW_ReleaseRotated(texturedata, cached_rotated);
+    SW_ReleaseRotated(texturedata, cached_mask);
+    return retval;
+}
+
 static void
-PrepTextureForCopy(const SDL_RenderCommand *cmd)
+PrepTextureForCopy(const SDL_RenderCommand *cmd, SDL_Surface *surface)
 {
     const Uint8 r = cmd->data.draw.r;
     const Uint8 g = cmd->data.draw.g;
     const Uint8 b = cmd->data.draw.b;
     const Uint8 a = cmd->data.draw.a;
     const SDL_BlendMode blend = cmd->data.draw.blend;
-    SDL_Texture *texture = cmd->data.draw.texture;
-    SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
     const SDL_bool colormod = ((r & g & b) != 0xFF);
     const SDL_bool alphamod = (a != 0xFF);
     const SDL_bool blending = ((blend == SDL_BLENDMODE_ADD) || (blend == SDL_BLENDMODE_MOD) || (blend == SDL_BLENDMODE_MUL));
@@ -585,37 +878,62 @@ PrepTextureForCopy(const SDL_RenderCommand *cmd)
 }
 
 static void
-SetDrawState(SDL_Surface *surface, SW_DrawStateCache *drawstate)
+SetDrawState(SDL_Surface *surface, SW_DrawStateCache *drawstate, const SDL_Rect *band)
 {
     if (drawstate->surface_cliprect_dirty) {
         const SDL_Rect *viewport = drawstate->viewport;
         const SDL_Rect *cliprect = drawstate->cliprect;
+        SDL_Rect clip_rect;
         SDL_assert(viewport != NULL);  /* the higher level should have forced a SDL_RENDERCMD_SETVIEWPORT */
 
         if (cliprect != NULL) {
-            SDL_Rect clip_rect;
             clip_rect.x = cliprect->x + viewport->x;
             clip_rect.y = cliprect->y + viewport->y;
             clip_rect.w = cliprect->w;
             clip_rect.h = cliprect->h;
             SDL_IntersectRect(viewport, &clip_rect, &clip_rect);
-            SDL_SetClipRect(surface, &clip_rect);
         } else {
-            SDL_SetClipRect(surface, drawstate->viewport);
+            clip_rect = *viewport;
+        }
+        if (band != NULL && !SDL_IntersectRect(band, &clip_rect, &clip_rect)) {
+            clip_rect.w = clip_rect.h = 0;
         }
+        SDL_SetClipRect(surface, &clip_rect);
         drawstate->surface_cliprect_dirty = SDL_FALSE;
     }
 }
 
-static int
-SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertices, size_t vertsize)
+/* Get the surface to copy from for the index'th copy command of the pass */
+static SDL_Surface *
+GetCopySource(SW_RenderPass *pass, SW_Band *band, const SDL_RenderCommand *cmd, int index)
 {
-    SDL_Surface *surface = SW_ActivateRenderer(renderer);
-    SW_DrawStateCache drawstate;
+    SDL_Surface *src;
+    SDL_Surface **view;
 
-    if (!surface) {
-        return -1;
+    if (band == NULL) {
+        return ((SW_TextureData *) cmd->data.draw.texture->driverdata)->surface;
+    }
+
+    view = &band->sources[pass->sources[index]];
+    if (*view == NULL) {
+        src = pass->textures[pass->sources[index]];
+        *view = SDL_CreateRGBSurfaceWithFormatFrom(src->pixels, src->w, src->h,
+                                                   src->format->BitsPerPixel, src->pitch,
+                                                   src->format->format);
     }
+    return *view;
+}
+
+/* Run the commands of a pass on the whole target, or only on one band of it */
+static void
+SW_RunPass(SW_RenderPass *pass, SW_Band *band)
+{
+    SDL_Surface *surface = band ? band->surface : pass->surface;
+    const SDL_Rect *bandrect = band ? &band->rect : NULL;
+    SDL_RenderCommand *cmd = pass->cmd;
+    void *vertices = pass->vertices;
+    SW_DrawStateCache drawstate;
+    int copies = 0;
 
     drawstate.viewport = NULL;
     drawstate.cliprect = NULL;
@@ -645,7 +963,7 @@ SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertic
                 const Uint8 b = cmd->data.color.b;
                 const Uint8 a = cmd->data.color.a;
                 /* By definition the clear ignores the clip rect */
-                SDL_SetClipRect(surface, NULL);
+                SDL_SetClipRect(surface, bandrect);
                 SDL_FillRect(surface, NULL, SDL_MapRGBA(surface->format, r, g, b, a));
                 drawstate.surface_cliprect_dirty = SDL_TRUE;
                 break;
@@ -659,7 +977,7 @@ SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertic
                 const int count = (int) cmd->data.draw.count;
                 const SDL_Point *verts = (SDL_Point *) (((Uint8 *) vertices) + cmd->data.draw.first);
                 const SDL_BlendMode blend = cmd->data.draw.blend;
-                SetDrawState(surface, &drawstate);
+                SetDrawState(surface, &drawstate, bandrect);
                 if (blend == SDL_BLENDMODE_NONE) {
                     SDL_DrawPoints(surface, verts, count, SDL_MapRGBA(surface->format, r, g, b, a));
                 } else {
@@ -676,7 +994,7 @@ SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertic
                 const int count = (int) cmd->data.draw.count;
                 const SDL_Point *verts = (SDL_Point *) (((Uint8 *) vertices) + cmd->data.draw.first);
                 const SDL_BlendMode blend = cmd->data.draw.blend;
-                SetDrawState(surface, &drawstate);
+                SetDrawState(surface, &drawstate, bandrect);
                 if (blend == SDL_BLENDMODE_NONE) {
                     SDL_DrawLines(surface, verts, count, SDL_MapRGBA(surface->format, r, g, b, a));
                 } else {
@@ -693,7 +1011,7 @@ SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertic
                 const int count = (int) cmd->data.draw.count;
                 const SDL_Rect *verts = (SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
                 const SDL_BlendMode blend = cmd->data.draw.blend;
-                SetDrawState(surface, &drawstate);
+                SetDrawState(surface, &drawstate, bandrect);
                 if (blend == SDL_BLENDMODE_NONE) {
                     SDL_FillRects(surface, verts, count, SDL_MapRGBA(surface->format, r, g, b, a));
                 } else {
@@ -703,33 +1021,42 @@ SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertic
             }
 
             case SDL_RENDERCMD_COPY: {
-                SDL_Rect *verts = (SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
+                const SDL_Rect *verts = (SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
                 const SDL_Rect *srcrect = verts;
-                SDL_Rect *dstrect = verts + 1;
-                SDL_Texture *texture = cmd->data.draw.texture;
-                SDL_Surface *src = (SDL_Surface *) texture->driverdata;
+                SDL_Rect dstrect = verts[1];  /* the blit clips this, and other bands need it intact */
+                SDL_Surface *src = GetCopySource(pass, band, cmd, copies++);
 
-                SetDrawState(surface, &drawstate);
+                if (!src) {
+                    break;
+                }
 
-                PrepTextureForCopy(cmd);
+                SetDrawState(surface, &drawstate, bandrect);
 
-                if ( srcrect->w == dstrect->w && srcrect->h == dstrect->h ) {
-                    SDL_BlitSurface(src, srcrect, surface, dstrect);
+                PrepTextureForCopy(cmd, src);
+
+                if ( srcrect->w == dstrect.w && srcrect->h == dstrect.h ) {
+                    SDL_BlitSurface(src, srcrect, surface, &dstrect);
                 } else {
                     /* If scaling is ever done, permanently disable RLE (which doesn't support scaling)
                      * to avoid potentially frequent RLE encoding/decoding.
                      */
                     SDL_SetSurfaceRLE(surface, 0);
-                    SDL_BlitScaled(src, srcrect, surface, dstrect);
+                    SDL_BlitScaled(src, srcrect, surface, &dstrect);
                 }
                 break;
             }
 
             case SDL_RENDERCMD_COPY_EX: {
                 const CopyExData *copydata = (CopyExData *) (((Uint8 *) vertices) + cmd->data.draw.first);
-                SetDrawState(surface, &drawstate);
-                PrepTextureForCopy(cmd);
-                SW_RenderCopyEx(renderer, surface, cmd->data.draw.texture, &copydata->srcrect,
+                SDL_Surface *src = GetCopySource(pass, band, cmd, copies++);
+
+                if (!src) {
+                    break;
+                }
+
+                SetDrawState(surface, &drawstate, bandrect);
+                PrepTextureForCopy(cmd, src);
+                SW_RenderCopyEx(pass->renderer, surface, cmd->data.draw.texture, src, &copydata->srcrect,
                                 &copydata->dstrect, copydata->angle, &copydata->center, copydata->flip);
                 break;
             }
@@ -740,6 +1067,293 @@ SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertic
 
         cmd = cmd->next;
     }
+}
+
+#if !SDL_THREADS_DISABLED
+
+static void
+SW_RunBand(SW_RenderPass *pass, SW_Band *band)
+{
+    int i;
+
+    SW_RunPass(pass, band);
+
+    for (i = 0; i < pass->num_textures; ++i) {
+        if (band->sources[i]) {
+            SDL_FreeSurface(band->sources[i]);
+            band->sources[i] = NULL;
+        }
+    }
+}
+
+static int SDLCALL
+SW_BandThread(void *arg)
+{
+    SW_Band *band = (SW_Band *) arg;
+    SW_RenderData *data = band->data;
+
+    for ( ; ; ) {
+        SDL_SemWait(band->start);
+        if (data->quit) {
+            break;
+        }
+        SW_RunBand(&data->pass, band);
+        SDL_SemPost(data->done);
+    }
+    return 0;
+}
+
+static void
+SW_DestroyBands(SW_RenderData *data)
+{
+    int i;
+
+    if (!data->bands) {
+        return;
+    }
+
+    data->quit = SDL_TRUE;
+    for (i = 1; i <= data->num_workers; ++i) {
+        SDL_SemPost(data->bands[i].start);
+        SDL_WaitThread(data->bands[i].thread, NULL);
+    }
+    for (i = 0; i < data->num_threads; ++i) {
+        if (data->bands[i].start) {
+            SDL_DestroySemaphore(data->bands[i].start);
+        }
+        SDL_free(data->bands[i].sources);
+    }
+    if (data->done) {
+        SDL_DestroySemaphore(data->done);
+        data->done = NULL;
+    }
+    SDL_free(data->bands);
+    data->bands = NULL;
+    data->num_workers = 0;
+
+    SDL_free(data->pass.textures);
+    SDL_free(data->pass.sources);
+    SDL_zero(data->pass);
+}
+
+/* Band 0 runs on the calling thread, the others each get a worker thread */
+static int
+SW_CreateBands(SW_RenderData *data)
+{
+    int i;
+
+    data->bands = (SW_Band *) SDL_calloc(data->num_threads, sizeof(*data->bands));
+    if (!data->bands) {
+        return SDL_OutOfMemory();
+    }
+    data->quit = SDL_FALSE;
+    data->done = SDL_CreateSemaphore(0);
+    if (!data->done) {
+        SW_DestroyBands(data);
+        return -1;
+    }
+
+    for (i = 0; i < data->num_threads; ++i) {
+        data->bands[i].data = data;
+    }
+    for (i = 1; i < data->num_threads; ++i) {
+        SW_Band *band = &data->bands[i];
+
+        band->start = SDL_CreateSemaphore(0);
+        if (!band->start) {
+            SW_DestroyBands(data);
+            return -1;
+        }
+        band->thread = SDL_CreateThreadInternal(SW_BandThread, "SDLRenderSW", 0, band);
+        if (!band->thread) {
+            SW_DestroyBands(data);
+            return -1;
+        }
+        data->num_workers = i;
+    }
+    return 0;
+}
+
+static SDL_bool
+SW_AddPassTexture(SW_RenderPass *pass, SDL_Surface *src)
+{
+    int i;
+
+    for (i = 0; i < pass->num_textures; ++i) {
+        if (pass->textures[i] == src) {
+            break;
+        }
+    }
+    if (i == pass->num_textures) {
+        if (pass->num_textures == pass->max_textures) {
+            const int max_textures = pass->max_textures ? (pass->max_textures * 2) : 16;
+            SDL_Surface **textures = (SDL_Surface **) SDL_realloc(pass->textures, max_textures * sizeof(*textures));
+            if (!textures) {
+                return SDL_FALSE;
+            }
+            pass->textures = textures;
+            pass->max_textures = max_textures;
+        }
+        pass->textures[pass->num_textures++] = src;
+    }
+
+    if (pass->num_sources == pass->max_sources) {
+        const int max_sources = pass->max_sources ? (pass->max_sources * 2) : 64;
+        int *sources = (int *) SDL_realloc(pass->sources, max_sources * sizeof(*sources));
+        if (!sources) {
+            return SDL_FALSE;
+        }
+        pass->sources = sources;
+        pass->max_sources = max_sources;
+    }
+    pass->sources[pass->num_sources++] = i;
+    return SDL_TRUE;
+}
+
+/* Check that every command of the batch gives the same pixels when it's
+   clipped to bands, and collect the textures it uses.
+
+   Lines and scaled copies are left to the serial path, since clipping
+   changes where their pixels are sampled. Textures lose RLE acceleration,
+   because their pixels have to be readable from all the threads.
+ */
+static SDL_bool
+SW_PreparePass(SW_RenderPass *pass, SDL_RenderCommand *cmd, void *vertices)
+{
+    pass->num_textures = 0;
+    pass->num_sources = 0;
+
+    for ( ; cmd; cmd = cmd->next) {
+        switch (cmd->command) {
+            case SDL_RENDERCMD_DRAW_LINES:
+                return SDL_FALSE;
+
+            case SDL_RENDERCMD_COPY:
+            case SDL_RENDERCMD_COPY_EX: {
+                SDL_Surface *src = ((SW_TextureData *) cmd->data.draw.texture->driverdata)->surface;
+
+                if (cmd->command == SDL_RENDERCMD_COPY) {
+                    const SDL_Rect *verts = (SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
+                    if (verts[0].w != verts[1].w || verts[0].h != verts[1].h) {
+                        return SDL_FALSE;
+                    }
+                }
+
+                if (src->flags & SDL_RLEACCEL) {
+                    SDL_UnRLESurface(src, 1);
+                }
+                SDL_SetSurfaceRLE(src, 0);
+                if (!src->pixels || src->locked) {
+                    return SDL_FALSE;
+                }
+                if (!SW_AddPassTexture(pass, src)) {
+                    return SDL_FALSE;
+                }
+                break;
+            }
+
+            default:
+                break;
+        }
+    }
+    return SDL_TRUE;
+}
+
+static SDL_bool
+SW_RunCommandQueueThreaded(SDL_Renderer * renderer, SDL_Surface *surface, SDL_RenderCommand *cmd, void *vertices)
+{
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
+    SW_RenderPass *pass = &data->pass;
+    const int num_bands = SDL_min(data->num_threads, surface->h / SW_MIN_BAND_HEIGHT);
+    SDL_bool retval = SDL_FALSE;
+    int i;
+
+    if (num_bands < 2 || surface->format->BytesPerPixel < 2 || SDL_MUSTLOCK(surface)) {
+        return SDL_FALSE;
+    }
+    if (!data->bands && SW_CreateBands(data) < 0) {
+        data->num_threads = 0;  /* don't try again */
+        return SDL_FALSE;
+    }
+    if (!SW_PreparePass(pass, cmd, vertices)) {
+        return SDL_FALSE;
+    }
+    pass->renderer = renderer;
+    pass->cmd = cmd;
+    pass->vertices = vertices;
+    pass->surface = surface;
+
+    for (i = 0; i < num_bands; ++i) {
+        SW_Band *band = &data->bands[i];
+        const int y0 = (surface->h * i) / num_bands;
+        const int y1 = (surface->h * (i + 1)) / num_bands;
+
+        if (band->max_sources < pass->num_textures) {
+            SDL_Surface **sources = (SDL_Surface **) SDL_realloc(band->sources, pass->num_textures * sizeof(*sources));
+            if (!sources) {
+                goto done;
+            }
+            band->sources = sources;
+            band->max_sources = pass->num_textures;
+        }
+        SDL_memset(band->sources, 0, pass->num_textures * sizeof(*band->sources));
+
+        band->rect.x = 0;
+        band->rect.y = y0;
+        band->rect.w = surface->w;
+        band->rect.h = y1 - y0;
+        band->surface = SDL_CreateRGBSurfaceWithFormatFrom(surface->pixels, surface->w, surface->h,
+                                                           surface->format->BitsPerPixel, surface->pitch,
+                                                           surface->format->format);
+        if (!band->surface) {
+            goto done;
+        }
+    }
+
+    for (i = 1; i < num_bands; ++i) {
+        SDL_SemPost(data->bands[i].start);
+    }
+    SW_RunBand(pass, &data->bands[0]);
+    for (i = 1; i < num_bands; ++i) {
+        SDL_SemWait(data->done);
+    }
+    retval = SDL_TRUE;
+
+done:
+    for (i = 0; i < num_bands; ++i) {
+        if (data->bands[i].surface) {
+            SDL_FreeSurface(data->bands[i].surface);
+            data->bands[i].surface = NULL;
+        }
+    }
+    return retval;
+}
+
+#endif /* !SDL_THREADS_DISABLED */
+
+static int
+SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertices, size_t vertsize)
+{
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
+    SDL_Surface *surface = SW_ActivateRenderer(renderer);
+    SW_RenderPass pass;
+
+    if (!surface) {
+        return -1;
+    }
+
+#if !SDL_THREADS_DISABLED
+    if (data->num_threads > 1 && SW_RunCommandQueueThreaded(renderer, surface, cmd, vertices)) {
+        return 0;
+    }
+#endif
+
+    SDL_zero(pass);
+    pass.renderer = renderer;
+    pass.cmd = cmd;
+    pass.vertices = vertices;
+    pass.surface = surface;
+    SW_RunPass(&pass, NULL);
 
     return 0;
 }
@@ -788,9 +1402,13 @@ SW_RenderPresent(SDL_Renderer * renderer)
 static void
 SW_DestroyTexture(SDL_Renderer * renderer, SDL_Texture * texture)
 {
-    SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
+    SW_TextureData *texturedata = (SW_TextureData *) texture->driverdata;
 
-    SDL_FreeSurface(surface);
+    if (texturedata) {
+        SW_FlushRotateCache(texturedata);
+        SDL_FreeSurface(texturedata->surface);
+        SDL_free(texturedata);
+    }
 }
 
 static void
@@ -798,7 +1416,12 @@ SW_DestroyRenderer(SDL_Renderer * renderer)
 {
     SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
 
-    SDL_free(data);
+    if (data) {
+#if !SDL_THREADS_DISABLED
+        SW_DestroyBands(data);
+#endif
+        SDL_free(data);
+    }
     SDL_free(renderer);
 }
 
@@ -807,6 +1430,7 @@ SW_CreateRendererForSurface(SDL_Surface * surface)
 {
     SDL_Renderer *renderer;
     SW_RenderData *data;
+    const char *hint;
 
     if (!surface) {
         SDL_SetError("Can't create renderer for NULL surface");
@@ -827,6 +1451,10 @@ SW_CreateRendererForSurface(SDL_Surface * surface)
     }
     data->surface = surface;
     data->window = surface;
+    hint = SDL_GetHint(SDL_HINT_RENDER_SOFTWARE_THREADS);
+    if (hint) {
+        data->num_threads = SDL_min(SDL_atoi(hint), SW_MAX_THREADS);
+    }
 
     renderer->WindowEvent = SW_WindowEvent;
     renderer->GetOutputSize = SW_GetOutputSize;
@@ -41,6 +41,8 @@ Andreas Schiffler -- aschiffler at ferzkopp dot net
 
 #include "SDL.h"
 #include "SDL_rotate.h"
+#include "../../cpuinfo/SDL_cpuinfo_c.h"
+#include "../../cpuinfo/SDL_simd.h"
 
 /* ---- Internally used structures */
 
@@ -209,6 +211,483 @@ transformSurfaceY90(SDL_Surface * src, SDL_Surface * dst, int angle, int flipx,
 
 #undef TRANSFORM_SURFACE_90
 
+/* !
+\brief Copies the source pixel under a destination pixel, if there is one.
+
+\param src Source surface.
+\param pc The destination pixel.
+\param sdx Horizontal source position, in 16.16 fixed point.
+\param sdy Vertical source position, in 16.16 fixed point.
+\param flipx Flag indicating horizontal mirroring should be applied.
+\param flipy Flag indicating vertical mirroring should be applied.
+*/
+static SDL_INLINE void
+transformPixelRGBA(SDL_Surface * src, tColorRGBA *pc, int sdx, int sdy, int flipx, int flipy)
+{
+    int dx = (sdx >> 16);
+    int dy = (sdy >> 16);
+    if ((unsigned)dx < (unsigned)src->w && (unsigned)dy < (unsigned)src->h) {
+        if(flipx) dx = (src->w-1) - dx;
+        if(flipy) dy = (src->h-1) - dy;
+        *pc = *((tColorRGBA *)((Uint8 *)src->pixels + src->pitch * dy) + dx);
+    }
+}
+
+/* !
+\brief Interpolates the four source pixels around a destination pixel, if they are all inside the source.
+
+The SIMD versions below give exactly the same results.
+
+\param src Source surface.
+\param pc The destination pixel.
+\param sdx Horizontal source position, in 16.16 fixed point.
+\param sdy Vertical source position, in 16.16 fixed point.
+\param flipx Flag indicating horizontal mirroring should be applied.
+\param flipy Flag indicating vertical mirroring should be applied.
+*/
+static SDL_INLINE void
+transformPixelRGBASmooth(SDL_Surface * src, tColorRGBA *pc, int sdx, int sdy, int flipx, int flipy)
+{
+    int t1, t2, ex, ey;
+    tColorRGBA c00, c01, c10, c11, cswap;
+    tColorRGBA *sp;
+    int dx = (sdx >> 16);
+    int dy = (sdy >> 16);
+    if (flipx) dx = (src->w-1) - dx;
+    if (flipy) dy = (src->h-1) - dy;
+    if ((dx > -1) && (dy > -1) && (dx < (src->w-1)) && (dy < (src->h-1))) {
+        sp = (tColorRGBA *) ((Uint8 *) src->pixels + src->pitch * dy) + dx;
+        c00 = *sp;
+        sp += 1;
+        c01 = *sp;
+        sp += (src->pitch/4);
+        c11 = *sp;
+        sp -= 1;
+        c10 = *sp;
+        if (flipx) {
+            cswap = c00; c00=c01; c01=cswap;
+            cswap = c10; c10=c11; c11=cswap;
+        }
+        if (flipy) {
+            cswap = c00; c00=c10; c10=cswap;
+            cswap = c01; c01=c11; c11=cswap;
+        }
+        /*
+        * Interpolate colors
+        */
+        ex = (sdx & 0xffff);
+        ey = (sdy & 0xffff);
+        t1 = ((((c01.r - c00.r) * ex) >> 16) + c00.r) & 0xff;
+        t2 = ((((c11.r - c10.r) * ex) >> 16) + c10.r) & 0xff;
+        pc->r = (((t2 - t1) * ey) >> 16) + t1;
+        t1 = ((((c01.g - c00.g) * ex) >> 16) + c00.g) & 0xff;
+        t2 = ((((c11.g - c10.g) * ex) >> 16) + c10.g) & 0xff;
+        pc->g = (((t2 - t1) * ey) >> 16) + t1;
+        t1 = ((((c01.b - c00.b) * ex) >> 16) + c00.b) & 0xff;
+        t2 = ((((c11.b - c10.b) * ex) >> 16) + c10.b) & 0xff;
+        pc->b = (((t2 - t1) * ey) >> 16) + t1;
+        t1 = ((((c01.a - c00.a) * ex) >> 16) + c00.a) & 0xff;
+        t2 = ((((c11.a - c10.a) * ex) >> 16) + c10.a) & 0xff;
+        pc->a = (((t2 - t1) * ey) >> 16) + t1;
+    }
+}
+
+/* !
+\brief Transforms the first pixels of a destination row, several at a time.
+
+\param src Source surface.
+\param pc The first destination pixel of the row.
+\param width The number of pixels in the row.
+\param sdx Horizontal source position of the first pixel, in 16.16 fixed point.
+\param sdy Vertical source position of the first pixel, in 16.16 fixed point.
+\param icos Horizontal source increment between destination pixels.
+\param isin Vertical source increment between destination pixels.
+\param flipx Flag indicating horizontal mirroring should be applied.
+\param flipy Flag indicating vertical mirroring should be applied.
+\return The number of pixels that were transformed, the caller does the rest.
+*/
+typedef int (*tTransformRow)(SDL_Surface * src, void *pc, int width, int sdx, int sdy, int icos, int isin, int flipx, int flipy);
+
+#if SDL_SSE2_INTRINSICS
+
+/* Computes a + (((b - a) * f) >> 16) for 16-bit channels in 0..255 and f in 0..0xffff, like the C code.
+   _mm_mulhi_epi16 takes f as signed, which is compensated by adding (b - a) back when f >= 0x8000. */
+static SDL_INLINE __m128i
+lerpChannels_SSE2(__m128i a, __m128i b, __m128i f)
+{
+    const __m128i d = _mm_sub_epi16(b, a);
+    __m128i r = _mm_mulhi_epi16(d, f);
+    r = _mm_add_epi16(r, _mm_and_si128(d, _mm_srai_epi16(f, 15)));
+    return _mm_add_epi16(r, a);
+}
+
+/* Repeats the 32-bit fractions of four pixels for the 16-bit channels of two pixels at a time */
+static SDL_INLINE void
+spreadFractions_SSE2(__m128i f, __m128i *lo, __m128i *hi)
+{
+    f = _mm_or_si128(f, _mm_slli_epi32(f, 16));
+    *lo = _mm_unpacklo_epi32(f, f);
+    *hi = _mm_unpackhi_epi32(f, f);
+}
+
+static int
+transformRowRGBASmooth_SSE2(SDL_Surface * src, void *pc, int width, int sdx, int sdy, int icos, int isin, int flipx, int flipy)
+{
+    const __m128i sw = _mm_set1_epi32(src->w - 1);
+    const __m128i sh = _mm_set1_epi32(src->h - 1);
+    const __m128i minus1 = _mm_set1_epi32(-1);
+    const __m128i fraction = _mm_set1_epi32(0xffff);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i stepx = _mm_set1_epi32(4 * icos);
+    const __m128i stepy = _mm_set1_epi32(4 * isin);
+    /* Offsets of the corners, swapped when flipping like the C code does */
+    const int ox0 = flipx ? 1 : 0, ox1 = 1 - ox0;
+    const int oy0 = flipy ? src->pitch : 0, oy1 = src->pitch - oy0;
+    __m128i vsdx = _mm_setr_epi32(sdx, sdx + icos, sdx + 2 * icos, sdx + 3 * icos);
+    __m128i vsdy = _mm_setr_epi32(sdy, sdy + isin, sdy + 2 * isin, sdy + 3 * isin);
+    Uint32 *dst = (Uint32 *) pc;
+    int x, i;
+
+    for (x = 0; x + 4 <= width; x += 4, dst += 4) {
+        __m128i dx = _mm_srai_epi32(vsdx, 16);
+        __m128i dy = _mm_srai_epi32(vsdy, 16);
+        __m128i inside;
+
+        if (flipx) dx = _mm_sub_epi32(sw, dx);
+        if (flipy) dy = _mm_sub_epi32(sh, dy);
+        inside = _mm_and_si128(
+            _mm_and_si128(_mm_cmpgt_epi32(dx, minus1), _mm_cmplt_epi32(dx, sw)),
+            _mm_and_si128(_mm_cmpgt_epi32(dy, minus1), _mm_cmplt_epi32(dy, sh)));
+
+        if (_mm_movemask_epi8(inside)) {
+            int ix[4], iy[4], mask[4];
+            Uint32 c00[4], c01[4], c10[4], c11[4];
+            __m128i exlo, exhi, eylo, eyhi, t1, t2, lo, hi, a, b, c, d, result;
+
+            _mm_storeu_si128((__m128i *) ix, dx);
+            _mm_storeu_si128((__m128i *) iy, dy);
+            _mm_storeu_si128((__m128i *) mask, inside);
+            for (i = 0; i < 4; ++i) {
+                if (mask[i]) {
+                    const Uint8 *sp = (const Uint8 *)src->pixels + src->pitch * iy[i] + ix[i] * 4;
+                    const Uint32 *r0 = (const Uint32 *)(sp + oy0);
+                    const Uint32 *r1 = (const Uint32 *)(sp + oy1);
+                    c00[i] = r0[ox0];
+                    c01[i] = r0[ox1];
+                    c10[i] = r1[ox0];
+                    c11[i] = r1[ox1];
+                } else {
+                    c00[i] = c01[i] = c10[i] = c11[i] = 0;
+                }
+            }
+
+            spreadFractions_SSE2(_mm_and_si128(vsdx, fraction), &exlo, &exhi);
+            spreadFractions_SSE2(_mm_and_si128(vsdy, fraction), &eylo, &eyhi);
+            a = _mm_loadu_si128((const __m128i *) c00);
+            b = _mm_loadu_si128((const __m128i *) c01);
+            c = _mm_loadu_si128((const __m128i *) c10);
+            d = _mm_loadu_si128((const __m128i *) c11);
+
+            t1 = lerpChannels_SSE2(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero), exlo);
+            t2 = lerpChannels_SSE2(_mm_unpacklo_epi8(c, zero), _mm_unpacklo_epi8(d, zero), exlo);
+            lo = lerpChannels_SSE2(t1, t2, eylo);
+            t1 = lerpChannels_SSE2(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero), exhi);
+            t2 = lerpChannels_SSE2(_mm_unpackhi_epi8(c, zero), _mm_unpackhi_epi8(d, zero), exhi);
+            hi = lerpChannels_SSE2(t1, t2, eyhi);
+
+            result = _mm_packus_epi16(lo, hi);
+            result = _mm_or_si128(_mm_and_si128(inside, result),
+                                  _mm_andnot_si128(inside, _mm_loadu_si128((const __m128i *) dst)));
+            _mm_storeu_si128((__m128i *) dst, result);
+        }
+
+        vsdx = _mm_add_epi32(vsdx, stepx);
+        vsdy = _mm_add_epi32(vsdy, stepy);
+    }
+    return x;
+}
+
+#endif /* SDL_SSE2_INTRINSICS */
+
+#if SDL_AVX2_INTRINSICS
+
+/* The AVX2 versions gather the source pixels, which needs the pitch in pixels */
+
+SDL_TARGETING("avx2") static SDL_INLINE __m256i
+lerpChannels_AVX2(__m256i a, __m256i b, __m256i f)
+{
+    const __m256i d = _mm256_sub_epi16(b, a);
+    __m256i r = _mm256_mulhi_epi16(d, f);
+    r = _mm256_add_epi16(r, _mm256_and_si256(d, _mm256_srai_epi16(f, 15)));
+    return _mm256_add_epi16(r, a);
+}
+
+SDL_TARGETING("avx2") static int
+transformRowRGBA_AVX2(SDL_Surface * src, void *pc, int width, int sdx, int sdy, int icos, int isin, int flipx, int flipy)
+{
+    const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i w = _mm256_set1_epi32(src->w);
+    const __m256i h = _mm256_set1_epi32(src->h);
+    const __m256i sw = _mm256_set1_epi32(src->w - 1);
+    const __m256i sh = _mm256_set1_epi32(src->h - 1);
+    const __m256i minus1 = _mm256_set1_epi32(-1);
+    const __m256i pitch = _mm256_set1_epi32(src->pitch / 4);
+    const __m256i stepx = _mm256_set1_epi32(8 * icos);
+    const __m256i stepy = _mm256_set1_epi32(8 * isin);
+    __m256i vsdx = _mm256_add_epi32(_mm256_set1_epi32(sdx), _mm256_mullo_epi32(lanes, _mm256_set1_epi32(icos)));
+    __m256i vsdy = _mm256_add_epi32(_mm256_set1_epi32(sdy), _mm256_mullo_epi32(lanes, _mm256_set1_epi32(isin)));
+    int *dst = (int *) pc;
+    int x;
+
+    if (src->pitch & 3) {
+        return 0;
+    }
+
+    for (x = 0; x + 8 <= width; x += 8, dst += 8) {
+        __m256i dx = _mm256_srai_epi32(vsdx, 16);
+        __m256i dy = _mm256_srai_epi32(vsdy, 16);
+        const __m256i inside = _mm256_and_si256(
+            _mm256_and_si256(_mm256_cmpgt_epi32(dx, minus1), _mm256_cmpgt_epi32(w, dx)),
+            _mm256_and_si256(_mm256_cmpgt_epi32(dy, minus1), _mm256_cmpgt_epi32(h, dy)));
+
+        vsdx = _mm256_add_epi32(vsdx, stepx);
+        vsdy = _mm256_add_epi32(vsdy, stepy);
+
+        if (!_mm256_testz_si256(inside, inside)) {
+            __m256i index, result;
+
+            if (flipx) dx = _mm256_sub_epi32(sw, dx);
+            if (flipy) dy = _mm256_sub_epi32(sh, dy);
+            index = _mm256_add_epi32(_mm256_mullo_epi32(dy, pitch), dx);
+            result = _mm256_mask_i32gather_epi32(_mm256_setzero_si256(), (const int *) src->pixels, index, inside, 4);
+            _mm256_maskstore_epi32(dst, inside, result);
+        }
+    }
+    return x;
+}
+
+SDL_TARGETING("avx2") static int
+transformRowRGBASmooth_AVX2(SDL_Surface * src, void *pc, int width, int sdx, int sdy, int icos, int isin, int flipx, int flipy)
+{
+    const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i sw = _mm256_set1_epi32(src->w - 1);
+    const __m256i sh = _mm256_set1_epi32(src->h - 1);
+    const __m256i minus1 = _mm256_set1_epi32(-1);
+    const __m256i fraction = _mm256_set1_epi32(0xffff);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i pitch = _mm256_set1_epi32(src->pitch / 4);
+    const __m256i stepx = _mm256_set1_epi32(8 * icos);
+    const __m256i stepy = _mm256_set1_epi32(8 * isin);
+    /* Offsets of the corners, swapped when flipping like the C code does */
+    const int ox0 = flipx ? 1 : 0, ox1 = 1 - ox0;
+    const int oy0 = flipy ? src->pitch / 4 : 0, oy1 = src->pitch / 4 - oy0;
+    const __m256i o00 = _mm256_set1_epi32(oy0 + ox0);
+    const __m256i o01 = _mm256_set1_epi32(oy0 + ox1);
+    const __m256i o10 = _mm256_set1_epi32(oy1 + ox0);
+    const __m256i o11 = _mm256_set1_epi32(oy1 + ox1);
+    const int *pixels = (const int *) src->pixels;
+    __m256i vsdx = _mm256_add_epi32(_mm256_set1_epi32(sdx), _mm256_mullo_epi32(lanes, _mm256_set1_epi32(icos)));
+    __m256i vsdy = _mm256_add_epi32(_mm256_set1_epi32(sdy), _mm256_mullo_epi32(lanes, _mm256_set1_epi32(isin)));
+    int *dst = (int *) pc;
+    int x;
+
+    if (src->pitch & 3) {
+        return 0;
+    }
+
+    for (x = 0; x + 8 <= width; x += 8, dst += 8) {
+        __m256i dx = _mm256_srai_epi32(vsdx, 16);
+        __m256i dy = _mm256_srai_epi32(vsdy, 16);
+        __m256i inside;
+
+        if (flipx) dx = _mm256_sub_epi32(sw, dx);
+        if (flipy) dy = _mm256_sub_epi32(sh, dy);
+        inside = _mm256_and_si256(
+            _mm256_and_si256(_mm256_cmpgt_epi32(dx, minus1), _mm256_cmpgt_epi32(sw, dx)),
+            _mm256_and_si256(_mm256_cmpgt_epi32(dy, minus1), _mm256_cmpgt_epi32(sh, dy)));
+
+        if (!_mm256_testz_si256(inside, inside)) {
+            const __m256i index = _mm256_add_epi32(_mm256_mullo_epi32(dy, pitch), dx);
+            const __m256i a = _mm256_mask_i32gather_epi32(zero, pixels, _mm256_add_epi32(index, o00), inside, 4);
+            const __m256i b = _mm256_mask_i32gather_epi32(zero, pixels, _mm256_add_epi32(index, o01), inside, 4);
+            const __m256i c = _mm256_mask_i32gather_epi32(zero, pixels, _mm256_add_epi32(index, o10), inside, 4);
+            const __m256i d = _mm256_mask_i32gather_epi32(zero, pixels, _mm256_add_epi32(index, o11), inside, 4);
+            __m256i ex = _mm256_and_si256(vsdx, fraction);
+            __m256i ey = _mm256_and_si256(vsdy, fraction);
+            __m256i exlo, exhi, eylo, eyhi, t1, t2, lo, hi;
+
+            /* Unpacking works within 128-bit lanes, so the fractions follow the same pattern */
+            ex = _mm256_or_si256(ex, _mm256_slli_epi32(ex, 16));
+            ey = _mm256_or_si256(ey, _mm256_slli_epi32(ey, 16));
+            exlo = _mm256_unpacklo_epi32(ex, ex);
+            exhi = _mm256_unpackhi_epi32(ex, ex);
+            eylo = _mm256_unpacklo_epi32(ey, ey);
+            eyhi = _mm256_unpackhi_epi32(ey, ey);
+
+            t1 = lerpChannels_AVX2(_mm256_unpacklo_epi8(a, zero), _mm256_unpacklo_epi8(b, zero), exlo);
+            t2 = lerpChannels_AVX2(_mm256_unpacklo_epi8(c, zero), _mm256_unpacklo_epi8(d, zero), exlo);
+            lo = lerpChannels_AVX2(t1, t2, eylo);
+            t1 = lerpChannels_AVX2(_mm256_unpackhi_epi8(a, zero), _mm256_unpackhi_epi8(b, zero), exhi);
+            t2 = lerpChannels_AVX2(_mm256_unpackhi_epi8(c, zero), _mm256_unpackhi_epi8(d, zero), exhi);
+            hi = lerpChannels_AVX2(t1, t2, eyhi);
+
+            _mm256_maskstore_epi32(dst, inside, _mm256_packus_epi16(lo, hi));
+        }
+
+        vsdx = _mm256_add_epi32(vsdx, stepx);
+        vsdy = _mm256_add_epi32(vsdy, stepy);
+    }
+    return x;
+}
+
+/* 8-bit pixels are gathered as the aligned 32-bit words holding them, which stay inside
+   the pixel buffer when the pitch is a multiple of 4. */
+SDL_TARGETING("avx2") static int
+transformRowY_AVX2(SDL_Surface * src, void *pc, int width, int sdx, int sdy, int icos, int isin, int flipx, int flipy)
+{
+    const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i w = _mm256_set1_epi32(src->w);
+    const __m256i h = _mm256_set1_epi32(src->h);
+    const __m256i sw = _mm256_set1_epi32(src->w - 1);
+    const __m256i sh = _mm256_set1_epi32(src->h - 1);
+    const __m256i minus1 = _mm256_set1_epi32(-1);
+    const __m256i three = _mm256_set1_epi32(3);
+    const __m256i pitch = _mm256_set1_epi32(src->pitch);
+    const __m256i stepx = _mm256_set1_epi32(8 * icos);
+    const __m256i stepy = _mm256_set1_epi32(8 * isin);
+    __m256i vsdx = _mm256_add_epi32(_mm256_set1_epi32(sdx), _mm256_mullo_epi32(lanes, _mm256_set1_epi32(icos)));
+    __m256i vsdy = _mm256_add_epi32(_mm256_set1_epi32(sdy), _mm256_mullo_epi32(lanes, _mm256_set1_epi32(isin)));
+    Uint8 *dst = (Uint8 *) pc;
+    int x;
+
+    if ((src->pitch & 3) || ((uintptr_t) src->pixels & 3)) {
+        return 0;
+    }
+
+    for (x = 0; x + 8 <= width; x += 8, dst += 8) {
+        __m256i dx = _mm256_srai_epi32(vsdx, 16);
+        __m256i dy = _mm256_srai_epi32(vsdy, 16);
+        const __m256i inside = _mm256_and_si256(
+            _mm256_and_si256(_mm256_cmpgt_epi32(dx, minus1), _mm256_cmpgt_epi32(w, dx)),
+            _mm256_and_si256(_mm256_cmpgt_epi32(dy, minus1), _mm256_cmpgt_epi32(h, dy)));
+
+        vsdx = _mm256_add_epi32(vsdx, stepx);
+        vsdy = _mm256_add_epi32(vsdy, stepy);
+
+        if (!_mm256_testz_si256(inside, inside)) {
+            __m256i offset, words, mask;
+            Uint64 result, keep, old;
+
+            if (flipx) dx = _mm256_sub_epi32(sw, dx);
+            if (flipy) dy = _mm256_sub_epi32(sh, dy);
+            offset = _mm256_add_epi32(_mm256_mullo_epi32(dy, pitch), dx);
+            words = _mm256_mask_i32gather_epi32(_mm256_setzero_si256(), (const int *) src->pixels,
+                                                _mm256_srli_epi32(offset, 2), inside, 4);
+            words = _mm256_srlv_epi32(words, _mm256_slli_epi32(_mm256_and_si256(offset, three), 3));
+            words = _mm256_and_si256(words, _mm256_set1_epi32(0xff));
+
+            /* Narrow the eight pixels and the mask down to bytes */
+            words = _mm256_packus_epi32(words, words);
+            words = _mm256_packus_epi16(words, words);
+            mask = _mm256_packs_epi32(inside, inside);
+            mask = _mm256_packs_epi16(mask, mask);
+            result = (Uint32) _mm_cvtsi128_si32(_mm256_castsi256_si128(words)) |
+                     ((Uint64) (Uint32) _mm_cvtsi128_si32(_mm256_extracti128_si256(words, 1)) << 32);
+            keep = (Uint32) _mm_cvtsi128_si32(_mm256_castsi256_si128(mask)) |
+                   ((Uint64) (Uint32) _mm_cvtsi128_si32(_mm256_extracti128_si256(mask, 1)) << 32);
+            SDL_memcpy(&old, dst, sizeof(old));
+            result = (result & keep) | (old & ~keep);
+            SDL_memcpy(dst, &result, sizeof(result));
+        }
+    }
+    return x;
+}
+
+#endif /* SDL_AVX2_INTRINSICS */
+
+#if SDL_NEON_INTRINSICS && SDL_BYTEORDER == SDL_LIL_ENDIAN
+
+/* Computes a + (((b - a) * f) >> 16) for the four channels of a pixel, like the C code */
+static SDL_INLINE int32x4_t
+lerpChannels_NEON(int32x4_t a, int32x4_t b, int32x4_t f)
+{
+    return vaddq_s32(vshrq_n_s32(vmulq_s32(vsubq_s32(b, a), f), 16), a);
+}
+
+static SDL_INLINE Uint32
+interpolatePixel_NEON(Uint32 c00, Uint32 c01, Uint32 c10, Uint32 c11, int ex, int ey)
+{
+    const uint16x8_t p0 = vmovl_u8(vcreate_u8(((Uint64) c01 << 32) | c00));
+    const uint16x8_t p1 = vmovl_u8(vcreate_u8(((Uint64) c11 << 32) | c10));
+    const int32x4_t a = vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(p0)));
+    const int32x4_t b = vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(p0)));
+    const int32x4_t c = vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(p1)));
+    const int32x4_t d = vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(p1)));
+    const int32x4_t fx = vdupq_n_s32(ex);
+    const int32x4_t t1 = lerpChannels_NEON(a, b, fx);
+    const int32x4_t t2 = lerpChannels_NEON(c, d, fx);
+    const uint16x4_t r = vmovn_u32(vreinterpretq_u32_s32(lerpChannels_NEON(t1, t2, vdupq_n_s32(ey))));
+    return vget_lane_u32(vreinterpret_u32_u8(vmovn_u16(vcombine_u16(r, r))), 0);
+}
+
+static int
+transformRowRGBASmooth_NEON(SDL_Surface * src, void *pc, int width, int sdx, int sdy, int icos, int isin, int flipx, int flipy)
+{
+    const int32x4_t sw = vdupq_n_s32(src->w - 1);
+    const int32x4_t sh = vdupq_n_s32(src->h - 1);
+    const int32x4_t zero = vdupq_n_s32(0);
+    const int32x4_t fraction = vdupq_n_s32(0xffff);
+    const int32x4_t stepx = vdupq_n_s32(4 * icos);
+    const int32x4_t stepy = vdupq_n_s32(4 * isin);
+    /* Offsets of the corners, swapped when flipping like the C code does */
+    const int ox0 = flipx ? 1 : 0, ox1 = 1 - ox0;
+    const int oy0 = flipy ? src->pitch : 0, oy1 = src->pitch - oy0;
+    const int32_t initx[4] = { sdx, sdx + icos, sdx + 2 * icos, sdx + 3 * icos };
+    const int32_t inity[4] = { sdy, sdy + isin, sdy + 2 * isin, sdy + 3 * isin };
+    int32x4_t vsdx = vld1q_s32(initx);
+    int32x4_t vsdy = vld1q_s32(inity);
+    Uint32 *dst = (Uint32 *) pc;
+    int x, i;
+
+    for (x = 0; x + 4 <= width; x += 4, dst += 4) {
+        int32x4_t dx = vshrq_n_s32(vsdx, 16);
+        int32x4_t dy = vshrq_n_s32(vsdy, 16);
+        uint32x4_t inside;
+        uint32x2_t any;
+
+        if (flipx) dx = vsubq_s32(sw, dx);
+        if (flipy) dy = vsubq_s32(sh, dy);
+        inside = vandq_u32(vandq_u32(vcgeq_s32(dx, zero), vcltq_s32(dx, sw)),
+                           vandq_u32(vcgeq_s32(dy, zero), vcltq_s32(dy, sh)));
+        any = vorr_u32(vget_low_u32(inside), vget_high_u32(inside));
+
+        if (vget_lane_u32(vpmax_u32(any, any), 0)) {
+            int32_t ix[4], iy[4], ex[4], ey[4];
+            Uint32 mask[4];
+
+            vst1q_s32(ix, dx);
+            vst1q_s32(iy, dy);
+            vst1q_s32(ex, vandq_s32(vsdx, fraction));
+            vst1q_s32(ey, vandq_s32(vsdy, fraction));
+            vst1q_u32(mask, inside);
+            for (i = 0; i < 4; ++i) {
+                if (mask[i]) {
+                    const Uint8 *sp = (const Uint8 *)src->pixels + src->pitch * iy[i] + ix[i] * 4;
+                    const Uint32 *r0 = (const Uint32 *)(sp + oy0);
+                    const Uint32 *r1 = (const Uint32 *)(sp + oy1);
+                    dst[i] = interpolatePixel_NEON(r0[ox0], r0[ox1], r1[ox0], r1[ox1], ex[i], ey[i]);
+                }
+            }
+        }
+
+        vsdx = vaddq_s32(vsdx, stepx);
+        vsdy = vaddq_s32(vsdy, stepy);
+    }
+    return x;
+}
+
+#endif /* SDL_NEON_INTRINSICS */
+
 /* !
 \brief Internal 32 bit rotozoomer with optional anti-aliasing.
 
@@ -217,6 +696,7 @@ parameters by scanning the destination surface and applying optionally anti-alia
 by bilinear interpolation.
 Assumes src and dst surfaces are of 32 bit depth.
 Assumes dst surface was allocated with the correct dimensions.
+Uses AVX2, or SSE2 and NEON when smoothing, for most of each row when the CPU supports it.
 
 \param src Source surface.
 \param dst Destination surface.
@@ -231,10 +711,10 @@ Assumes dst surface was allocated with the correct dimensions.
 static void
 _transformSurfaceRGBA(SDL_Surface * src, SDL_Surface * dst, int cx, int cy, int isin, int icos, int flipx, int flipy, int smooth)
 {
-    int x, y, t1, t2, dx, dy, xd, yd, sdx, sdy, ax, ay, ex, ey, sw, sh;
-    tColorRGBA c00, c01, c10, c11, cswap;
-    tColorRGBA *pc, *sp;
+    int x, y, dy, xd, yd, sdx, sdy, ax, ay;
+    tColorRGBA *pc;
     int gap;
+    tTransformRow transformRow = NULL;
 
     /*
     * Variable setup
@@ -243,84 +723,56 @@ _transformSurfaceRGBA(SDL_Surface * src, SDL_Surface * dst, int cx, int cy, int
     yd = ((src->h - dst->h) << 15);
     ax = (cx << 16) - (icos * cx);
     ay = (cy << 16) - (isin * cx);
-    sw = src->w - 1;
-    sh = src->h - 1;
     pc = (tColorRGBA*) dst->pixels;
     gap = dst->pitch - dst->w * 4;
 
+#if SDL_AVX2_INTRINSICS
+    if (!transformRow && SDL_CPUFeatureEnabled(CPU_HAS_AVX2)) {
+        transformRow = smooth ? transformRowRGBASmooth_AVX2 : transformRowRGBA_AVX2;
+    }
+#endif
+#if SDL_SSE2_INTRINSICS
+    /* Without a gather instruction, only the interpolation is worth doing with SIMD */
+    if (!transformRow && smooth && SDL_CPUFeatureEnabled(CPU_HAS_SSE2)) {
+        transformRow = transformRowRGBASmooth_SSE2;
+    }
+#endif
+#if SDL_NEON_INTRINSICS && SDL_BYTEORDER == SDL_LIL_ENDIAN
+    if (!transformRow && smooth && SDL_CPUFeatureEnabled(CPU_HAS_NEON)) {
+        transformRow = transformRowRGBASmooth_NEON;
+    }
+#endif
+
     /*
     * Switch between interpolating and non-interpolating code
     */
-    if (smooth) {
-        for (y = 0; y < dst->h; y++) {
-            dy = cy - y;
-            sdx = (ax + (isin * dy)) + xd;
-            sdy = (ay - (icos * dy)) + yd;
-            for (x = 0; x < dst->w; x++) {
-                dx = (sdx >> 16);
-                dy = (sdy >> 16);
-                if (flipx) dx = sw - dx;
-                if (flipy) dy = sh - dy;
-                if ((dx > -1) && (dy > -1) && (dx < (src->w-1)) && (dy < (src->h-1))) {
-                    sp = (tColorRGBA *) ((Uint8 *) src->pixels + src->pitch * dy) + dx;
-                    c00 = *sp;
-                    sp += 1;
-                    c01 = *sp;
-                    sp += (src->pitch/4);
-                    c11 = *sp;
-                    sp -= 1;
-                    c10 = *sp;
-                    if (flipx) {
-                        cswap = c00; c00=c01; c01=cswap;
-                        cswap = c10; c10=c11; c11=cswap;
-                    }
-                    if (flipy) {
-                        cswap = c00; c00=c10; c10=cswap;
-                        cswap = c01; c01=c11; c11=cswap;
-                    }
-                    /*
-                    * Interpolate colors
-                    */
-                    ex = (sdx & 0xffff);
-                    ey = (sdy & 0xffff);
-                    t1 = ((((c01.r - c00.r) * ex) >> 16) + c00.r) & 0xff;
-                    t2 = ((((c11.r - c10.r) * ex) >> 16) + c10.r) & 0xff;
-                    pc->r = (((t2 - t1) * ey) >> 16) + t1;
-                    t1 = ((((c01.g - c00.g) * ex) >> 16) + c00.g) & 0xff;
-                    t2 = ((((c11.g - c10.g) * ex) >> 16) + c10.g) & 0xff;
-                    pc->g = (((t2 - t1) * ey) >> 16) + t1;
-                    t1 = ((((c01.b - c00.b) * ex) >> 16) + c00.b) & 0xff;
-                    t2 = ((((c11.b - c10.b) * ex) >> 16) + c10.b) & 0xff;
-                    pc->b = (((t2 - t1) * ey) >> 16) + t1;
-                    t1 = ((((c01.a - c00.a) * ex) >> 16) + c00.a) & 0xff;
-                    t2 = ((((c11.a - c10.a) * ex) >> 16) + c10.a) & 0xff;
-                    pc->a = (((t2 - t1) * ey) >> 16) + t1;
-                }
+    for (y = 0; y < dst->h; y++) {
+        dy = cy - y;
+        sdx = (ax + (isin * dy)) + xd;
+        sdy = (ay - (icos * dy)) + yd;
+        x = 0;
+        if (transformRow) {
+            x = transformRow(src, pc, dst->w, sdx, sdy, icos, isin, flipx, flipy);
+            sdx += x * icos;
+            sdy += x * isin;
+            pc += x;
+        }
+        if (smooth) {
+            for (; x < dst->w; x++) {
+                transformPixelRGBASmooth(src, pc, sdx, sdy, flipx, flipy);
                 sdx += icos;
                 sdy += isin;
                 pc++;
             }
-            pc = (tColorRGBA *) ((Uint8 *) pc + gap);
-        }
-    } else {
-        for (y = 0; y < dst->h; y++) {
-            dy = cy - y;
-            sdx = (ax + (isin * dy)) + xd;
-            sdy = (ay - (icos * dy)) + yd;
-            for (x = 0; x < dst->w; x++) {
-                dx = (sdx >> 16);
-                dy = (sdy >> 16);
-                if ((unsigned)dx < (unsigned)src->w && (unsigned)dy < (unsigned)src->h) {
-                    if(flipx) dx = sw - dx;
-                    if(flipy) dy = sh - dy;
-                    *pc = *((tColorRGBA *)((Uint8 *)src->pixels + src->pitch * dy) + dx);
-                }
+        } else {
+            for (; x < dst->w; x++) {
+                transformPixelRGBA(src, pc, sdx, sdy, flipx, flipy);
                 sdx += icos;
                 sdy += isin;
                 pc++;
             }
-            pc = (tColorRGBA *) ((Uint8 *) pc + gap);
         }
+        pc = (tColorRGBA *) ((Uint8 *) pc + gap);
     }
 }
 
@@ -332,6 +784,7 @@ Rotates and zooms 8 bit RGBA/ABGR 'src' surface to 'dst' surface based on the co
 parameters by scanning the destination surface.
 Assumes src and dst surfaces are of 8 bit depth.
 Assumes dst surface was allocated with the correct dimensions.
+Uses AVX2 for most of each row when the CPU supports it.
 
 \param src Source surface.
 \param dst Destination surface.
@@ -348,6 +801,7 @@ transformSurfaceY(SDL_Surface * src, SDL_Surface * dst, int cx, int cy, int isin
     int x, y, dx, dy, xd, yd, sdx, sdy, ax, ay;
     tColorY *pc;
     int gap;
+    tTransformRow transformRow = NULL;
 
     /*
     * Variable setup
@@ -358,6 +812,13 @@ transformSurfaceY(SDL_Surface * src, SDL_Surface * dst, int cx, int cy, int isin
     ay = (cy << 16) - (isin * cx);
     pc = (tColorY*) dst->pixels;
     gap = dst->pitch - dst->w;
+
+#if SDL_AVX2_INTRINSICS
+    if (SDL_CPUFeatureEnabled(CPU_HAS_AVX2)) {
+        transformRow = transformRowY_AVX2;
+    }
+#endif
+
     /*
     * Clear surface to colorkey
     */
@@ -369,7 +830,14 @@ transformSurfaceY(SDL_Surface * src, SDL_Surface * dst, int cx, int cy, int isin
         dy = cy - y;
         sdx = (ax + (isin * dy)) + xd;
         sdy = (ay - (icos * dy)) + yd;
-        for (x = 0; x < dst->w; x++) {
+        x = 0;
+        if (transformRow) {
+            x = transformRow(src, pc, dst->w, sdx, sdy, icos, isin, flipx, flipy);
+            sdx += x * icos;
+            sdy += x * isin;
+            pc += x;
+        }
+        for (; x < dst->w; x++) {
             dx = (sdx >> 16);
             dy = (sdy >> 16);
             if ((unsigned)dx < (unsigned)src->w && (unsigned)dy < (unsigned)src->h) {
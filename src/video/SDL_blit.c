@@ -20,6 +20,7 @@
 */
 #include "../SDL_internal.h"
 
+#include "SDL_atomic.h"
 #include "SDL_video.h"
 #include "SDL_sysvideo.h"
 #include "SDL_blit.h"
@@ -28,6 +29,8 @@
 #include "SDL_blit_slow.h"
 #include "SDL_RLEaccel_c.h"
 #include "SDL_pixels_c.h"
+#include "../cpuinfo/SDL_cpuinfo_c.h"
+#include "../cpuinfo/SDL_simd.h"
 
 /* The general purpose software blit routine */
 static int SDLCALL
@@ -126,44 +129,72 @@ SDL_UseAltivecPrefetch()
 }
 #endif /* __MACOSX__ */
 
-static SDL_BlitFunc
-SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
-                   SDL_BlitFuncEntry * entries)
+/* The CPU features the blitters may use, worked out again only after
+   SDL_HINT_CPU_DISABLE_FEATURES changed. Blit maps are also built on the
+   threads of SDL_ConvertPixels(), so the pair is only used under the lock. */
+static int
+SDL_GetBlitCPUFeatures(void)
 {
-    int i, flagcheck = (flags & (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_COLORKEY | SDL_COPY_NEAREST));
-    static int features = 0x7fffffff;
-
-    /* Get the available CPU features */
-    if (features == 0x7fffffff) {
-        const char *override = SDL_getenv("SDL_BLIT_CPU_FEATURES");
-
-        features = SDL_CPU_ANY;
+    static SDL_SpinLock features_lock = 0;
+    static int features = SDL_CPU_ANY;
+    static int features_generation = -1;
+    const int generation = SDL_GetCPUFeaturesGeneration();
+    const char *override;
+    int mask = SDL_CPU_ANY;
+
+    SDL_AtomicLock(&features_lock);
+    if (generation == features_generation) {
+        mask = features;
+        SDL_AtomicUnlock(&features_lock);
+        return mask;
+    }
 
-        /* Allow an override for testing .. */
-        if (override) {
-            SDL_sscanf(override, "%u", &features);
-        } else {
-            if (SDL_HasMMX()) {
-                features |= SDL_CPU_MMX;
-            }
-            if (SDL_Has3DNow()) {
-                features |= SDL_CPU_3DNOW;
-            }
-            if (SDL_HasSSE()) {
-                features |= SDL_CPU_SSE;
-            }
-            if (SDL_HasSSE2()) {
-                features |= SDL_CPU_SSE2;
-            }
-            if (SDL_HasAltiVec()) {
-                if (SDL_UseAltivecPrefetch()) {
-                    features |= SDL_CPU_ALTIVEC_PREFETCH;
-                } else {
-                    features |= SDL_CPU_ALTIVEC_NOPREFETCH;
-                }
+    /* Allow an override for testing .. */
+    override = SDL_getenv("SDL_BLIT_CPU_FEATURES");
+    if (override) {
+        SDL_sscanf(override, "%u", &mask);
+    } else {
+        if (SDL_CPUFeatureEnabled(CPU_HAS_MMX)) {
+            mask |= SDL_CPU_MMX;
+        }
+        if (SDL_CPUFeatureEnabled(CPU_HAS_3DNOW)) {
+            mask |= SDL_CPU_3DNOW;
+        }
+        if (SDL_CPUFeatureEnabled(CPU_HAS_SSE)) {
+            mask |= SDL_CPU_SSE;
+        }
+        if (SDL_CPUFeatureEnabled(CPU_HAS_SSE2)) {
+            mask |= SDL_CPU_SSE2;
+        }
+        if (SDL_CPUFeatureEnabled(CPU_HAS_SSE41)) {
+            mask |= SDL_CPU_SSE41;
+        }
+        if (SDL_CPUFeatureEnabled(CPU_HAS_AVX2)) {
+            mask |= SDL_CPU_AVX2;
+        }
+        if (SDL_CPUFeatureEnabled(CPU_HAS_NEON)) {
+            mask |= SDL_CPU_NEON;
+        }
+        if (SDL_CPUFeatureEnabled(CPU_HAS_ALTIVEC)) {
+            if (SDL_UseAltivecPrefetch()) {
+                mask |= SDL_CPU_ALTIVEC_PREFETCH;
+            } else {
+                mask |= SDL_CPU_ALTIVEC_NOPREFETCH;
             }
         }
     }
+    features = mask;
+    features_generation = generation;
+    SDL_AtomicUnlock(&features_lock);
+    return mask;
+}
+
+static SDL_BlitFunc
+SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
+                   SDL_BlitFuncEntry * entries)
+{
+    int i, flagcheck = (flags & (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_COLORKEY | SDL_COPY_NEAREST));
+    const int features = SDL_GetBlitCPUFeatures();
 
     for (i = 0; entries[i].func; ++i) {
         /* Check for matching pixel formats */
@@ -24,6 +24,8 @@
 
 #include "SDL_video.h"
 #include "SDL_blit.h"
+#include "../cpuinfo/SDL_cpuinfo_c.h"
+#include "../cpuinfo/SDL_simd.h"
 
 /* Functions to perform alpha blended blitting */
 
@@ -1208,6 +1210,601 @@ BlitARGBto555PixelAlpha(SDL_BlitInfo * info)
     }
 }
 
+#if defined(SDL_SSE2_INTRINSICS) || defined(SDL_AVX2_INTRINSICS)
+
+/* The SSE2 and AVX2 blitters below give the same results as the MMX blitters
+   for RGB to RGB, and as the C blitters for 565. These per-pixel versions
+   handle the end of the rows that don't fill a whole register. */
+
+/* ARGB8888->(A)RGB888 blending with pixel alpha, as in BlitRGBtoRGBPixelAlphaMMX */
+static SDL_INLINE Uint32
+BlendRGBtoRGBPixelAlpha(Uint32 s, Uint32 d)
+{
+    const Uint32 alpha = s >> 24;
+    Uint32 result;
+    int shift;
+
+    if (alpha == 0) {
+        return d;
+    } else if (alpha == SDL_ALPHA_OPAQUE) {
+        return s;
+    }
+
+    result = ((alpha * 0xff >> 8) + ((d >> 24) * (alpha ^ 0xff) >> 8)) << 24;
+    for (shift = 0; shift < 24; shift += 8) {
+        const Uint32 sc = (s >> shift) & 0xff;
+        const Uint32 dc = (d >> shift) & 0xff;
+        result |= ((sc * alpha >> 8) + (dc * (alpha ^ 0xff) >> 8)) << shift;
+    }
+    return result;
+}
+
+/* RGB888->(A)RGB888 blending with surface alpha, as in BlitRGBtoRGBSurfaceAlphaMMX */
+static SDL_INLINE Uint32
+BlendRGBtoRGBSurfaceAlpha(Uint32 s, Uint32 d, int alpha, Uint32 chanmask, Uint32 dalpha)
+{
+    Uint32 result = d & ~chanmask;
+    int shift;
+
+    for (shift = 0; shift < 32; shift += 8) {
+        if (chanmask & (0xffu << shift)) {
+            const int sc = (s >> shift) & 0xff;
+            const int dc = (d >> shift) & 0xff;
+            result |= (Uint32)((dc + ((sc - dc) * alpha >> 8)) & 0xff) << shift;
+        }
+    }
+    return result | dalpha;
+}
+
+/* ARGB8888->RGB565 blending with pixel alpha, as in BlitARGBto565PixelAlpha */
+static SDL_INLINE Uint16
+BlendARGBto565PixelAlpha(Uint32 s, Uint16 dst)
+{
+    const unsigned alpha = s >> 27; /* downscale alpha to 5 bits */
+    Uint32 d = dst;
+
+    if (alpha == 0) {
+        return dst;
+    } else if (alpha == (SDL_ALPHA_OPAQUE >> 3)) {
+        return (Uint16)((s >> 8 & 0xf800) + (s >> 5 & 0x7e0) + (s >> 3 & 0x1f));
+    }
+    s = ((s & 0xfc00) << 11) + (s >> 8 & 0xf800) + (s >> 3 & 0x1f);
+    d = (d | d << 16) & 0x07e0f81f;
+    d += (s - d) * alpha >> 5;
+    d &= 0x07e0f81f;
+    return (Uint16)(d | d >> 16);
+}
+
+/* RGB888->RGB565 blending with surface alpha, as in BlitNtoNSurfaceAlpha */
+static SDL_INLINE Uint16
+BlendRGBto565SurfaceAlpha(Uint32 s, Uint16 d, unsigned alpha, const SDL_PixelFormat *srcfmt, const SDL_PixelFormat *dstfmt)
+{
+    unsigned sR, sG, sB;
+    unsigned dR, dG, dB;
+    Uint32 Pixel;
+
+    RGB_FROM_PIXEL(s, srcfmt, sR, sG, sB);
+    RGB_FROM_PIXEL(d, dstfmt, dR, dG, dB);
+    ALPHA_BLEND_RGB(sR, sG, sB, alpha, dR, dG, dB);
+    PIXEL_FROM_RGB(Pixel, dstfmt, dR, dG, dB);
+    return (Uint16)Pixel;
+}
+
+#endif /* SDL_SSE2_INTRINSICS || SDL_AVX2_INTRINSICS */
+
+#if defined(SDL_SSE2_INTRINSICS)
+
+/* SSE2 has no 32-bit multiply that keeps the low half of the products */
+static SDL_INLINE __m128i
+MulLo32SSE2(__m128i a, __m128i b)
+{
+    const __m128i even = _mm_mul_epu32(a, b);
+    const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                              _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+/* fast ARGB888->(A)RGB888 blending with pixel alpha, 4 pixels at a time */
+static void
+BlitRGBtoRGBPixelAlphaSSE2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i opaque = _mm_set1_epi32(SDL_ALPHA_OPAQUE);
+    const __m128i mask = _mm_set1_epi16(0xff);
+    const __m128i amask = _mm_set_epi16(0xff, 0, 0, 0, 0xff, 0, 0, 0);   /* source alpha is multiplied by 0xff */
+
+    while (height--) {
+        int n = width;
+
+        for (; n >= 4; n -= 4) {
+            const __m128i src = _mm_loadu_si128((const __m128i *)srcp);
+            const __m128i dst = _mm_loadu_si128((const __m128i *)dstp);
+            const __m128i alpha = _mm_srli_epi32(src, 24);
+            const __m128i is_clear = _mm_cmpeq_epi32(alpha, zero);
+            const __m128i is_opaque = _mm_cmpeq_epi32(alpha, opaque);
+
+            if (_mm_movemask_epi8(is_clear) != 0xffff) {
+                __m128i a, a_lo, a_hi, lo, hi, res;
+
+                a = _mm_or_si128(alpha, _mm_slli_epi32(alpha, 16));   /* 0A0A per pixel */
+                a_lo = _mm_unpacklo_epi32(a, a);                        /* 0A0A0A0A for pixels 0 and 1 */
+                a_hi = _mm_unpackhi_epi32(a, a);                        /* 0A0A0A0A for pixels 2 and 3 */
+
+                lo = _mm_add_epi16(
+                    _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(src, zero), _mm_or_si128(a_lo, amask)), 8),
+                    _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(dst, zero), _mm_xor_si128(a_lo, mask)), 8));
+                hi = _mm_add_epi16(
+                    _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(src, zero), _mm_or_si128(a_hi, amask)), 8),
+                    _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(dst, zero), _mm_xor_si128(a_hi, mask)), 8));
+                res = _mm_packus_epi16(lo, hi);
+
+                /* Opaque pixels are copied, transparent pixels are left alone */
+                res = _mm_or_si128(_mm_and_si128(is_opaque, src), _mm_andnot_si128(is_opaque, res));
+                res = _mm_or_si128(_mm_and_si128(is_clear, dst), _mm_andnot_si128(is_clear, res));
+                _mm_storeu_si128((__m128i *)dstp, res);
+            }
+            srcp += 4;
+            dstp += 4;
+        }
+        while (n--) {
+            *dstp = BlendRGBtoRGBPixelAlpha(*srcp, *dstp);
+            ++srcp;
+            ++dstp;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* fast RGB888->(A)RGB888 blending with surface alpha, 4 pixels at a time */
+static void
+BlitRGBtoRGBSurfaceAlphaSSE2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    SDL_PixelFormat *df = info->dst_fmt;
+    const int alpha = info->a;
+    const Uint32 dalpha = df->Amask;
+    const Uint32 chanmask = (0xff << df->Rshift) | (0xff << df->Gshift) | (0xff << df->Bshift);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dsta = _mm_set1_epi32(dalpha);
+    __m128i mm_alpha;
+
+    /* 0A0A0A0A for 2 pixels, minus the channel that isn't color */
+    mm_alpha = _mm_unpacklo_epi8(_mm_set1_epi32((alpha * 0x01010101) & chanmask), zero);
+
+    while (height--) {
+        int n = width;
+
+        for (; n >= 4; n -= 4) {
+            const __m128i src = _mm_loadu_si128((const __m128i *)srcp);
+            const __m128i dst = _mm_loadu_si128((const __m128i *)dstp);
+            __m128i lo, hi, d_lo, d_hi;
+
+            /* dst + (src - dst) * alpha >> 8, wrapping in 8 bits */
+            d_lo = _mm_unpacklo_epi8(dst, zero);
+            d_hi = _mm_unpackhi_epi8(dst, zero);
+            lo = _mm_mullo_epi16(_mm_sub_epi16(_mm_unpacklo_epi8(src, zero), d_lo), mm_alpha);
+            hi = _mm_mullo_epi16(_mm_sub_epi16(_mm_unpackhi_epi8(src, zero), d_hi), mm_alpha);
+            lo = _mm_add_epi8(_mm_srli_epi16(lo, 8), d_lo);
+            hi = _mm_add_epi8(_mm_srli_epi16(hi, 8), d_hi);
+
+            _mm_storeu_si128((__m128i *)dstp, _mm_or_si128(_mm_packus_epi16(lo, hi), dsta));
+            srcp += 4;
+            dstp += 4;
+        }
+        while (n--) {
+            *dstp = BlendRGBtoRGBSurfaceAlpha(*srcp, *dstp, alpha, chanmask, dalpha);
+            ++srcp;
+            ++dstp;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* fast ARGB8888->RGB565 blending with pixel alpha, 4 pixels at a time */
+static void
+BlitARGBto565PixelAlphaSSE2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint16 *dstp = (Uint16 *) info->dst;
+    int dstskip = info->dst_skip >> 1;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i opaque = _mm_set1_epi32(SDL_ALPHA_OPAQUE >> 3);
+    const __m128i mask = _mm_set1_epi32(0x07e0f81f);
+
+    while (height--) {
+        int n = width;
+
+        for (; n >= 4; n -= 4) {
+            const __m128i src = _mm_loadu_si128((const __m128i *)srcp);
+            const __m128i dst = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)dstp), zero);
+            const __m128i alpha = _mm_srli_epi32(src, 27);
+            const __m128i is_clear = _mm_cmpeq_epi32(alpha, zero);
+            const __m128i is_opaque = _mm_cmpeq_epi32(alpha, opaque);
+
+            if (_mm_movemask_epi8(is_clear) != 0xffff) {
+                __m128i s, d, res, copy;
+
+                /* Convert source and destination to G0RAB65565, and blend all components at the same time */
+                s = _mm_add_epi32(_mm_add_epi32(
+                        _mm_slli_epi32(_mm_and_si128(src, _mm_set1_epi32(0xfc00)), 11),
+                        _mm_and_si128(_mm_srli_epi32(src, 8), _mm_set1_epi32(0xf800))),
+                        _mm_and_si128(_mm_srli_epi32(src, 3), _mm_set1_epi32(0x1f)));
+                d = _mm_and_si128(_mm_or_si128(dst, _mm_slli_epi32(dst, 16)), mask);
+                d = _mm_add_epi32(d, _mm_srli_epi32(MulLo32SSE2(_mm_sub_epi32(s, d), alpha), 5));
+                d = _mm_and_si128(d, mask);
+                res = _mm_or_si128(d, _mm_srli_epi32(d, 16));
+
+                copy = _mm_add_epi32(_mm_add_epi32(
+                        _mm_and_si128(_mm_srli_epi32(src, 8), _mm_set1_epi32(0xf800)),
+                        _mm_and_si128(_mm_srli_epi32(src, 5), _mm_set1_epi32(0x7e0))),
+                        _mm_and_si128(_mm_srli_epi32(src, 3), _mm_set1_epi32(0x1f)));
+                res = _mm_or_si128(_mm_and_si128(is_opaque, copy), _mm_andnot_si128(is_opaque, res));
+                res = _mm_or_si128(_mm_and_si128(is_clear, dst), _mm_andnot_si128(is_clear, res));
+
+                /* Keep the low 16 bits, sign extended so they survive the saturation */
+                res = _mm_srai_epi32(_mm_slli_epi32(res, 16), 16);
+                _mm_storel_epi64((__m128i *)dstp, _mm_packs_epi32(res, res));
+            }
+            srcp += 4;
+            dstp += 4;
+        }
+        while (n--) {
+            *dstp = BlendARGBto565PixelAlpha(*srcp, *dstp);
+            ++srcp;
+            ++dstp;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* One color channel of 8 pixels, blended as in ALPHA_BLEND_RGB: dst + (src - dst) * alpha / 255 */
+static SDL_INLINE __m128i
+BlendChannelSSE2(__m128i s, __m128i d, __m128i alpha)
+{
+    const __m128i diff = _mm_sub_epi16(s, d);
+    const __m128i sign = _mm_srai_epi16(diff, 15);
+    __m128i v;
+
+    /* Divide the magnitude, so the quotient is truncated towards zero like in C.
+       v / 255 == (v + 1 + (v >> 8)) >> 8 for any v <= 255 * 255 */
+    v = _mm_mullo_epi16(_mm_sub_epi16(_mm_xor_si128(diff, sign), sign), alpha);
+    v = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(v, _mm_set1_epi16(1)), _mm_srli_epi16(v, 8)), 8);
+    return _mm_add_epi16(d, _mm_sub_epi16(_mm_xor_si128(v, sign), sign));
+}
+
+/* fast RGB888->RGB565 blending with surface alpha, 8 pixels at a time */
+static void
+BlitRGBto565SurfaceAlphaSSE2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint16 *dstp = (Uint16 *) info->dst;
+    int dstskip = info->dst_skip >> 1;
+    SDL_PixelFormat *sf = info->src_fmt;
+    SDL_PixelFormat *df = info->dst_fmt;
+    const unsigned alpha = info->a;
+    const __m128i mm_alpha = _mm_set1_epi16(alpha);
+    const __m128i mask8 = _mm_set1_epi32(0xff);
+    const __m128i mask5 = _mm_set1_epi16(0x1f);
+    const __m128i mask6 = _mm_set1_epi16(0x3f);
+    const __m128i sR = _mm_cvtsi32_si128(sf->Rshift), sG = _mm_cvtsi32_si128(sf->Gshift), sB = _mm_cvtsi32_si128(sf->Bshift);
+    const __m128i dR = _mm_cvtsi32_si128(df->Rshift), dG = _mm_cvtsi32_si128(df->Gshift), dB = _mm_cvtsi32_si128(df->Bshift);
+
+    if (!alpha) {
+        return;
+    }
+
+    while (height--) {
+        int n = width;
+
+        for (; n >= 8; n -= 8) {
+            const __m128i src0 = _mm_loadu_si128((const __m128i *)srcp);
+            const __m128i src1 = _mm_loadu_si128((const __m128i *)(srcp + 4));
+            const __m128i dst = _mm_loadu_si128((const __m128i *)dstp);
+            __m128i r, g, b, dr, dg, db;
+
+            /* 8 bits source channels */
+            r = _mm_packs_epi32(_mm_and_si128(_mm_srl_epi32(src0, sR), mask8), _mm_and_si128(_mm_srl_epi32(src1, sR), mask8));
+            g = _mm_packs_epi32(_mm_and_si128(_mm_srl_epi32(src0, sG), mask8), _mm_and_si128(_mm_srl_epi32(src1, sG), mask8));
+            b = _mm_packs_epi32(_mm_and_si128(_mm_srl_epi32(src0, sB), mask8), _mm_and_si128(_mm_srl_epi32(src1, sB), mask8));
+
+            /* Destination channels expanded to 8 bits like SDL_expand_byte does:
+               v * 255 / 31 == (v * 1053) >> 7, v * 255 / 63 == (v << 2) + ((v * 49) >> 10) */
+            dr = _mm_srli_epi16(_mm_mullo_epi16(_mm_and_si128(_mm_srl_epi16(dst, dR), mask5), _mm_set1_epi16(1053)), 7);
+            db = _mm_srli_epi16(_mm_mullo_epi16(_mm_and_si128(_mm_srl_epi16(dst, dB), mask5), _mm_set1_epi16(1053)), 7);
+            dg = _mm_and_si128(_mm_srl_epi16(dst, dG), mask6);
+            dg = _mm_add_epi16(_mm_slli_epi16(dg, 2), _mm_srli_epi16(_mm_mullo_epi16(dg, _mm_set1_epi16(49)), 10));
+
+            r = BlendChannelSSE2(r, dr, mm_alpha);
+            g = BlendChannelSSE2(g, dg, mm_alpha);
+            b = BlendChannelSSE2(b, db, mm_alpha);
+
+            _mm_storeu_si128((__m128i *)dstp, _mm_or_si128(_mm_or_si128(
+                _mm_sll_epi16(_mm_srli_epi16(r, 3), dR),
+                _mm_sll_epi16(_mm_srli_epi16(g, 2), dG)),
+                _mm_sll_epi16(_mm_srli_epi16(b, 3), dB)));
+            srcp += 8;
+            dstp += 8;
+        }
+        while (n--) {
+            *dstp = BlendRGBto565SurfaceAlpha(*srcp, *dstp, alpha, sf, df);
+            ++srcp;
+            ++dstp;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+#endif /* SDL_SSE2_INTRINSICS */
+
+#if defined(SDL_AVX2_INTRINSICS)
+
+/* fast ARGB888->(A)RGB888 blending with pixel alpha, 8 pixels at a time */
+SDL_TARGETING("avx2") static void
+BlitRGBtoRGBPixelAlphaAVX2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i opaque = _mm256_set1_epi32(SDL_ALPHA_OPAQUE);
+    const __m256i mask = _mm256_set1_epi16(0xff);
+    const __m256i amask = _mm256_set1_epi64x(0x00ff000000000000LL);   /* source alpha is multiplied by 0xff */
+
+    while (height--) {
+        int n = width;
+
+        for (; n >= 8; n -= 8) {
+            const __m256i src = _mm256_loadu_si256((const __m256i *)srcp);
+            const __m256i dst = _mm256_loadu_si256((const __m256i *)dstp);
+            const __m256i alpha = _mm256_srli_epi32(src, 24);
+            const __m256i is_clear = _mm256_cmpeq_epi32(alpha, zero);
+            const __m256i is_opaque = _mm256_cmpeq_epi32(alpha, opaque);
+
+            if (_mm256_movemask_epi8(is_clear) != -1) {
+                __m256i a, a_lo, a_hi, lo, hi, res;
+
+                a = _mm256_or_si256(alpha, _mm256_slli_epi32(alpha, 16));
+                a_lo = _mm256_unpacklo_epi32(a, a);
+                a_hi = _mm256_unpackhi_epi32(a, a);
+
+                lo = _mm256_add_epi16(
+                    _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(src, zero), _mm256_or_si256(a_lo, amask)), 8),
+                    _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(dst, zero), _mm256_xor_si256(a_lo, mask)), 8));
+                hi = _mm256_add_epi16(
+                    _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(src, zero), _mm256_or_si256(a_hi, amask)), 8),
+                    _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(dst, zero), _mm256_xor_si256(a_hi, mask)), 8));
+                res = _mm256_packus_epi16(lo, hi);
+
+                res = _mm256_blendv_epi8(res, src, is_opaque);
+                res = _mm256_blendv_epi8(res, dst, is_clear);
+                _mm256_storeu_si256((__m256i *)dstp, res);
+            }
+            srcp += 8;
+            dstp += 8;
+        }
+        while (n--) {
+            *dstp = BlendRGBtoRGBPixelAlpha(*srcp, *dstp);
+            ++srcp;
+            ++dstp;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* fast RGB888->(A)RGB888 blending with surface alpha, 8 pixels at a time */
+SDL_TARGETING("avx2") static void
+BlitRGBtoRGBSurfaceAlphaAVX2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    SDL_PixelFormat *df = info->dst_fmt;
+    const int alpha = info->a;
+    const Uint32 dalpha = df->Amask;
+    const Uint32 chanmask = (0xff << df->Rshift) | (0xff << df->Gshift) | (0xff << df->Bshift);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i dsta = _mm256_set1_epi32(dalpha);
+    __m256i mm_alpha;
+
+    mm_alpha = _mm256_unpacklo_epi8(_mm256_set1_epi32((alpha * 0x01010101) & chanmask), zero);
+
+    while (height--) {
+        int n = width;
+
+        for (; n >= 8; n -= 8) {
+            const __m256i src = _mm256_loadu_si256((const __m256i *)srcp);
+            const __m256i dst = _mm256_loadu_si256((const __m256i *)dstp);
+            __m256i lo, hi, d_lo, d_hi;
+
+            d_lo = _mm256_unpacklo_epi8(dst, zero);
+            d_hi = _mm256_unpackhi_epi8(dst, zero);
+            lo = _mm256_mullo_epi16(_mm256_sub_epi16(_mm256_unpacklo_epi8(src, zero), d_lo), mm_alpha);
+            hi = _mm256_mullo_epi16(_mm256_sub_epi16(_mm256_unpackhi_epi8(src, zero), d_hi), mm_alpha);
+            lo = _mm256_add_epi8(_mm256_srli_epi16(lo, 8), d_lo);
+            hi = _mm256_add_epi8(_mm256_srli_epi16(hi, 8), d_hi);
+
+            _mm256_storeu_si256((__m256i *)dstp, _mm256_or_si256(_mm256_packus_epi16(lo, hi), dsta));
+            srcp += 8;
+            dstp += 8;
+        }
+        while (n--) {
+            *dstp = BlendRGBtoRGBSurfaceAlpha(*srcp, *dstp, alpha, chanmask, dalpha);
+            ++srcp;
+            ++dstp;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* fast ARGB8888->RGB565 blending with pixel alpha, 8 pixels at a time */
+SDL_TARGETING("avx2") static void
+BlitARGBto565PixelAlphaAVX2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint16 *dstp = (Uint16 *) info->dst;
+    int dstskip = info->dst_skip >> 1;
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i opaque = _mm256_set1_epi32(SDL_ALPHA_OPAQUE >> 3);
+    const __m256i mask = _mm256_set1_epi32(0x07e0f81f);
+
+    while (height--) {
+        int n = width;
+
+        for (; n >= 8; n -= 8) {
+            const __m256i src = _mm256_loadu_si256((const __m256i *)srcp);
+            const __m256i dst = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)dstp));
+            const __m256i alpha = _mm256_srli_epi32(src, 27);
+            const __m256i is_clear = _mm256_cmpeq_epi32(alpha, zero);
+            const __m256i is_opaque = _mm256_cmpeq_epi32(alpha, opaque);
+
+            if (_mm256_movemask_epi8(is_clear) != -1) {
+                __m256i s, d, res, copy;
+
+                s = _mm256_add_epi32(_mm256_add_epi32(
+                        _mm256_slli_epi32(_mm256_and_si256(src, _mm256_set1_epi32(0xfc00)), 11),
+                        _mm256_and_si256(_mm256_srli_epi32(src, 8), _mm256_set1_epi32(0xf800))),
+                        _mm256_and_si256(_mm256_srli_epi32(src, 3), _mm256_set1_epi32(0x1f)));
+                d = _mm256_and_si256(_mm256_or_si256(dst, _mm256_slli_epi32(dst, 16)), mask);
+                d = _mm256_add_epi32(d, _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_sub_epi32(s, d), alpha), 5));
+                d = _mm256_and_si256(d, mask);
+                res = _mm256_or_si256(d, _mm256_srli_epi32(d, 16));
+
+                copy = _mm256_add_epi32(_mm256_add_epi32(
+                        _mm256_and_si256(_mm256_srli_epi32(src, 8), _mm256_set1_epi32(0xf800)),
+                        _mm256_and_si256(_mm256_srli_epi32(src, 5), _mm256_set1_epi32(0x7e0))),
+                        _mm256_and_si256(_mm256_srli_epi32(src, 3), _mm256_set1_epi32(0x1f)));
+                res = _mm256_blendv_epi8(res, copy, is_opaque);
+                res = _mm256_blendv_epi8(res, dst, is_clear);
+
+                /* Keep the low 16 bits, the unsigned saturation doesn't clip them */
+                res = _mm256_and_si256(res, _mm256_set1_epi32(0xffff));
+                res = _mm256_permute4x64_epi64(_mm256_packus_epi32(res, res), _MM_SHUFFLE(3, 1, 2, 0));
+                _mm_storeu_si128((__m128i *)dstp, _mm256_castsi256_si128(res));
+            }
+            srcp += 8;
+            dstp += 8;
+        }
+        while (n--) {
+            *dstp = BlendARGBto565PixelAlpha(*srcp, *dstp);
+            ++srcp;
+            ++dstp;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+SDL_TARGETING("avx2") static SDL_INLINE __m256i
+BlendChannelAVX2(__m256i s, __m256i d, __m256i alpha)
+{
+    const __m256i diff = _mm256_sub_epi16(s, d);
+    __m256i v;
+
+    v = _mm256_mullo_epi16(_mm256_abs_epi16(diff), alpha);
+    v = _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(v, _mm256_set1_epi16(1)), _mm256_srli_epi16(v, 8)), 8);
+    return _mm256_add_epi16(d, _mm256_sign_epi16(v, diff));
+}
+
+/* fast RGB888->RGB565 blending with surface alpha, 16 pixels at a time */
+SDL_TARGETING("avx2") static void
+BlitRGBto565SurfaceAlphaAVX2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint16 *dstp = (Uint16 *) info->dst;
+    int dstskip = info->dst_skip >> 1;
+    SDL_PixelFormat *sf = info->src_fmt;
+    SDL_PixelFormat *df = info->dst_fmt;
+    const unsigned alpha = info->a;
+    const __m256i mm_alpha = _mm256_set1_epi16(alpha);
+    const __m256i mask8 = _mm256_set1_epi32(0xff);
+    const __m256i mask5 = _mm256_set1_epi16(0x1f);
+    const __m256i mask6 = _mm256_set1_epi16(0x3f);
+    const __m128i sR = _mm_cvtsi32_si128(sf->Rshift), sG = _mm_cvtsi32_si128(sf->Gshift), sB = _mm_cvtsi32_si128(sf->Bshift);
+    const __m128i dR = _mm_cvtsi32_si128(df->Rshift), dG = _mm_cvtsi32_si128(df->Gshift), dB = _mm_cvtsi32_si128(df->Bshift);
+
+    if (!alpha) {
+        return;
+    }
+
+    while (height--) {
+        int n = width;
+
+        for (; n >= 16; n -= 16) {
+            /* The lanes of packs are 128-bit, so the sources are loaded as { 0-3, 8-11 } and { 4-7, 12-15 } */
+            const __m256i src0 = _mm256_inserti128_si256(_mm256_castsi128_si256(
+                _mm_loadu_si128((const __m128i *)srcp)), _mm_loadu_si128((const __m128i *)(srcp + 8)), 1);
+            const __m256i src1 = _mm256_inserti128_si256(_mm256_castsi128_si256(
+                _mm_loadu_si128((const __m128i *)(srcp + 4))), _mm_loadu_si128((const __m128i *)(srcp + 12)), 1);
+            const __m256i dst = _mm256_loadu_si256((const __m256i *)dstp);
+            __m256i r, g, b, dr, dg, db;
+
+            r = _mm256_packs_epi32(_mm256_and_si256(_mm256_srl_epi32(src0, sR), mask8), _mm256_and_si256(_mm256_srl_epi32(src1, sR), mask8));
+            g = _mm256_packs_epi32(_mm256_and_si256(_mm256_srl_epi32(src0, sG), mask8), _mm256_and_si256(_mm256_srl_epi32(src1, sG), mask8));
+            b = _mm256_packs_epi32(_mm256_and_si256(_mm256_srl_epi32(src0, sB), mask8), _mm256_and_si256(_mm256_srl_epi32(src1, sB), mask8));
+
+            dr = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_and_si256(_mm256_srl_epi16(dst, dR), mask5), _mm256_set1_epi16(1053)), 7);
+            db = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_and_si256(_mm256_srl_epi16(dst, dB), mask5), _mm256_set1_epi16(1053)), 7);
+            dg = _mm256_and_si256(_mm256_srl_epi16(dst, dG), mask6);
+            dg = _mm256_add_epi16(_mm256_slli_epi16(dg, 2), _mm256_srli_epi16(_mm256_mullo_epi16(dg, _mm256_set1_epi16(49)), 10));
+
+            r = BlendChannelAVX2(r, dr, mm_alpha);
+            g = BlendChannelAVX2(g, dg, mm_alpha);
+            b = BlendChannelAVX2(b, db, mm_alpha);
+
+            _mm256_storeu_si256((__m256i *)dstp, _mm256_or_si256(_mm256_or_si256(
+                _mm256_sll_epi16(_mm256_srli_epi16(r, 3), dR),
+                _mm256_sll_epi16(_mm256_srli_epi16(g, 2), dG)),
+                _mm256_sll_epi16(_mm256_srli_epi16(b, 3), dB)));
+            srcp += 16;
+            dstp += 16;
+        }
+        while (n--) {
+            *dstp = BlendRGBto565SurfaceAlpha(*srcp, *dstp, alpha, sf, df);
+            ++srcp;
+            ++dstp;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+#endif /* SDL_AVX2_INTRINSICS */
+
 /* General (slow) N->N blending with per-surface alpha */
 static void
 BlitNtoNSurfaceAlpha(SDL_BlitInfo * info)
@@ -1357,11 +1954,11 @@ SDL_CalculateBlitA(SDL_Surface * surface)
                     || (sf->Bmask == 0xff && df->Bmask == 0x1f)))
                 {
 #if SDL_ARM_NEON_BLITTERS
-                    if (SDL_HasNEON())
+                    if (SDL_CPUFeatureEnabled(CPU_HAS_NEON))
                         return BlitARGBto565PixelAlphaARMNEON;
 #endif
 #if SDL_ARM_SIMD_BLITTERS
-                    if (SDL_HasARMSIMD())
+                    if (SDL_CPUFeatureEnabled(CPU_HAS_ARM_SIMD))
                         return BlitARGBto565PixelAlphaARMSIMD;
 #endif
                 }
@@ -1370,8 +1967,17 @@ SDL_CalculateBlitA(SDL_Surface * surface)
                     && sf->Gmask == 0xff00
                     && ((sf->Rmask == 0xff && df->Rmask == 0x1f)
                         || (sf->Bmask == 0xff && df->Bmask == 0x1f))) {
-                if (df->Gmask == 0x7e0)
+                if (df->Gmask == 0x7e0) {
+#if defined(SDL_AVX2_INTRINSICS)
+                    if (SDL_CPUFeatureEnabled(CPU_HAS_AVX2))
+                        return BlitARGBto565PixelAlphaAVX2;
+#endif
+#if defined(SDL_SSE2_INTRINSICS)
+                    if (SDL_CPUFeatureEnabled(CPU_HAS_SSE2))
+                        return BlitARGBto565PixelAlphaSSE2;
+#endif
                     return BlitARGBto565PixelAlpha;
+                }
                 else if (df->Gmask == 0x3e0)
                     return BlitARGBto555PixelAlpha;
             }
@@ -1381,28 +1987,43 @@ SDL_CalculateBlitA(SDL_Surface * surface)
             if (sf->Rmask == df->Rmask
                 && sf->Gmask == df->Gmask
                 && sf->Bmask == df->Bmask && sf->BytesPerPixel == 4) {
+#if defined(SDL_AVX2_INTRINSICS) || defined(SDL_SSE2_INTRINSICS)
+                if (sf->Amask == 0xff000000
+                    && sf->Rshift % 8 == 0
+                    && sf->Gshift % 8 == 0
+                    && sf->Bshift % 8 == 0) {
+#if defined(SDL_AVX2_INTRINSICS)
+                    if (SDL_CPUFeatureEnabled(CPU_HAS_AVX2))
+                        return BlitRGBtoRGBPixelAlphaAVX2;
+#endif
+#if defined(SDL_SSE2_INTRINSICS)
+                    if (SDL_CPUFeatureEnabled(CPU_HAS_SSE2))
+                        return BlitRGBtoRGBPixelAlphaSSE2;
+#endif
+                }
+#endif
 #if defined(__MMX__) || defined(__3dNOW__)
                 if (sf->Rshift % 8 == 0
                     && sf->Gshift % 8 == 0
                     && sf->Bshift % 8 == 0
                     && sf->Ashift % 8 == 0 && sf->Aloss == 0) {
 #ifdef __3dNOW__
-                    if (SDL_Has3DNow())
+                    if (SDL_CPUFeatureEnabled(CPU_HAS_3DNOW))
                         return BlitRGBtoRGBPixelAlphaMMX3DNOW;
 #endif
 #ifdef __MMX__
-                    if (SDL_HasMMX())
+                    if (SDL_CPUFeatureEnabled(CPU_HAS_MMX))
                         return BlitRGBtoRGBPixelAlphaMMX;
 #endif
                 }
 #endif /* __MMX__ || __3dNOW__ */
                 if (sf->Amask == 0xff000000) {
 #if SDL_ARM_NEON_BLITTERS
-                    if (SDL_HasNEON())
+                    if (SDL_CPUFeatureEnabled(CPU_HAS_NEON))
                         return BlitRGBtoRGBPixelAlphaARMNEON;
 #endif
 #if SDL_ARM_SIMD_BLITTERS
-                    if (SDL_HasARMSIMD())
+                    if (SDL_CPUFeatureEnabled(CPU_HAS_ARM_SIMD))
                         return BlitRGBtoRGBPixelAlphaARMSIMD;
 #endif
                     return BlitRGBtoRGBPixelAlpha;
@@ -1432,30 +2053,56 @@ SDL_CalculateBlitA(SDL_Surface * surface)
                 if (surface->map->identity) {
                     if (df->Gmask == 0x7e0) {
 #ifdef __MMX__
-                        if (SDL_HasMMX())
+                        if (SDL_CPUFeatureEnabled(CPU_HAS_MMX))
                             return Blit565to565SurfaceAlphaMMX;
                         else
 #endif
                             return Blit565to565SurfaceAlpha;
                     } else if (df->Gmask == 0x3e0) {
 #ifdef __MMX__
-                        if (SDL_HasMMX())
+                        if (SDL_CPUFeatureEnabled(CPU_HAS_MMX))
                             return Blit555to555SurfaceAlphaMMX;
                         else
 #endif
                             return Blit555to555SurfaceAlpha;
                     }
                 }
+                if (sf->BytesPerPixel == 4 && df->Gmask == 0x7e0
+                    && sf->Rshift % 8 == 0
+                    && sf->Gshift % 8 == 0
+                    && sf->Bshift % 8 == 0
+                    && sf->Rloss == 0 && sf->Gloss == 0 && sf->Bloss == 0) {
+#if defined(SDL_AVX2_INTRINSICS)
+                    if (SDL_CPUFeatureEnabled(CPU_HAS_AVX2))
+                        return BlitRGBto565SurfaceAlphaAVX2;
+#endif
+#if defined(SDL_SSE2_INTRINSICS)
+                    if (SDL_CPUFeatureEnabled(CPU_HAS_SSE2))
+                        return BlitRGBto565SurfaceAlphaSSE2;
+#endif
+                }
                 return BlitNtoNSurfaceAlpha;
 
             case 4:
                 if (sf->Rmask == df->Rmask
                     && sf->Gmask == df->Gmask
                     && sf->Bmask == df->Bmask && sf->BytesPerPixel == 4) {
+                    if (sf->Rshift % 8 == 0
+                        && sf->Gshift % 8 == 0
+                        && sf->Bshift % 8 == 0) {
+#if defined(SDL_AVX2_INTRINSICS)
+                        if (SDL_CPUFeatureEnabled(CPU_HAS_AVX2))
+                            return BlitRGBtoRGBSurfaceAlphaAVX2;
+#endif
+#if defined(SDL_SSE2_INTRINSICS)
+                        if (SDL_CPUFeatureEnabled(CPU_HAS_SSE2))
+                            return BlitRGBtoRGBSurfaceAlphaSSE2;
+#endif
+                    }
 #ifdef __MMX__
                     if (sf->Rshift % 8 == 0
                         && sf->Gshift % 8 == 0
-                        && sf->Bshift % 8 == 0 && SDL_HasMMX())
+                        && sf->Bshift % 8 == 0 && SDL_CPUFeatureEnabled(CPU_HAS_MMX))
                         return BlitRGBtoRGBSurfaceAlphaMMX;
 #endif
                     if ((sf->Rmask | sf->Gmask | sf->Bmask) == 0xffffff) {
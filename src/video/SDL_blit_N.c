@@ -26,6 +26,7 @@
 #include "SDL_endian.h"
 #include "SDL_cpuinfo.h"
 #include "SDL_blit.h"
+#include "../cpuinfo/SDL_cpuinfo_c.h"
 
 
 /* General optimized routines that write char by char */
@@ -917,9 +918,9 @@ GetBlitFeatures(void)
         } else {
             features = (0
                         /* Feature 1 is has-MMX */
-                        | ((SDL_HasMMX())? BLIT_FEATURE_HAS_MMX : 0)
+                        | ((SDL_CPUFeatureEnabled(CPU_HAS_MMX))? BLIT_FEATURE_HAS_MMX : 0)
                         /* Feature 2 is has-AltiVec */
-                        | ((SDL_HasAltiVec())? BLIT_FEATURE_HAS_ALTIVEC : 0)
+                        | ((SDL_CPUFeatureEnabled(CPU_HAS_ALTIVEC))? BLIT_FEATURE_HAS_ALTIVEC : 0)
                         /* Feature 4 is dont-use-prefetch */
                         /* !!!! FIXME: Check for G5 or later, not the cache size! Always prefetch on a G4. */
                         | ((GetL3CacheSize() == 0) ? BLIT_FEATURE_ALTIVEC_DONT_USE_PREFETCH : 0)
@@ -934,7 +935,7 @@ GetBlitFeatures(void)
 #endif
 #else
 /* Feature 1 is has-MMX */
-#define GetBlitFeatures() ((SDL_HasMMX() ? BLIT_FEATURE_HAS_MMX : 0) | (SDL_HasARMSIMD() ? BLIT_FEATURE_HAS_ARM_SIMD : 0))
+#define GetBlitFeatures() ((SDL_CPUFeatureEnabled(CPU_HAS_MMX) ? BLIT_FEATURE_HAS_MMX : 0) | (SDL_CPUFeatureEnabled(CPU_HAS_ARM_SIMD) ? BLIT_FEATURE_HAS_ARM_SIMD : 0))
 #endif
 
 #if SDL_ARM_SIMD_BLITTERS
@@ -3451,7 +3452,7 @@ SDL_CalculateBlitN(SDL_Surface * surface)
         else {
 #if SDL_ALTIVEC_BLITTERS
             if ((srcfmt->BytesPerPixel == 4) && (dstfmt->BytesPerPixel == 4)
-                && SDL_HasAltiVec()) {
+                && SDL_CPUFeatureEnabled(CPU_HAS_ALTIVEC)) {
                 return Blit32to32KeyAltivec;
             } else
 #endif
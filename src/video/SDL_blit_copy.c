@@ -23,6 +23,7 @@
 #include "SDL_video.h"
 #include "SDL_blit.h"
 #include "SDL_blit_copy.h"
+#include "../cpuinfo/SDL_cpuinfo_c.h"
 
 
 #ifdef __SSE__
@@ -128,7 +129,7 @@ SDL_BlitCopy(SDL_BlitInfo * info)
     }
 
 #ifdef __SSE__
-    if (SDL_HasSSE() &&
+    if (SDL_CPUFeatureEnabled(CPU_HAS_SSE) &&
         !((uintptr_t) src & 15) && !(srcskip & 15) &&
         !((uintptr_t) dst & 15) && !(dstskip & 15)) {
         while (h--) {
@@ -141,7 +142,7 @@ SDL_BlitCopy(SDL_BlitInfo * info)
 #endif
 
 #ifdef __MMX__
-    if (SDL_HasMMX() && !(srcskip & 7) && !(dstskip & 7)) {
+    if (SDL_CPUFeatureEnabled(CPU_HAS_MMX) && !(srcskip & 7) && !(dstskip & 7)) {
         while (h--) {
             SDL_memcpyMMX(dst, src, w);
             src += srcskip;
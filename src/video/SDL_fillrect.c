@@ -23,6 +23,7 @@
 #include "SDL_video.h"
 #include "SDL_blit.h"
 #include "SDL_cpuinfo.h"
+#include "../cpuinfo/SDL_cpuinfo_c.h"
 
 
 #ifdef __SSE__
@@ -329,7 +330,7 @@ SDL_FillRects(SDL_Surface * dst, const SDL_Rect * rects, int count,
     }
 
 #if SDL_ARM_NEON_BLITTERS
-    if (SDL_HasNEON() && dst->format->BytesPerPixel != 3 && fill_function == NULL) {
+    if (SDL_CPUFeatureEnabled(CPU_HAS_NEON) && dst->format->BytesPerPixel != 3 && fill_function == NULL) {
         switch (dst->format->BytesPerPixel) {
         case 1:
             fill_function = fill_8_neon;
@@ -344,7 +345,7 @@ SDL_FillRects(SDL_Surface * dst, const SDL_Rect * rects, int count,
     }
 #endif
 #if SDL_ARM_SIMD_BLITTERS
-    if (SDL_HasARMSIMD() && dst->format->BytesPerPixel != 3 && fill_function == NULL) {
+    if (SDL_CPUFeatureEnabled(CPU_HAS_ARM_SIMD) && dst->format->BytesPerPixel != 3 && fill_function == NULL) {
         switch (dst->format->BytesPerPixel) {
         case 1:
             fill_function = fill_8_simd;
@@ -366,7 +367,7 @@ SDL_FillRects(SDL_Surface * dst, const SDL_Rect * rects, int count,
                 color |= (color << 8);
                 color |= (color << 16);
 #ifdef __SSE__
-                if (SDL_HasSSE()) {
+                if (SDL_CPUFeatureEnabled(CPU_HAS_SSE)) {
                     fill_function = SDL_FillRect1SSE;
                     break;
                 }
@@ -379,7 +380,7 @@ SDL_FillRects(SDL_Surface * dst, const SDL_Rect * rects, int count,
             {
                 color |= (color << 16);
 #ifdef __SSE__
-                if (SDL_HasSSE()) {
+                if (SDL_CPUFeatureEnabled(CPU_HAS_SSE)) {
                     fill_function = SDL_FillRect2SSE;
                     break;
                 }
@@ -398,7 +399,7 @@ SDL_FillRects(SDL_Surface * dst, const SDL_Rect * rects, int count,
         case 4:
             {
 #ifdef __SSE__
-                if (SDL_HasSSE()) {
+                if (SDL_CPUFeatureEnabled(CPU_HAS_SSE)) {
                     fill_function = SDL_FillRect4SSE;
                     break;
                 }
@@ -22,6 +22,7 @@
 
 /* General (mostly internal) pixel/color manipulation routines for SDL */
 
+#include "SDL_atomic.h"
 #include "SDL_endian.h"
 #include "SDL_video.h"
 #include "SDL_sysvideo.h"
@@ -496,21 +497,107 @@ SDL_MasksToPixelFormatEnum(int bpp, Uint32 Rmask, Uint32 Gmask, Uint32 Bmask,
     return SDL_PIXELFORMAT_UNKNOWN;
 }
 
-static SDL_PixelFormat *formats;
+/* The non-indexed formats are shared. They're kept in an open addressed
+   hash table, and a slot only ever goes from empty to a single format, which
+   is never reclaimed, so lookups of formats that are already there don't
+   need a lock. Filling a slot is done under formats_lock. The table is much
+   larger than the number of pixel formats SDL knows about.
+
+   A slot's references are counted in refcount, and the format's own
+   refcount is a copy of it for apps. Both, and the palette that's released
+   along with the last reference, only change under the slot's lock. */
+#define FORMAT_CACHE_SIZE   128
+
+typedef struct
+{
+    SDL_atomic_t ready;
+    SDL_atomic_t refcount;
+    SDL_SpinLock lock;
+    SDL_PixelFormat format;
+} SDL_FormatSlot;
+
+static SDL_FormatSlot formats[FORMAT_CACHE_SIZE];
 static SDL_SpinLock formats_lock = 0;
 
+/* Returns the slot of a shared format, or NULL if the format isn't shared */
+static SDL_FormatSlot *
+SDL_GetFormatSlot(const SDL_PixelFormat *format)
+{
+    const Uint8 *first = (const Uint8 *) &formats[0];
+    const Uint8 *end = (const Uint8 *) &formats[FORMAT_CACHE_SIZE];
+
+    if ((const Uint8 *) format < first || (const Uint8 *) format >= end) {
+        return NULL;
+    }
+    return &formats[((const Uint8 *) format - first) / sizeof(SDL_FormatSlot)];
+}
+
+/* Returns the slot holding the format, or the empty slot it would go in, or
+   NULL if the table is full */
+static SDL_FormatSlot *
+SDL_FindFormatSlot(Uint32 pixel_format)
+{
+    Uint32 hash = (pixel_format * 0x9E3779B1) >> 25;
+    int i;
+
+    for (i = 0; i < FORMAT_CACHE_SIZE; i++) {
+        SDL_FormatSlot *slot = &formats[(hash + i) % FORMAT_CACHE_SIZE];
+
+        if (!SDL_AtomicGet(&slot->ready)) {
+            return slot;
+        }
+        SDL_MemoryBarrierAcquire();
+        if (slot->format.format == pixel_format) {
+            return slot;
+        }
+    }
+    return NULL;
+}
+
+/* Returns the shared format with a new reference, or NULL if the format is
+   invalid or the table is full, leaving it to the caller to allocate the
+   format and set the error */
+static SDL_PixelFormat *
+SDL_GetCachedFormat(Uint32 pixel_format)
+{
+    SDL_FormatSlot *slot = SDL_FindFormatSlot(pixel_format);
+
+    if (!slot || !SDL_AtomicGet(&slot->ready)) {
+        /* Another thread may be filling the same slot, so look again under the lock */
+        SDL_AtomicLock(&formats_lock);
+        slot = SDL_FindFormatSlot(pixel_format);
+        if (slot && !SDL_AtomicGet(&slot->ready)) {
+            if (SDL_InitFormat(&slot->format, pixel_format) < 0) {
+                slot = NULL;
+            } else {
+                slot->format.refcount = 0;
+                SDL_MemoryBarrierRelease();
+                SDL_AtomicSet(&slot->ready, 1);
+            }
+        }
+        SDL_AtomicUnlock(&formats_lock);
+
+        if (!slot) {
+            return NULL;
+        }
+    }
+
+    SDL_AtomicLock(&slot->lock);
+    slot->format.refcount = SDL_AtomicAdd(&slot->refcount, 1) + 1;
+    SDL_AtomicUnlock(&slot->lock);
+
+    return &slot->format;
+}
+
 SDL_PixelFormat *
 SDL_AllocFormat(Uint32 pixel_format)
 {
     SDL_PixelFormat *format;
 
-    SDL_AtomicLock(&formats_lock);
-
-    /* Look it up in our list of previously allocated formats */
-    for (format = formats; format; format = format->next) {
-        if (pixel_format == format->format) {
-            ++format->refcount;
-            SDL_AtomicUnlock(&formats_lock);
+    if (!SDL_ISPIXELFORMAT_INDEXED(pixel_format)) {
+        /* Share the RGB formats */
+        format = SDL_GetCachedFormat(pixel_format);
+        if (format) {
             return format;
         }
     }
@@ -518,25 +605,15 @@ SDL_AllocFormat(Uint32 pixel_format)
     /* Allocate an empty pixel format structure, and initialize it */
     format = SDL_malloc(sizeof(*format));
     if (format == NULL) {
-        SDL_AtomicUnlock(&formats_lock);
         SDL_OutOfMemory();
         return NULL;
     }
     if (SDL_InitFormat(format, pixel_format) < 0) {
-        SDL_AtomicUnlock(&formats_lock);
         SDL_free(format);
         SDL_InvalidParamError("format");
         return NULL;
     }
 
-    if (!SDL_ISPIXELFORMAT_INDEXED(pixel_format)) {
-        /* Cache the RGB formats */
-        format->next = formats;
-        formats = format;
-    }
-
-    SDL_AtomicUnlock(&formats_lock);
-
     return format;
 }
 
@@ -608,34 +685,31 @@ SDL_InitFormat(SDL_PixelFormat * format, Uint32 pixel_format)
 void
 SDL_FreeFormat(SDL_PixelFormat *format)
 {
-    SDL_PixelFormat *prev;
+    SDL_FormatSlot *slot;
 
     if (!format) {
         SDL_InvalidParamError("format");
         return;
     }
 
-    SDL_AtomicLock(&formats_lock);
-
-    if (--format->refcount > 0) {
-        SDL_AtomicUnlock(&formats_lock);
+    slot = SDL_GetFormatSlot(format);
+    if (slot) {
+        /* The shared formats stay in their slot for the next caller, but
+           don't keep a palette alive */
+        SDL_AtomicLock(&slot->lock);
+        if (SDL_AtomicDecRef(&slot->refcount) && format->palette) {
+            SDL_FreePalette(format->palette);
+            format->palette = NULL;
+        }
+        format->refcount = SDL_AtomicGet(&slot->refcount);
+        SDL_AtomicUnlock(&slot->lock);
         return;
     }
 
-    /* Remove this format from our list */
-    if (format == formats) {
-        formats = format->next;
-    } else if (formats) {
-        for (prev = formats; prev->next; prev = prev->next) {
-            if (prev->next == format) {
-                prev->next = format->next;
-                break;
-            }
-        }
+    if (--format->refcount > 0) {
+        return;
     }
 
-    SDL_AtomicUnlock(&formats_lock);
-
     if (format->palette) {
         SDL_FreePalette(format->palette);
     }
@@ -676,6 +750,8 @@ SDL_AllocPalette(int ncolors)
 int
 SDL_SetPixelFormatPalette(SDL_PixelFormat * format, SDL_Palette *palette)
 {
+    SDL_FormatSlot *slot;
+
     if (!format) {
         return SDL_SetError("SDL_SetPixelFormatPalette() passed NULL format");
     }
@@ -688,6 +764,12 @@ SDL_SetPixelFormatPalette(SDL_PixelFormat * format, SDL_Palette *palette)
         return 0;
     }
 
+    /* A shared format's palette can be released by SDL_FreeFormat() */
+    slot = SDL_GetFormatSlot(format);
+    if (slot) {
+        SDL_AtomicLock(&slot->lock);
+    }
+
     if (format->palette) {
         SDL_FreePalette(format->palette);
     }
@@ -698,6 +780,10 @@ SDL_SetPixelFormatPalette(SDL_PixelFormat * format, SDL_Palette *palette)
         ++format->palette->refcount;
     }
 
+    if (slot) {
+        SDL_AtomicUnlock(&slot->lock);
+    }
+
     return 0;
 }
 
@@ -39,6 +39,11 @@ extern void SDL_FreeBlitMap(SDL_BlitMap * map);
 
 extern void SDL_InvalidateAllBlitMap(SDL_Surface *surface);
 
+/* Conversion in row bands, on several threads with SDL_HINT_CONVERT_PIXELS_THREADS.
+   func converts the given rows, bands start at a multiple of rowalign rows. */
+typedef int (*SDL_ConvertBandFunc)(void *data, int row, int rows);
+extern int SDL_ConvertPixelBands(int width, int height, int rowalign, SDL_ConvertBandFunc func, void *data);
+
 /* Miscellaneous functions */
 extern void SDL_DitherColors(SDL_Color * colors, int bpp);
 extern Uint8 SDL_FindColor(SDL_Palette * pal, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
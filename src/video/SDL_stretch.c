@@ -29,6 +29,8 @@
 #include "SDL_video.h"
 #include "SDL_blit.h"
 #include "SDL_render.h"
+#include "../cpuinfo/SDL_cpuinfo_c.h"
+#include "../cpuinfo/SDL_simd.h"
 
 /* This isn't ready for general consumption yet - it should be folded
    into the general blitting mechanism.
@@ -232,6 +234,13 @@ SDL_UpperSoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
         return SDL_SetError("Only works with same format surfaces");
     }
 
+    if (scaleMode != SDL_ScaleModeNearest) {
+        if ((src->format->BytesPerPixel != 4 && src->format->BytesPerPixel != 2) ||
+            src->format->format == SDL_PIXELFORMAT_ARGB2101010) {
+            return SDL_SetError("Linear scaling only works with 16 and 32 bpp surfaces");
+        }
+    }
+
     /* Verify the blit rectangles */
     if (srcrect) {
         if ((srcrect->x < 0) || (srcrect->y < 0) ||
@@ -412,7 +421,7 @@ SDL_SoftStretchLowerNearest(SDL_Surface *src, const SDL_Rect *srcrect,
     fp_sum_w_init    = fp_sum_w + left_pad_w * fp_step_w;                                       \
     left_pad_w_init  = left_pad_w;                                                              \
     right_pad_w_init = right_pad_w;                                                             \
-    dst_gap          = dst_pitch - 4 * dst_w;                                                   \
+    dst_gap          = dst_pitch - (int)sizeof(*dst) * dst_w;                                   \
     middle_init      = dst_w - left_pad_w - right_pad_w;                                        \
 
 #define BILINEAR___HEIGHT                                                                       \
@@ -594,22 +603,96 @@ scale_mat(const Uint32 *src, int src_w, int src_h, int src_pitch,
     return 0;
 }
 
-#if defined(__SSE2__)
-#  define HAVE_SSE2_INTRINSICS 1
-#endif
+/* 16-bit pixels are unpacked to 4 channels of 16 bits in a Uint64, so that one
+   64-bit multiply interpolates all the channels at once. Each row is first
+   interpolated vertically into 'rows' (channels < 64 * FRAC_ONE), then the
+   channels are split in 2 groups of 32 bits for the horizontal interpolation,
+   with room for the FRAC_ONE * FRAC_ONE factor. */
+#define SPREAD_MASK_16  0x0000FFFF0000FFFFULL
 
-#if defined(__ARM_NEON)
-#  define HAVE_NEON_INTRINSICS 1
-#endif
+typedef struct scale_16_format_t {
+    Uint32 masks[4];
+    Uint8 shifts[4];
+} scale_16_format_t;
 
-/* TODO: this didn't compile on Window10 universal package last time I tried .. */
-#if defined(__WINRT__)
-#  if defined(HAVE_NEON_INTRINSICS)
-#    undef HAVE_NEON_INTRINSICS
-#  endif
-#endif
+static SDL_INLINE Uint64
+SPREAD_16(Uint32 pixel, const scale_16_format_t *f)
+{
+    return (Uint64)((pixel & f->masks[0]) >> f->shifts[0]) |
+           (Uint64)((pixel & f->masks[1]) >> f->shifts[1]) << 16 |
+           (Uint64)((pixel & f->masks[2]) >> f->shifts[2]) << 32 |
+           (Uint64)((pixel & f->masks[3]) >> f->shifts[3]) << 48;
+}
+
+static SDL_INLINE Uint16
+INTERPOL_BILINEAR_16(const Uint64 *rows, int frac_w0, const scale_16_format_t *f)
+{
+    const Uint32 frac_w1 = FRAC_ONE - frac_w0;
+    const Uint64 even = (rows[0] & SPREAD_MASK_16) * frac_w1 + (rows[1] & SPREAD_MASK_16) * frac_w0;
+    const Uint64 odd = ((rows[0] >> 16) & SPREAD_MASK_16) * frac_w1 + ((rows[1] >> 16) & SPREAD_MASK_16) * frac_w0;
+
+    return (Uint16)((((Uint32)even >> (2 * PRECISION)) << f->shifts[0]) |
+                    (((Uint32)odd >> (2 * PRECISION)) << f->shifts[1]) |
+                    ((Uint32)(even >> (32 + 2 * PRECISION)) << f->shifts[2]) |
+                    ((Uint32)(odd >> (32 + 2 * PRECISION)) << f->shifts[3]));
+}
+
+static int
+scale_mat_16(const Uint16 *src, int src_w, int src_h, int src_pitch,
+        Uint16 *dst, int dst_w, int dst_h, int dst_pitch, const SDL_PixelFormat *format)
+{
+    scale_16_format_t f;
+    Uint64 *rows;
+
+    BILINEAR___START
+
+    f.masks[0] = format->Rmask;
+    f.masks[1] = format->Gmask;
+    f.masks[2] = format->Bmask;
+    f.masks[3] = format->Amask;
+    f.shifts[0] = format->Rshift;
+    f.shifts[1] = format->Gshift;
+    f.shifts[2] = format->Bshift;
+    f.shifts[3] = format->Ashift;
+
+    /* One more column, the right of the last pixel is read with a zero weight */
+    rows = (Uint64 *)SDL_calloc(src_w + 1, sizeof(Uint64));
+    if (!rows) {
+        return SDL_OutOfMemory();
+    }
 
-#if defined(HAVE_SSE2_INTRINSICS)
+    for (i = 0; i < dst_h; i++) {
+        int x;
+
+        BILINEAR___HEIGHT
+
+        for (x = 0; x < src_w; x++) {
+            rows[x] = SPREAD_16(((const Uint16 *)src_h0)[x], &f) * frac_h1 +
+                      SPREAD_16(((const Uint16 *)src_h1)[x], &f) * frac_h0;
+        }
+
+        while (left_pad_w--) {
+            *dst++ = INTERPOL_BILINEAR_16(rows, FRAC_ZERO, &f);
+        }
+
+        while (middle--) {
+            int index_w = SRC_INDEX(fp_sum_w);
+            int frac_w = FRAC(fp_sum_w);
+            fp_sum_w += fp_step_w;
+            *dst++ = INTERPOL_BILINEAR_16(rows + index_w, frac_w, &f);
+        }
+
+        while (right_pad_w--) {
+            *dst++ = INTERPOL_BILINEAR_16(rows + src_w - 2, FRAC_ONE, &f);
+        }
+        dst = (Uint16 *)((Uint8 *)dst + dst_gap);
+    }
+
+    SDL_free(rows);
+    return 0;
+}
+
+#if defined(SDL_SSE2_INTRINSICS)
 
 #if 0
 static void
@@ -621,17 +704,6 @@ printf_128(const char *str, __m128i var)
 }
 #endif
 
-static SDL_INLINE int
-hasSSE2()
-{
-    static int val = -1;
-    if (val != -1) {
-        return val;
-    }
-    val = SDL_HasSSE2();
-    return val;
-}
-
 static SDL_INLINE void
 INTERPOL_BILINEAR_SSE(const Uint32 *s0, const Uint32 *s1, int frac_w, __m128i v_frac_h0, __m128i v_frac_h1, Uint32 *dst, __m128i zero)
 {
@@ -790,20 +862,251 @@ scale_mat_SSE(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *ds
     }
     return 0;
 }
+
+static void
+spread_rows_16_SSE(const Uint16 *s0, const Uint16 *s1, int src_w, int frac_h0, int frac_h1, const scale_16_format_t *f, Uint64 *rows)
+{
+    const __m128i v_frac_h0 = _mm_set1_epi16(frac_h0);
+    const __m128i v_frac_h1 = _mm_set1_epi16(frac_h1);
+    __m128i v_masks[4], v_shifts[4];
+    int x, c;
+
+    for (c = 0; c < 4; c++) {
+        v_masks[c] = _mm_set1_epi16((short)f->masks[c]);
+        v_shifts[c] = _mm_cvtsi32_si128(f->shifts[c]);
+    }
+
+    for (x = 0; x + 8 <= src_w; x += 8) {
+        const __m128i p0 = _mm_loadu_si128((const __m128i *)(s0 + x));
+        const __m128i p1 = _mm_loadu_si128((const __m128i *)(s1 + x));
+        __m128i k[4], rg, ba;
+
+        /* Unpack and interpolate vertically 8 pixels, one channel at a time */
+        for (c = 0; c < 4; c++) {
+            k[c] = _mm_add_epi16(_mm_mullo_epi16(_mm_srl_epi16(_mm_and_si128(p0, v_masks[c]), v_shifts[c]), v_frac_h1),
+                                 _mm_mullo_epi16(_mm_srl_epi16(_mm_and_si128(p1, v_masks[c]), v_shifts[c]), v_frac_h0));
+        }
+
+        /* Interleave the channels back to one Uint64 per pixel */
+        rg = _mm_unpacklo_epi16(k[0], k[1]);
+        ba = _mm_unpacklo_epi16(k[2], k[3]);
+        _mm_storeu_si128((__m128i *)(rows + x + 0), _mm_unpacklo_epi32(rg, ba));
+        _mm_storeu_si128((__m128i *)(rows + x + 2), _mm_unpackhi_epi32(rg, ba));
+        rg = _mm_unpackhi_epi16(k[0], k[1]);
+        ba = _mm_unpackhi_epi16(k[2], k[3]);
+        _mm_storeu_si128((__m128i *)(rows + x + 4), _mm_unpacklo_epi32(rg, ba));
+        _mm_storeu_si128((__m128i *)(rows + x + 6), _mm_unpackhi_epi32(rg, ba));
+    }
+
+    for (; x < src_w; x++) {
+        rows[x] = SPREAD_16(s0[x], f) * frac_h1 + SPREAD_16(s1[x], f) * frac_h0;
+    }
+}
+
+static SDL_INLINE Uint16
+INTERPOL_BILINEAR_16_SSE(const Uint64 *rows, int frac_w0, __m128i v_scales)
+{
+    __m128i v = _mm_loadu_si128((const __m128i *)rows);   /* Load j0 and j1 */
+
+    /* Interpolation horizontal, on interleaved { j0, j1 } channels */
+    v = _mm_madd_epi16(_mm_unpacklo_epi16(v, _mm_srli_si128(v, 8)),
+                       _mm_set1_epi32(((Uint32)frac_w0 << 16) | (FRAC_ONE - frac_w0)));
+    v = _mm_srli_epi32(v, PRECISION * 2);
+    v = _mm_packs_epi32(v, v);
+
+    /* Shift the channels back in place, and merge them */
+    v = _mm_mullo_epi16(v, v_scales);
+    v = _mm_or_si128(v, _mm_srli_epi64(v, 16));
+    v = _mm_or_si128(v, _mm_srli_epi64(v, 32));
+    return (Uint16)_mm_cvtsi128_si32(v);
+}
+
+static int
+scale_mat_16_SSE(const Uint16 *src, int src_w, int src_h, int src_pitch,
+        Uint16 *dst, int dst_w, int dst_h, int dst_pitch, const SDL_PixelFormat *format)
+{
+    scale_16_format_t f;
+    __m128i v_scales;
+    Uint64 *rows;
+
+    BILINEAR___START
+
+    f.masks[0] = format->Rmask;
+    f.masks[1] = format->Gmask;
+    f.masks[2] = format->Bmask;
+    f.masks[3] = format->Amask;
+    f.shifts[0] = format->Rshift;
+    f.shifts[1] = format->Gshift;
+    f.shifts[2] = format->Bshift;
+    f.shifts[3] = format->Ashift;
+    v_scales = _mm_setr_epi16((short)(1 << f.shifts[0]), (short)(1 << f.shifts[1]),
+                              (short)(1 << f.shifts[2]), (short)(1 << f.shifts[3]), 0, 0, 0, 0);
+
+    /* One more column, the right of the last pixel is read with a zero weight */
+    rows = (Uint64 *)SDL_calloc(src_w + 1, sizeof(Uint64));
+    if (!rows) {
+        return SDL_OutOfMemory();
+    }
+
+    for (i = 0; i < dst_h; i++) {
+
+        BILINEAR___HEIGHT
+
+        spread_rows_16_SSE((const Uint16 *)src_h0, (const Uint16 *)src_h1, src_w, frac_h0, frac_h1, &f, rows);
+
+        while (left_pad_w--) {
+            *dst++ = INTERPOL_BILINEAR_16_SSE(rows, FRAC_ZERO, v_scales);
+        }
+
+        while (middle--) {
+            int index_w = SRC_INDEX(fp_sum_w);
+            int frac_w = FRAC(fp_sum_w);
+            fp_sum_w += fp_step_w;
+            *dst++ = INTERPOL_BILINEAR_16_SSE(rows + index_w, frac_w, v_scales);
+        }
+
+        while (right_pad_w--) {
+            *dst++ = INTERPOL_BILINEAR_16_SSE(rows + src_w - 2, FRAC_ONE, v_scales);
+        }
+        dst = (Uint16 *)((Uint8 *)dst + dst_gap);
+    }
+
+    SDL_free(rows);
+    return 0;
+}
 #endif
 
-#if defined(HAVE_NEON_INTRINSICS)
+#if defined(SDL_AVX2_INTRINSICS)
+
+SDL_TARGETING("avx2") static SDL_INLINE void
+INTERPOL_BILINEAR_AVX2(const Uint32 *s0, const Uint32 *s1, int frac_w, __m128i v_frac_h0, __m128i v_frac_h1, Uint32 *dst)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i v_frac_w = _mm_set1_epi32(((Uint32)frac_w << 16) | (FRAC_ONE - frac_w));
+    __m128i x_00_01, x_10_11, k0;
+
+    x_00_01 = _mm_loadl_epi64((const __m128i *)s0);  /* Load x00 and x01 */
+    x_10_11 = _mm_loadl_epi64((const __m128i *)s1);
+
+    /* Interpolation vertical, then horizontal: same arithmetic as scale_mat_SSE */
+    k0 = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(x_00_01, zero), v_frac_h1),
+                       _mm_mullo_epi16(_mm_unpacklo_epi8(x_10_11, zero), v_frac_h0));
+    k0 = _mm_madd_epi16(_mm_unpacklo_epi16(k0, _mm_srli_si128(k0, 8)), v_frac_w);
+
+    /* Store 1 pixel */
+    k0 = _mm_srli_epi32(k0, PRECISION * 2);
+    k0 = _mm_packs_epi32(k0, k0);
+    k0 = _mm_packus_epi16(k0, k0);
+    *dst = _mm_cvtsi128_si32(k0);
+}
 
-static SDL_INLINE int
-hasNEON()
+SDL_TARGETING("avx2") static int
+scale_mat_AVX2(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
 {
-    static int val = -1;
-    if (val != -1) {
-        return val;
+    __m128i v_fp_step;
+
+    BILINEAR___START
+
+    v_fp_step = _mm_setr_epi32(0, fp_step_w, 2 * fp_step_w, 3 * fp_step_w);
+
+    for (i = 0; i < dst_h; i++) {
+        int nb_block4;
+        __m128i v_frac_h0, v_frac_h1, v_fp_w;
+        __m256i v256_frac_h0, v256_frac_h1;
+        __m256i zero;
+
+        BILINEAR___HEIGHT
+
+        nb_block4 = middle / 4;
+
+        v_frac_h0 = _mm_set1_epi16(frac_h0);
+        v_frac_h1 = _mm_set1_epi16(frac_h1);
+        v256_frac_h0 = _mm256_set1_epi16(frac_h0);
+        v256_frac_h1 = _mm256_set1_epi16(frac_h1);
+        zero = _mm256_setzero_si256();
+
+        while (left_pad_w--) {
+            INTERPOL_BILINEAR_AVX2(src_h0, src_h1, FRAC_ZERO, v_frac_h0, v_frac_h1, dst);
+            dst += 1;
+        }
+
+        v_fp_w = _mm_add_epi32(_mm_set1_epi32(fp_sum_w), v_fp_step);
+        fp_sum_w += 4 * fp_step_w * nb_block4;
+
+        while (nb_block4--) {
+            int index_w_0, index_w_1, index_w_2, index_w_3;
+            __m128i v_index_w, v_frac_w, v_w;
+            __m256i x_0, x_1, k_02, k_13, l_02, l_13;
+
+            /* Source offsets and weight pairs { 1 - frac, frac } of the 4 output pixels */
+            v_index_w = _mm_slli_epi32(_mm_srli_epi32(v_fp_w, 16), 2);
+            v_frac_w = _mm_and_si128(_mm_srli_epi32(v_fp_w, 16 - PRECISION), _mm_set1_epi32(FRAC_ONE - 1));
+            v_w = _mm_or_si128(_mm_slli_epi32(v_frac_w, 16), _mm_sub_epi32(_mm_set1_epi32(FRAC_ONE), v_frac_w));
+            v_fp_w = _mm_add_epi32(v_fp_w, _mm_set1_epi32(4 * fp_step_w));
+
+            /* Load { x00 x01, x02 x03 | x04 x05, x06 x07 } and the same from the row below */
+            index_w_0 = _mm_cvtsi128_si32(v_index_w);
+            index_w_1 = _mm_extract_epi32(v_index_w, 1);
+            index_w_2 = _mm_extract_epi32(v_index_w, 2);
+            index_w_3 = _mm_extract_epi32(v_index_w, 3);
+            x_0 = _mm256_inserti128_si256(_mm256_castsi128_si256(
+                    _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)((const Uint8 *)src_h0 + index_w_0)),
+                                       _mm_loadl_epi64((const __m128i *)((const Uint8 *)src_h0 + index_w_1)))),
+                    _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)((const Uint8 *)src_h0 + index_w_2)),
+                                       _mm_loadl_epi64((const __m128i *)((const Uint8 *)src_h0 + index_w_3))), 1);
+            x_1 = _mm256_inserti128_si256(_mm256_castsi128_si256(
+                    _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)((const Uint8 *)src_h1 + index_w_0)),
+                                       _mm_loadl_epi64((const __m128i *)((const Uint8 *)src_h1 + index_w_1)))),
+                    _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)((const Uint8 *)src_h1 + index_w_2)),
+                                       _mm_loadl_epi64((const __m128i *)((const Uint8 *)src_h1 + index_w_3))), 1);
+
+            /* Interpolation vertical, pixels 0 and 2 in the low halves of the lanes, 1 and 3 in the high halves */
+            k_02 = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(x_0, zero), v256_frac_h1),
+                                    _mm256_mullo_epi16(_mm256_unpacklo_epi8(x_1, zero), v256_frac_h0));
+            k_13 = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(x_0, zero), v256_frac_h1),
+                                    _mm256_mullo_epi16(_mm256_unpackhi_epi8(x_1, zero), v256_frac_h0));
+
+            /* Interpolation horizontal, on interleaved { j0, j1 } components */
+            l_02 = _mm256_madd_epi16(_mm256_unpacklo_epi16(k_02, _mm256_srli_si256(k_02, 8)),
+                                     _mm256_permutevar8x32_epi32(_mm256_castsi128_si256(v_w), _mm256_setr_epi32(0, 0, 0, 0, 2, 2, 2, 2)));
+            l_13 = _mm256_madd_epi16(_mm256_unpacklo_epi16(k_13, _mm256_srli_si256(k_13, 8)),
+                                     _mm256_permutevar8x32_epi32(_mm256_castsi128_si256(v_w), _mm256_setr_epi32(1, 1, 1, 1, 3, 3, 3, 3)));
+
+            /* Shift and narrow to { p0 p1 . . | p2 p3 . . } */
+            l_02 = _mm256_packs_epi32(_mm256_srli_epi32(l_02, PRECISION * 2), _mm256_srli_epi32(l_13, PRECISION * 2));
+            l_02 = _mm256_packus_epi16(l_02, l_02);
+
+            /* Store 4 pixels */
+            _mm_storeu_si128((__m128i *)dst, _mm256_castsi256_si128(_mm256_permute4x64_epi64(l_02, 0x08)));
+            dst += 4;
+        }
+
+        /* Last points */
+        middle &= 0x3;
+        while (middle--) {
+            int index_w = 4 * SRC_INDEX(fp_sum_w);
+            int frac_w = FRAC(fp_sum_w);
+            const Uint32 *s_00_01 = (const Uint32 *)((const Uint8 *)src_h0 + index_w);
+            const Uint32 *s_10_11 = (const Uint32 *)((const Uint8 *)src_h1 + index_w);
+            fp_sum_w += fp_step_w;
+            INTERPOL_BILINEAR_AVX2(s_00_01, s_10_11, frac_w, v_frac_h0, v_frac_h1, dst);
+            dst += 1;
+        }
+
+        while (right_pad_w--) {
+            int index_w = 4 * (src_w - 2);
+            const Uint32 *s_00_01 = (const Uint32 *)((const Uint8 *)src_h0 + index_w);
+            const Uint32 *s_10_11 = (const Uint32 *)((const Uint8 *)src_h1 + index_w);
+            INTERPOL_BILINEAR_AVX2(s_00_01, s_10_11, FRAC_ONE, v_frac_h0, v_frac_h1, dst);
+            dst += 1;
+        }
+        dst = (Uint32 *)((Uint8 *)dst + dst_gap);
     }
-    val = SDL_HasNEON();
-    return val;
+    return 0;
 }
+#endif
+
+#if defined(SDL_NEON_INTRINSICS)
 
 static SDL_INLINE void
 INTERPOL_BILINEAR_NEON(const Uint32 *s0, const Uint32 *s1, int frac_w, uint8x8_t v_frac_h0, uint8x8_t v_frac_h1, Uint32 *dst)
@@ -1072,23 +1375,39 @@ SDL_SoftStretchLowerLinear(SDL_Surface *s, const SDL_Rect *srcrect,
     int dst_h = dstrect->h;
     int src_pitch = s->pitch;
     int dst_pitch = d->pitch;
-    Uint32 *src = (Uint32 *) ((Uint8 *)s->pixels + srcrect->x * 4 + srcrect->y * src_pitch);
-    Uint32 *dst = (Uint32 *) ((Uint8 *)d->pixels + dstrect->x * 4 + dstrect->y * dst_pitch);
+    const int bpp = d->format->BytesPerPixel;
+    Uint32 *src = (Uint32 *) ((Uint8 *)s->pixels + srcrect->x * bpp + srcrect->y * src_pitch);
+    Uint32 *dst = (Uint32 *) ((Uint8 *)d->pixels + dstrect->x * bpp + dstrect->y * dst_pitch);
+
+    if (bpp == 2) {
+#if defined(SDL_SSE2_INTRINSICS)
+        if (SDL_CPUFeatureEnabled(CPU_HAS_SSE2)) {
+            return scale_mat_16_SSE((const Uint16 *)src, src_w, src_h, src_pitch, (Uint16 *)dst, dst_w, dst_h, dst_pitch, d->format);
+        }
+#endif
+        return scale_mat_16((const Uint16 *)src, src_w, src_h, src_pitch, (Uint16 *)dst, dst_w, dst_h, dst_pitch, d->format);
+    }
 
-#if defined(HAVE_NEON_INTRINSICS)
-    if (ret == -1 && hasNEON()) {
+#if defined(SDL_NEON_INTRINSICS)
+    if (ret == -1 && SDL_CPUFeatureEnabled(CPU_HAS_NEON)) {
         ret = scale_mat_NEON(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
     }
 #endif
 
-#if defined(HAVE_SSE2_INTRINSICS)
-    if (ret == -1 && hasSSE2()) {
+#if defined(SDL_AVX2_INTRINSICS)
+    if (ret == -1 && SDL_CPUFeatureEnabled(CPU_HAS_AVX2)) {
+        ret = scale_mat_AVX2(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+    }
+#endif
+
+#if defined(SDL_SSE2_INTRINSICS)
+    if (ret == -1 && SDL_CPUFeatureEnabled(CPU_HAS_SSE2)) {
         ret = scale_mat_SSE(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
     }
 #endif
 
     if (ret == -1) {
-        scale_mat(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        ret = scale_mat(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
     }
 
     return ret;
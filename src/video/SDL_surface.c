@@ -21,11 +21,23 @@
 #include "../SDL_internal.h"
 
 #include "SDL_video.h"
+#include "SDL_atomic.h"
+#include "SDL_cpuinfo.h"
+#include "SDL_hints.h"
 #include "SDL_sysvideo.h"
 #include "SDL_blit.h"
 #include "SDL_RLEaccel_c.h"
 #include "SDL_pixels_c.h"
 #include "SDL_yuv_c.h"
+#include "../cpuinfo/SDL_cpuinfo_c.h"
+#include "../thread/SDL_systhread.h"
+
+/* Don't split conversions into bands smaller than this many pixels */
+#define CONVERT_MIN_BAND_PIXELS     (256 * 1024)
+#define CONVERT_MAX_THREADS         16
+
+/* How many format pairs SDL_ConvertPixels() remembers the blitter for */
+#define CONVERT_BLIT_CACHE_SIZE     8
 
 
 /* Check to make sure we can safely check multiplication of surface w and pitch and it won't overflow size_t */
@@ -1087,7 +1099,17 @@ SDL_ConvertSurface(SDL_Surface * surface, const SDL_PixelFormat * format,
         }
     }
 
-    ret = SDL_LowerBlit(surface, &bounds, convert, &bounds);
+    if (!surface->format->palette && !convert->format->palette &&
+        surface->format->format != SDL_PIXELFORMAT_UNKNOWN &&
+        convert->format->format != SDL_PIXELFORMAT_UNKNOWN &&
+        !SDL_MUSTLOCK(surface) && convert->pixels) {
+        /* A plain copy, which SDL_ConvertPixels() can split into bands */
+        ret = SDL_ConvertPixels(surface->w, surface->h,
+                                surface->format->format, surface->pixels, surface->pitch,
+                                convert->format->format, convert->pixels, convert->pitch);
+    } else {
+        ret = SDL_LowerBlit(surface, &bounds, convert, &bounds);
+    }
 
     /* Restore colorkey alpha value */
     if (palette_ck_transform) {
@@ -1261,6 +1283,264 @@ SDL_CreateSurfaceOnStack(int width, int height, Uint32 pixel_format,
     return SDL_TRUE;
 }
 
+#if !SDL_THREADS_DISABLED
+typedef struct
+{
+    SDL_ConvertBandFunc func;
+    void *data;
+    int row;
+    int rows;
+    int result;
+    SDL_Thread *thread;
+} SDL_ConvertBand;
+
+static int SDLCALL
+SDL_ConvertBandThread(void *arg)
+{
+    SDL_ConvertBand *band = (SDL_ConvertBand *) arg;
+    band->result = band->func(band->data, band->row, band->rows);
+    return 0;
+}
+
+static int
+GetConvertThreads(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_CONVERT_PIXELS_THREADS);
+
+    if (!hint) {
+        return 1;
+    } else if (SDL_strcasecmp(hint, "auto") == 0) {
+        return SDL_GetCPUCount();
+    }
+    return SDL_atoi(hint);
+}
+#endif /* !SDL_THREADS_DISABLED */
+
+int
+SDL_ConvertPixelBands(int width, int height, int rowalign, SDL_ConvertBandFunc func, void *data)
+{
+#if !SDL_THREADS_DISABLED
+    const Sint64 pixels = (Sint64) width * height;
+    const int units = height / rowalign;
+    int numbands = SDL_min(GetConvertThreads(), CONVERT_MAX_THREADS);
+
+    numbands = (int) SDL_min((Sint64) numbands, pixels / CONVERT_MIN_BAND_PIXELS);
+    numbands = SDL_min(numbands, units);
+
+    if (numbands >= 2) {
+        SDL_ConvertBand bands[CONVERT_MAX_THREADS];
+        int i, ret = 0;
+
+        /* The last band gets whatever doesn't fill a whole rowalign */
+        for (i = 0; i < numbands; i++) {
+            const int start = (units * i / numbands) * rowalign;
+            const int end = (i == numbands - 1) ? height : (units * (i + 1) / numbands) * rowalign;
+            bands[i].func = func;
+            bands[i].data = data;
+            bands[i].row = start;
+            bands[i].rows = end - start;
+            bands[i].result = 0;
+            bands[i].thread = NULL;
+        }
+
+        /* The first band runs on this thread */
+        for (i = 1; i < numbands; i++) {
+            bands[i].thread = SDL_CreateThreadInternal(SDL_ConvertBandThread, "SDLConvert", 0, &bands[i]);
+        }
+        bands[0].result = func(data, bands[0].row, bands[0].rows);
+        for (i = 1; i < numbands; i++) {
+            if (bands[i].thread) {
+                SDL_WaitThread(bands[i].thread, NULL);
+            } else {
+                bands[i].result = func(data, bands[i].row, bands[i].rows);
+            }
+        }
+
+        for (i = 0; i < numbands; i++) {
+            if (bands[i].result < 0) {
+                /* The error message is per thread, convert again here to set it */
+                if (bands[i].thread) {
+                    bands[i].result = func(data, bands[i].row, bands[i].rows);
+                }
+                ret = bands[i].result;
+                break;
+            }
+        }
+        return ret;
+    }
+#endif /* !SDL_THREADS_DISABLED */
+
+    return func(data, 0, height);
+}
+
+typedef struct
+{
+    int width;
+    Uint32 src_format;
+    const Uint8 *src;
+    int src_pitch;
+    Uint32 dst_format;
+    Uint8 *dst;
+    int dst_pitch;
+} SDL_ConvertPixelsData;
+
+static int
+SDL_ConvertPixels_Copy(void *data, int row, int rows)
+{
+    const SDL_ConvertPixelsData *cvt = (const SDL_ConvertPixelsData *) data;
+    const int width = cvt->width * SDL_BYTESPERPIXEL(cvt->src_format);
+    const Uint8 *src = cvt->src + row * cvt->src_pitch;
+    Uint8 *dst = cvt->dst + row * cvt->dst_pitch;
+    int i;
+
+    for (i = rows; i--;) {
+        SDL_memcpy(dst, src, width);
+        src += cvt->src_pitch;
+        dst += cvt->dst_pitch;
+    }
+    return 0;
+}
+
+/* SDL_ConvertPixels() blits between surfaces on the stack, with no palettes
+   and no blend flags, so the blitter SDL_MapSurface() picks only depends on
+   the two formats. Streaming conversions keep converting the same pair, so
+   the formats and the blitter are kept here instead of being set up again.
+   Entries are only used with the CPU features they were picked for. */
+typedef struct
+{
+    int cpu_generation;
+    Uint32 flags;
+    SDL_PixelFormat src_fmt;
+    SDL_PixelFormat dst_fmt;
+    int identity;
+    SDL_blit blit;
+    void *data;
+} SDL_ConvertBlitCacheEntry;
+
+static SDL_ConvertBlitCacheEntry convert_blit_cache[CONVERT_BLIT_CACHE_SIZE];
+static int convert_blit_cache_next = 0;
+static SDL_SpinLock convert_blit_cache_lock = 0;
+
+static SDL_bool
+SDL_GetConvertBlit(Uint32 src_format, Uint32 dst_format, Uint32 flags, int cpu_generation, SDL_ConvertBlitCacheEntry *entry)
+{
+    SDL_bool found = SDL_FALSE;
+    int i;
+
+    SDL_AtomicLock(&convert_blit_cache_lock);
+    for (i = 0; i < CONVERT_BLIT_CACHE_SIZE; i++) {
+        const SDL_ConvertBlitCacheEntry *cached = &convert_blit_cache[i];
+        if (cached->blit &&
+            cached->cpu_generation == cpu_generation &&
+            cached->src_fmt.format == src_format &&
+            cached->dst_fmt.format == dst_format &&
+            cached->flags == flags) {
+            *entry = *cached;
+            found = SDL_TRUE;
+            break;
+        }
+    }
+    SDL_AtomicUnlock(&convert_blit_cache_lock);
+
+    return found;
+}
+
+static void
+SDL_AddConvertBlit(const SDL_ConvertBlitCacheEntry *entry)
+{
+    SDL_AtomicLock(&convert_blit_cache_lock);
+    convert_blit_cache[convert_blit_cache_next] = *entry;
+    convert_blit_cache_next = (convert_blit_cache_next + 1) % CONVERT_BLIT_CACHE_SIZE;
+    SDL_AtomicUnlock(&convert_blit_cache_lock);
+}
+
+static int
+SDL_ConvertPixels_Blit(void *data, int row, int rows)
+{
+    const SDL_ConvertPixelsData *cvt = (const SDL_ConvertPixelsData *) data;
+    const int cpu_generation = SDL_GetCPUFeaturesGeneration();
+    SDL_ConvertBlitCacheEntry entry;
+    SDL_Surface src_surface, dst_surface;
+    SDL_PixelFormat src_fmt, dst_fmt;
+    SDL_BlitMap src_blitmap, dst_blitmap;
+    SDL_Rect rect;
+    int ret;
+
+    /* Set up the rect and go! */
+    rect.x = 0;
+    rect.y = 0;
+    rect.w = cvt->width;
+    rect.h = rows;
+
+    if (SDL_GetConvertBlit(cvt->src_format, cvt->dst_format, 0, cpu_generation, &entry)) {
+        /* Build the mapping SDL_MapSurface() would, without registering it
+           with the destination surface, since it's never invalidated */
+        SDL_zero(src_surface);
+        src_surface.flags = SDL_PREALLOC;
+        src_surface.format = &entry.src_fmt;
+        src_surface.pixels = (void *) (cvt->src + row * cvt->src_pitch);
+        src_surface.w = cvt->width;
+        src_surface.h = rows;
+        src_surface.pitch = cvt->src_pitch;
+        src_surface.map = &src_blitmap;
+        src_surface.refcount = 1;
+
+        SDL_zero(dst_surface);
+        dst_surface.flags = SDL_PREALLOC;
+        dst_surface.format = &entry.dst_fmt;
+        dst_surface.pixels = cvt->dst + row * cvt->dst_pitch;
+        dst_surface.w = cvt->width;
+        dst_surface.h = rows;
+        dst_surface.pitch = cvt->dst_pitch;
+        dst_surface.map = &dst_blitmap;
+        dst_surface.refcount = 1;
+
+        SDL_zero(src_blitmap);
+        src_blitmap.dst = &dst_surface;
+        src_blitmap.identity = entry.identity;
+        src_blitmap.blit = entry.blit;
+        src_blitmap.data = entry.data;
+        src_blitmap.info.flags = entry.flags;
+        src_blitmap.info.r = 0xFF;
+        src_blitmap.info.g = 0xFF;
+        src_blitmap.info.b = 0xFF;
+        src_blitmap.info.a = 0xFF;
+        src_blitmap.info.src_fmt = &entry.src_fmt;
+        src_blitmap.info.dst_fmt = &entry.dst_fmt;
+        SDL_zero(dst_blitmap);
+
+        return entry.blit(&src_surface, &rect, &dst_surface, &rect);
+    }
+
+    if (!SDL_CreateSurfaceOnStack(cvt->width, rows, cvt->src_format,
+                                  (void *) (cvt->src + row * cvt->src_pitch), cvt->src_pitch,
+                                  &src_surface, &src_fmt, &src_blitmap)) {
+        return -1;
+    }
+    if (!SDL_CreateSurfaceOnStack(cvt->width, rows, cvt->dst_format,
+                                  cvt->dst + row * cvt->dst_pitch, cvt->dst_pitch,
+                                  &dst_surface, &dst_fmt, &dst_blitmap)) {
+        return -1;
+    }
+
+    ret = SDL_LowerBlit(&src_surface, &rect, &dst_surface, &rect);
+    if (ret == 0 && src_blitmap.blit) {
+        entry.cpu_generation = cpu_generation;
+        entry.flags = src_blitmap.info.flags;
+        entry.src_fmt = src_fmt;
+        entry.dst_fmt = dst_fmt;
+        entry.identity = src_blitmap.identity;
+        entry.blit = src_blitmap.blit;
+        entry.data = src_blitmap.data;
+        SDL_AddConvertBlit(&entry);
+    }
+
+    /* Free blitmap reference, after blitting between stack'ed surfaces */
+    SDL_InvalidateMap(src_surface.map);
+
+    return ret;
+}
+
 /*
  * Copy a block of pixels of one format to another format
  */
@@ -1268,12 +1548,7 @@ int SDL_ConvertPixels(int width, int height,
                       Uint32 src_format, const void * src, int src_pitch,
                       Uint32 dst_format, void * dst, int dst_pitch)
 {
-    SDL_Surface src_surface, dst_surface;
-    SDL_PixelFormat src_fmt, dst_fmt;
-    SDL_BlitMap src_blitmap, dst_blitmap;
-    SDL_Rect rect;
-    void *nonconst_src = (void *) src;
-    int ret;
+    SDL_ConvertPixelsData cvt;
 
     /* Check to make sure we are blitting somewhere, so we don't crash */
     if (!dst) {
@@ -1298,40 +1573,20 @@ int SDL_ConvertPixels(int width, int height,
     }
 #endif
 
+    cvt.width = width;
+    cvt.src_format = src_format;
+    cvt.src = (const Uint8 *) src;
+    cvt.src_pitch = src_pitch;
+    cvt.dst_format = dst_format;
+    cvt.dst = (Uint8 *) dst;
+    cvt.dst_pitch = dst_pitch;
+
     /* Fast path for same format copy */
     if (src_format == dst_format) {
-        int i;
-        const int bpp = SDL_BYTESPERPIXEL(src_format);
-        width *= bpp;
-        for (i = height; i--;) {
-            SDL_memcpy(dst, src, width);
-            src = (const Uint8*)src + src_pitch;
-            dst = (Uint8*)dst + dst_pitch;
-        }
-        return 0;
+        return SDL_ConvertPixelBands(width, height, 1, SDL_ConvertPixels_Copy, &cvt);
     }
 
-    if (!SDL_CreateSurfaceOnStack(width, height, src_format, nonconst_src,
-                                  src_pitch,
-                                  &src_surface, &src_fmt, &src_blitmap)) {
-        return -1;
-    }
-    if (!SDL_CreateSurfaceOnStack(width, height, dst_format, dst, dst_pitch,
-                                  &dst_surface, &dst_fmt, &dst_blitmap)) {
-        return -1;
-    }
-
-    /* Set up the rect and go! */
-    rect.x = 0;
-    rect.y = 0;
-    rect.w = width;
-    rect.h = height;
-    ret = SDL_LowerBlit(&src_surface, &rect, &dst_surface, &rect);
-
-    /* Free blitmap reference, after blitting between stack'ed surfaces */
-    SDL_InvalidateMap(src_surface.map);
-
-    return ret;
+    return SDL_ConvertPixelBands(width, height, 1, SDL_ConvertPixels_Blit, &cvt);
 }
 
 /*
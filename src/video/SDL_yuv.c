@@ -25,6 +25,8 @@
 #include "SDL_pixels_c.h"
 #include "SDL_yuv_c.h"
 
+#include "../cpuinfo/SDL_cpuinfo_c.h"
+#include "../cpuinfo/SDL_simd.h"
 #include "yuv2rgb/yuv_rgb.h"
 
 #define SDL_YUV_SD_THRESHOLD    576
@@ -181,216 +183,141 @@ static int GetYUVPlanes(int width, int height, Uint32 format, const void *yuv, i
     return 0;
 }
 
-static SDL_bool yuv_rgb_sse(
-    Uint32 src_format, Uint32 dst_format,
-    Uint32 width, Uint32 height, 
-    const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride, 
-    Uint8 *rgb, Uint32 rgb_stride, 
-    YCbCrType yuv_type)
+/* Moves the planes from GetYUVPlanes() down to the given row, which has to be
+   even for the formats with chroma planes half the height of the image. */
+static void OffsetYUVPlanes(Uint32 format, int row, const Uint8 **y, const Uint8 **u, const Uint8 **v, Uint32 y_stride, Uint32 uv_stride)
 {
-#ifdef __SSE2__
-    if (!SDL_HasSSE2()) {
-        return SDL_FALSE;
-    }
+    const int uv_row = IsPlanar2x2Format(format) ? (row / 2) : row;
 
-    if (src_format == SDL_PIXELFORMAT_YV12 ||
-        src_format == SDL_PIXELFORMAT_IYUV) {
+    *y += row * y_stride;
+    *u += uv_row * uv_stride;
+    *v += uv_row * uv_stride;
+}
 
-        switch (dst_format) {
-        case SDL_PIXELFORMAT_RGB565:
-            yuv420_rgb565_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        case SDL_PIXELFORMAT_RGB24:
-            yuv420_rgb24_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        case SDL_PIXELFORMAT_RGBX8888:
-        case SDL_PIXELFORMAT_RGBA8888:
-            yuv420_rgba_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        case SDL_PIXELFORMAT_BGRX8888:
-        case SDL_PIXELFORMAT_BGRA8888:
-            yuv420_bgra_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        case SDL_PIXELFORMAT_RGB888:
-        case SDL_PIXELFORMAT_ARGB8888:
-            yuv420_argb_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        case SDL_PIXELFORMAT_BGR888:
-        case SDL_PIXELFORMAT_ABGR8888:
-            yuv420_abgr_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        default:
-            break;
-        }
-    }
+/* Converts the given rows of YUV planes to a packed RGB format */
+typedef void (*YUVToRGBFunc)(Uint32 width, Uint32 height,
+                             const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride,
+                             Uint8 *rgb, Uint32 rgb_stride,
+                             YCbCrType yuv_type);
 
-    if (src_format == SDL_PIXELFORMAT_YUY2 ||
-        src_format == SDL_PIXELFORMAT_UYVY ||
-        src_format == SDL_PIXELFORMAT_YVYU) {
+/* Which of the yuv2rgb source layouts a YUV format uses, or -1 */
+static int GetYUVToRGBSource(Uint32 format)
+{
+    switch (format) {
+    case SDL_PIXELFORMAT_YV12:
+    case SDL_PIXELFORMAT_IYUV:
+        return 0;
+    case SDL_PIXELFORMAT_YUY2:
+    case SDL_PIXELFORMAT_UYVY:
+    case SDL_PIXELFORMAT_YVYU:
+        return 1;
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
+        return 2;
+    default:
+        return -1;
+    }
+}
 
-        switch (dst_format) {
-        case SDL_PIXELFORMAT_RGB565:
-            yuv422_rgb565_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        case SDL_PIXELFORMAT_RGB24:
-            yuv422_rgb24_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        case SDL_PIXELFORMAT_RGBX8888:
-        case SDL_PIXELFORMAT_RGBA8888:
-            yuv422_rgba_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        case SDL_PIXELFORMAT_BGRX8888:
-        case SDL_PIXELFORMAT_BGRA8888:
-            yuv422_bgra_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        case SDL_PIXELFORMAT_RGB888:
-        case SDL_PIXELFORMAT_ARGB8888:
-            yuv422_argb_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        case SDL_PIXELFORMAT_BGR888:
-        case SDL_PIXELFORMAT_ABGR8888:
-            yuv422_abgr_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        default:
-            break;
-        }
+/* Which of the yuv2rgb output formats an RGB format uses, or -1 */
+static int GetYUVToRGBDest(Uint32 format)
+{
+    switch (format) {
+    case SDL_PIXELFORMAT_RGB565:
+        return 0;
+    case SDL_PIXELFORMAT_RGB24:
+        return 1;
+    case SDL_PIXELFORMAT_RGBX8888:
+    case SDL_PIXELFORMAT_RGBA8888:
+        return 2;
+    case SDL_PIXELFORMAT_BGRX8888:
+    case SDL_PIXELFORMAT_BGRA8888:
+        return 3;
+    case SDL_PIXELFORMAT_RGB888:
+    case SDL_PIXELFORMAT_ARGB8888:
+        return 4;
+    case SDL_PIXELFORMAT_BGR888:
+    case SDL_PIXELFORMAT_ABGR8888:
+        return 5;
+    case SDL_PIXELFORMAT_BGR565:
+        return 6;
+    case SDL_PIXELFORMAT_BGR24:
+        return 7;
+    default:
+        return -1;
     }
+}
 
-    if (src_format == SDL_PIXELFORMAT_NV12 ||
-        src_format == SDL_PIXELFORMAT_NV21) {
+#define YUV_TO_RGB_ROW(layout, suffix) \
+    { layout##_rgb565_##suffix, layout##_rgb24_##suffix, layout##_rgba_##suffix, layout##_bgra_##suffix, \
+      layout##_argb_##suffix, layout##_abgr_##suffix, layout##_bgr565_##suffix, layout##_bgr24_##suffix }
 
-        switch (dst_format) {
-        case SDL_PIXELFORMAT_RGB565:
-            yuvnv12_rgb565_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        case SDL_PIXELFORMAT_RGB24:
-            yuvnv12_rgb24_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        case SDL_PIXELFORMAT_RGBX8888:
-        case SDL_PIXELFORMAT_RGBA8888:
-            yuvnv12_rgba_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        case SDL_PIXELFORMAT_BGRX8888:
-        case SDL_PIXELFORMAT_BGRA8888:
-            yuvnv12_bgra_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        case SDL_PIXELFORMAT_RGB888:
-        case SDL_PIXELFORMAT_ARGB8888:
-            yuvnv12_argb_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        case SDL_PIXELFORMAT_BGR888:
-        case SDL_PIXELFORMAT_ABGR8888:
-            yuvnv12_abgr_sseu(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        default:
-            break;
-        }
-    }
+#define YUV_TO_RGB_TABLE(suffix) \
+    { YUV_TO_RGB_ROW(yuv420, suffix), YUV_TO_RGB_ROW(yuv422, suffix), YUV_TO_RGB_ROW(yuvnv12, suffix) }
+
+static const YUVToRGBFunc yuv_rgb_std_funcs[3][8] = YUV_TO_RGB_TABLE(std);
+#ifdef __SSE2__
+static const YUVToRGBFunc yuv_rgb_sse_funcs[3][8] = YUV_TO_RGB_TABLE(sseu);
+#endif
+#if SDL_AVX2_INTRINSICS
+static const YUVToRGBFunc yuv_rgb_avx2_funcs[3][8] = YUV_TO_RGB_TABLE(avx2);
+#endif
+#if SDL_NEON_INTRINSICS && SDL_BYTEORDER == SDL_LIL_ENDIAN
+static const YUVToRGBFunc yuv_rgb_neon_funcs[3][8] = YUV_TO_RGB_TABLE(neon);
 #endif
-    return SDL_FALSE;
-}
 
-static SDL_bool yuv_rgb_std(
-    Uint32 src_format, Uint32 dst_format,
-    Uint32 width, Uint32 height, 
-    const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride, 
-    Uint8 *rgb, Uint32 rgb_stride, 
-    YCbCrType yuv_type)
+static YUVToRGBFunc GetYUVToRGBFunc(Uint32 src_format, Uint32 dst_format)
 {
-    if (src_format == SDL_PIXELFORMAT_YV12 ||
-        src_format == SDL_PIXELFORMAT_IYUV) {
+    const int src = GetYUVToRGBSource(src_format);
+    const int dst = GetYUVToRGBDest(dst_format);
 
-        switch (dst_format) {
-        case SDL_PIXELFORMAT_RGB565:
-            yuv420_rgb565_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        case SDL_PIXELFORMAT_RGB24:
-            yuv420_rgb24_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        case SDL_PIXELFORMAT_RGBX8888:
-        case SDL_PIXELFORMAT_RGBA8888:
-            yuv420_rgba_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        case SDL_PIXELFORMAT_BGRX8888:
-        case SDL_PIXELFORMAT_BGRA8888:
-            yuv420_bgra_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        case SDL_PIXELFORMAT_RGB888:
-        case SDL_PIXELFORMAT_ARGB8888:
-            yuv420_argb_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        case SDL_PIXELFORMAT_BGR888:
-        case SDL_PIXELFORMAT_ABGR8888:
-            yuv420_abgr_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        default:
-            break;
-        }
+    if (src < 0 || dst < 0) {
+        return NULL;
     }
-
-    if (src_format == SDL_PIXELFORMAT_YUY2 ||
-        src_format == SDL_PIXELFORMAT_UYVY ||
-        src_format == SDL_PIXELFORMAT_YVYU) {
-
-        switch (dst_format) {
-        case SDL_PIXELFORMAT_RGB565:
-            yuv422_rgb565_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        case SDL_PIXELFORMAT_RGB24:
-            yuv422_rgb24_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        case SDL_PIXELFORMAT_RGBX8888:
-        case SDL_PIXELFORMAT_RGBA8888:
-            yuv422_rgba_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        case SDL_PIXELFORMAT_BGRX8888:
-        case SDL_PIXELFORMAT_BGRA8888:
-            yuv422_bgra_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        case SDL_PIXELFORMAT_RGB888:
-        case SDL_PIXELFORMAT_ARGB8888:
-            yuv422_argb_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        case SDL_PIXELFORMAT_BGR888:
-        case SDL_PIXELFORMAT_ABGR8888:
-            yuv422_abgr_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        default:
-            break;
-        }
+#if SDL_AVX2_INTRINSICS
+    if (SDL_CPUFeatureEnabled(CPU_HAS_AVX2)) {
+        return yuv_rgb_avx2_funcs[src][dst];
     }
-
-    if (src_format == SDL_PIXELFORMAT_NV12 ||
-        src_format == SDL_PIXELFORMAT_NV21) {
-
-        switch (dst_format) {
-        case SDL_PIXELFORMAT_RGB565:
-            yuvnv12_rgb565_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        case SDL_PIXELFORMAT_RGB24:
-            yuvnv12_rgb24_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        case SDL_PIXELFORMAT_RGBX8888:
-        case SDL_PIXELFORMAT_RGBA8888:
-            yuvnv12_rgba_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        case SDL_PIXELFORMAT_BGRX8888:
-        case SDL_PIXELFORMAT_BGRA8888:
-            yuvnv12_bgra_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        case SDL_PIXELFORMAT_RGB888:
-        case SDL_PIXELFORMAT_ARGB8888:
-            yuvnv12_argb_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        case SDL_PIXELFORMAT_BGR888:
-        case SDL_PIXELFORMAT_ABGR8888:
-            yuvnv12_abgr_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
-            return SDL_TRUE;
-        default:
-            break;
-        }
+#endif
+#ifdef __SSE2__
+    if (SDL_CPUFeatureEnabled(CPU_HAS_SSE2)) {
+        return yuv_rgb_sse_funcs[src][dst];
     }
-    return SDL_FALSE;
+#endif
+#if SDL_NEON_INTRINSICS && SDL_BYTEORDER == SDL_LIL_ENDIAN
+    if (SDL_CPUFeatureEnabled(CPU_HAS_NEON)) {
+        return yuv_rgb_neon_funcs[src][dst];
+    }
+#endif
+    return yuv_rgb_std_funcs[src][dst];
+}
+
+typedef struct
+{
+    YUVToRGBFunc func;
+    Uint32 src_format;
+    int width;
+    const Uint8 *y;
+    const Uint8 *u;
+    const Uint8 *v;
+    Uint32 y_stride;
+    Uint32 uv_stride;
+    Uint8 *rgb;
+    Uint32 rgb_stride;
+    YCbCrType yuv_type;
+} YUVToRGBBands;
+
+static int yuv_rgb_band(void *data, int row, int rows)
+{
+    const YUVToRGBBands *bands = (const YUVToRGBBands *) data;
+    const Uint8 *y = bands->y;
+    const Uint8 *u = bands->u;
+    const Uint8 *v = bands->v;
+
+    OffsetYUVPlanes(bands->src_format, row, &y, &u, &v, bands->y_stride, bands->uv_stride);
+    bands->func(bands->width, rows, y, u, v, bands->y_stride, bands->uv_stride,
+                bands->rgb + row * bands->rgb_stride, bands->rgb_stride, bands->yuv_type);
+    return 0;
 }
 
 int
@@ -398,27 +325,24 @@ SDL_ConvertPixels_YUV_to_RGB(int width, int height,
          Uint32 src_format, const void *src, int src_pitch,
          Uint32 dst_format, void *dst, int dst_pitch)
 {
-    const Uint8 *y = NULL;
-    const Uint8 *u = NULL;
-    const Uint8 *v = NULL;
-    Uint32 y_stride = 0;
-    Uint32 uv_stride = 0;
-    YCbCrType yuv_type = YCBCR_601;
+    YUVToRGBBands bands;
 
-    if (GetYUVPlanes(width, height, src_format, src, src_pitch, &y, &u, &v, &y_stride, &uv_stride) < 0) {
+    SDL_zero(bands);
+    if (GetYUVPlanes(width, height, src_format, src, src_pitch, &bands.y, &bands.u, &bands.v, &bands.y_stride, &bands.uv_stride) < 0) {
         return -1;
     }
 
-    if (GetYUVConversionType(width, height, &yuv_type) < 0) {
+    if (GetYUVConversionType(width, height, &bands.yuv_type) < 0) {
         return -1;
     }
 
-    if (yuv_rgb_sse(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8*)dst, dst_pitch, yuv_type)) {
-        return 0;
-    }
-
-    if (yuv_rgb_std(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8*)dst, dst_pitch, yuv_type)) {
-        return 0;
+    bands.func = GetYUVToRGBFunc(src_format, dst_format);
+    if (bands.func) {
+        bands.src_format = src_format;
+        bands.width = width;
+        bands.rgb = (Uint8 *)dst;
+        bands.rgb_stride = dst_pitch;
+        return SDL_ConvertPixelBands(width, height, 2, yuv_rgb_band, &bands);
     }
 
     /* No fast path for the RGB format, instead convert using an intermediate buffer */
@@ -456,89 +380,586 @@ struct RGB2YUVFactors
     float v[3]; /* Rfactor, Gfactor, Bfactor */
 };
 
-static int
-SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int src_pitch, Uint32 dst_format, void *dst, int dst_pitch)
-{
-    const int src_pitch_x_2    = src_pitch * 2;
-    const int height_half      = height / 2;
-    const int height_remainder = (height & 0x1);
-    const int width_half       = width / 2;
-    const int width_remainder  = (width & 0x1);
-    int i, j;
- 
-    static struct RGB2YUVFactors RGB2YUVFactorTables[SDL_YUV_CONVERSION_BT709 + 1] =
+static const struct RGB2YUVFactors RGB2YUVFactorTables[SDL_YUV_CONVERSION_BT709 + 1] =
+{
+    /* ITU-T T.871 (JPEG) */
     {
-        /* ITU-T T.871 (JPEG) */
-        {
-            0,
-            {  0.2990f,  0.5870f,  0.1140f },
-            { -0.1687f, -0.3313f,  0.5000f },
-            {  0.5000f, -0.4187f, -0.0813f },
-        },
-        /* ITU-R BT.601-7 */
-        {
-            16,
-            {  0.2568f,  0.5041f,  0.0979f },
-            { -0.1482f, -0.2910f,  0.4392f },
-            {  0.4392f, -0.3678f, -0.0714f },
-        },
-        /* ITU-R BT.709-6 */
-        {
-            16,
-            { 0.1826f,  0.6142f,  0.0620f },
-            {-0.1006f, -0.3386f,  0.4392f },
-            { 0.4392f, -0.3989f, -0.0403f },
-        },
-    };
-    const struct RGB2YUVFactors *cvt = &RGB2YUVFactorTables[SDL_GetYUVConversionModeForResolution(width, height)];
+        0,
+        {  0.2990f,  0.5870f,  0.1140f },
+        { -0.1687f, -0.3313f,  0.5000f },
+        {  0.5000f, -0.4187f, -0.0813f },
+    },
+    /* ITU-R BT.601-7 */
+    {
+        16,
+        {  0.2568f,  0.5041f,  0.0979f },
+        { -0.1482f, -0.2910f,  0.4392f },
+        {  0.4392f, -0.3678f, -0.0714f },
+    },
+    /* ITU-R BT.709-6 */
+    {
+        16,
+        { 0.1826f,  0.6142f,  0.0620f },
+        {-0.1006f, -0.3386f,  0.4392f },
+        { 0.4392f, -0.3989f, -0.0403f },
+    },
+};
 
+/* The SIMD versions below do the same float math in the same order, and wrap
+   the results to 8 bits the same way, so they give the same results as these. */
 #define MAKE_Y(r, g, b) (Uint8)((int)(cvt->y[0] * (r) + cvt->y[1] * (g) + cvt->y[2] * (b) + 0.5f) + cvt->y_offset)
 #define MAKE_U(r, g, b) (Uint8)((int)(cvt->u[0] * (r) + cvt->u[1] * (g) + cvt->u[2] * (b) + 0.5f) + 128)
 #define MAKE_V(r, g, b) (Uint8)((int)(cvt->v[0] * (r) + cvt->v[1] * (g) + cvt->v[2] * (b) + 0.5f) + 128)
 
-#define READ_2x2_PIXELS                                                                                         \
-        const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];                                                    \
-        const Uint32 p2 = ((const Uint32 *)curr_row)[2 * i + 1];                                                \
-        const Uint32 p3 = ((const Uint32 *)next_row)[2 * i];                                                    \
-        const Uint32 p4 = ((const Uint32 *)next_row)[2 * i + 1];                                                \
-        const Uint32 r = ((p1 & 0x00ff0000) + (p2 & 0x00ff0000) + (p3 & 0x00ff0000) + (p4 & 0x00ff0000)) >> 18; \
-        const Uint32 g = ((p1 & 0x0000ff00) + (p2 & 0x0000ff00) + (p3 & 0x0000ff00) + (p4 & 0x0000ff00)) >> 10; \
-        const Uint32 b = ((p1 & 0x000000ff) + (p2 & 0x000000ff) + (p3 & 0x000000ff) + (p4 & 0x000000ff)) >> 2;  \
-
-#define READ_2x1_PIXELS                                                                                         \
-        const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];                                                    \
-        const Uint32 p2 = ((const Uint32 *)next_row)[2 * i];                                                    \
-        const Uint32 r = ((p1 & 0x00ff0000) + (p2 & 0x00ff0000)) >> 17;                                         \
-        const Uint32 g = ((p1 & 0x0000ff00) + (p2 & 0x0000ff00)) >> 9;                                          \
-        const Uint32 b = ((p1 & 0x000000ff) + (p2 & 0x000000ff)) >> 1;                                          \
-
-#define READ_1x2_PIXELS                                                                                         \
-        const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];                                                    \
-        const Uint32 p2 = ((const Uint32 *)curr_row)[2 * i + 1];                                                \
-        const Uint32 r = ((p1 & 0x00ff0000) + (p2 & 0x00ff0000)) >> 17;                                         \
-        const Uint32 g = ((p1 & 0x0000ff00) + (p2 & 0x0000ff00)) >> 9;                                          \
-        const Uint32 b = ((p1 & 0x000000ff) + (p2 & 0x000000ff)) >> 1;                                          \
-
-#define READ_1x1_PIXEL                                                                                          \
-        const Uint32 p = ((const Uint32 *)curr_row)[2 * i];                                                     \
-        const Uint32 r = (p & 0x00ff0000) >> 16;                                                                \
-        const Uint32 g = (p & 0x0000ff00) >> 8;                                                                 \
-        const Uint32 b = (p & 0x000000ff);                                                                      \
-
-#define READ_TWO_RGB_PIXELS                                                                                     \
-        const Uint32 p = ((const Uint32 *)curr_row)[2 * i];                                                     \
-        const Uint32 r = (p & 0x00ff0000) >> 16;                                                                \
-        const Uint32 g = (p & 0x0000ff00) >> 8;                                                                 \
-        const Uint32 b = (p & 0x000000ff);                                                                      \
-        const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i + 1];                                                \
-        const Uint32 r1 = (p1 & 0x00ff0000) >> 16;                                                              \
-        const Uint32 g1 = (p1 & 0x0000ff00) >> 8;                                                               \
-        const Uint32 b1 = (p1 & 0x000000ff);                                                                    \
-        const Uint32 R = (r + r1)/2;                                                                            \
-        const Uint32 G = (g + g1)/2;                                                                            \
-        const Uint32 B = (b + b1)/2;                                                                            \
-
-#define READ_ONE_RGB_PIXEL  READ_1x1_PIXEL
+/* Row converters for 32-bit RGB pixels, with red in bits 16-23 and blue in
+   bits 0-7 (ARGB8888, RGB888), or the other way around if bgr is set
+   (ABGR8888, BGR888). The alpha or padding byte is ignored. */
+
+/* Writes the Y value of width pixels */
+typedef void (*RGB32ToYRowFunc)(const struct RGB2YUVFactors *cvt, SDL_bool bgr,
+                                const Uint32 *src, int width, Uint8 *y);
+
+/* Writes the U and V values of each 2x2 block of pixels from two rows, which
+   can be the same row for the last row of an image with an odd height. The
+   last block of a row with an odd width is one pixel wide. Planar formats use
+   a uv_step of 1, and the interleaved NV12 and NV21 formats a uv_step of 2. */
+typedef void (*RGB32ToUVRowFunc)(const struct RGB2YUVFactors *cvt, SDL_bool bgr,
+                                 const Uint32 *curr, const Uint32 *next, int width,
+                                 Uint8 *u, Uint8 *v, int uv_step);
+
+/* Writes a row of YUY2, UYVY or YVYU, with U and V from each pair of pixels */
+typedef void (*RGB32ToPackedRowFunc)(const struct RGB2YUVFactors *cvt, SDL_bool bgr,
+                                     const Uint32 *src, int width, Uint8 *dst, Uint32 dst_format);
+
+typedef struct
+{
+    RGB32ToYRowFunc y;
+    RGB32ToUVRowFunc uv;
+    RGB32ToPackedRowFunc packed;
+} RGB32ToYUVFuncs;
+
+static void RGB32ToYRow_C(const struct RGB2YUVFactors *cvt, SDL_bool bgr,
+                          const Uint32 *src, int width, Uint8 *y)
+{
+    const int r_shift = bgr ? 0 : 16;
+    const int b_shift = bgr ? 16 : 0;
+    int i;
+
+    for (i = 0; i < width; i++) {
+        const Uint32 p = src[i];
+        const Uint32 r = (p >> r_shift) & 0xff;
+        const Uint32 g = (p >> 8) & 0xff;
+        const Uint32 b = (p >> b_shift) & 0xff;
+        y[i] = MAKE_Y(r, g, b);
+    }
+}
+
+static void RGB32ToUVRow_C(const struct RGB2YUVFactors *cvt, SDL_bool bgr,
+                           const Uint32 *curr, const Uint32 *next, int width,
+                           Uint8 *u, Uint8 *v, int uv_step)
+{
+    const int r_shift = bgr ? 0 : 16;
+    const int b_shift = bgr ? 16 : 0;
+    int i;
+
+    /* A block one pixel wide or high counts that pixel twice, which gives
+       the same average as dividing by the number of pixels */
+    for (i = 0; i < width; i += 2) {
+        const int i1 = (i + 1 < width) ? (i + 1) : i;
+        const Uint32 p1 = curr[i], p2 = curr[i1], p3 = next[i], p4 = next[i1];
+        const Uint32 r = (((p1 >> r_shift) & 0xff) + ((p2 >> r_shift) & 0xff) + ((p3 >> r_shift) & 0xff) + ((p4 >> r_shift) & 0xff)) >> 2;
+        const Uint32 g = (((p1 >> 8) & 0xff) + ((p2 >> 8) & 0xff) + ((p3 >> 8) & 0xff) + ((p4 >> 8) & 0xff)) >> 2;
+        const Uint32 b = (((p1 >> b_shift) & 0xff) + ((p2 >> b_shift) & 0xff) + ((p3 >> b_shift) & 0xff) + ((p4 >> b_shift) & 0xff)) >> 2;
+        *u = MAKE_U(r, g, b);
+        *v = MAKE_V(r, g, b);
+        u += uv_step;
+        v += uv_step;
+    }
+}
+
+static void RGB32ToPackedRow_C(const struct RGB2YUVFactors *cvt, SDL_bool bgr,
+                               const Uint32 *src, int width, Uint8 *dst, Uint32 dst_format)
+{
+    const int r_shift = bgr ? 0 : 16;
+    const int b_shift = bgr ? 16 : 0;
+    /* Offsets of Y0 U Y1 V in each group of 4 bytes */
+    const int y_offset = (dst_format == SDL_PIXELFORMAT_UYVY) ? 1 : 0;
+    const int u_offset = (dst_format == SDL_PIXELFORMAT_UYVY) ? 0 : (dst_format == SDL_PIXELFORMAT_YVYU) ? 3 : 1;
+    const int v_offset = (dst_format == SDL_PIXELFORMAT_UYVY) ? 2 : (dst_format == SDL_PIXELFORMAT_YVYU) ? 1 : 3;
+    int i;
+
+    for (i = 0; i < width; i += 2) {
+        const Uint32 p = src[i];
+        const Uint32 r = (p >> r_shift) & 0xff;
+        const Uint32 g = (p >> 8) & 0xff;
+        const Uint32 b = (p >> b_shift) & 0xff;
+        const Uint32 p1 = src[(i + 1 < width) ? (i + 1) : i];
+        const Uint32 r1 = (p1 >> r_shift) & 0xff;
+        const Uint32 g1 = (p1 >> 8) & 0xff;
+        const Uint32 b1 = (p1 >> b_shift) & 0xff;
+        const Uint32 R = (r + r1) / 2;
+        const Uint32 G = (g + g1) / 2;
+        const Uint32 B = (b + b1) / 2;
+
+        dst[y_offset] = MAKE_Y(r, g, b);
+        dst[y_offset + 2] = MAKE_Y(r1, g1, b1);
+        dst[u_offset] = MAKE_U(R, G, B);
+        dst[v_offset] = MAKE_V(R, G, B);
+        dst += 4;
+    }
+}
+
+#if SDL_SSE2_INTRINSICS
+/* Returns the Y, U or V values of four pixels, before wrapping to 8 bits */
+static SDL_INLINE __m128i
+RGB2YUV_SSE2(const float *factors, int offset, __m128 r, __m128 g, __m128 b)
+{
+    __m128 x = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(factors[0]), r), _mm_mul_ps(_mm_set1_ps(factors[1]), g));
+    x = _mm_add_ps(_mm_add_ps(x, _mm_mul_ps(_mm_set1_ps(factors[2]), b)), _mm_set1_ps(0.5f));
+    return _mm_add_epi32(_mm_cvttps_epi32(x), _mm_set1_epi32(offset));
+}
+
+/* Wraps 16 32-bit values to 8 bits */
+static SDL_INLINE __m128i
+RGB2YUV_Pack_SSE2(__m128i a, __m128i b, __m128i c, __m128i d)
+{
+    const __m128i mask = _mm_set1_epi32(0xff);
+    const __m128i ab = _mm_packs_epi32(_mm_and_si128(a, mask), _mm_and_si128(b, mask));
+    const __m128i cd = _mm_packs_epi32(_mm_and_si128(c, mask), _mm_and_si128(d, mask));
+    return _mm_packus_epi16(ab, cd);
+}
+
+/* Splits four pixels into red, green and blue */
+static SDL_INLINE void
+RGB32_Split_SSE2(__m128i p, SDL_bool bgr, __m128 *r, __m128 *g, __m128 *b)
+{
+    const __m128i mask = _mm_set1_epi32(0xff);
+    const __m128 lo = _mm_cvtepi32_ps(_mm_and_si128(p, mask));
+    const __m128 hi = _mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(p, 16), mask));
+    *g = _mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(p, 8), mask));
+    *r = bgr ? lo : hi;
+    *b = bgr ? hi : lo;
+}
+
+/* Averages the 2x2 blocks of eight pixels from two rows into red, green and blue.
+   Each sum fits in 16 bits, so red and blue are added up together. */
+static SDL_INLINE void
+RGB32_Average2x2_SSE2(const Uint32 *curr, const Uint32 *next, SDL_bool bgr, __m128 *r, __m128 *g, __m128 *b)
+{
+    const __m128i mask = _mm_set1_epi32(0x00ff00ff);
+    const __m128i c0 = _mm_loadu_si128((const __m128i *)curr);
+    const __m128i c1 = _mm_loadu_si128((const __m128i *)(curr + 4));
+    const __m128i n0 = _mm_loadu_si128((const __m128i *)next);
+    const __m128i n1 = _mm_loadu_si128((const __m128i *)(next + 4));
+    const __m128 rb0 = _mm_castsi128_ps(_mm_add_epi32(_mm_and_si128(c0, mask), _mm_and_si128(n0, mask)));
+    const __m128 rb1 = _mm_castsi128_ps(_mm_add_epi32(_mm_and_si128(c1, mask), _mm_and_si128(n1, mask)));
+    const __m128 ga0 = _mm_castsi128_ps(_mm_add_epi32(_mm_and_si128(_mm_srli_epi32(c0, 8), mask), _mm_and_si128(_mm_srli_epi32(n0, 8), mask)));
+    const __m128 ga1 = _mm_castsi128_ps(_mm_add_epi32(_mm_and_si128(_mm_srli_epi32(c1, 8), mask), _mm_and_si128(_mm_srli_epi32(n1, 8), mask)));
+    const __m128i rb = _mm_add_epi32(_mm_castps_si128(_mm_shuffle_ps(rb0, rb1, _MM_SHUFFLE(2, 0, 2, 0))),
+                                     _mm_castps_si128(_mm_shuffle_ps(rb0, rb1, _MM_SHUFFLE(3, 1, 3, 1))));
+    const __m128i ga = _mm_add_epi32(_mm_castps_si128(_mm_shuffle_ps(ga0, ga1, _MM_SHUFFLE(2, 0, 2, 0))),
+                                     _mm_castps_si128(_mm_shuffle_ps(ga0, ga1, _MM_SHUFFLE(3, 1, 3, 1))));
+    const __m128 lo = _mm_cvtepi32_ps(_mm_srli_epi32(_mm_and_si128(rb, _mm_set1_epi32(0xffff)), 2));
+    const __m128 hi = _mm_cvtepi32_ps(_mm_srli_epi32(rb, 18));
+    *g = _mm_cvtepi32_ps(_mm_srli_epi32(_mm_and_si128(ga, _mm_set1_epi32(0xffff)), 2));
+    *r = bgr ? lo : hi;
+    *b = bgr ? hi : lo;
+}
+
+/* Returns the Y values of 16 pixels */
+static SDL_INLINE __m128i
+RGB32ToY16_SSE2(const struct RGB2YUVFactors *cvt, SDL_bool bgr, const Uint32 *src)
+{
+    __m128i y[4];
+    int k;
+
+    for (k = 0; k < 4; k++) {
+        __m128 r, g, b;
+        RGB32_Split_SSE2(_mm_loadu_si128((const __m128i *)(src + 4 * k)), bgr, &r, &g, &b);
+        y[k] = RGB2YUV_SSE2(cvt->y, cvt->y_offset, r, g, b);
+    }
+    return RGB2YUV_Pack_SSE2(y[0], y[1], y[2], y[3]);
+}
+
+/* Returns the U and V values of the 2x2 blocks of 16 pixels from two rows, in the low 8 bytes */
+static SDL_INLINE void
+RGB32ToUV8_SSE2(const struct RGB2YUVFactors *cvt, SDL_bool bgr, const Uint32 *curr, const Uint32 *next, __m128i *u, __m128i *v)
+{
+    __m128i u4[2], v4[2];
+    int k;
+
+    for (k = 0; k < 2; k++) {
+        __m128 r, g, b;
+        RGB32_Average2x2_SSE2(curr + 8 * k, next + 8 * k, bgr, &r, &g, &b);
+        u4[k] = RGB2YUV_SSE2(cvt->u, 128, r, g, b);
+        v4[k] = RGB2YUV_SSE2(cvt->v, 128, r, g, b);
+    }
+    *u = RGB2YUV_Pack_SSE2(u4[0], u4[1], u4[0], u4[1]);
+    *v = RGB2YUV_Pack_SSE2(v4[0], v4[1], v4[0], v4[1]);
+}
+
+static void RGB32ToYRow_SSE2(const struct RGB2YUVFactors *cvt, SDL_bool bgr,
+                             const Uint32 *src, int width, Uint8 *y)
+{
+    int i;
+
+    for (i = 0; i + 16 <= width; i += 16) {
+        _mm_storeu_si128((__m128i *)(y + i), RGB32ToY16_SSE2(cvt, bgr, src + i));
+    }
+    RGB32ToYRow_C(cvt, bgr, src + i, width - i, y + i);
+}
+
+static void RGB32ToUVRow_SSE2(const struct RGB2YUVFactors *cvt, SDL_bool bgr,
+                              const Uint32 *curr, const Uint32 *next, int width,
+                              Uint8 *u, Uint8 *v, int uv_step)
+{
+    int i;
+
+    for (i = 0; i + 16 <= width; i += 16) {
+        __m128i u8, v8;
+        RGB32ToUV8_SSE2(cvt, bgr, curr + i, next + i, &u8, &v8);
+        if (uv_step == 1) {
+            _mm_storel_epi64((__m128i *)(u + i / 2), u8);
+            _mm_storel_epi64((__m128i *)(v + i / 2), v8);
+        } else if (u < v) {
+            _mm_storeu_si128((__m128i *)(u + i), _mm_unpacklo_epi8(u8, v8));
+        } else {
+            _mm_storeu_si128((__m128i *)(v + i), _mm_unpacklo_epi8(v8, u8));
+        }
+    }
+    RGB32ToUVRow_C(cvt, bgr, curr + i, next + i, width - i, u + (i / 2) * uv_step, v + (i / 2) * uv_step, uv_step);
+}
+
+static void RGB32ToPackedRow_SSE2(const struct RGB2YUVFactors *cvt, SDL_bool bgr,
+                                  const Uint32 *src, int width, Uint8 *dst, Uint32 dst_format)
+{
+    int i;
+
+    for (i = 0; i + 16 <= width; i += 16) {
+        const __m128i y = RGB32ToY16_SSE2(cvt, bgr, src + i);
+        __m128i u, v, uv;
+
+        /* Averaging a row with itself gives the average of each pair of pixels */
+        RGB32ToUV8_SSE2(cvt, bgr, src + i, src + i, &u, &v);
+        uv = (dst_format == SDL_PIXELFORMAT_YVYU) ? _mm_unpacklo_epi8(v, u) : _mm_unpacklo_epi8(u, v);
+        if (dst_format == SDL_PIXELFORMAT_UYVY) {
+            _mm_storeu_si128((__m128i *)(dst + 2 * i), _mm_unpacklo_epi8(uv, y));
+            _mm_storeu_si128((__m128i *)(dst + 2 * i + 16), _mm_unpackhi_epi8(uv, y));
+        } else {
+            _mm_storeu_si128((__m128i *)(dst + 2 * i), _mm_unpacklo_epi8(y, uv));
+            _mm_storeu_si128((__m128i *)(dst + 2 * i + 16), _mm_unpackhi_epi8(y, uv));
+        }
+    }
+    RGB32ToPackedRow_C(cvt, bgr, src + i, width - i, dst + 2 * i, dst_format);
+}
+#endif /* SDL_SSE2_INTRINSICS */
+
+#if SDL_AVX2_INTRINSICS
+/* Returns the Y, U or V values of eight pixels, before wrapping to 8 bits */
+SDL_TARGETING("avx2") static SDL_INLINE __m256i
+RGB2YUV_AVX2(const float *factors, int offset, __m256 r, __m256 g, __m256 b)
+{
+    __m256 x = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(factors[0]), r), _mm256_mul_ps(_mm256_set1_ps(factors[1]), g));
+    x = _mm256_add_ps(_mm256_add_ps(x, _mm256_mul_ps(_mm256_set1_ps(factors[2]), b)), _mm256_set1_ps(0.5f));
+    return _mm256_add_epi32(_mm256_cvttps_epi32(x), _mm256_set1_epi32(offset));
+}
+
+/* Wraps 16 32-bit values to 8 bits */
+SDL_TARGETING("avx2") static SDL_INLINE __m128i
+RGB2YUV_Pack_AVX2(__m256i a, __m256i b)
+{
+    const __m256i mask = _mm256_set1_epi32(0xff);
+    /* The 256-bit pack works within each 128-bit lane, so put the lanes back in order */
+    const __m256i ab = _mm256_permute4x64_epi64(_mm256_packs_epi32(_mm256_and_si256(a, mask), _mm256_and_si256(b, mask)), 0xD8);
+    return _mm_packus_epi16(_mm256_castsi256_si128(ab), _mm256_extracti128_si256(ab, 1));
+}
+
+/* Splits eight pixels into red, green and blue */
+SDL_TARGETING("avx2") static SDL_INLINE void
+RGB32_Split_AVX2(__m256i p, SDL_bool bgr, __m256 *r, __m256 *g, __m256 *b)
+{
+    const __m256i mask = _mm256_set1_epi32(0xff);
+    const __m256 lo = _mm256_cvtepi32_ps(_mm256_and_si256(p, mask));
+    const __m256 hi = _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(p, 16), mask));
+    *g = _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(p, 8), mask));
+    *r = bgr ? lo : hi;
+    *b = bgr ? hi : lo;
+}
+
+/* Averages the 2x2 blocks of 16 pixels from two rows into red, green and blue.
+   Each sum fits in 16 bits, so red and blue are added up together. */
+SDL_TARGETING("avx2") static SDL_INLINE void
+RGB32_Average2x2_AVX2(const Uint32 *curr, const Uint32 *next, SDL_bool bgr, __m256 *r, __m256 *g, __m256 *b)
+{
+    const __m256i mask = _mm256_set1_epi32(0x00ff00ff);
+    const __m256i c0 = _mm256_loadu_si256((const __m256i *)curr);
+    const __m256i c1 = _mm256_loadu_si256((const __m256i *)(curr + 8));
+    const __m256i n0 = _mm256_loadu_si256((const __m256i *)next);
+    const __m256i n1 = _mm256_loadu_si256((const __m256i *)(next + 8));
+    const __m256 rb0 = _mm256_castsi256_ps(_mm256_add_epi32(_mm256_and_si256(c0, mask), _mm256_and_si256(n0, mask)));
+    const __m256 rb1 = _mm256_castsi256_ps(_mm256_add_epi32(_mm256_and_si256(c1, mask), _mm256_and_si256(n1, mask)));
+    const __m256 ga0 = _mm256_castsi256_ps(_mm256_add_epi32(_mm256_and_si256(_mm256_srli_epi32(c0, 8), mask), _mm256_and_si256(_mm256_srli_epi32(n0, 8), mask)));
+    const __m256 ga1 = _mm256_castsi256_ps(_mm256_add_epi32(_mm256_and_si256(_mm256_srli_epi32(c1, 8), mask), _mm256_and_si256(_mm256_srli_epi32(n1, 8), mask)));
+    /* The shuffles work within each 128-bit lane, so put the pairs back in order */
+    const __m256i rb = _mm256_permute4x64_epi64(_mm256_add_epi32(_mm256_castps_si256(_mm256_shuffle_ps(rb0, rb1, _MM_SHUFFLE(2, 0, 2, 0))),
+                                                                 _mm256_castps_si256(_mm256_shuffle_ps(rb0, rb1, _MM_SHUFFLE(3, 1, 3, 1)))), 0xD8);
+    const __m256i ga = _mm256_permute4x64_epi64(_mm256_add_epi32(_mm256_castps_si256(_mm256_shuffle_ps(ga0, ga1, _MM_SHUFFLE(2, 0, 2, 0))),
+                                                                 _mm256_castps_si256(_mm256_shuffle_ps(ga0, ga1, _MM_SHUFFLE(3, 1, 3, 1)))), 0xD8);
+    const __m256 lo = _mm256_cvtepi32_ps(_mm256_srli_epi32(_mm256_and_si256(rb, _mm256_set1_epi32(0xffff)), 2));
+    const __m256 hi = _mm256_cvtepi32_ps(_mm256_srli_epi32(rb, 18));
+    *g = _mm256_cvtepi32_ps(_mm256_srli_epi32(_mm256_and_si256(ga, _mm256_set1_epi32(0xffff)), 2));
+    *r = bgr ? lo : hi;
+    *b = bgr ? hi : lo;
+}
+
+/* Returns the Y values of 16 pixels */
+SDL_TARGETING("avx2") static SDL_INLINE __m128i
+RGB32ToY16_AVX2(const struct RGB2YUVFactors *cvt, SDL_bool bgr, const Uint32 *src)
+{
+    __m256 r, g, b;
+    __m256i y0, y1;
+
+    RGB32_Split_AVX2(_mm256_loadu_si256((const __m256i *)src), bgr, &r, &g, &b);
+    y0 = RGB2YUV_AVX2(cvt->y, cvt->y_offset, r, g, b);
+    RGB32_Split_AVX2(_mm256_loadu_si256((const __m256i *)(src + 8)), bgr, &r, &g, &b);
+    y1 = RGB2YUV_AVX2(cvt->y, cvt->y_offset, r, g, b);
+    return RGB2YUV_Pack_AVX2(y0, y1);
+}
+
+/* Returns the U and V values of the 2x2 blocks of 32 pixels from two rows */
+SDL_TARGETING("avx2") static SDL_INLINE void
+RGB32ToUV16_AVX2(const struct RGB2YUVFactors *cvt, SDL_bool bgr, const Uint32 *curr, const Uint32 *next, __m128i *u, __m128i *v)
+{
+    __m256 r, g, b;
+    __m256i u0, v0, u1, v1;
+
+    RGB32_Average2x2_AVX2(curr, next, bgr, &r, &g, &b);
+    u0 = RGB2YUV_AVX2(cvt->u, 128, r, g, b);
+    v0 = RGB2YUV_AVX2(cvt->v, 128, r, g, b);
+    RGB32_Average2x2_AVX2(curr + 16, next + 16, bgr, &r, &g, &b);
+    u1 = RGB2YUV_AVX2(cvt->u, 128, r, g, b);
+    v1 = RGB2YUV_AVX2(cvt->v, 128, r, g, b);
+    *u = RGB2YUV_Pack_AVX2(u0, u1);
+    *v = RGB2YUV_Pack_AVX2(v0, v1);
+}
+
+SDL_TARGETING("avx2") static void
+RGB32ToYRow_AVX2(const struct RGB2YUVFactors *cvt, SDL_bool bgr,
+                 const Uint32 *src, int width, Uint8 *y)
+{
+    int i;
+
+    for (i = 0; i + 32 <= width; i += 32) {
+        _mm_storeu_si128((__m128i *)(y + i), RGB32ToY16_AVX2(cvt, bgr, src + i));
+        _mm_storeu_si128((__m128i *)(y + i + 16), RGB32ToY16_AVX2(cvt, bgr, src + i + 16));
+    }
+    RGB32ToYRow_C(cvt, bgr, src + i, width - i, y + i);
+}
+
+SDL_TARGETING("avx2") static void
+RGB32ToUVRow_AVX2(const struct RGB2YUVFactors *cvt, SDL_bool bgr,
+                  const Uint32 *curr, const Uint32 *next, int width,
+                  Uint8 *u, Uint8 *v, int uv_step)
+{
+    int i;
+
+    for (i = 0; i + 32 <= width; i += 32) {
+        __m128i u16, v16;
+        RGB32ToUV16_AVX2(cvt, bgr, curr + i, next + i, &u16, &v16);
+        if (uv_step == 1) {
+            _mm_storeu_si128((__m128i *)(u + i / 2), u16);
+            _mm_storeu_si128((__m128i *)(v + i / 2), v16);
+        } else if (u < v) {
+            _mm_storeu_si128((__m128i *)(u + i), _mm_unpacklo_epi8(u16, v16));
+            _mm_storeu_si128((__m128i *)(u + i + 16), _mm_unpackhi_epi8(u16, v16));
+        } else {
+            _mm_storeu_si128((__m128i *)(v + i), _mm_unpacklo_epi8(v16, u16));
+            _mm_storeu_si128((__m128i *)(v + i + 16), _mm_unpackhi_epi8(v16, u16));
+        }
+    }
+    RGB32ToUVRow_C(cvt, bgr, curr + i, next + i, width - i, u + (i / 2) * uv_step, v + (i / 2) * uv_step, uv_step);
+}
+
+SDL_TARGETING("avx2") static void
+RGB32ToPackedRow_AVX2(const struct RGB2YUVFactors *cvt, SDL_bool bgr,
+                      const Uint32 *src, int width, Uint8 *dst, Uint32 dst_format)
+{
+    int i, k;
+
+    for (i = 0; i + 32 <= width; i += 32) {
+        __m128i u, v, uv[2];
+
+        /* Averaging a row with itself gives the average of each pair of pixels */
+        RGB32ToUV16_AVX2(cvt, bgr, src + i, src + i, &u, &v);
+        if (dst_format == SDL_PIXELFORMAT_YVYU) {
+            uv[0] = _mm_unpacklo_epi8(v, u);
+            uv[1] = _mm_unpackhi_epi8(v, u);
+        } else {
+            uv[0] = _mm_unpacklo_epi8(u, v);
+            uv[1] = _mm_unpackhi_epi8(u, v);
+        }
+        for (k = 0; k < 2; k++) {
+            const __m128i y = RGB32ToY16_AVX2(cvt, bgr, src + i + 16 * k);
+            Uint8 *out = dst + 2 * (i + 16 * k);
+            if (dst_format == SDL_PIXELFORMAT_UYVY) {
+                _mm_storeu_si128((__m128i *)out, _mm_unpacklo_epi8(uv[k], y));
+                _mm_storeu_si128((__m128i *)(out + 16), _mm_unpackhi_epi8(uv[k], y));
+            } else {
+                _mm_storeu_si128((__m128i *)out, _mm_unpacklo_epi8(y, uv[k]));
+                _mm_storeu_si128((__m128i *)(out + 16), _mm_unpackhi_epi8(y, uv[k]));
+            }
+        }
+    }
+    RGB32ToPackedRow_C(cvt, bgr, src + i, width - i, dst + 2 * i, dst_format);
+}
+#endif /* SDL_AVX2_INTRINSICS */
+
+#if SDL_NEON_INTRINSICS && SDL_BYTEORDER == SDL_LIL_ENDIAN
+/* Returns the Y, U or V values of four pixels, before wrapping to 8 bits */
+static SDL_INLINE uint32x4_t
+RGB2YUV_NEON(const float *factors, int offset, float32x4_t r, float32x4_t g, float32x4_t b)
+{
+    float32x4_t x = vaddq_f32(vmulq_f32(vdupq_n_f32(factors[0]), r), vmulq_f32(vdupq_n_f32(factors[1]), g));
+    x = vaddq_f32(vaddq_f32(x, vmulq_f32(vdupq_n_f32(factors[2]), b)), vdupq_n_f32(0.5f));
+    return vreinterpretq_u32_s32(vaddq_s32(vcvtq_s32_f32(x), vdupq_n_s32(offset)));
+}
+
+/* Returns the Y, U or V values of eight pixels, wrapped to 8 bits by the narrowing moves */
+static SDL_INLINE uint8x8_t
+RGB2YUV8_NEON(const float *factors, int offset, uint16x8_t r, uint16x8_t g, uint16x8_t b)
+{
+    const uint32x4_t lo = RGB2YUV_NEON(factors, offset, vcvtq_f32_u32(vmovl_u16(vget_low_u16(r))),
+                                       vcvtq_f32_u32(vmovl_u16(vget_low_u16(g))), vcvtq_f32_u32(vmovl_u16(vget_low_u16(b))));
+    const uint32x4_t hi = RGB2YUV_NEON(factors, offset, vcvtq_f32_u32(vmovl_u16(vget_high_u16(r))),
+                                       vcvtq_f32_u32(vmovl_u16(vget_high_u16(g))), vcvtq_f32_u32(vmovl_u16(vget_high_u16(b))));
+    return vmovn_u16(vcombine_u16(vmovn_u32(lo), vmovn_u32(hi)));
+}
+
+/* Returns the Y values of 16 pixels, loaded with vld4q_u8() */
+static SDL_INLINE uint8x16_t
+RGB32ToY16_NEON(const struct RGB2YUVFactors *cvt, SDL_bool bgr, uint8x16x4_t p)
+{
+    const uint8x16_t r = bgr ? p.val[0] : p.val[2];
+    const uint8x16_t g = p.val[1];
+    const uint8x16_t b = bgr ? p.val[2] : p.val[0];
+    const uint8x8_t lo = RGB2YUV8_NEON(cvt->y, cvt->y_offset, vmovl_u8(vget_low_u8(r)), vmovl_u8(vget_low_u8(g)), vmovl_u8(vget_low_u8(b)));
+    const uint8x8_t hi = RGB2YUV8_NEON(cvt->y, cvt->y_offset, vmovl_u8(vget_high_u8(r)), vmovl_u8(vget_high_u8(g)), vmovl_u8(vget_high_u8(b)));
+    return vcombine_u8(lo, hi);
+}
+
+static void RGB32ToYRow_NEON(const struct RGB2YUVFactors *cvt, SDL_bool bgr,
+                             const Uint32 *src, int width, Uint8 *y)
+{
+    int i;
+
+    for (i = 0; i + 16 <= width; i += 16) {
+        vst1q_u8(y + i, RGB32ToY16_NEON(cvt, bgr, vld4q_u8((const Uint8 *)(src + i))));
+    }
+    RGB32ToYRow_C(cvt, bgr, src + i, width - i, y + i);
+}
+
+static void RGB32ToUVRow_NEON(const struct RGB2YUVFactors *cvt, SDL_bool bgr,
+                              const Uint32 *curr, const Uint32 *next, int width,
+                              Uint8 *u, Uint8 *v, int uv_step)
+{
+    int i;
+
+    for (i = 0; i + 16 <= width; i += 16) {
+        const uint8x16x4_t c = vld4q_u8((const Uint8 *)(curr + i));
+        const uint8x16x4_t n = vld4q_u8((const Uint8 *)(next + i));
+        const uint16x8_t lo = vshrq_n_u16(vpadalq_u8(vpaddlq_u8(c.val[0]), n.val[0]), 2);
+        const uint16x8_t g = vshrq_n_u16(vpadalq_u8(vpaddlq_u8(c.val[1]), n.val[1]), 2);
+        const uint16x8_t hi = vshrq_n_u16(vpadalq_u8(vpaddlq_u8(c.val[2]), n.val[2]), 2);
+        const uint16x8_t r = bgr ? lo : hi;
+        const uint16x8_t b = bgr ? hi : lo;
+        uint8x8x2_t uv;
+
+        uv.val[0] = RGB2YUV8_NEON(cvt->u, 128, r, g, b);
+        uv.val[1] = RGB2YUV8_NEON(cvt->v, 128, r, g, b);
+        if (uv_step == 1) {
+            vst1_u8(u + i / 2, uv.val[0]);
+            vst1_u8(v + i / 2, uv.val[1]);
+        } else if (u < v) {
+            vst2_u8(u + i, uv);
+        } else {
+            const uint8x8_t tmp = uv.val[0];
+            uv.val[0] = uv.val[1];
+            uv.val[1] = tmp;
+            vst2_u8(v + i, uv);
+        }
+    }
+    RGB32ToUVRow_C(cvt, bgr, curr + i, next + i, width - i, u + (i / 2) * uv_step, v + (i / 2) * uv_step, uv_step);
+}
+
+static void RGB32ToPackedRow_NEON(const struct RGB2YUVFactors *cvt, SDL_bool bgr,
+                                  const Uint32 *src, int width, Uint8 *dst, Uint32 dst_format)
+{
+    int i;
+
+    for (i = 0; i + 16 <= width; i += 16) {
+        const uint8x16x4_t p = vld4q_u8((const Uint8 *)(src + i));
+        const uint16x8_t lo = vshrq_n_u16(vpaddlq_u8(p.val[0]), 1);
+        const uint16x8_t g = vshrq_n_u16(vpaddlq_u8(p.val[1]), 1);
+        const uint16x8_t hi = vshrq_n_u16(vpaddlq_u8(p.val[2]), 1);
+        const uint8x8_t u = RGB2YUV8_NEON(cvt->u, 128, bgr ? lo : hi, g, bgr ? hi : lo);
+        const uint8x8_t v = RGB2YUV8_NEON(cvt->v, 128, bgr ? lo : hi, g, bgr ? hi : lo);
+        const uint8x16_t y = RGB32ToY16_NEON(cvt, bgr, p);
+        const uint8x8x2_t y01 = vuzp_u8(vget_low_u8(y), vget_high_u8(y));
+        uint8x8x4_t out;
+
+        if (dst_format == SDL_PIXELFORMAT_UYVY) {
+            out.val[0] = u; out.val[1] = y01.val[0]; out.val[2] = v; out.val[3] = y01.val[1];
+        } else if (dst_format == SDL_PIXELFORMAT_YVYU) {
+            out.val[0] = y01.val[0]; out.val[1] = v; out.val[2] = y01.val[1]; out.val[3] = u;
+        } else {
+            out.val[0] = y01.val[0]; out.val[1] = u; out.val[2] = y01.val[1]; out.val[3] = v;
+        }
+        vst4_u8(dst + 2 * i, out);
+    }
+    RGB32ToPackedRow_C(cvt, bgr, src + i, width - i, dst + 2 * i, dst_format);
+}
+#endif /* SDL_NEON_INTRINSICS */
+
+static const RGB32ToYUVFuncs *GetRGB32ToYUVFuncs(void)
+{
+    static const RGB32ToYUVFuncs funcs_c = { RGB32ToYRow_C, RGB32ToUVRow_C, RGB32ToPackedRow_C };
+#if SDL_AVX2_INTRINSICS
+    static const RGB32ToYUVFuncs funcs_avx2 = { RGB32ToYRow_AVX2, RGB32ToUVRow_AVX2, RGB32ToPackedRow_AVX2 };
+#endif
+#if SDL_SSE2_INTRINSICS
+    static const RGB32ToYUVFuncs funcs_sse2 = { RGB32ToYRow_SSE2, RGB32ToUVRow_SSE2, RGB32ToPackedRow_SSE2 };
+#endif
+#if SDL_NEON_INTRINSICS && SDL_BYTEORDER == SDL_LIL_ENDIAN
+    static const RGB32ToYUVFuncs funcs_neon = { RGB32ToYRow_NEON, RGB32ToUVRow_NEON, RGB32ToPackedRow_NEON };
+#endif
+
+#if SDL_AVX2_INTRINSICS
+    if (SDL_CPUFeatureEnabled(CPU_HAS_AVX2)) {
+        return &funcs_avx2;
+    }
+#endif
+#if SDL_SSE2_INTRINSICS
+    if (SDL_CPUFeatureEnabled(CPU_HAS_SSE2)) {
+        return &funcs_sse2;
+    }
+#endif
+#if SDL_NEON_INTRINSICS && SDL_BYTEORDER == SDL_LIL_ENDIAN
+    if (SDL_CPUFeatureEnabled(CPU_HAS_NEON)) {
+        return &funcs_neon;
+    }
+#endif
+    return &funcs_c;
+}
+
+/* Converts rows [row, row + rows) of an image of 32-bit RGB pixels, row has to be even */
+static int
+SDL_ConvertPixels_RGB32_to_YUV(int width, int height, int row, int rows, Uint32 src_format, const void *src, int src_pitch, Uint32 dst_format, void *dst, int dst_pitch)
+{
+    const RGB32ToYUVFuncs *funcs = GetRGB32ToYUVFuncs();
+    const struct RGB2YUVFactors *cvt = &RGB2YUVFactorTables[SDL_GetYUVConversionModeForResolution(width, height)];
+    const SDL_bool bgr = (src_format == SDL_PIXELFORMAT_ABGR8888 || src_format == SDL_PIXELFORMAT_BGR888);
+    const Uint8 *curr_row = (const Uint8 *)src + row * src_pitch;
+    int j;
 
     switch (dst_format) 
     {
@@ -547,135 +968,32 @@ SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int sr
     case SDL_PIXELFORMAT_NV12:
     case SDL_PIXELFORMAT_NV21:
         {
-            const Uint8 *curr_row, *next_row;
-            
+            const int uv_step = (dst_format == SDL_PIXELFORMAT_NV12 || dst_format == SDL_PIXELFORMAT_NV21) ? 2 : 1;
             Uint8 *plane_y;
             Uint8 *plane_u;
             Uint8 *plane_v;
-            Uint8 *plane_interleaved_uv;
-            Uint32 y_stride, uv_stride, y_skip, uv_skip;
+            Uint32 y_stride, uv_stride;
 
             GetYUVPlanes(width, height, dst_format, dst, dst_pitch,
                          (const Uint8 **)&plane_y, (const Uint8 **)&plane_u, (const Uint8 **)&plane_v,
                          &y_stride, &uv_stride);
-            plane_interleaved_uv = (plane_y + height * y_stride);
-            y_skip = (y_stride - width);
-
-            curr_row = (const Uint8*)src;
-
-            /* Write Y plane */
-            for (j = 0; j < height; j++) {
-                for (i = 0; i < width; i++) {
-                    const Uint32 p1 = ((const Uint32 *)curr_row)[i];
-                    const Uint32 r = (p1 & 0x00ff0000) >> 16;
-                    const Uint32 g = (p1 & 0x0000ff00) >> 8;
-                    const Uint32 b = (p1 & 0x000000ff);
-                    *plane_y++ = MAKE_Y(r, g, b);
-                }
-                plane_y += y_skip;
-                curr_row += src_pitch;
-            }
+            OffsetYUVPlanes(dst_format, row, (const Uint8 **)&plane_y, (const Uint8 **)&plane_u, (const Uint8 **)&plane_v,
+                            y_stride, uv_stride);
 
-            curr_row = (const Uint8*)src;
-            next_row = (const Uint8*)src;
-            next_row += src_pitch;
-
-            if (dst_format == SDL_PIXELFORMAT_YV12 || dst_format == SDL_PIXELFORMAT_IYUV)
-            {
-                /* Write UV planes, not interleaved */
-                uv_skip = (uv_stride - (width + 1)/2);
-                for (j = 0; j < height_half; j++) {
-                    for (i = 0; i < width_half; i++) {
-                        READ_2x2_PIXELS;
-                        *plane_u++ = MAKE_U(r, g, b);
-                        *plane_v++ = MAKE_V(r, g, b);
-                    }
-                    if (width_remainder) {
-                        READ_2x1_PIXELS;
-                        *plane_u++ = MAKE_U(r, g, b);
-                        *plane_v++ = MAKE_V(r, g, b);
-                    }
-                    plane_u += uv_skip;
-                    plane_v += uv_skip;
-                    curr_row += src_pitch_x_2;
-                    next_row += src_pitch_x_2;
-                }
-                if (height_remainder) {
-                    for (i = 0; i < width_half; i++) {
-                        READ_1x2_PIXELS;
-                        *plane_u++ = MAKE_U(r, g, b);
-                        *plane_v++ = MAKE_V(r, g, b);
-                    }
-                    if (width_remainder) {
-                        READ_1x1_PIXEL;
-                        *plane_u++ = MAKE_U(r, g, b);
-                        *plane_v++ = MAKE_V(r, g, b);
-                    }
-                    plane_u += uv_skip;
-                    plane_v += uv_skip;
-                }
-            }
-            else if (dst_format == SDL_PIXELFORMAT_NV12)
-            {
-                uv_skip = (uv_stride - ((width + 1)/2)*2);
-                for (j = 0; j < height_half; j++) {
-                    for (i = 0; i < width_half; i++) {
-                        READ_2x2_PIXELS;
-                        *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                        *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                    }
-                    if (width_remainder) {
-                        READ_2x1_PIXELS;
-                        *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                        *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                    }
-                    plane_interleaved_uv += uv_skip;
-                    curr_row += src_pitch_x_2;
-                    next_row += src_pitch_x_2;
-                }
-                if (height_remainder) {
-                    for (i = 0; i < width_half; i++) {
-                        READ_1x2_PIXELS;
-                        *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                        *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                    }
-                    if (width_remainder) {
-                        READ_1x1_PIXEL;
-                        *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                        *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                    }
-                }
-            } 
-            else /* dst_format == SDL_PIXELFORMAT_NV21 */
-            {
-                uv_skip = (uv_stride - ((width + 1)/2)*2);
-                for (j = 0; j < height_half; j++) {
-                    for (i = 0; i < width_half; i++) {
-                        READ_2x2_PIXELS;
-                        *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                        *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                    }
-                    if (width_remainder) {
-                        READ_2x1_PIXELS;
-                        *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                        *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                    }
-                    plane_interleaved_uv += uv_skip;
-                    curr_row += src_pitch_x_2;
-                    next_row += src_pitch_x_2;
-                }
-                if (height_remainder) {
-                    for (i = 0; i < width_half; i++) {
-                        READ_1x2_PIXELS;
-                        *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                        *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                    }
-                    if (width_remainder) {
-                        READ_1x1_PIXEL;
-                        *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                        *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                    }
+            for (j = 0; j < rows; j += 2) {
+                /* The last row of an odd height image has its 2x2 blocks made of just that row */
+                const Uint8 *next_row = (j + 1 < rows) ? (curr_row + src_pitch) : curr_row;
+
+                funcs->y(cvt, bgr, (const Uint32 *)curr_row, width, plane_y);
+                if (next_row != curr_row) {
+                    funcs->y(cvt, bgr, (const Uint32 *)next_row, width, plane_y + y_stride);
                 }
+                funcs->uv(cvt, bgr, (const Uint32 *)curr_row, (const Uint32 *)next_row, width, plane_u, plane_v, uv_step);
+
+                curr_row += 2 * src_pitch;
+                plane_y += 2 * y_stride;
+                plane_u += uv_stride;
+                plane_v += uv_stride;
             }
         }
         break;
@@ -684,85 +1002,18 @@ SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int sr
     case SDL_PIXELFORMAT_UYVY:
     case SDL_PIXELFORMAT_YVYU:
         {
-            const Uint8 *curr_row = (const Uint8*) src;
-            Uint8 *plane           = (Uint8*) dst;
+            Uint8 *plane = (Uint8*) dst + row * dst_pitch;
             const int row_size = (4 * ((width + 1) / 2));
-            int plane_skip;
 
             if (dst_pitch < row_size) {
                 return SDL_SetError("Destination pitch is too small, expected at least %d\n", row_size);
             }
-            plane_skip = (dst_pitch - row_size);
 
             /* Write YUV plane, packed */
-            if (dst_format == SDL_PIXELFORMAT_YUY2) 
-            {
-                for (j = 0; j < height; j++) {
-                    for (i = 0; i < width_half; i++) {
-                        READ_TWO_RGB_PIXELS;
-                        /* Y U Y1 V */
-                        *plane++ = MAKE_Y(r, g, b);
-                        *plane++ = MAKE_U(R, G, B);
-                        *plane++ = MAKE_Y(r1, g1, b1);
-                        *plane++ = MAKE_V(R, G, B);
-                    }
-                    if (width_remainder) {
-                        READ_ONE_RGB_PIXEL;
-                        /* Y U Y V */
-                        *plane++ = MAKE_Y(r, g, b);
-                        *plane++ = MAKE_U(r, g, b);
-                        *plane++ = MAKE_Y(r, g, b);
-                        *plane++ = MAKE_V(r, g, b);
-                    }
-                    plane += plane_skip;
-                    curr_row += src_pitch;
-                }
-            } 
-            else if (dst_format == SDL_PIXELFORMAT_UYVY)
-            {
-                for (j = 0; j < height; j++) {
-                    for (i = 0; i < width_half; i++) {
-                        READ_TWO_RGB_PIXELS;
-                        /* U Y V Y1 */
-                        *plane++ = MAKE_U(R, G, B);
-                        *plane++ = MAKE_Y(r, g, b);
-                        *plane++ = MAKE_V(R, G, B);
-                        *plane++ = MAKE_Y(r1, g1, b1);
-                    }
-                    if (width_remainder) {
-                        READ_ONE_RGB_PIXEL;
-                        /* U Y V Y */
-                        *plane++ = MAKE_U(r, g, b);
-                        *plane++ = MAKE_Y(r, g, b);
-                        *plane++ = MAKE_V(r, g, b);
-                        *plane++ = MAKE_Y(r, g, b);
-                    }
-                    plane += plane_skip;
-                    curr_row += src_pitch;
-                }
-            }
-            else if (dst_format == SDL_PIXELFORMAT_YVYU)
-            {
-                for (j = 0; j < height; j++) {
-                    for (i = 0; i < width_half; i++) {
-                        READ_TWO_RGB_PIXELS;
-                        /* Y V Y1 U */
-                        *plane++ = MAKE_Y(r, g, b);
-                        *plane++ = MAKE_V(R, G, B);
-                        *plane++ = MAKE_Y(r1, g1, b1);
-                        *plane++ = MAKE_U(R, G, B);
-                    }
-                    if (width_remainder) {
-                        READ_ONE_RGB_PIXEL;
-                        /* Y V Y U */
-                        *plane++ = MAKE_Y(r, g, b);
-                        *plane++ = MAKE_V(r, g, b);
-                        *plane++ = MAKE_Y(r, g, b);
-                        *plane++ = MAKE_U(r, g, b);
-                    }
-                    plane += plane_skip;
-                    curr_row += src_pitch;
-                }
+            for (j = 0; j < rows; j++) {
+                funcs->packed(cvt, bgr, (const Uint32 *)curr_row, width, plane, dst_format);
+                plane += dst_pitch;
+                curr_row += src_pitch;
             }
         }
         break;
@@ -770,16 +1021,48 @@ SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int sr
     default:
         return SDL_SetError("Unsupported YUV destination format: %s", SDL_GetPixelFormatName(dst_format));
     }
+    return 0;
+}
+
 #undef MAKE_Y
 #undef MAKE_U
 #undef MAKE_V
-#undef READ_2x2_PIXELS
-#undef READ_2x1_PIXELS
-#undef READ_1x2_PIXELS
-#undef READ_1x1_PIXEL
-#undef READ_TWO_RGB_PIXELS
-#undef READ_ONE_RGB_PIXEL
-    return 0;
+
+typedef struct
+{
+    int width;
+    int height;
+    Uint32 src_format;
+    const void *src;
+    int src_pitch;
+    Uint32 dst_format;
+    void *dst;
+    int dst_pitch;
+} RGB32ToYUVBands;
+
+static int RGB32_to_YUV_Band(void *data, int row, int rows)
+{
+    const RGB32ToYUVBands *bands = (const RGB32ToYUVBands *) data;
+
+    return SDL_ConvertPixels_RGB32_to_YUV(bands->width, bands->height, row, rows,
+                                          bands->src_format, bands->src, bands->src_pitch,
+                                          bands->dst_format, bands->dst, bands->dst_pitch);
+}
+
+static int
+RGB32_to_YUV_Bands(int width, int height, Uint32 src_format, const void *src, int src_pitch, Uint32 dst_format, void *dst, int dst_pitch)
+{
+    RGB32ToYUVBands bands;
+
+    bands.width = width;
+    bands.height = height;
+    bands.src_format = src_format;
+    bands.src = src;
+    bands.src_pitch = src_pitch;
+    bands.dst_format = dst_format;
+    bands.dst = dst;
+    bands.dst_pitch = dst_pitch;
+    return SDL_ConvertPixelBands(width, height, 2, RGB32_to_YUV_Band, &bands);
 }
 
 int
@@ -810,12 +1093,13 @@ SDL_ConvertPixels_RGB_to_YUV(int width, int height,
     }
 #endif
 
-    /* ARGB8888 to FOURCC */
-    if (src_format == SDL_PIXELFORMAT_ARGB8888) {
-        return SDL_ConvertPixels_ARGB8888_to_YUV(width, height, src, src_pitch, dst_format, dst, dst_pitch);
+    /* 32-bit RGB to FOURCC */
+    if (src_format == SDL_PIXELFORMAT_ARGB8888 || src_format == SDL_PIXELFORMAT_RGB888 ||
+        src_format == SDL_PIXELFORMAT_ABGR8888 || src_format == SDL_PIXELFORMAT_BGR888) {
+        return RGB32_to_YUV_Bands(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
     }
 
-    /* not ARGB8888 to FOURCC : need an intermediate conversion */
+    /* other RGB to FOURCC : need an intermediate conversion */
     {
         int ret;
         void *tmp;
@@ -834,7 +1118,7 @@ SDL_ConvertPixels_RGB_to_YUV(int width, int height,
         }
 
         /* convert tmp/ARGB8888 to dst/FOURCC */
-        ret = SDL_ConvertPixels_ARGB8888_to_YUV(width, height, tmp, tmp_pitch, dst_format, dst, dst_pitch);
+        ret = RGB32_to_YUV_Bands(width, height, SDL_PIXELFORMAT_ARGB8888, tmp, tmp_pitch, dst_format, dst, dst_pitch);
         SDL_free(tmp);
         return ret;
     }
@@ -964,7 +1248,7 @@ SDL_ConvertPixels_PackUVPlanes_to_NV(int width, int height, const void *src, int
     Uint8 *dstUV;
     Uint8 *tmp = NULL;
 #ifdef __SSE2__
-    const SDL_bool use_SSE2 = SDL_HasSSE2();
+    const SDL_bool use_SSE2 = SDL_CPUFeatureEnabled(CPU_HAS_SSE2);
 #endif
 
     /* Skip the Y plane */
@@ -1038,7 +1322,7 @@ SDL_ConvertPixels_SplitNV_to_UVPlanes(int width, int height, const void *src, in
     Uint8 *dst1, *dst2;
     Uint8 *tmp = NULL;
 #ifdef __SSE2__
-    const SDL_bool use_SSE2 = SDL_HasSSE2();
+    const SDL_bool use_SSE2 = SDL_CPUFeatureEnabled(CPU_HAS_SSE2);
 #endif
 
     /* Skip the Y plane */
@@ -1116,7 +1400,7 @@ SDL_ConvertPixels_SwapNV(int width, int height, const void *src, int src_pitch,
     const Uint16 *srcUV;
     Uint16 *dstUV;
 #ifdef __SSE2__
-    const SDL_bool use_SSE2 = SDL_HasSSE2();
+    const SDL_bool use_SSE2 = SDL_CPUFeatureEnabled(CPU_HAS_SSE2);
 #endif
 
     /* Skip the Y plane */
@@ -1252,7 +1536,7 @@ SDL_ConvertPixels_YUY2_to_UYVY(int width, int height, const void *src, int src_p
     const Uint8 *srcYUV = (const Uint8 *)src;
     Uint8 *dstYUV = (Uint8 *)dst;
 #ifdef __SSE2__
-    const SDL_bool use_SSE2 = SDL_HasSSE2();
+    const SDL_bool use_SSE2 = SDL_CPUFeatureEnabled(CPU_HAS_SSE2);
 #endif
 
     y = height;
@@ -1294,7 +1578,7 @@ SDL_ConvertPixels_YUY2_to_YVYU(int width, int height, const void *src, int src_p
     const Uint8 *srcYUV = (const Uint8 *)src;
     Uint8 *dstYUV = (Uint8 *)dst;
 #ifdef __SSE2__
-    const SDL_bool use_SSE2 = SDL_HasSSE2();
+    const SDL_bool use_SSE2 = SDL_CPUFeatureEnabled(CPU_HAS_SSE2);
 #endif
 
     y = height;
@@ -1336,7 +1620,7 @@ SDL_ConvertPixels_UYVY_to_YUY2(int width, int height, const void *src, int src_p
     const Uint8 *srcYUV = (const Uint8 *)src;
     Uint8 *dstYUV = (Uint8 *)dst;
 #ifdef __SSE2__
-    const SDL_bool use_SSE2 = SDL_HasSSE2();
+    const SDL_bool use_SSE2 = SDL_CPUFeatureEnabled(CPU_HAS_SSE2);
 #endif
 
     y = height;
@@ -1378,7 +1662,7 @@ SDL_ConvertPixels_UYVY_to_YVYU(int width, int height, const void *src, int src_p
     const Uint8 *srcYUV = (const Uint8 *)src;
     Uint8 *dstYUV = (Uint8 *)dst;
 #ifdef __SSE2__
-    const SDL_bool use_SSE2 = SDL_HasSSE2();
+    const SDL_bool use_SSE2 = SDL_CPUFeatureEnabled(CPU_HAS_SSE2);
 #endif
 
     y = height;
@@ -1420,7 +1704,7 @@ SDL_ConvertPixels_YVYU_to_YUY2(int width, int height, const void *src, int src_p
     const Uint8 *srcYUV = (const Uint8 *)src;
     Uint8 *dstYUV = (Uint8 *)dst;
 #ifdef __SSE2__
-    const SDL_bool use_SSE2 = SDL_HasSSE2();
+    const SDL_bool use_SSE2 = SDL_CPUFeatureEnabled(CPU_HAS_SSE2);
 #endif
 
     y = height;
@@ -1462,7 +1746,7 @@ SDL_ConvertPixels_YVYU_to_UYVY(int width, int height, const void *src, int src_p
     const Uint8 *srcYUV = (const Uint8 *)src;
     Uint8 *dstYUV = (Uint8 *)dst;
 #ifdef __SSE2__
-    const SDL_bool use_SSE2 = SDL_HasSSE2();
+    const SDL_bool use_SSE2 = SDL_CPUFeatureEnabled(CPU_HAS_SSE2);
 #endif
 
     y = height;
@@ -1537,7 +1821,7 @@ SDL_ConvertPixels_Packed4_to_Packed4(int width, int height,
 }
 
 static int
-SDL_ConvertPixels_Planar2x2_to_Packed4(int width, int height,
+SDL_ConvertPixels_Planar2x2_to_Packed4(int width, int height, int row, int rows,
          Uint32 src_format, const void *src, int src_pitch,
          Uint32 dst_format, void *dst, int dst_pitch)
 {
@@ -1549,14 +1833,11 @@ SDL_ConvertPixels_Planar2x2_to_Packed4(int width, int height,
     Uint32 dstY_pitch, dstUV_pitch;
     Uint32 dst_pitch_left;
 
-    if (src == dst) {
-        return SDL_SetError("Can't change YUV plane types in-place");
-    }
-
     if (GetYUVPlanes(width, height, src_format, src, src_pitch,
                      &srcY1, &srcU, &srcV, &srcY_pitch, &srcUV_pitch) < 0) {
         return -1;
     }
+    OffsetYUVPlanes(src_format, row, &srcY1, &srcU, &srcV, srcY_pitch, srcUV_pitch);
     srcY2 = srcY1 + srcY_pitch;
     srcY_pitch_left = (srcY_pitch - width);
 
@@ -1573,13 +1854,14 @@ SDL_ConvertPixels_Planar2x2_to_Packed4(int width, int height,
                      &dstY_pitch, &dstUV_pitch) < 0) {
         return -1;
     }
+    OffsetYUVPlanes(dst_format, row, (const Uint8 **)&dstY1, (const Uint8 **)&dstU1, (const Uint8 **)&dstV1, dstY_pitch, dstUV_pitch);
     dstY2 = dstY1 + dstY_pitch;
     dstU2 = dstU1 + dstUV_pitch;
     dstV2 = dstV1 + dstUV_pitch;
     dst_pitch_left = (dstY_pitch - 4*((width + 1)/2));
 
     /* Copy 2x2 blocks of pixels at a time */
-    for (y = 0; y < (height - 1); y += 2) {
+    for (y = 0; y < (rows - 1); y += 2) {
         for (x = 0; x < (width - 1); x += 2) {
             /* Row 1 */
             *dstY1 = *srcY1++;
@@ -1644,7 +1926,7 @@ SDL_ConvertPixels_Planar2x2_to_Packed4(int width, int height,
     }
 
     /* Last row */
-    if (y == (height - 1)) {
+    if (y == (rows - 1)) {
         for (x = 0; x < (width - 1); x += 2) {
             /* Row 1 */
             *dstY1 = *srcY1++;
@@ -1680,7 +1962,7 @@ SDL_ConvertPixels_Planar2x2_to_Packed4(int width, int height,
 }
 
 static int
-SDL_ConvertPixels_Packed4_to_Planar2x2(int width, int height,
+SDL_ConvertPixels_Packed4_to_Planar2x2(int width, int height, int row, int rows,
          Uint32 src_format, const void *src, int src_pitch,
          Uint32 dst_format, void *dst, int dst_pitch)
 {
@@ -1692,14 +1974,11 @@ SDL_ConvertPixels_Packed4_to_Planar2x2(int width, int height,
     Uint32 dstY_pitch, dstUV_pitch;
     Uint32 dstY_pitch_left, dstUV_pitch_left, dstUV_pixel_stride;
 
-    if (src == dst) {
-        return SDL_SetError("Can't change YUV plane types in-place");
-    }
-
     if (GetYUVPlanes(width, height, src_format, src, src_pitch,
                      &srcY1, &srcU1, &srcV1, &srcY_pitch, &srcUV_pitch) < 0) {
         return -1;
     }
+    OffsetYUVPlanes(src_format, row, &srcY1, &srcU1, &srcV1, srcY_pitch, srcUV_pitch);
     srcY2 = srcY1 + srcY_pitch;
     srcU2 = srcU1 + srcUV_pitch;
     srcV2 = srcV1 + srcUV_pitch;
@@ -1710,6 +1989,7 @@ SDL_ConvertPixels_Packed4_to_Planar2x2(int width, int height,
                      &dstY_pitch, &dstUV_pitch) < 0) {
         return -1;
     }
+    OffsetYUVPlanes(dst_format, row, (const Uint8 **)&dstY1, (const Uint8 **)&dstU, (const Uint8 **)&dstV, dstY_pitch, dstUV_pitch);
     dstY2 = dstY1 + dstY_pitch;
     dstY_pitch_left = (dstY_pitch - width);
 
@@ -1722,7 +2002,7 @@ SDL_ConvertPixels_Packed4_to_Planar2x2(int width, int height,
     }
 
     /* Copy 2x2 blocks of pixels at a time */
-    for (y = 0; y < (height - 1); y += 2) {
+    for (y = 0; y < (rows - 1); y += 2) {
         for (x = 0; x < (width - 1); x += 2) {
             /* Row 1 */
             *dstY1++ = *srcY1;
@@ -1785,7 +2065,7 @@ SDL_ConvertPixels_Packed4_to_Planar2x2(int width, int height,
     }
 
     /* Last row */
-    if (y == (height - 1)) {
+    if (y == (rows - 1)) {
         for (x = 0; x < (width - 1); x += 2) {
             *dstY1++ = *srcY1;
             srcY1 += 2;
@@ -1813,6 +2093,62 @@ SDL_ConvertPixels_Packed4_to_Planar2x2(int width, int height,
 
 #endif /* SDL_HAVE_YUV */
 
+typedef struct
+{
+    int width;
+    int height;
+    Uint32 src_format;
+    const void *src;
+    int src_pitch;
+    Uint32 dst_format;
+    void *dst;
+    int dst_pitch;
+} YUVToYUVBands;
+
+static int YUV_to_YUV_Band(void *data, int row, int rows)
+{
+    const YUVToYUVBands *bands = (const YUVToYUVBands *) data;
+    const Uint32 src_format = bands->src_format;
+    const Uint32 dst_format = bands->dst_format;
+
+    if (IsPlanar2x2Format(src_format)) {
+        return SDL_ConvertPixels_Planar2x2_to_Packed4(bands->width, bands->height, row, rows,
+                                                      src_format, bands->src, bands->src_pitch,
+                                                      dst_format, bands->dst, bands->dst_pitch);
+    } else if (IsPlanar2x2Format(dst_format)) {
+        return SDL_ConvertPixels_Packed4_to_Planar2x2(bands->width, bands->height, row, rows,
+                                                      src_format, bands->src, bands->src_pitch,
+                                                      dst_format, bands->dst, bands->dst_pitch);
+    } else {
+        /* Packed formats keep all of a row in one place */
+        const void *src = (const Uint8 *)bands->src + row * bands->src_pitch;
+        void *dst = (Uint8 *)bands->dst + row * bands->dst_pitch;
+
+        if (src_format == dst_format) {
+            return SDL_ConvertPixels_YUV_to_YUV_Copy(bands->width, rows, src_format, src, bands->src_pitch, dst, bands->dst_pitch);
+        }
+        return SDL_ConvertPixels_Packed4_to_Packed4(bands->width, rows, src_format, src, bands->src_pitch, dst_format, dst, bands->dst_pitch);
+    }
+}
+
+static int
+YUV_to_YUV_Bands(int width, int height,
+         Uint32 src_format, const void *src, int src_pitch,
+         Uint32 dst_format, void *dst, int dst_pitch)
+{
+    YUVToYUVBands bands;
+
+    bands.width = width;
+    bands.height = height;
+    bands.src_format = src_format;
+    bands.src = src;
+    bands.src_pitch = src_pitch;
+    bands.dst_format = dst_format;
+    bands.dst = dst;
+    bands.dst_pitch = dst_pitch;
+    return SDL_ConvertPixelBands(width, height, 2, YUV_to_YUV_Band, &bands);
+}
+
 int
 SDL_ConvertPixels_YUV_to_YUV(int width, int height,
          Uint32 src_format, const void *src, int src_pitch,
@@ -1824,17 +2160,24 @@ SDL_ConvertPixels_YUV_to_YUV(int width, int height,
             /* Nothing to do */
             return 0;
         }
+        if (IsPacked4Format(src_format)) {
+            return YUV_to_YUV_Bands(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
+        }
         return SDL_ConvertPixels_YUV_to_YUV_Copy(width, height, src_format, src, src_pitch, dst, dst_pitch);
     }
 
+    /* Planar to planar conversions lay out their planes from the full height,
+       so they aren't split into bands */
     if (IsPlanar2x2Format(src_format) && IsPlanar2x2Format(dst_format)) {
         return SDL_ConvertPixels_Planar2x2_to_Planar2x2(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
     } else if (IsPacked4Format(src_format) && IsPacked4Format(dst_format)) {
-        return SDL_ConvertPixels_Packed4_to_Packed4(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
-    } else if (IsPlanar2x2Format(src_format) && IsPacked4Format(dst_format)) {
-        return SDL_ConvertPixels_Planar2x2_to_Packed4(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
-    } else if (IsPacked4Format(src_format) && IsPlanar2x2Format(dst_format)) {
-        return SDL_ConvertPixels_Packed4_to_Planar2x2(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
+        return YUV_to_YUV_Bands(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
+    } else if ((IsPlanar2x2Format(src_format) && IsPacked4Format(dst_format)) ||
+               (IsPacked4Format(src_format) && IsPlanar2x2Format(dst_format))) {
+        if (src == dst) {
+            return SDL_SetError("Can't change YUV plane types in-place");
+        }
+        return YUV_to_YUV_Bands(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
     } else {
         return SDL_SetError("SDL_ConvertPixels_YUV_to_YUV: Unsupported YUV conversion: %s -> %s", SDL_GetPixelFormatName(src_format), SDL_GetPixelFormatName(dst_format));
     }
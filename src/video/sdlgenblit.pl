@@ -85,6 +85,48 @@ my %set_rgba_string = (
     "BGRA8888" => "_pixel = (_B << 24) | (_G << 16) | (_R << 8) | _A;",
 );
 
+# The SIMD versions of the modulate and blend blitters, fastest first.
+# The x86 ones are generated from the same code, see x86_code().
+# NEON has a template of its own, see neon_code().
+my @simd_isas = (
+    "AVX2",
+    "SSE41",
+    "NEON",
+);
+
+my %simd_info = (
+    "AVX2" => {
+        "condition" => "defined(SDL_AVX2_INTRINSICS)",
+        "define" => "SDL_AVX2_INTRINSICS",
+        "cpu" => "SDL_CPU_AVX2",
+        "target" => "avx2",
+        "vec" => "__m256i",
+        "mm" => "_mm256_",
+        "si" => "si256",
+        "width" => 8,
+        "lanes" => "_mm256_broadcastsi128_si256(x)",
+    },
+    "SSE41" => {
+        "condition" => "defined(SDL_SSE4_1_INTRINSICS)",
+        "define" => "SDL_SSE4_1_INTRINSICS",
+        "cpu" => "SDL_CPU_SSE41",
+        "target" => "sse4.1",
+        "vec" => "__m128i",
+        "mm" => "_mm_",
+        "si" => "si128",
+        "width" => 4,
+        "lanes" => "x",
+    },
+    "NEON" => {
+        # The channels are found by byte, which needs little endian vectors
+        "condition" => "defined(SDL_NEON_INTRINSICS) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)",
+        "define" => "SDL_NEON_INTRINSICS",
+        "cpu" => "SDL_CPU_NEON",
+        "target" => "",
+        "width" => 4,
+    },
+);
+
 sub open_file {
     my $name = shift;
     open(FILE, ">$name.new") || die "Cant' open $name.new: $!";
@@ -518,6 +560,443 @@ __EOF__
 __EOF__
 }
 
+sub simd_funcname
+{
+    my $isa = shift;
+    my $modulate = shift;
+    my $blend = shift;
+    my $scale = shift;
+
+    my $name = "SDL_Blit_8888";
+    if ( $modulate ) {
+        $name .= "_Modulate";
+    }
+    if ( $blend ) {
+        $name .= "_Blend";
+    }
+    if ( $scale ) {
+        $name .= "_Scale";
+    }
+    return "${name}_$isa";
+}
+
+sub output_simdfuncs
+{
+    foreach my $isa (@simd_isas) {
+        my %info = %{$simd_info{$isa}};
+        my $code;
+        if ( $isa eq "NEON" ) {
+            $code = neon_code();
+        } else {
+            $code = x86_code();
+        }
+        $code =~ s/CONDITION/$info{"condition"}/g;
+        $code =~ s/"TARGET"/"$info{"target"}"/g;
+        $code =~ s/LANES/$info{"lanes"}/g if ( defined($info{"lanes"}) );
+        $code =~ s/VEC/$info{"vec"}/g if ( defined($info{"vec"}) );
+        $code =~ s/_mmX_/$info{"mm"}/g if ( defined($info{"mm"}) );
+        $code =~ s/siX/$info{"si"}/g if ( defined($info{"si"}) );
+        $code =~ s/WIDTH/$info{"width"}/g;
+        $code =~ s/_ISA\b/_$isa/g;
+        print FILE $code;
+
+        my $targeting = "";
+        if ( $info{"target"} ne "" ) {
+            $targeting = "SDL_TARGETING(\"$info{'target'}\") ";
+        }
+        for (my $modulate = 0; $modulate <= 1; ++$modulate) {
+            for (my $blend = 0; $blend <= 1; ++$blend) {
+                for (my $scale = 0; $scale <= 1; ++$scale) {
+                    if ( $modulate || $blend ) {
+                        my $name = simd_funcname($isa, $modulate, $blend, $scale);
+                        my @args = map { $_ ? "SDL_TRUE" : "SDL_FALSE" } ($modulate, $blend, $scale);
+                        print FILE <<__EOF__;
+${targeting}static void
+$name(SDL_BlitInfo *info)
+{
+    SDL_Blit_8888_$isa(info, $args[0], $args[1], $args[2]);
+}
+
+__EOF__
+                    }
+                }
+            }
+        }
+        print FILE <<__EOF__;
+#endif /* $info{"define"} */
+
+__EOF__
+    }
+}
+
+sub x86_code
+{
+    return <<'__EOF__';
+#if CONDITION
+
+/* Copies a 128-bit pattern to every 128-bit lane */
+SDL_TARGETING("TARGET") static SDL_INLINE VEC
+SDL_Blit_Lanes_ISA(__m128i x)
+{
+    return LANES;
+}
+
+/* x / 255 for x <= 255 * 255, in 16-bit lanes */
+SDL_TARGETING("TARGET") static SDL_INLINE VEC
+SDL_Blit_Div255_ISA(VEC x)
+{
+    return _mmX_srli_epi16(_mmX_add_epi16(_mmX_add_epi16(x, _mmX_set1_epi16(1)), _mmX_srli_epi16(x, 8)), 8);
+}
+
+/* The blend modes of the C blitters, with 16 bits per channel */
+SDL_TARGETING("TARGET") static SDL_INLINE VEC
+SDL_Blit_Blend_ISA(int mode, VEC s, VEC d, VEC A, VEC alpha_lanes)
+{
+    const VEC v255 = _mmX_set1_epi16(255);
+
+    switch (mode) {
+    case SDL_COPY_BLEND:
+        return _mmX_add_epi16(s, SDL_Blit_Div255_ISA(_mmX_mullo_epi16(_mmX_sub_epi16(v255, A), d)));
+    case SDL_COPY_ADD:
+        return _mmX_blendv_epi8(_mmX_min_epu16(_mmX_add_epi16(s, d), v255), d, alpha_lanes);
+    case SDL_COPY_MOD:
+        return _mmX_blendv_epi8(SDL_Blit_Div255_ISA(_mmX_mullo_epi16(s, d)), d, alpha_lanes);
+    case SDL_COPY_MUL:
+    {
+        /* (s * d + d * (255 - A)) / 255 needs 32 bits, and anything past 255 is clamped anyway */
+        const VEC one = _mmX_set1_epi32(1);
+        const VEC t = _mmX_sub_epi16(_mmX_add_epi16(s, v255), A);
+        const VEC lo16 = _mmX_mullo_epi16(d, t);
+        const VEC hi16 = _mmX_mulhi_epu16(d, t);
+        VEC lo = _mmX_unpacklo_epi16(lo16, hi16);
+        VEC hi = _mmX_unpackhi_epi16(lo16, hi16);
+        lo = _mmX_srli_epi32(_mmX_add_epi32(_mmX_add_epi32(lo, one), _mmX_srli_epi32(lo, 8)), 8);
+        hi = _mmX_srli_epi32(_mmX_add_epi32(_mmX_add_epi32(hi, one), _mmX_srli_epi32(hi, 8)), 8);
+        return _mmX_min_epu16(_mmX_packus_epi32(lo, hi), v255);
+    }
+    default:
+        return d;
+    }
+}
+
+/* Converts, modulates and blends WIDTH pixels at a time between any of the
+   8888 formats, giving the same results as the C blitters. */
+SDL_TARGETING("TARGET") static SDL_INLINE void
+SDL_Blit_8888_ISA(SDL_BlitInfo *info, SDL_bool modulate, SDL_bool blend, SDL_bool scale)
+{
+    const int flags = info->flags;
+    const int mode = flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    const SDL_bool premultiply = blend && (flags & (SDL_COPY_BLEND | SDL_COPY_ADD));
+    const SDL_PixelFormat *srcfmt = info->src_fmt;
+    const SDL_PixelFormat *dstfmt = info->dst_fmt;
+    const int dstR = dstfmt->Rshift / 8;
+    const int dstG = dstfmt->Gshift / 8;
+    const int dstB = dstfmt->Bshift / 8;
+    const int dstA = 6 - dstR - dstG - dstB; /* the byte left, even if it isn't alpha */
+    const VEC zero = _mmX_setzero_siX();
+    const VEC v255 = _mmX_set1_epi16(255);
+    Uint32 shuffle, modulation, fill = 0, opaque = 0, keep = 0xFFFFFFFF;
+    Uint8 mR, mG, mB, mA;
+    VEC shuffle_mask, fill_mask, opaque_mask, keep_mask, modulation16, alpha_lanes, alpha_shuffle;
+    int x, y, incx = 0, incy = 0;
+
+    /* Move the source channels to where they are in the destination */
+    shuffle = ((Uint32)(srcfmt->Rshift / 8) << (dstR * 8)) |
+              ((Uint32)(srcfmt->Gshift / 8) << (dstG * 8)) |
+              ((Uint32)(srcfmt->Bshift / 8) << (dstB * 8));
+    if (srcfmt->Amask) {
+        shuffle |= (Uint32)(srcfmt->Ashift / 8) << (dstA * 8);
+    } else {
+        /* The shuffle clears the alpha channel, which is then filled in */
+        shuffle |= 0x80u << (dstA * 8);
+        fill = (Uint32)((modulate && (flags & SDL_COPY_MODULATE_ALPHA)) ? info->a : 0xFF) << (dstA * 8);
+    }
+    if (!dstfmt->Amask) {
+        keep = ~(0xFFu << (dstA * 8));
+    } else if (mode == SDL_COPY_MUL && !srcfmt->Amask && !modulate) {
+        /* The C blitters leave the destination opaque here */
+        opaque = 0xFFu << (dstA * 8);
+    }
+    shuffle_mask = _mmX_add_epi8(_mmX_set1_epi32((int)shuffle),
+                                 SDL_Blit_Lanes_ISA(_mm_setr_epi32(0, 0x04040404, 0x08080808, 0x0C0C0C0C)));
+    fill_mask = _mmX_set1_epi32((int)fill);
+    opaque_mask = _mmX_set1_epi32((int)opaque);
+    keep_mask = _mmX_set1_epi32((int)keep);
+
+    /* Sources without alpha already have the modulated alpha filled in */
+    mR = (modulate && (flags & SDL_COPY_MODULATE_COLOR)) ? info->r : 255;
+    mG = (modulate && (flags & SDL_COPY_MODULATE_COLOR)) ? info->g : 255;
+    mB = (modulate && (flags & SDL_COPY_MODULATE_COLOR)) ? info->b : 255;
+    mA = (modulate && srcfmt->Amask && (flags & SDL_COPY_MODULATE_ALPHA)) ? info->a : 255;
+    modulation = ((Uint32)mR << (dstR * 8)) | ((Uint32)mG << (dstG * 8)) |
+                 ((Uint32)mB << (dstB * 8)) | ((Uint32)mA << (dstA * 8));
+    modulation16 = _mmX_unpacklo_epi8(_mmX_set1_epi32((int)modulation), zero);
+
+    /* The 16-bit alpha lane of each pixel, and a shuffle copying it to all lanes */
+    alpha_lanes = _mmX_set1_epi32((int)(0xFFu << (dstA * 8)));
+    alpha_lanes = _mmX_unpacklo_epi8(alpha_lanes, alpha_lanes);
+    alpha_shuffle = _mmX_add_epi8(_mmX_set1_epi16((short)((dstA * 2) | ((dstA * 2 + 1) << 8))),
+                                  SDL_Blit_Lanes_ISA(_mm_setr_epi32(0, 0, 0x08080808, 0x08080808)));
+
+    if (scale) {
+        incy = (info->src_h << 16) / info->dst_h;
+        incx = (info->src_w << 16) / info->dst_w;
+    }
+
+    for (y = 0; y < info->dst_h; ++y) {
+        const Uint32 *src = (const Uint32 *)(info->src + (scale ? (y * incy) >> 16 : y) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)(info->dst + y * info->dst_pitch);
+        int posx = 0;
+
+        for (x = 0; x < info->dst_w; x += WIDTH) {
+            const int count = SDL_min(info->dst_w - x, WIDTH);
+            Uint32 srcbuf[WIDTH], dstbuf[WIDTH];
+            const Uint32 *s = src + x;
+            Uint32 *d = dst + x;
+            VEC pixels, s_lo, s_hi;
+            int i;
+
+            /* The end of the row is done in a copy, with the same code */
+            if (count < WIDTH) {
+                SDL_zeroa(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(srcbuf, s, scale ? 0 : count * sizeof(Uint32));
+                SDL_memcpy(dstbuf, d, count * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+            if (scale) {
+                for (i = 0; i < count; ++i) {
+                    srcbuf[i] = src[posx >> 16];
+                    posx += incx;
+                }
+                s = srcbuf;
+            }
+
+            pixels = _mmX_shuffle_epi8(_mmX_loadu_siX((const VEC *)s), shuffle_mask);
+            pixels = _mmX_or_siX(pixels, fill_mask);
+            s_lo = _mmX_unpacklo_epi8(pixels, zero);
+            s_hi = _mmX_unpackhi_epi8(pixels, zero);
+
+            if (modulation != 0xFFFFFFFF) {
+                s_lo = SDL_Blit_Div255_ISA(_mmX_mullo_epi16(s_lo, modulation16));
+                s_hi = SDL_Blit_Div255_ISA(_mmX_mullo_epi16(s_hi, modulation16));
+            }
+            if (blend) {
+                const VEC dst8 = _mmX_loadu_siX((const VEC *)d);
+                const VEC a_lo = _mmX_shuffle_epi8(s_lo, alpha_shuffle);
+                const VEC a_hi = _mmX_shuffle_epi8(s_hi, alpha_shuffle);
+
+                if (premultiply) {
+                    s_lo = SDL_Blit_Div255_ISA(_mmX_mullo_epi16(s_lo, _mmX_blendv_epi8(a_lo, v255, alpha_lanes)));
+                    s_hi = SDL_Blit_Div255_ISA(_mmX_mullo_epi16(s_hi, _mmX_blendv_epi8(a_hi, v255, alpha_lanes)));
+                }
+                s_lo = SDL_Blit_Blend_ISA(mode, s_lo, _mmX_unpacklo_epi8(dst8, zero), a_lo, alpha_lanes);
+                s_hi = SDL_Blit_Blend_ISA(mode, s_hi, _mmX_unpackhi_epi8(dst8, zero), a_hi, alpha_lanes);
+            }
+
+            pixels = _mmX_or_siX(_mmX_packus_epi16(s_lo, s_hi), opaque_mask);
+            pixels = _mmX_and_siX(pixels, keep_mask);
+            _mmX_storeu_siX((VEC *)d, pixels);
+            if (count < WIDTH) {
+                SDL_memcpy(dst + x, dstbuf, count * sizeof(Uint32));
+            }
+        }
+    }
+}
+
+__EOF__
+}
+
+sub neon_code
+{
+    return <<'__EOF__';
+#if CONDITION
+
+/* Looks bytes up like _mm_shuffle_epi8(), indices past 15 give 0 */
+static SDL_INLINE uint8x16_t
+SDL_Blit_Shuffle_ISA(uint8x16_t x, uint8x16_t indices)
+{
+#if defined(__aarch64__) || defined(_M_ARM64)
+    return vqtbl1q_u8(x, indices);
+#else
+    uint8x8x2_t table;
+    table.val[0] = vget_low_u8(x);
+    table.val[1] = vget_high_u8(x);
+    return vcombine_u8(vtbl2_u8(table, vget_low_u8(indices)), vtbl2_u8(table, vget_high_u8(indices)));
+#endif
+}
+
+/* x / 255 for x <= 255 * 255, in 16-bit lanes */
+static SDL_INLINE uint16x8_t
+SDL_Blit_Div255_ISA(uint16x8_t x)
+{
+    return vshrq_n_u16(vaddq_u16(vaddq_u16(x, vdupq_n_u16(1)), vshrq_n_u16(x, 8)), 8);
+}
+
+/* The same rounding for 32-bit lanes */
+static SDL_INLINE uint32x4_t
+SDL_Blit_Div255_32_ISA(uint32x4_t x)
+{
+    return vshrq_n_u32(vaddq_u32(vaddq_u32(x, vdupq_n_u32(1)), vshrq_n_u32(x, 8)), 8);
+}
+
+/* The blend modes of the C blitters, with 16 bits per channel */
+static SDL_INLINE uint16x8_t
+SDL_Blit_Blend_ISA(int mode, uint16x8_t s, uint16x8_t d, uint16x8_t A, uint16x8_t alpha_lanes)
+{
+    const uint16x8_t v255 = vdupq_n_u16(255);
+
+    switch (mode) {
+    case SDL_COPY_BLEND:
+        return vaddq_u16(s, SDL_Blit_Div255_ISA(vmulq_u16(vsubq_u16(v255, A), d)));
+    case SDL_COPY_ADD:
+        return vbslq_u16(alpha_lanes, d, vminq_u16(vaddq_u16(s, d), v255));
+    case SDL_COPY_MOD:
+        return vbslq_u16(alpha_lanes, d, SDL_Blit_Div255_ISA(vmulq_u16(s, d)));
+    case SDL_COPY_MUL:
+    {
+        /* (s * d + d * (255 - A)) / 255 needs 32 bits, and anything past 255 is clamped anyway */
+        const uint16x8_t t = vsubq_u16(vaddq_u16(s, v255), A);
+        const uint32x4_t lo = SDL_Blit_Div255_32_ISA(vmull_u16(vget_low_u16(d), vget_low_u16(t)));
+        const uint32x4_t hi = SDL_Blit_Div255_32_ISA(vmull_u16(vget_high_u16(d), vget_high_u16(t)));
+        return vminq_u16(vcombine_u16(vqmovn_u32(lo), vqmovn_u32(hi)), v255);
+    }
+    default:
+        return d;
+    }
+}
+
+/* Converts, modulates and blends WIDTH pixels at a time between any of the
+   8888 formats, giving the same results as the C blitters. */
+static SDL_INLINE void
+SDL_Blit_8888_ISA(SDL_BlitInfo *info, SDL_bool modulate, SDL_bool blend, SDL_bool scale)
+{
+    static const Uint32 pixel_offsets[4] = { 0, 0x04040404, 0x08080808, 0x0C0C0C0C };
+    static const Uint32 lane_offsets[4] = { 0, 0, 0x08080808, 0x08080808 };
+    const int flags = info->flags;
+    const int mode = flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    const SDL_bool premultiply = blend && (flags & (SDL_COPY_BLEND | SDL_COPY_ADD));
+    const SDL_PixelFormat *srcfmt = info->src_fmt;
+    const SDL_PixelFormat *dstfmt = info->dst_fmt;
+    const int dstR = dstfmt->Rshift / 8;
+    const int dstG = dstfmt->Gshift / 8;
+    const int dstB = dstfmt->Bshift / 8;
+    const int dstA = 6 - dstR - dstG - dstB; /* the byte left, even if it isn't alpha */
+    const uint16x8_t v255 = vdupq_n_u16(255);
+    Uint32 shuffle, modulation, fill = 0, opaque = 0, keep = 0xFFFFFFFF;
+    Uint8 mR, mG, mB, mA;
+    uint8x16_t shuffle_mask, fill_mask, opaque_mask, keep_mask, alpha_shuffle;
+    uint16x8_t modulation16, alpha_lanes;
+    int x, y, incx = 0, incy = 0;
+
+    /* Move the source channels to where they are in the destination */
+    shuffle = ((Uint32)(srcfmt->Rshift / 8) << (dstR * 8)) |
+              ((Uint32)(srcfmt->Gshift / 8) << (dstG * 8)) |
+              ((Uint32)(srcfmt->Bshift / 8) << (dstB * 8));
+    if (srcfmt->Amask) {
+        shuffle |= (Uint32)(srcfmt->Ashift / 8) << (dstA * 8);
+    } else {
+        /* The shuffle clears the alpha channel, which is then filled in */
+        shuffle |= 0x80u << (dstA * 8);
+        fill = (Uint32)((modulate && (flags & SDL_COPY_MODULATE_ALPHA)) ? info->a : 0xFF) << (dstA * 8);
+    }
+    if (!dstfmt->Amask) {
+        keep = ~(0xFFu << (dstA * 8));
+    } else if (mode == SDL_COPY_MUL && !srcfmt->Amask && !modulate) {
+        /* The C blitters leave the destination opaque here */
+        opaque = 0xFFu << (dstA * 8);
+    }
+    shuffle_mask = vaddq_u8(vreinterpretq_u8_u32(vdupq_n_u32(shuffle)), vreinterpretq_u8_u32(vld1q_u32(pixel_offsets)));
+    fill_mask = vreinterpretq_u8_u32(vdupq_n_u32(fill));
+    opaque_mask = vreinterpretq_u8_u32(vdupq_n_u32(opaque));
+    keep_mask = vreinterpretq_u8_u32(vdupq_n_u32(keep));
+
+    /* Sources without alpha already have the modulated alpha filled in */
+    mR = (modulate && (flags & SDL_COPY_MODULATE_COLOR)) ? info->r : 255;
+    mG = (modulate && (flags & SDL_COPY_MODULATE_COLOR)) ? info->g : 255;
+    mB = (modulate && (flags & SDL_COPY_MODULATE_COLOR)) ? info->b : 255;
+    mA = (modulate && srcfmt->Amask && (flags & SDL_COPY_MODULATE_ALPHA)) ? info->a : 255;
+    modulation = ((Uint32)mR << (dstR * 8)) | ((Uint32)mG << (dstG * 8)) |
+                 ((Uint32)mB << (dstB * 8)) | ((Uint32)mA << (dstA * 8));
+    modulation16 = vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(modulation)));
+
+    /* The 16-bit alpha lane of each pixel, and a shuffle copying it to all lanes */
+    alpha_lanes = vceqq_u16(vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(0xFFu << (dstA * 8)))), v255);
+    alpha_shuffle = vaddq_u8(vreinterpretq_u8_u16(vdupq_n_u16((Uint16)((dstA * 2) | ((dstA * 2 + 1) << 8)))),
+                             vreinterpretq_u8_u32(vld1q_u32(lane_offsets)));
+
+    if (scale) {
+        incy = (info->src_h << 16) / info->dst_h;
+        incx = (info->src_w << 16) / info->dst_w;
+    }
+
+    for (y = 0; y < info->dst_h; ++y) {
+        const Uint32 *src = (const Uint32 *)(info->src + (scale ? (y * incy) >> 16 : y) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)(info->dst + y * info->dst_pitch);
+        int posx = 0;
+
+        for (x = 0; x < info->dst_w; x += WIDTH) {
+            const int count = SDL_min(info->dst_w - x, WIDTH);
+            Uint32 srcbuf[WIDTH], dstbuf[WIDTH];
+            const Uint32 *s = src + x;
+            Uint32 *d = dst + x;
+            uint8x16_t pixels;
+            uint16x8_t s_lo, s_hi;
+            int i;
+
+            /* The end of the row is done in a copy, with the same code */
+            if (count < WIDTH) {
+                SDL_zeroa(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(srcbuf, s, scale ? 0 : count * sizeof(Uint32));
+                SDL_memcpy(dstbuf, d, count * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+            if (scale) {
+                for (i = 0; i < count; ++i) {
+                    srcbuf[i] = src[posx >> 16];
+                    posx += incx;
+                }
+                s = srcbuf;
+            }
+
+            pixels = SDL_Blit_Shuffle_ISA(vld1q_u8((const Uint8 *)s), shuffle_mask);
+            pixels = vorrq_u8(pixels, fill_mask);
+            s_lo = vmovl_u8(vget_low_u8(pixels));
+            s_hi = vmovl_u8(vget_high_u8(pixels));
+
+            if (modulation != 0xFFFFFFFF) {
+                s_lo = SDL_Blit_Div255_ISA(vmulq_u16(s_lo, modulation16));
+                s_hi = SDL_Blit_Div255_ISA(vmulq_u16(s_hi, modulation16));
+            }
+            if (blend) {
+                const uint8x16_t dst8 = vld1q_u8((const Uint8 *)d);
+                const uint16x8_t a_lo = vreinterpretq_u16_u8(SDL_Blit_Shuffle_ISA(vreinterpretq_u8_u16(s_lo), alpha_shuffle));
+                const uint16x8_t a_hi = vreinterpretq_u16_u8(SDL_Blit_Shuffle_ISA(vreinterpretq_u8_u16(s_hi), alpha_shuffle));
+
+                if (premultiply) {
+                    s_lo = SDL_Blit_Div255_ISA(vmulq_u16(s_lo, vbslq_u16(alpha_lanes, v255, a_lo)));
+                    s_hi = SDL_Blit_Div255_ISA(vmulq_u16(s_hi, vbslq_u16(alpha_lanes, v255, a_hi)));
+                }
+                s_lo = SDL_Blit_Blend_ISA(mode, s_lo, vmovl_u8(vget_low_u8(dst8)), a_lo, alpha_lanes);
+                s_hi = SDL_Blit_Blend_ISA(mode, s_hi, vmovl_u8(vget_high_u8(dst8)), a_hi, alpha_lanes);
+            }
+
+            pixels = vorrq_u8(vcombine_u8(vqmovn_u16(s_lo), vqmovn_u16(s_hi)), opaque_mask);
+            pixels = vandq_u8(pixels, keep_mask);
+            vst1q_u8((Uint8 *)d, pixels);
+            if (count < WIDTH) {
+                SDL_memcpy(dst + x, dstbuf, count * sizeof(Uint32));
+            }
+        }
+    }
+}
+
+__EOF__
+}
+
 sub output_copyfunc_h
 {
 }
@@ -528,10 +1007,72 @@ sub output_copyinc
 #include "SDL_video.h"
 #include "SDL_blit.h"
 #include "SDL_blit_auto.h"
+#include "../cpuinfo/SDL_simd.h"
 
 __EOF__
 }
 
+sub copyflags
+{
+    my $modulate = shift;
+    my $blend = shift;
+    my $scale = shift;
+
+    my $flags = "";
+    my $flag = "";
+    if ( $modulate ) {
+        $flag = "SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA";
+        if ( $flags eq "" ) {
+            $flags = $flag;
+        } else {
+            $flags = "$flags | $flag";
+        }
+    }
+    if ( $blend ) {
+        $flag = "SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL";
+        if ( $flags eq "" ) {
+            $flags = $flag;
+        } else {
+            $flags = "$flags | $flag";
+        }
+    }
+    if ( $scale ) {
+        $flag = "SDL_COPY_NEAREST";
+        if ( $flags eq "" ) {
+            $flags = $flag;
+        } else {
+            $flags = "$flags | $flag";
+        }
+    }
+    if ( $flags eq "" ) {
+        $flags = "0";
+    }
+    return $flags;
+}
+
+sub output_simdfunctable
+{
+    my $src = shift;
+    my $dst = shift;
+
+    foreach my $isa (@simd_isas) {
+        my %info = %{$simd_info{$isa}};
+        print FILE "#if $info{'condition'}\n";
+        for (my $modulate = 0; $modulate <= 1; ++$modulate) {
+            for (my $blend = 0; $blend <= 1; ++$blend) {
+                for (my $scale = 0; $scale <= 1; ++$scale) {
+                    if ( $modulate || $blend ) {
+                        my $flags = copyflags($modulate, $blend, $scale);
+                        my $name = simd_funcname($isa, $modulate, $blend, $scale);
+                        print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ($flags), $info{'cpu'}, $name },\n";
+                    }
+                }
+            }
+        }
+        print FILE "#endif\n";
+    }
+}
+
 sub output_copyfunctable
 {
     print FILE <<__EOF__;
@@ -545,36 +1086,13 @@ __EOF__
                 for (my $blend = 0; $blend <= 1; ++$blend) {
                     for (my $scale = 0; $scale <= 1; ++$scale) {
                         if ( $modulate || $blend || $scale ) {
-                            print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ";
-                            my $flags = "";
-                            my $flag = "";
-                            if ( $modulate ) {
-                                $flag = "SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA";
-                                if ( $flags eq "" ) {
-                                    $flags = $flag;
-                                } else {
-                                    $flags = "$flags | $flag";
-                                }
-                            }
-                            if ( $blend ) {
-                                $flag = "SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL";
-                                if ( $flags eq "" ) {
-                                    $flags = $flag;
-                                } else {
-                                    $flags = "$flags | $flag";
-                                }
-                            }
-                            if ( $scale ) {
-                                $flag = "SDL_COPY_NEAREST";
-                                if ( $flags eq "" ) {
-                                    $flags = $flag;
-                                } else {
-                                    $flags = "$flags | $flag";
-                                }
-                            }
-                            if ( $flags eq "" ) {
-                                $flags = "0";
+                            # The SIMD blitters come first so they are picked when the CPU
+                            # has them, but after the plain scaling one, which they don't replace
+                            if ( $modulate == 0 && $blend == 1 && $scale == 0 ) {
+                                output_simdfunctable($src, $dst);
                             }
+                            print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ";
+                            my $flags = copyflags($modulate, $blend, $scale);
                             print FILE "($flags), SDL_CPU_ANY,";
                             output_copyfuncname("", $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, 0, " },\n");
                         }
@@ -623,5 +1141,6 @@ for (my $i = 0; $i <= $#src_formats; ++$i) {
         output_copyfunc_c($src_formats[$i], $dst_formats[$j]);
     }
 }
+output_simdfuncs();
 output_copyfunctable();
 close_file("SDL_blit_auto.c");
@@ -0,0 +1,315 @@
+// Copyright 2016 Adrien Descamps
+// Distributed under BSD 3-Clause License
+
+/* You need to define the following macros before including this file:
+	AVX2_FUNCTION_NAME
+	STD_FUNCTION_NAME
+	YUV_FORMAT
+	RGB_FORMAT
+*/
+
+/* This does the same 16 bit fixed point math as yuv_rgb_sse_func.h, on 32
+   pixels of a line at once, so both give the same results.
+
+   The 256 bit unpack and pack instructions work within each 128 bit lane.
+   Expanding the U and V values in pixel order and unpacking the Y values
+   with zeros puts pixels 0-7 and 16-23 in one register, and 8-15 and 24-31
+   in the other, so packing them back to bytes gives the pixels in order. */
+
+#define LOAD_SI256 _mm256_loadu_si256
+#define SAVE_SI256 _mm256_storeu_si256
+
+#define UV2RGB_32(U,V,R1,G1,B1,R2,G2,B2) \
+	r_tmp = _mm256_mullo_epi16(V, _mm256_set1_epi16(param->v_r_factor)); \
+	g_tmp = _mm256_add_epi16( \
+		_mm256_mullo_epi16(U, _mm256_set1_epi16(param->u_g_factor)), \
+		_mm256_mullo_epi16(V, _mm256_set1_epi16(param->v_g_factor))); \
+	b_tmp = _mm256_mullo_epi16(U, _mm256_set1_epi16(param->u_b_factor)); \
+	R1 = _mm256_unpacklo_epi16(r_tmp, r_tmp); \
+	G1 = _mm256_unpacklo_epi16(g_tmp, g_tmp); \
+	B1 = _mm256_unpacklo_epi16(b_tmp, b_tmp); \
+	R2 = _mm256_unpackhi_epi16(r_tmp, r_tmp); \
+	G2 = _mm256_unpackhi_epi16(g_tmp, g_tmp); \
+	B2 = _mm256_unpackhi_epi16(b_tmp, b_tmp); \
+
+#define ADD_Y2RGB_32(Y1,Y2,R1,G1,B1,R2,G2,B2) \
+	Y1 = _mm256_mullo_epi16(_mm256_sub_epi16(Y1, _mm256_set1_epi16(param->y_shift)), _mm256_set1_epi16(param->y_factor)); \
+	Y2 = _mm256_mullo_epi16(_mm256_sub_epi16(Y2, _mm256_set1_epi16(param->y_shift)), _mm256_set1_epi16(param->y_factor)); \
+	\
+	R1 = _mm256_srai_epi16(_mm256_add_epi16(R1, Y1), PRECISION); \
+	G1 = _mm256_srai_epi16(_mm256_add_epi16(G1, Y1), PRECISION); \
+	B1 = _mm256_srai_epi16(_mm256_add_epi16(B1, Y1), PRECISION); \
+	R2 = _mm256_srai_epi16(_mm256_add_epi16(R2, Y2), PRECISION); \
+	G2 = _mm256_srai_epi16(_mm256_add_epi16(G2, Y2), PRECISION); \
+	B2 = _mm256_srai_epi16(_mm256_add_epi16(B2, Y2), PRECISION); \
+
+#define PACK_RGB565_AVX2(R, G, B, rgb_ptr) \
+{ \
+	const __m256i red_mask = _mm256_set1_epi16((short)0xF800); \
+	__m256i lo, hi; \
+\
+	lo = _mm256_and_si256(_mm256_unpacklo_epi8(_mm256_setzero_si256(), R), red_mask); \
+	hi = _mm256_and_si256(_mm256_unpackhi_epi8(_mm256_setzero_si256(), R), red_mask); \
+	lo = _mm256_or_si256(lo, _mm256_slli_epi16(_mm256_srli_epi16(_mm256_unpacklo_epi8(G, _mm256_setzero_si256()), 2), 5)); \
+	hi = _mm256_or_si256(hi, _mm256_slli_epi16(_mm256_srli_epi16(_mm256_unpackhi_epi8(G, _mm256_setzero_si256()), 2), 5)); \
+	lo = _mm256_or_si256(lo, _mm256_srli_epi16(_mm256_unpacklo_epi8(B, _mm256_setzero_si256()), 3)); \
+	hi = _mm256_or_si256(hi, _mm256_srli_epi16(_mm256_unpackhi_epi8(B, _mm256_setzero_si256()), 3)); \
+	SAVE_SI256((__m256i*)(rgb_ptr), _mm256_permute2x128_si256(lo, hi, 0x20)); \
+	SAVE_SI256((__m256i*)(rgb_ptr+32), _mm256_permute2x128_si256(lo, hi, 0x31)); \
+}
+
+/* RGB24 is packed 16 pixels at a time with the SSE2 shuffle */
+#define PACK_RGB24_16_STEP1(R1, R2, G1, G2, B1, B2, RGB1, RGB2, RGB3, RGB4, RGB5, RGB6) \
+RGB1 = _mm_packus_epi16(_mm_and_si128(R1,_mm_set1_epi16(0xFF)), _mm_and_si128(R2,_mm_set1_epi16(0xFF))); \
+RGB2 = _mm_packus_epi16(_mm_and_si128(G1,_mm_set1_epi16(0xFF)), _mm_and_si128(G2,_mm_set1_epi16(0xFF))); \
+RGB3 = _mm_packus_epi16(_mm_and_si128(B1,_mm_set1_epi16(0xFF)), _mm_and_si128(B2,_mm_set1_epi16(0xFF))); \
+RGB4 = _mm_packus_epi16(_mm_srli_epi16(R1,8), _mm_srli_epi16(R2,8)); \
+RGB5 = _mm_packus_epi16(_mm_srli_epi16(G1,8), _mm_srli_epi16(G2,8)); \
+RGB6 = _mm_packus_epi16(_mm_srli_epi16(B1,8), _mm_srli_epi16(B2,8)); \
+
+#define PACK_RGB24_16_STEP2(R1, R2, G1, G2, B1, B2, RGB1, RGB2, RGB3, RGB4, RGB5, RGB6) \
+R1 = _mm_packus_epi16(_mm_and_si128(RGB1,_mm_set1_epi16(0xFF)), _mm_and_si128(RGB2,_mm_set1_epi16(0xFF))); \
+R2 = _mm_packus_epi16(_mm_and_si128(RGB3,_mm_set1_epi16(0xFF)), _mm_and_si128(RGB4,_mm_set1_epi16(0xFF))); \
+G1 = _mm_packus_epi16(_mm_and_si128(RGB5,_mm_set1_epi16(0xFF)), _mm_and_si128(RGB6,_mm_set1_epi16(0xFF))); \
+G2 = _mm_packus_epi16(_mm_srli_epi16(RGB1,8), _mm_srli_epi16(RGB2,8)); \
+B1 = _mm_packus_epi16(_mm_srli_epi16(RGB3,8), _mm_srli_epi16(RGB4,8)); \
+B2 = _mm_packus_epi16(_mm_srli_epi16(RGB5,8), _mm_srli_epi16(RGB6,8)); \
+
+#define PACK_RGB24_AVX2(R, G, B, rgb_ptr) \
+{ \
+	__m128i r1 = _mm256_castsi256_si128(R), r2 = _mm256_extracti128_si256(R, 1); \
+	__m128i g1 = _mm256_castsi256_si128(G), g2 = _mm256_extracti128_si256(G, 1); \
+	__m128i b1 = _mm256_castsi256_si128(B), b2 = _mm256_extracti128_si256(B, 1); \
+	__m128i rgb1, rgb2, rgb3, rgb4, rgb5, rgb6; \
+\
+	PACK_RGB24_16_STEP1(r1, r2, g1, g2, b1, b2, rgb1, rgb2, rgb3, rgb4, rgb5, rgb6) \
+	PACK_RGB24_16_STEP2(r1, r2, g1, g2, b1, b2, rgb1, rgb2, rgb3, rgb4, rgb5, rgb6) \
+	PACK_RGB24_16_STEP1(r1, r2, g1, g2, b1, b2, rgb1, rgb2, rgb3, rgb4, rgb5, rgb6) \
+	PACK_RGB24_16_STEP2(r1, r2, g1, g2, b1, b2, rgb1, rgb2, rgb3, rgb4, rgb5, rgb6) \
+	PACK_RGB24_16_STEP1(r1, r2, g1, g2, b1, b2, rgb1, rgb2, rgb3, rgb4, rgb5, rgb6) \
+	_mm_storeu_si128((__m128i*)(rgb_ptr), rgb1); \
+	_mm_storeu_si128((__m128i*)(rgb_ptr+16), rgb2); \
+	_mm_storeu_si128((__m128i*)(rgb_ptr+32), rgb3); \
+	_mm_storeu_si128((__m128i*)(rgb_ptr+48), rgb4); \
+	_mm_storeu_si128((__m128i*)(rgb_ptr+64), rgb5); \
+	_mm_storeu_si128((__m128i*)(rgb_ptr+80), rgb6); \
+}
+
+/* The four channels are given in the order they are stored in memory */
+#define PACK_RGBA_AVX2(C1, C2, C3, C4, rgb_ptr) \
+{ \
+	__m256i lo_12, hi_12, lo_34, hi_34, rgb1, rgb2, rgb3, rgb4; \
+\
+	lo_12 = _mm256_unpacklo_epi8(C1, C2); \
+	hi_12 = _mm256_unpackhi_epi8(C1, C2); \
+	lo_34 = _mm256_unpacklo_epi8(C3, C4); \
+	hi_34 = _mm256_unpackhi_epi8(C3, C4); \
+	rgb1 = _mm256_unpacklo_epi16(lo_12, lo_34); \
+	rgb2 = _mm256_unpackhi_epi16(lo_12, lo_34); \
+	rgb3 = _mm256_unpacklo_epi16(hi_12, hi_34); \
+	rgb4 = _mm256_unpackhi_epi16(hi_12, hi_34); \
+	SAVE_SI256((__m256i*)(rgb_ptr), _mm256_permute2x128_si256(rgb1, rgb2, 0x20)); \
+	SAVE_SI256((__m256i*)(rgb_ptr+32), _mm256_permute2x128_si256(rgb3, rgb4, 0x20)); \
+	SAVE_SI256((__m256i*)(rgb_ptr+64), _mm256_permute2x128_si256(rgb1, rgb2, 0x31)); \
+	SAVE_SI256((__m256i*)(rgb_ptr+96), _mm256_permute2x128_si256(rgb3, rgb4, 0x31)); \
+}
+
+#if RGB_FORMAT == RGB_FORMAT_RGB565
+#define PACK_LINE(r, g, b, rgb_ptr) PACK_RGB565_AVX2(r, g, b, rgb_ptr)
+#elif RGB_FORMAT == RGB_FORMAT_BGR565
+#define PACK_LINE(r, g, b, rgb_ptr) PACK_RGB565_AVX2(b, g, r, rgb_ptr)
+#elif RGB_FORMAT == RGB_FORMAT_RGB24
+#define PACK_LINE(r, g, b, rgb_ptr) PACK_RGB24_AVX2(r, g, b, rgb_ptr)
+#elif RGB_FORMAT == RGB_FORMAT_BGR24
+#define PACK_LINE(r, g, b, rgb_ptr) PACK_RGB24_AVX2(b, g, r, rgb_ptr)
+#elif RGB_FORMAT == RGB_FORMAT_RGBA
+#define PACK_LINE(r, g, b, rgb_ptr) PACK_RGBA_AVX2(a, b, g, r, rgb_ptr)
+#elif RGB_FORMAT == RGB_FORMAT_BGRA
+#define PACK_LINE(r, g, b, rgb_ptr) PACK_RGBA_AVX2(a, r, g, b, rgb_ptr)
+#elif RGB_FORMAT == RGB_FORMAT_ARGB
+#define PACK_LINE(r, g, b, rgb_ptr) PACK_RGBA_AVX2(b, g, r, a, rgb_ptr)
+#elif RGB_FORMAT == RGB_FORMAT_ABGR
+#define PACK_LINE(r, g, b, rgb_ptr) PACK_RGBA_AVX2(r, g, b, a, rgb_ptr)
+#else
+#error PACK_LINE unimplemented
+#endif
+
+#if YUV_FORMAT == YUV_FORMAT_420
+
+#define READ_Y(y_ptr) \
+	y = LOAD_SI256((const __m256i*)(y_ptr)); \
+
+#define READ_UV	\
+	u_16 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(u_ptr))); \
+	v_16 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(v_ptr))); \
+
+#elif YUV_FORMAT == YUV_FORMAT_422
+
+#define READ_Y(y_ptr) \
+{ \
+	__m256i y1, y2; \
+	y1 = _mm256_srli_epi16(_mm256_slli_epi16(LOAD_SI256((const __m256i*)(y_ptr)), 8), 8); \
+	y2 = _mm256_srli_epi16(_mm256_slli_epi16(LOAD_SI256((const __m256i*)(y_ptr+32)), 8), 8); \
+	y = _mm256_permute4x64_epi64(_mm256_packus_epi16(y1, y2), 0xD8); \
+}
+
+#define READ_UV	\
+{ \
+	__m256i u1, u2, v1, v2; \
+	u1 = _mm256_srli_epi32(_mm256_slli_epi32(LOAD_SI256((const __m256i*)(u_ptr)), 24), 24); \
+	u2 = _mm256_srli_epi32(_mm256_slli_epi32(LOAD_SI256((const __m256i*)(u_ptr+32)), 24), 24); \
+	u_16 = _mm256_permute4x64_epi64(_mm256_packs_epi32(u1, u2), 0xD8); \
+	v1 = _mm256_srli_epi32(_mm256_slli_epi32(LOAD_SI256((const __m256i*)(v_ptr)), 24), 24); \
+	v2 = _mm256_srli_epi32(_mm256_slli_epi32(LOAD_SI256((const __m256i*)(v_ptr+32)), 24), 24); \
+	v_16 = _mm256_permute4x64_epi64(_mm256_packs_epi32(v1, v2), 0xD8); \
+}
+
+#elif YUV_FORMAT == YUV_FORMAT_NV12
+
+#define READ_Y(y_ptr) \
+	y = LOAD_SI256((const __m256i*)(y_ptr)); \
+
+#define READ_UV	\
+	u_16 = _mm256_and_si256(LOAD_SI256((const __m256i*)(u_ptr)), _mm256_set1_epi16(0xFF)); \
+	v_16 = _mm256_and_si256(LOAD_SI256((const __m256i*)(v_ptr)), _mm256_set1_epi16(0xFF)); \
+
+#else
+#error READ_UV unimplemented
+#endif
+
+#define YUV2RGB_LINE(y_ptr, R, G, B) \
+	READ_Y(y_ptr) \
+	y_16_1 = _mm256_unpacklo_epi8(y, _mm256_setzero_si256()); \
+	y_16_2 = _mm256_unpackhi_epi8(y, _mm256_setzero_si256()); \
+	r_16_1 = r_uv_16_1; g_16_1 = g_uv_16_1; b_16_1 = b_uv_16_1; \
+	r_16_2 = r_uv_16_2; g_16_2 = g_uv_16_2; b_16_2 = b_uv_16_2; \
+	\
+	ADD_Y2RGB_32(y_16_1, y_16_2, r_16_1, g_16_1, b_16_1, r_16_2, g_16_2, b_16_2) \
+	\
+	R = _mm256_packus_epi16(r_16_1, r_16_2); \
+	G = _mm256_packus_epi16(g_16_1, g_16_2); \
+	B = _mm256_packus_epi16(b_16_1, b_16_2); \
+
+
+void SDL_TARGETING("avx2") AVX2_FUNCTION_NAME(uint32_t width, uint32_t height,
+	const uint8_t *Y, const uint8_t *U, const uint8_t *V, uint32_t Y_stride, uint32_t UV_stride,
+	uint8_t *RGB, uint32_t RGB_stride,
+	YCbCrType yuv_type)
+{
+	const YUV2RGBParam *const param = &(YUV2RGB[yuv_type]);
+#if YUV_FORMAT == YUV_FORMAT_420
+	const int y_pixel_stride = 1;
+	const int uv_pixel_stride = 1;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 2;
+#elif YUV_FORMAT == YUV_FORMAT_422
+	const int y_pixel_stride = 2;
+	const int uv_pixel_stride = 4;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 1;
+#elif YUV_FORMAT == YUV_FORMAT_NV12
+	const int y_pixel_stride = 1;
+	const int uv_pixel_stride = 2;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 2;
+#endif
+#if RGB_FORMAT == RGB_FORMAT_RGB565 || RGB_FORMAT == RGB_FORMAT_BGR565
+	const int rgb_pixel_stride = 2;
+#elif RGB_FORMAT == RGB_FORMAT_RGB24 || RGB_FORMAT == RGB_FORMAT_BGR24
+	const int rgb_pixel_stride = 3;
+#else
+	const int rgb_pixel_stride = 4;
+	const __m256i a = _mm256_set1_epi8((char)0xFF);
+#endif
+
+	if (width >= 32) {
+		uint32_t xpos, ypos;
+		for(ypos=0; ypos<(height-(uv_y_sample_interval-1)); ypos+=uv_y_sample_interval)
+		{
+			const uint8_t *y_ptr1=Y+ypos*Y_stride,
+				*y_ptr2=Y+(ypos+1)*Y_stride,
+				*u_ptr=U+(ypos/uv_y_sample_interval)*UV_stride,
+				*v_ptr=V+(ypos/uv_y_sample_interval)*UV_stride;
+
+			uint8_t *rgb_ptr1=RGB+ypos*RGB_stride,
+				*rgb_ptr2=RGB+(ypos+1)*RGB_stride;
+
+			for(xpos=0; xpos<(width-31); xpos+=32)
+			{
+				__m256i r_tmp, g_tmp, b_tmp;
+				__m256i r_16_1, g_16_1, b_16_1, r_16_2, g_16_2, b_16_2;
+				__m256i r_uv_16_1, g_uv_16_1, b_uv_16_1, r_uv_16_2, g_uv_16_2, b_uv_16_2;
+				__m256i y_16_1, y_16_2;
+				__m256i y, u_16, v_16;
+				__m256i r_8, g_8, b_8;
+
+				READ_UV
+				u_16 = _mm256_add_epi16(u_16, _mm256_set1_epi16(-128));
+				v_16 = _mm256_add_epi16(v_16, _mm256_set1_epi16(-128));
+				UV2RGB_32(u_16, v_16, r_uv_16_1, g_uv_16_1, b_uv_16_1, r_uv_16_2, g_uv_16_2, b_uv_16_2)
+
+				YUV2RGB_LINE(y_ptr1, r_8, g_8, b_8)
+				PACK_LINE(r_8, g_8, b_8, rgb_ptr1)
+
+				/* The packed formats don't share U and V with the next line */
+				if (uv_y_sample_interval > 1)
+				{
+					YUV2RGB_LINE(y_ptr2, r_8, g_8, b_8)
+					PACK_LINE(r_8, g_8, b_8, rgb_ptr2)
+				}
+
+				y_ptr1+=32*y_pixel_stride;
+				y_ptr2+=32*y_pixel_stride;
+				u_ptr+=32*uv_pixel_stride/uv_x_sample_interval;
+				v_ptr+=32*uv_pixel_stride/uv_x_sample_interval;
+				rgb_ptr1+=32*rgb_pixel_stride;
+				rgb_ptr2+=32*rgb_pixel_stride;
+			}
+		}
+
+		/* Catch the last line, if needed */
+		if (uv_y_sample_interval == 2 && ypos == (height-1))
+		{
+			const uint8_t *y_ptr=Y+ypos*Y_stride,
+				*u_ptr=U+(ypos/uv_y_sample_interval)*UV_stride,
+				*v_ptr=V+(ypos/uv_y_sample_interval)*UV_stride;
+
+			uint8_t *rgb_ptr=RGB+ypos*RGB_stride;
+
+			STD_FUNCTION_NAME(width, 1, y_ptr, u_ptr, v_ptr, Y_stride, UV_stride, rgb_ptr, RGB_stride, yuv_type);
+		}
+	}
+
+	/* Catch the right column, if needed */
+	{
+		int converted = (width & ~31);
+		if (converted != width)
+		{
+			const uint8_t *y_ptr=Y+converted*y_pixel_stride,
+				*u_ptr=U+converted*uv_pixel_stride/uv_x_sample_interval,
+				*v_ptr=V+converted*uv_pixel_stride/uv_x_sample_interval;
+
+			uint8_t *rgb_ptr=RGB+converted*rgb_pixel_stride;
+
+			STD_FUNCTION_NAME(width-converted, height, y_ptr, u_ptr, v_ptr, Y_stride, UV_stride, rgb_ptr, RGB_stride, yuv_type);
+		}
+	}
+}
+
+#undef AVX2_FUNCTION_NAME
+#undef STD_FUNCTION_NAME
+#undef YUV_FORMAT
+#undef RGB_FORMAT
+#undef LOAD_SI256
+#undef SAVE_SI256
+#undef UV2RGB_32
+#undef ADD_Y2RGB_32
+#undef PACK_RGB565_AVX2
+#undef PACK_RGB24_16_STEP1
+#undef PACK_RGB24_16_STEP2
+#undef PACK_RGB24_AVX2
+#undef PACK_RGBA_AVX2
+#undef PACK_LINE
+#undef READ_Y
+#undef READ_UV
+#undef YUV2RGB_LINE
@@ -0,0 +1,247 @@
+// Copyright 2016 Adrien Descamps
+// Distributed under BSD 3-Clause License
+
+/* You need to define the following macros before including this file:
+	NEON_FUNCTION_NAME
+	STD_FUNCTION_NAME
+	YUV_FORMAT
+	RGB_FORMAT
+*/
+
+/* This does the same 16 bit fixed point math as yuv_rgb_sse_func.h, on 16
+   pixels of a line at once, so both give the same results. The NEON
+   structure loads and stores take care of the interleaved formats. */
+
+#define UV2RGB_16(U,V,R1,G1,B1,R2,G2,B2) \
+{ \
+	int16x8x2_t r_dup, g_dup, b_dup; \
+	r_tmp = vmulq_s16(V, vdupq_n_s16(param->v_r_factor)); \
+	g_tmp = vaddq_s16( \
+		vmulq_s16(U, vdupq_n_s16(param->u_g_factor)), \
+		vmulq_s16(V, vdupq_n_s16(param->v_g_factor))); \
+	b_tmp = vmulq_s16(U, vdupq_n_s16(param->u_b_factor)); \
+	r_dup = vzipq_s16(r_tmp, r_tmp); \
+	g_dup = vzipq_s16(g_tmp, g_tmp); \
+	b_dup = vzipq_s16(b_tmp, b_tmp); \
+	R1 = r_dup.val[0]; G1 = g_dup.val[0]; B1 = b_dup.val[0]; \
+	R2 = r_dup.val[1]; G2 = g_dup.val[1]; B2 = b_dup.val[1]; \
+}
+
+#define ADD_Y2RGB_16(Y1,Y2,R1,G1,B1,R2,G2,B2) \
+	Y1 = vmulq_s16(vsubq_s16(Y1, vdupq_n_s16(param->y_shift)), vdupq_n_s16(param->y_factor)); \
+	Y2 = vmulq_s16(vsubq_s16(Y2, vdupq_n_s16(param->y_shift)), vdupq_n_s16(param->y_factor)); \
+	\
+	R1 = vshrq_n_s16(vaddq_s16(R1, Y1), PRECISION); \
+	G1 = vshrq_n_s16(vaddq_s16(G1, Y1), PRECISION); \
+	B1 = vshrq_n_s16(vaddq_s16(B1, Y1), PRECISION); \
+	R2 = vshrq_n_s16(vaddq_s16(R2, Y2), PRECISION); \
+	G2 = vshrq_n_s16(vaddq_s16(G2, Y2), PRECISION); \
+	B2 = vshrq_n_s16(vaddq_s16(B2, Y2), PRECISION); \
+
+#define PACK_RGB565_NEON(R, G, B, rgb_ptr) \
+{ \
+	uint16x8_t lo, hi; \
+	lo = vsriq_n_u16(vsriq_n_u16(vshll_n_u8(vget_low_u8(R), 8), vshll_n_u8(vget_low_u8(G), 8), 5), vshll_n_u8(vget_low_u8(B), 8), 11); \
+	hi = vsriq_n_u16(vsriq_n_u16(vshll_n_u8(vget_high_u8(R), 8), vshll_n_u8(vget_high_u8(G), 8), 5), vshll_n_u8(vget_high_u8(B), 8), 11); \
+	vst1q_u16((uint16_t*)(rgb_ptr), lo); \
+	vst1q_u16((uint16_t*)(rgb_ptr+16), hi); \
+}
+
+#define PACK_RGB24_NEON(C1, C2, C3, rgb_ptr) \
+{ \
+	uint8x16x3_t rgb; \
+	rgb.val[0] = C1; rgb.val[1] = C2; rgb.val[2] = C3; \
+	vst3q_u8(rgb_ptr, rgb); \
+}
+
+/* The four channels are given in the order they are stored in memory */
+#define PACK_RGBA_NEON(C1, C2, C3, C4, rgb_ptr) \
+{ \
+	uint8x16x4_t rgb; \
+	rgb.val[0] = C1; rgb.val[1] = C2; rgb.val[2] = C3; rgb.val[3] = C4; \
+	vst4q_u8(rgb_ptr, rgb); \
+}
+
+#if RGB_FORMAT == RGB_FORMAT_RGB565
+#define PACK_LINE(r, g, b, rgb_ptr) PACK_RGB565_NEON(r, g, b, rgb_ptr)
+#elif RGB_FORMAT == RGB_FORMAT_BGR565
+#define PACK_LINE(r, g, b, rgb_ptr) PACK_RGB565_NEON(b, g, r, rgb_ptr)
+#elif RGB_FORMAT == RGB_FORMAT_RGB24
+#define PACK_LINE(r, g, b, rgb_ptr) PACK_RGB24_NEON(r, g, b, rgb_ptr)
+#elif RGB_FORMAT == RGB_FORMAT_BGR24
+#define PACK_LINE(r, g, b, rgb_ptr) PACK_RGB24_NEON(b, g, r, rgb_ptr)
+#elif RGB_FORMAT == RGB_FORMAT_RGBA
+#define PACK_LINE(r, g, b, rgb_ptr) PACK_RGBA_NEON(a, b, g, r, rgb_ptr)
+#elif RGB_FORMAT == RGB_FORMAT_BGRA
+#define PACK_LINE(r, g, b, rgb_ptr) PACK_RGBA_NEON(a, r, g, b, rgb_ptr)
+#elif RGB_FORMAT == RGB_FORMAT_ARGB
+#define PACK_LINE(r, g, b, rgb_ptr) PACK_RGBA_NEON(b, g, r, a, rgb_ptr)
+#elif RGB_FORMAT == RGB_FORMAT_ABGR
+#define PACK_LINE(r, g, b, rgb_ptr) PACK_RGBA_NEON(r, g, b, a, rgb_ptr)
+#else
+#error PACK_LINE unimplemented
+#endif
+
+#if YUV_FORMAT == YUV_FORMAT_420
+
+#define READ_Y(y_ptr) \
+	y = vld1q_u8(y_ptr); \
+
+#define READ_UV	\
+	u_8 = vld1_u8(u_ptr); \
+	v_8 = vld1_u8(v_ptr); \
+
+#elif YUV_FORMAT == YUV_FORMAT_422
+
+#define READ_Y(y_ptr) \
+	y = vld2q_u8(y_ptr).val[0]; \
+
+#define READ_UV	\
+	u_8 = vld4_u8(u_ptr).val[0]; \
+	v_8 = vld4_u8(v_ptr).val[0]; \
+
+#elif YUV_FORMAT == YUV_FORMAT_NV12
+
+#define READ_Y(y_ptr) \
+	y = vld1q_u8(y_ptr); \
+
+#define READ_UV	\
+	u_8 = vld2_u8(u_ptr).val[0]; \
+	v_8 = vld2_u8(v_ptr).val[0]; \
+
+#else
+#error READ_UV unimplemented
+#endif
+
+#define YUV2RGB_LINE(y_ptr, R, G, B) \
+	READ_Y(y_ptr) \
+	y_16_1 = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(y))); \
+	y_16_2 = vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(y))); \
+	r_16_1 = r_uv_16_1; g_16_1 = g_uv_16_1; b_16_1 = b_uv_16_1; \
+	r_16_2 = r_uv_16_2; g_16_2 = g_uv_16_2; b_16_2 = b_uv_16_2; \
+	\
+	ADD_Y2RGB_16(y_16_1, y_16_2, r_16_1, g_16_1, b_16_1, r_16_2, g_16_2, b_16_2) \
+	\
+	R = vcombine_u8(vqmovun_s16(r_16_1), vqmovun_s16(r_16_2)); \
+	G = vcombine_u8(vqmovun_s16(g_16_1), vqmovun_s16(g_16_2)); \
+	B = vcombine_u8(vqmovun_s16(b_16_1), vqmovun_s16(b_16_2)); \
+
+
+void NEON_FUNCTION_NAME(uint32_t width, uint32_t height,
+	const uint8_t *Y, const uint8_t *U, const uint8_t *V, uint32_t Y_stride, uint32_t UV_stride,
+	uint8_t *RGB, uint32_t RGB_stride,
+	YCbCrType yuv_type)
+{
+	const YUV2RGBParam *const param = &(YUV2RGB[yuv_type]);
+#if YUV_FORMAT == YUV_FORMAT_420
+	const int y_pixel_stride = 1;
+	const int uv_pixel_stride = 1;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 2;
+#elif YUV_FORMAT == YUV_FORMAT_422
+	const int y_pixel_stride = 2;
+	const int uv_pixel_stride = 4;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 1;
+#elif YUV_FORMAT == YUV_FORMAT_NV12
+	const int y_pixel_stride = 1;
+	const int uv_pixel_stride = 2;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 2;
+#endif
+#if RGB_FORMAT == RGB_FORMAT_RGB565 || RGB_FORMAT == RGB_FORMAT_BGR565
+	const int rgb_pixel_stride = 2;
+#elif RGB_FORMAT == RGB_FORMAT_RGB24 || RGB_FORMAT == RGB_FORMAT_BGR24
+	const int rgb_pixel_stride = 3;
+#else
+	const int rgb_pixel_stride = 4;
+	const uint8x16_t a = vdupq_n_u8(0xFF);
+#endif
+
+	if (width >= 16) {
+		uint32_t xpos, ypos;
+		for(ypos=0; ypos<(height-(uv_y_sample_interval-1)); ypos+=uv_y_sample_interval)
+		{
+			const uint8_t *y_ptr1=Y+ypos*Y_stride,
+				*y_ptr2=Y+(ypos+1)*Y_stride,
+				*u_ptr=U+(ypos/uv_y_sample_interval)*UV_stride,
+				*v_ptr=V+(ypos/uv_y_sample_interval)*UV_stride;
+
+			uint8_t *rgb_ptr1=RGB+ypos*RGB_stride,
+				*rgb_ptr2=RGB+(ypos+1)*RGB_stride;
+
+			for(xpos=0; xpos<(width-15); xpos+=16)
+			{
+				int16x8_t r_tmp, g_tmp, b_tmp;
+				int16x8_t r_16_1, g_16_1, b_16_1, r_16_2, g_16_2, b_16_2;
+				int16x8_t r_uv_16_1, g_uv_16_1, b_uv_16_1, r_uv_16_2, g_uv_16_2, b_uv_16_2;
+				int16x8_t y_16_1, y_16_2, u_16, v_16;
+				uint8x16_t y, r_8, g_8, b_8;
+				uint8x8_t u_8, v_8;
+
+				READ_UV
+				u_16 = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(u_8)), vdupq_n_s16(128));
+				v_16 = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(v_8)), vdupq_n_s16(128));
+				UV2RGB_16(u_16, v_16, r_uv_16_1, g_uv_16_1, b_uv_16_1, r_uv_16_2, g_uv_16_2, b_uv_16_2)
+
+				YUV2RGB_LINE(y_ptr1, r_8, g_8, b_8)
+				PACK_LINE(r_8, g_8, b_8, rgb_ptr1)
+
+				/* The packed formats don't share U and V with the next line */
+				if (uv_y_sample_interval > 1)
+				{
+					YUV2RGB_LINE(y_ptr2, r_8, g_8, b_8)
+					PACK_LINE(r_8, g_8, b_8, rgb_ptr2)
+				}
+
+				y_ptr1+=16*y_pixel_stride;
+				y_ptr2+=16*y_pixel_stride;
+				u_ptr+=16*uv_pixel_stride/uv_x_sample_interval;
+				v_ptr+=16*uv_pixel_stride/uv_x_sample_interval;
+				rgb_ptr1+=16*rgb_pixel_stride;
+				rgb_ptr2+=16*rgb_pixel_stride;
+			}
+		}
+
+		/* Catch the last line, if needed */
+		if (uv_y_sample_interval == 2 && ypos == (height-1))
+		{
+			const uint8_t *y_ptr=Y+ypos*Y_stride,
+				*u_ptr=U+(ypos/uv_y_sample_interval)*UV_stride,
+				*v_ptr=V+(ypos/uv_y_sample_interval)*UV_stride;
+
+			uint8_t *rgb_ptr=RGB+ypos*RGB_stride;
+
+			STD_FUNCTION_NAME(width, 1, y_ptr, u_ptr, v_ptr, Y_stride, UV_stride, rgb_ptr, RGB_stride, yuv_type);
+		}
+	}
+
+	/* Catch the right column, if needed */
+	{
+		int converted = (width & ~15);
+		if (converted != width)
+		{
+			const uint8_t *y_ptr=Y+converted*y_pixel_stride,
+				*u_ptr=U+converted*uv_pixel_stride/uv_x_sample_interval,
+				*v_ptr=V+converted*uv_pixel_stride/uv_x_sample_interval;
+
+			uint8_t *rgb_ptr=RGB+converted*rgb_pixel_stride;
+
+			STD_FUNCTION_NAME(width-converted, height, y_ptr, u_ptr, v_ptr, Y_stride, UV_stride, rgb_ptr, RGB_stride, yuv_type);
+		}
+	}
+}
+
+#undef NEON_FUNCTION_NAME
+#undef STD_FUNCTION_NAME
+#undef YUV_FORMAT
+#undef RGB_FORMAT
+#undef UV2RGB_16
+#undef ADD_Y2RGB_16
+#undef PACK_RGB565_NEON
+#undef PACK_RGB24_NEON
+#undef PACK_RGBA_NEON
+#undef PACK_LINE
+#undef READ_Y
+#undef READ_UV
+#undef YUV2RGB_LINE
@@ -184,11 +184,30 @@ PACK_RGB24_32_STEP1(R1, R2, G1, G2, B1, B2, RGB1, RGB2, RGB3, RGB4, RGB5, RGB6)
 	\
 	PACK_RGBA_32(a, a, b_8_21, b_8_22, g_8_21, g_8_22, r_8_21, r_8_22, rgb_9, rgb_10, rgb_11, rgb_12, rgb_13, rgb_14, rgb_15, rgb_16) \
 
+#elif RGB_FORMAT == RGB_FORMAT_BGR565
+
+#define PACK_PIXEL \
+	__m128i rgb_1, rgb_2, rgb_3, rgb_4, rgb_5, rgb_6, rgb_7, rgb_8; \
+	\
+	PACK_RGB565_32(b_8_11, b_8_12, g_8_11, g_8_12, r_8_11, r_8_12, rgb_1, rgb_2, rgb_3, rgb_4) \
+	\
+	PACK_RGB565_32(b_8_21, b_8_22, g_8_21, g_8_22, r_8_21, r_8_22, rgb_5, rgb_6, rgb_7, rgb_8) \
+
+#elif RGB_FORMAT == RGB_FORMAT_BGR24
+
+#define PACK_PIXEL \
+	__m128i rgb_1, rgb_2, rgb_3, rgb_4, rgb_5, rgb_6; \
+	__m128i rgb_7, rgb_8, rgb_9, rgb_10, rgb_11, rgb_12; \
+	\
+	PACK_RGB24_32(b_8_11, b_8_12, g_8_11, g_8_12, r_8_11, r_8_12, rgb_1, rgb_2, rgb_3, rgb_4, rgb_5, rgb_6) \
+	\
+	PACK_RGB24_32(b_8_21, b_8_22, g_8_21, g_8_22, r_8_21, r_8_22, rgb_7, rgb_8, rgb_9, rgb_10, rgb_11, rgb_12) \
+
 #else
 #error PACK_PIXEL unimplemented
 #endif
 
-#if RGB_FORMAT == RGB_FORMAT_RGB565
+#if RGB_FORMAT == RGB_FORMAT_RGB565 || RGB_FORMAT == RGB_FORMAT_BGR565
 
 #define SAVE_LINE1 \
 	SAVE_SI128((__m128i*)(rgb_ptr1), rgb_1); \
@@ -202,7 +221,7 @@ PACK_RGB24_32_STEP1(R1, R2, G1, G2, B1, B2, RGB1, RGB2, RGB3, RGB4, RGB5, RGB6)
 	SAVE_SI128((__m128i*)(rgb_ptr2+32), rgb_7); \
 	SAVE_SI128((__m128i*)(rgb_ptr2+48), rgb_8); \
 
-#elif RGB_FORMAT == RGB_FORMAT_RGB24
+#elif RGB_FORMAT == RGB_FORMAT_RGB24 || RGB_FORMAT == RGB_FORMAT_BGR24
 
 #define SAVE_LINE1 \
 	SAVE_SI128((__m128i*)(rgb_ptr1), rgb_1); \
@@ -404,9 +423,9 @@ void SSE_FUNCTION_NAME(uint32_t width, uint32_t height,
 	const int uv_x_sample_interval = 2;
 	const int uv_y_sample_interval = 2;
 #endif
-#if RGB_FORMAT == RGB_FORMAT_RGB565
+#if RGB_FORMAT == RGB_FORMAT_RGB565 || RGB_FORMAT == RGB_FORMAT_BGR565
 	const int rgb_pixel_stride = 2;
-#elif RGB_FORMAT == RGB_FORMAT_RGB24
+#elif RGB_FORMAT == RGB_FORMAT_RGB24 || RGB_FORMAT == RGB_FORMAT_BGR24
 	const int rgb_pixel_stride = 3;
 #elif RGB_FORMAT == RGB_FORMAT_RGBA || RGB_FORMAT == RGB_FORMAT_BGRA || \
       RGB_FORMAT == RGB_FORMAT_ARGB || RGB_FORMAT == RGB_FORMAT_ABGR
@@ -64,6 +64,23 @@
 		(((Uint32)clampU8(y_tmp+r_tmp)) << 0); \
 	rgb_ptr += 4; \
 
+#elif RGB_FORMAT == RGB_FORMAT_BGR565
+
+#define PACK_PIXEL(rgb_ptr) \
+	*(Uint16 *)rgb_ptr = \
+		((((Uint16)clampU8(y_tmp+b_tmp)) << 8 ) & 0xF800) | \
+		((((Uint16)clampU8(y_tmp+g_tmp)) << 3) & 0x07E0) | \
+		(((Uint16)clampU8(y_tmp+r_tmp)) >> 3); \
+	rgb_ptr += 2; \
+
+#elif RGB_FORMAT == RGB_FORMAT_BGR24
+
+#define PACK_PIXEL(rgb_ptr) \
+	rgb_ptr[0] = clampU8(y_tmp+b_tmp); \
+	rgb_ptr[1] = clampU8(y_tmp+g_tmp); \
+	rgb_ptr[2] = clampU8(y_tmp+r_tmp); \
+	rgb_ptr += 3; \
+
 #else
 #error PACK_PIXEL unimplemented
 #endif
@@ -10,14 +10,35 @@ best with 32-bit screen mode.
 Some blend modes may not be supported for all renderers. These tests
 will give failure.
 
-TODO:
-- command line arguments for things like window size, iterations...
+Besides the renderer tests, a few software surface operations and
+SDL_MixAudioFormat() are timed once, without a renderer.
+
+Every test is run for a few warmup iterations, then for the given number of
+repetitions. The time of each iteration is recorded, and the median and 95th
+percentile are reported, so results can be compared between runs. With
+--format csv or json, one record per test and blend mode is written to
+standard output (or --output), and the log goes to standard error.
+
+Every record has the category of its test, render, surface or audio, and
+only the columns that apply to it are filled in: the renderer and blend
+mode for render tests, the width and height for render and surface tests,
+and the sample format, channels and samples (per channel, per iteration)
+for audio tests.
+
+It runs headless with SDL_VIDEODRIVER=dummy or offscreen, for example:
+
+    SDL_VIDEODRIVER=dummy ./sdl2benchmark --renderer software --format csv
+
+Run with --help for the options.
 
 */
 
-#include "SDL2/SDL.h"
+#include <stdio.h>
+#include <stdlib.h>
 
-#define BENCHMARK_VERSION "0.6"
+#include "SDL.h"
+
+#define BENCHMARK_VERSION "0.8"
 
 #define WIDTH 800
 #define HEIGHT 600
@@ -25,20 +46,42 @@ TODO:
 #define RECTSIZE 100
 
 #define DURATION 1.0
+#define ITERATIONS 0
+#define WARMUP 10
+#define REPEAT 3
 #define OBJECTS 100
 
 #define SLEEP 0
 
+/* Sample frames and channels mixed by each iteration of the MixAudio tests */
+#define MIXSAMPLES 8192
+#define MIXCHANNELS 2
+
 #ifdef __amigaos4__
 static const char stackCookie[] __attribute__((used)) = "$STACK:60000";
 #endif
 
+typedef enum {
+    FORMAT_TEXT,
+    FORMAT_CSV,
+    FORMAT_JSON
+} OutputFormat;
+
+typedef enum {
+    CATEGORY_RENDER,
+    CATEGORY_SURFACE,
+    CATEGORY_AUDIO
+} Category;
+
 typedef struct {
     SDL_Renderer *renderer;
     SDL_Window *window;
     SDL_Texture *texture;
     SDL_Surface *surface;
+    SDL_Surface *source;
+    SDL_Surface *target;
     SDL_BlendMode mode;
+    SDL_AudioFormat audioformat;
     Uint32 width;
     Uint32 height;
     Uint32 rectsize;
@@ -46,19 +89,38 @@ typedef struct {
     Uint32 textureheight;
     Uint64 frequency;
     double duration;
+    Uint32 iterations;
+    Uint32 warmup;
+    Uint32 repeat;
     Uint32 objects;
     Uint32 sleep;
     Uint32 frames;
     Uint32 operations;
     Uint32 *buffer;
+    Uint8 *mixbuffer;
+    SDL_Point *points;
+    SDL_Rect *rects;
+    Uint64 *samples;
+    Uint32 numsamples;
+    Uint32 maxsamples;
     SDL_bool running;
-    const char* rendname;
+    SDL_bool fullscreen;
+    const char *rendname;
+    const char *testnames;
+    const char *modenames;
+    const char *imagefile;
+    const char *outputfile;
+    OutputFormat format;
+    FILE *output;
+    Uint32 records;
 } Context;
 
 typedef struct {
     const char *name;
     SDL_bool (*testfp)(Context *);
     SDL_bool usetexture;
+    Category category;
+    SDL_AudioFormat audioformat;
 } Test;
 
 typedef struct {
@@ -75,26 +137,48 @@ static SDL_bool testRenderCopyEx(Context *);
 static SDL_bool testColorModulation(Context *);
 static SDL_bool testAlphaModulation(Context *);
 static SDL_bool testUpdateTexture(Context *);
+static SDL_bool testStreamingTexture(Context *);
 static SDL_bool testReadPixels(Context *);
+static SDL_bool testSoftStretch(Context *);
+static SDL_bool testSoftStretchLinear(Context *);
+static SDL_bool testConvertSurface(Context *);
+static SDL_bool testConvertSurfaceRGB565(Context *);
+static SDL_bool testMixAudio(Context *);
 
 /* Insert here new tests */
 static const Test tests[] = {
-    { "Points", testPoints, SDL_FALSE },
-    { "Lines", testLines, SDL_FALSE },
-    { "FillRects", testFillRects, SDL_FALSE },
-    { "RenderCopy", testRenderCopy, SDL_TRUE },
-    { "RenderCopyEx", testRenderCopyEx, SDL_TRUE },
-    { "Color modulation", testColorModulation, SDL_TRUE },
-    { "Alpha modulation", testAlphaModulation, SDL_TRUE },
-    { "UpdateTexture", testUpdateTexture, SDL_TRUE },
-    { "ReadPixels", testReadPixels, SDL_TRUE }
+    { "Points", testPoints, SDL_FALSE, CATEGORY_RENDER, 0 },
+    { "Lines", testLines, SDL_FALSE, CATEGORY_RENDER, 0 },
+    { "FillRects", testFillRects, SDL_FALSE, CATEGORY_RENDER, 0 },
+    { "RenderCopy", testRenderCopy, SDL_TRUE, CATEGORY_RENDER, 0 },
+    { "RenderCopyEx", testRenderCopyEx, SDL_TRUE, CATEGORY_RENDER, 0 },
+    { "ColorModulation", testColorModulation, SDL_TRUE, CATEGORY_RENDER, 0 },
+    { "AlphaModulation", testAlphaModulation, SDL_TRUE, CATEGORY_RENDER, 0 },
+    { "UpdateTexture", testUpdateTexture, SDL_TRUE, CATEGORY_RENDER, 0 },
+    { "StreamingTexture", testStreamingTexture, SDL_TRUE, CATEGORY_RENDER, 0 },
+    { "ReadPixels", testReadPixels, SDL_TRUE, CATEGORY_RENDER, 0 },
+    { "SoftStretch", testSoftStretch, SDL_FALSE, CATEGORY_SURFACE, 0 },
+    { "SoftStretchLinear", testSoftStretchLinear, SDL_FALSE, CATEGORY_SURFACE, 0 },
+    { "ConvertSurface", testConvertSurface, SDL_FALSE, CATEGORY_SURFACE, 0 },
+    { "ConvertSurfaceRGB565", testConvertSurfaceRGB565, SDL_FALSE, CATEGORY_SURFACE, 0 },
+    { "MixAudioU8", testMixAudio, SDL_FALSE, CATEGORY_AUDIO, AUDIO_U8 },
+    { "MixAudioS8", testMixAudio, SDL_FALSE, CATEGORY_AUDIO, AUDIO_S8 },
+    { "MixAudioS16LSB", testMixAudio, SDL_FALSE, CATEGORY_AUDIO, AUDIO_S16LSB },
+    { "MixAudioS16MSB", testMixAudio, SDL_FALSE, CATEGORY_AUDIO, AUDIO_S16MSB },
+    { "MixAudioU16LSB", testMixAudio, SDL_FALSE, CATEGORY_AUDIO, AUDIO_U16LSB },
+    { "MixAudioU16MSB", testMixAudio, SDL_FALSE, CATEGORY_AUDIO, AUDIO_U16MSB },
+    { "MixAudioS32LSB", testMixAudio, SDL_FALSE, CATEGORY_AUDIO, AUDIO_S32LSB },
+    { "MixAudioS32MSB", testMixAudio, SDL_FALSE, CATEGORY_AUDIO, AUDIO_S32MSB },
+    { "MixAudioF32LSB", testMixAudio, SDL_FALSE, CATEGORY_AUDIO, AUDIO_F32LSB },
+    { "MixAudioF32MSB", testMixAudio, SDL_FALSE, CATEGORY_AUDIO, AUDIO_F32MSB }
 };
 
 static const BlendMode modes[] = {
     { "None", SDL_BLENDMODE_NONE },
     { "Blend", SDL_BLENDMODE_BLEND },
     { "Add", SDL_BLENDMODE_ADD },
-    { "Mod", SDL_BLENDMODE_MOD }
+    { "Mod", SDL_BLENDMODE_MOD },
+    { "Mul", SDL_BLENDMODE_MUL }
 };
 
 static const char *getModeName(SDL_BlendMode mode)
@@ -103,7 +187,7 @@ static const char *getModeName(SDL_BlendMode mode)
 
     static const char *unknown = "Unknown";
 
-    for (i = 0; i < sizeof(modes) / sizeof(modes[0]); i++)
+    for (i = 0; i < SDL_arraysize(modes); i++)
     {
         if (modes[i].mode == mode) {
             return modes[i].name;
@@ -113,6 +197,72 @@ static const char *getModeName(SDL_BlendMode mode)
     return unknown;
 }
 
+static const char *getCategoryName(Category category)
+{
+    switch (category) {
+    case CATEGORY_RENDER:
+        return "render";
+    case CATEGORY_SURFACE:
+        return "surface";
+    default:
+        return "audio";
+    }
+}
+
+static const char *getAudioFormatName(SDL_AudioFormat format)
+{
+    switch (format) {
+    case AUDIO_U8:
+        return "U8";
+    case AUDIO_S8:
+        return "S8";
+    case AUDIO_S16LSB:
+        return "S16LSB";
+    case AUDIO_S16MSB:
+        return "S16MSB";
+    case AUDIO_U16LSB:
+        return "U16LSB";
+    case AUDIO_U16MSB:
+        return "U16MSB";
+    case AUDIO_S32LSB:
+        return "S32LSB";
+    case AUDIO_S32MSB:
+        return "S32MSB";
+    case AUDIO_F32LSB:
+        return "F32LSB";
+    case AUDIO_F32MSB:
+        return "F32MSB";
+    default:
+        return "Unknown";
+    }
+}
+
+/* Returns whether name is in a comma separated list, an empty list has everything */
+static SDL_bool isSelected(const char *list, const char *name)
+{
+    const size_t len = SDL_strlen(name);
+
+    if (!list || !*list) {
+        return SDL_TRUE;
+    }
+
+    while (*list) {
+        const char *end = SDL_strchr(list, ',');
+        const size_t itemlen = end ? (size_t)(end - list) : SDL_strlen(list);
+
+        if (itemlen == len && SDL_strncasecmp(list, name, len) == 0) {
+            return SDL_TRUE;
+        }
+
+        if (!end) {
+            break;
+        }
+        list = end + 1;
+    }
+
+    return SDL_FALSE;
+}
+
 static void printInfo(Context *ctx)
 {
     SDL_RendererInfo ri;
@@ -128,6 +278,21 @@ static void printInfo(Context *ctx)
     }
 }
 
+static const char *getRendererName(Context *ctx)
+{
+    SDL_RendererInfo ri;
+
+    if (!ctx->renderer) {
+        return "surface";
+    }
+
+    if (SDL_GetRendererInfo(ctx->renderer, &ri)) {
+        return "unknown";
+    }
+
+    return ri.name;
+}
+
 static void render(Context *ctx)
 {
     SDL_RenderPresent(ctx->renderer);
@@ -170,9 +335,19 @@ static float interpolate(float min, float max, float percentage)
 
 static Uint32 getRand(Uint32 max)
 {
+    if (max == 0) {
+        return 0;
+    }
+
     return rand() % max;
 }
 
+/* Random position of something of the given size, 0 if it doesn't fit */
+static Uint32 getRandPosition(Uint32 space, Uint32 size)
+{
+    return size < space ? getRand(space - size) : 0;
+}
+
 static void makeRandomTexture(Context *ctx)
 {
     int i;
@@ -186,7 +361,7 @@ static void makeRandomTexture(Context *ctx)
     }
 }
 
-static SDL_bool prepareTexture(Context *ctx)
+static SDL_bool prepareTexture(Context *ctx, const Test *test)
 {
     int result;
 
@@ -201,7 +376,12 @@ static SDL_bool prepareTexture(Context *ctx)
         SDL_Log("Old texture!\n");
     }
 
-    ctx->texture = SDL_CreateTextureFromSurface(ctx->renderer, ctx->surface);
+    if (test->testfp == testStreamingTexture) {
+        ctx->texture = SDL_CreateTexture(ctx->renderer, SDL_PIXELFORMAT_ARGB8888,
+            SDL_TEXTUREACCESS_STREAMING, ctx->surface->w, ctx->surface->h);
+    } else {
+        ctx->texture = SDL_CreateTextureFromSurface(ctx->renderer, ctx->surface);
+    }
 
     if (!ctx->texture) {
         SDL_Log("[%s]Failed to create texture: %s\n", __FUNCTION__, SDL_GetError());
@@ -236,20 +416,46 @@ static SDL_bool prepareTexture(Context *ctx)
     return SDL_TRUE;
 }
 
-static SDL_bool prepareTest(Context *ctx, const Test *test)
+static SDL_bool prepareSurfaces(Context *ctx)
 {
-    if (!clearDisplay(ctx)) {
+    ctx->source = SDL_ConvertSurfaceFormat(ctx->surface, SDL_PIXELFORMAT_ARGB8888, 0);
+    ctx->target = SDL_CreateRGBSurfaceWithFormat(0, ctx->width, ctx->height, 32, SDL_PIXELFORMAT_ARGB8888);
+
+    if (!ctx->source || !ctx->target) {
+        SDL_Log("[%s]Failed to create surfaces: %s\n", __FUNCTION__, SDL_GetError());
         return SDL_FALSE;
     }
 
-    if (test->usetexture) {
-        if (!prepareTexture(ctx)) {
+    return SDL_TRUE;
+}
+
+static SDL_bool prepareTest(Context *ctx, const Test *test)
+{
+    switch (test->category) {
+    case CATEGORY_RENDER:
+        if (!clearDisplay(ctx)) {
+            return SDL_FALSE;
+        }
+
+        if (test->usetexture) {
+            if (!prepareTexture(ctx, test)) {
+                return SDL_FALSE;
+            }
+        }
+        break;
+    case CATEGORY_SURFACE:
+        if (!prepareSurfaces(ctx)) {
             return SDL_FALSE;
         }
+        break;
+    default:
+        ctx->audioformat = test->audioformat;
+        break;
     }
 
     ctx->frames = 0;
     ctx->operations = 0;
+    ctx->numsamples = 0;
 
     return SDL_TRUE;
 }
@@ -266,50 +472,236 @@ static void afterTest(Context *ctx)
         ctx->buffer = NULL;
     }
 
+    if (ctx->mixbuffer) {
+        SDL_free(ctx->mixbuffer);
+        ctx->mixbuffer = NULL;
+    }
+
+    SDL_FreeSurface(ctx->source);
+    ctx->source = NULL;
+
+    SDL_FreeSurface(ctx->target);
+    ctx->target = NULL;
+
     if (ctx->sleep) {
         SDL_Delay(ctx->sleep);
     }
 }
 
+static SDL_bool addSample(Context *ctx, Uint64 ticks)
+{
+    if (ctx->numsamples == ctx->maxsamples) {
+        const Uint32 maxsamples = ctx->maxsamples ? ctx->maxsamples * 2 : 1024;
+        Uint64 *samples = (Uint64 *)SDL_realloc(ctx->samples, maxsamples * sizeof(Uint64));
+
+        if (!samples) {
+            SDL_Log("[%s]Out of memory\n", __FUNCTION__);
+            return SDL_FALSE;
+        }
+
+        ctx->samples = samples;
+        ctx->maxsamples = maxsamples;
+    }
+
+    ctx->samples[ctx->numsamples++] = ticks;
+
+    return SDL_TRUE;
+}
+
+static int SDLCALL compareSamples(const void *a, const void *b)
+{
+    const Uint64 sa = *(const Uint64 *)a;
+    const Uint64 sb = *(const Uint64 *)b;
+
+    return (sa > sb) - (sa < sb);
+}
+
+/* Sample at the given percentile, in microseconds. The samples must be sorted */
+static double getPercentile(Context *ctx, double percentile)
+{
+    Uint32 index = (Uint32)(percentile / 100.0 * ctx->numsamples);
+
+    if (index >= ctx->numsamples) {
+        index = ctx->numsamples - 1;
+    }
+
+    return ctx->samples[index] * 1000000.0 / ctx->frequency;
+}
+
+static void writeHeader(Context *ctx)
+{
+    switch (ctx->format) {
+    case FORMAT_CSV:
+        fprintf(ctx->output, "category,renderer,test,mode,width,height,audio_format,channels,audio_samples,"
+            "result,samples,median_us,p95_us,mean_us,fps,ops\n");
+        break;
+    case FORMAT_JSON:
+        fprintf(ctx->output, "[\n");
+        break;
+    default:
+        break;
+    }
+}
+
+static void writeFooter(Context *ctx)
+{
+    switch (ctx->format) {
+    case FORMAT_JSON:
+        fprintf(ctx->output, "%s]\n", ctx->records ? "\n" : "");
+        break;
+    default:
+        break;
+    }
+    fflush(ctx->output);
+}
+
+static void writeRecord(Context *ctx, const Test *test, SDL_bool ok,
+                        double median, double p95, double mean, double fps, double ops)
+{
+    const char *category = getCategoryName(test->category);
+    const char *modename = getModeName(ctx->mode);
+    const char *audioname = getAudioFormatName(test->audioformat);
+    const char *result = ok ? "ok" : "failed";
+    char params[64];
+
+    switch (ctx->format) {
+    case FORMAT_CSV:
+        switch (test->category) {
+        case CATEGORY_RENDER:
+            fprintf(ctx->output, "%s,%s,%s,%s,%u,%u,,,,", category, getRendererName(ctx), test->name,
+                modename, ctx->width, ctx->height);
+            break;
+        case CATEGORY_SURFACE:
+            fprintf(ctx->output, "%s,,%s,,%u,%u,,,,", category, test->name, ctx->width, ctx->height);
+            break;
+        default:
+            fprintf(ctx->output, "%s,,%s,,,,%s,%d,%d,", category, test->name, audioname, MIXCHANNELS, MIXSAMPLES);
+            break;
+        }
+        fprintf(ctx->output, "%s,%u,%.3f,%.3f,%.3f,%.1f,%.1f\n",
+            result, ctx->numsamples, median, p95, mean, fps, ops);
+        break;
+    case FORMAT_JSON:
+        fprintf(ctx->output, "%s  { \"category\": \"%s\", \"test\": \"%s\", ",
+            ctx->records ? ",\n" : "", category, test->name);
+        switch (test->category) {
+        case CATEGORY_RENDER:
+            fprintf(ctx->output, "\"renderer\": \"%s\", \"mode\": \"%s\", \"width\": %u, \"height\": %u, ",
+                getRendererName(ctx), modename, ctx->width, ctx->height);
+            break;
+        case CATEGORY_SURFACE:
+            fprintf(ctx->output, "\"width\": %u, \"height\": %u, ", ctx->width, ctx->height);
+            break;
+        default:
+            fprintf(ctx->output, "\"audio_format\": \"%s\", \"channels\": %d, \"audio_samples\": %d, ",
+                audioname, MIXCHANNELS, MIXSAMPLES);
+            break;
+        }
+        fprintf(ctx->output, "\"result\": \"%s\", \"samples\": %u, "
+            "\"median_us\": %.3f, \"p95_us\": %.3f, \"mean_us\": %.3f, \"fps\": %.1f, \"ops\": %.1f }",
+            result, ctx->numsamples, median, p95, mean, fps, ops);
+        break;
+    default:
+        switch (test->category) {
+        case CATEGORY_RENDER:
+            SDL_snprintf(params, sizeof(params), "mode: %s", modename);
+            break;
+        case CATEGORY_SURFACE:
+            SDL_snprintf(params, sizeof(params), "%ux%u", ctx->width, ctx->height);
+            break;
+        default:
+            SDL_snprintf(params, sizeof(params), "%s, %d channels, %d samples", audioname, MIXCHANNELS, MIXSAMPLES);
+            break;
+        }
+        if (!ok) {
+            SDL_Log("%s [%s]...failed\n", test->name, params);
+        } else if (fps == ops || test->category != CATEGORY_RENDER) {
+            SDL_Log("%s [%s]...%u iterations, median %.1f us, p95 %.1f us => %.1f operations per second\n",
+                test->name, params, ctx->numsamples, median, p95, ops);
+        } else {
+            SDL_Log("%s [%s]...%u iterations, median %.1f us, p95 %.1f us => %.1f frames per second, %.1f operations per second\n",
+                test->name, params, ctx->numsamples, median, p95, fps, ops);
+        }
+        break;
+    }
+    ctx->records++;
+}
+
+static SDL_bool runIterations(Context *ctx, const Test *test, Uint32 iterations, double seconds, SDL_bool measure)
+{
+    const Uint64 start = SDL_GetPerformanceCounter();
+    Uint32 i;
+
+    for (i = 0; iterations ? i < iterations : SDL_TRUE; i++) {
+        const Uint64 before = SDL_GetPerformanceCounter();
+        Uint64 after;
+
+        if (!test->testfp(ctx)) {
+            return SDL_FALSE;
+        }
+
+        after = SDL_GetPerformanceCounter();
+
+        if (measure && !addSample(ctx, after - before)) {
+            return SDL_FALSE;
+        }
+
+        if (!iterations && (after - start) / (double)ctx->frequency >= seconds) {
+            break;
+        }
+    }
+
+    return SDL_TRUE;
+}
+
 static SDL_bool runTest(Context *ctx, const Test *test)
 {
-    Uint64 start, finish;
-    double duration;
-    float fps, ops;
+    Uint64 total = 0;
+    Uint32 frames, operations, r;
+    double duration, mean;
 
     if (!prepareTest(ctx, test)) {
+        writeRecord(ctx, test, SDL_FALSE, 0.0, 0.0, 0.0, 0.0, 0.0);
         return SDL_FALSE;
     }
 
-    start = SDL_GetPerformanceCounter();
+    if (!runIterations(ctx, test, ctx->warmup, 0.0, SDL_FALSE)) {
+        afterTest(ctx);
+        writeRecord(ctx, test, SDL_FALSE, 0.0, 0.0, 0.0, 0.0, 0.0);
+        return SDL_FALSE;
+    }
 
-    do {
-        if (!test->testfp(ctx)) {
+    frames = ctx->frames;
+    operations = ctx->operations;
+
+    for (r = 0; r < ctx->repeat; r++) {
+        if (!runIterations(ctx, test, ctx->iterations, ctx->duration, SDL_TRUE)) {
             afterTest(ctx);
+            writeRecord(ctx, test, SDL_FALSE, 0.0, 0.0, 0.0, 0.0, 0.0);
             return SDL_FALSE;
         }
+    }
 
-        finish = SDL_GetPerformanceCounter();
+    for (r = 0; r < ctx->numsamples; r++) {
+        total += ctx->samples[r];
+    }
 
-        duration = (finish - start) / (double)ctx->frequency;
-    } while (duration < ctx->duration);
+    duration = total / (double)ctx->frequency;
 
-    if (duration == 0.0) {
+    if (ctx->numsamples == 0 || duration == 0.0) {
         SDL_Log("Division by zero!\n");
         afterTest(ctx);
+        writeRecord(ctx, test, SDL_FALSE, 0.0, 0.0, 0.0, 0.0, 0.0);
         return SDL_FALSE;
     }
 
-    fps = ctx->frames / duration;
-    ops = ctx->operations / duration;
+    mean = duration * 1000000.0 / ctx->numsamples;
 
-    if (fps == ops) {
-        SDL_Log("%s [mode: %s]...%d frames drawn in %.3f seconds => %.1f frames per second\n",
-            test->name, getModeName(ctx->mode), ctx->frames, duration, fps);
-    } else {
-        SDL_Log("%s [mode: %s]...%d frames drawn in %.3f seconds => %.1f frames per second, %.1f operations per second\n",
-            test->name, getModeName(ctx->mode), ctx->frames, duration, fps, ops);
-    }
+    SDL_qsort(ctx->samples, ctx->numsamples, sizeof(Uint64), compareSamples);
+
+    writeRecord(ctx, test, SDL_TRUE,
+        getPercentile(ctx, 50.0), getPercentile(ctx, 95.0), mean,
+        (ctx->frames - frames) / duration, (ctx->operations - operations) / duration);
 
     afterTest(ctx);
 
@@ -333,6 +725,8 @@ static SDL_bool setRandomColor(Context *ctx)
 
 static SDL_bool testPointsInner(Context *ctx, SDL_bool linemode)
 {
+    SDL_Point *points = ctx->points;
+    int object;
     int result = SDL_SetRenderDrawBlendMode(ctx->renderer, ctx->mode);
 
     if (result) {
@@ -340,9 +734,6 @@ static SDL_bool testPointsInner(Context *ctx, SDL_bool linemode)
         return SDL_FALSE;
     }
 
-    SDL_Point points[ctx->objects];
-    int object;
-
     if (!setRandomColor(ctx)) {
         return SDL_FALSE;
     }
@@ -380,6 +771,9 @@ static SDL_bool testLines(Context *ctx)
 
 static SDL_bool testFillRects(Context *ctx)
 {
+    SDL_Rect *rects = ctx->rects;
+    int object;
+    int rectsize;
     int result = SDL_SetRenderDrawBlendMode(ctx->renderer, ctx->mode);
 
     if (result) {
@@ -387,18 +781,15 @@ static SDL_bool testFillRects(Context *ctx)
         return SDL_FALSE;
     }
 
-    SDL_Rect rects[ctx->objects];
-    int object;
-
     if (!setRandomColor(ctx)) {
         return SDL_FALSE;
     }
 
-    const int rectsize = ctx->rectsize + getRand(100); // + iteration
+    rectsize = ctx->rectsize + getRand(100); /* + iteration */
 
     for (object = 0; object < ctx->objects; object++) {
-        rects[object].x = getRand(ctx->width - rectsize);
-        rects[object].y = getRand(ctx->height - rectsize);
+        rects[object].x = getRandPosition(ctx->width, rectsize);
+        rects[object].y = getRandPosition(ctx->height, rectsize);
         rects[object].w = rectsize;
         rects[object].h = rectsize;
     }
@@ -421,41 +812,38 @@ static SDL_bool testRenderCopyInner(Context *ctx, SDL_bool ex)
 {
     int result;
 
-    //int object;
-    //const float scale = interpolate(0.5f, 2.0f, (float)ctx->iteration / ctx->iterations);
+    /*const float scale = interpolate(0.5f, 2.0f, (float)ctx->iteration / ctx->iterations);*/
     const float scale = (getRand(4) + 1) / 2.0f;
 
     int w = ctx->texturewidth * scale;
     int h = ctx->textureheight * scale;
 
-    //for (object = 0; object < ctx->objects; object++) {
-        SDL_Rect rect;
+    SDL_Rect rect;
 
-        rect.x = getRand(ctx->width - w);
-        rect.y = getRand(ctx->height - h);
-        rect.w = w;
-        rect.h = h;
+    rect.x = getRandPosition(ctx->width, w);
+    rect.y = getRandPosition(ctx->height, h);
+    rect.w = w;
+    rect.h = h;
 
-        if (!ex) {
-            result = SDL_RenderCopy(ctx->renderer, ctx->texture, NULL, &rect);
-        } else {
-            result = SDL_RenderCopyEx(
-                ctx->renderer,
-                ctx->texture,
-                NULL,
-                &rect,
-                getRand(360),
-                NULL,
-                SDL_FLIP_NONE);
-        }
+    if (!ex) {
+        result = SDL_RenderCopy(ctx->renderer, ctx->texture, NULL, &rect);
+    } else {
+        result = SDL_RenderCopyEx(
+            ctx->renderer,
+            ctx->texture,
+            NULL,
+            &rect,
+            getRand(360),
+            NULL,
+            SDL_FLIP_NONE);
+    }
 
-        if (result) {
-            SDL_Log("[%s]Failed to draw texture: %s\n", __FUNCTION__, SDL_GetError());
-            return SDL_FALSE;
-        }
+    if (result) {
+        SDL_Log("[%s]Failed to draw texture: %s\n", __FUNCTION__, SDL_GetError());
+        return SDL_FALSE;
+    }
 
-        ctx->operations++;
-    //}
+    ctx->operations++;
 
     render(ctx);
 
@@ -526,15 +914,37 @@ static SDL_bool testUpdateTexture(Context *ctx)
     return testRenderCopyInner(ctx, SDL_FALSE);
 }
 
+/* Like a video player: a new frame is written to a streaming texture, then drawn */
+static SDL_bool testStreamingTexture(Context *ctx)
+{
+    void *pixels;
+    int pitch, y;
+
+    if (SDL_LockTexture(ctx->texture, NULL, &pixels, &pitch)) {
+        SDL_Log("[%s]Failed to lock texture: %s\n", __FUNCTION__, SDL_GetError());
+        return SDL_FALSE;
+    }
+
+    for (y = 0; y < ctx->textureheight; y++) {
+        SDL_memcpy((Uint8 *)pixels + y * pitch, ctx->buffer + y * ctx->texturewidth, ctx->texturewidth * sizeof(Uint32));
+    }
+
+    SDL_UnlockTexture(ctx->texture);
+
+    ctx->operations++;
+
+    return testRenderCopyInner(ctx, SDL_FALSE);
+}
+
 static SDL_bool testReadPixels(Context *ctx)
 {
     SDL_bool result = SDL_TRUE;
 
     SDL_Rect rect;
-    rect.x = getRand(ctx->width - ctx->texturewidth);
-    rect.y = getRand(ctx->height - ctx->textureheight);
-    rect.w = ctx->texturewidth;
-    rect.h = ctx->textureheight;
+    rect.x = getRandPosition(ctx->width, ctx->texturewidth);
+    rect.y = getRandPosition(ctx->height, ctx->textureheight);
+    rect.w = SDL_min(ctx->texturewidth, ctx->width);
+    rect.h = SDL_min(ctx->textureheight, ctx->height);
 
     if (SDL_RenderReadPixels(
         ctx->renderer,
@@ -553,6 +963,102 @@ static SDL_bool testReadPixels(Context *ctx)
     return result;
 }
 
+/* The image is stretched to the window size */
+static SDL_bool testSoftStretchInner(Context *ctx, SDL_bool linear)
+{
+    int result;
+
+    if (linear) {
+        result = SDL_SoftStretchLinear(ctx->source, NULL, ctx->target, NULL);
+    } else {
+        result = SDL_SoftStretch(ctx->source, NULL, ctx->target, NULL);
+    }
+
+    if (result) {
+        SDL_Log("[%s]Failed to stretch surface: %s\n", __FUNCTION__, SDL_GetError());
+        return SDL_FALSE;
+    }
+
+    ctx->operations++;
+
+    return SDL_TRUE;
+}
+
+static SDL_bool testSoftStretch(Context *ctx)
+{
+    return testSoftStretchInner(ctx, SDL_FALSE);
+}
+
+static SDL_bool testSoftStretchLinear(Context *ctx)
+{
+    return testSoftStretchInner(ctx, SDL_TRUE);
+}
+
+/* A window sized ARGB8888 surface is converted to another format */
+static SDL_bool testConvertSurfaceInner(Context *ctx, Uint32 format)
+{
+    SDL_Surface *converted = SDL_ConvertSurfaceFormat(ctx->target, format, 0);
+
+    if (!converted) {
+        SDL_Log("[%s]Failed to convert surface: %s\n", __FUNCTION__, SDL_GetError());
+        return SDL_FALSE;
+    }
+
+    SDL_FreeSurface(converted);
+
+    ctx->operations++;
+
+    return SDL_TRUE;
+}
+
+static SDL_bool testConvertSurface(Context *ctx)
+{
+    return testConvertSurfaceInner(ctx, SDL_PIXELFORMAT_ABGR8888);
+}
+
+static SDL_bool testConvertSurfaceRGB565(Context *ctx)
+{
+    return testConvertSurfaceInner(ctx, SDL_PIXELFORMAT_RGB565);
+}
+
+/* Random audio is mixed at half volume into a fresh copy of other random audio */
+static SDL_bool testMixAudio(Context *ctx)
+{
+    const SDL_AudioFormat format = ctx->audioformat;
+    const Uint32 len = MIXSAMPLES * MIXCHANNELS * (SDL_AUDIO_BITSIZE(format) / 8);
+
+    if (!ctx->mixbuffer) {
+        Uint32 i;
+
+        ctx->mixbuffer = (Uint8 *)SDL_malloc(len * 3);
+
+        if (!ctx->mixbuffer) {
+            SDL_Log("[%s]Failed to allocate audio buffers\n", __FUNCTION__);
+            return SDL_FALSE;
+        }
+
+        if (SDL_AUDIO_ISFLOAT(format)) {
+            float *samples = (float *)ctx->mixbuffer;
+
+            for (i = 0; i < MIXSAMPLES * MIXCHANNELS * 2; i++) {
+                const float sample = (getRand(2001) / 1000.0f) - 1.0f;
+                samples[i] = SDL_AUDIO_ISBIGENDIAN(format) ? SDL_SwapFloatBE(sample) : SDL_SwapFloatLE(sample);
+            }
+        } else {
+            for (i = 0; i < len * 2; i++) {
+                ctx->mixbuffer[i] = (Uint8)getRand(256);
+            }
+        }
+    }
+
+    SDL_memcpy(ctx->mixbuffer + len * 2, ctx->mixbuffer + len, len);
+    SDL_MixAudioFormat(ctx->mixbuffer + len * 2, ctx->mixbuffer, format, len, SDL_MIX_MAXVOLUME / 2);
+
+    ctx->operations++;
+
+    return SDL_TRUE;
+}
+
 static void checkEvents(Context *ctx)
 {
     SDL_Event e;
@@ -565,6 +1071,8 @@ static void checkEvents(Context *ctx)
                 SDL_Log("Quitting...\n");
                 ctx->running = SDL_FALSE;
             }
+        } else if (e.type == SDL_QUIT) {
+            ctx->running = SDL_FALSE;
         }
     }
 }
@@ -573,8 +1081,16 @@ static void runTestSuite(Context *ctx)
 {
     int m, t;
 
-    for (t = 0; t < sizeof(tests) / sizeof(tests[0]); t++) {
-        for (m = 0; m < sizeof(modes) / sizeof(modes[0]); m++) {
+    for (t = 0; t < SDL_arraysize(tests); t++) {
+        if (tests[t].category != CATEGORY_RENDER || !isSelected(ctx->testnames, tests[t].name)) {
+            continue;
+        }
+
+        for (m = 0; m < SDL_arraysize(modes); m++) {
+            if (!isSelected(ctx->modenames, modes[m].name)) {
+                continue;
+            }
+
             ctx->mode = modes[m].mode;
 
             runTest(ctx, &tests[t]);
@@ -588,24 +1104,166 @@ static void runTestSuite(Context *ctx)
     }
 }
 
-/* TODO: need proper handling */
-static void checkParameters(Context *ctx, int argc, char **argv)
+/* The surface and audio mixing tests don't depend on the renderer or the blend mode */
+static void runSurfaceTests(Context *ctx)
 {
-    if (argc > 3) {
-        ctx->sleep = atoi(argv[3]);
+    SDL_bool first = SDL_TRUE;
+    int t;
+
+    ctx->mode = SDL_BLENDMODE_NONE;
+
+    for (t = 0; t < SDL_arraysize(tests); t++) {
+        if (tests[t].category == CATEGORY_RENDER || !isSelected(ctx->testnames, tests[t].name)) {
+            continue;
+        }
+
+        if (first) {
+            SDL_Log("Starting the software tests\n");
+            first = SDL_FALSE;
+        }
+
+        runTest(ctx, &tests[t]);
+
+        checkEvents(ctx);
+
+        if (!ctx->running) {
+            return;
+        }
+    }
+}
+
+static void printUsage(const char *argv0)
+{
+    SDL_Log("Usage: %s [options]\n", argv0);
+    SDL_Log("  --renderer NAME      test only this renderer (default: all of them)\n");
+    SDL_Log("  --tests A,B,...      run only these tests (default: all of them)\n");
+    SDL_Log("  --modes A,B,...      use only these blend modes (default: all of them)\n");
+    SDL_Log("  --width N            window and stretch target width (default: %d)\n", WIDTH);
+    SDL_Log("  --height N           window and stretch target height (default: %d)\n", HEIGHT);
+    SDL_Log("  --objects N          points, lines or rectangles per frame (default: %d)\n", OBJECTS);
+    SDL_Log("  --rectsize N         minimum rectangle size (default: %d)\n", RECTSIZE);
+    SDL_Log("  --iterations N       iterations per repetition, 0 to use --duration (default: %d)\n", ITERATIONS);
+    SDL_Log("  --duration SECONDS   duration of a repetition without --iterations (default: %.1f)\n", DURATION);
+    SDL_Log("  --warmup N           iterations before measuring (default: %d)\n", WARMUP);
+    SDL_Log("  --repeat N           repetitions of each test (default: %d)\n", REPEAT);
+    SDL_Log("  --sleep MS           pause between tests (default: %d)\n", SLEEP);
+    SDL_Log("  --image FILE         image to draw (default: sample.bmp, or a generated one)\n");
+    SDL_Log("  --format FORMAT      text, csv or json (default: text)\n");
+    SDL_Log("  --output FILE        where to write csv or json (default: standard output)\n");
+    SDL_Log("  --windowed           use a window instead of fullscreen\n");
+    SDL_Log("  --seed N             seed of the random positions and colors\n");
+    SDL_Log("  --list               list the tests, blend modes and renderers\n");
+}
+
+static void printList(void)
+{
+    SDL_RendererInfo ri;
+    int i;
+
+    SDL_Log("Tests:\n");
+    for (i = 0; i < SDL_arraysize(tests); i++) {
+        SDL_Log("  %s (%s)\n", tests[i].name, getCategoryName(tests[i].category));
     }
 
-    if (argc > 2) {
-        ctx->duration = atof(argv[2]);
+    SDL_Log("Blend modes:\n");
+    for (i = 0; i < SDL_arraysize(modes); i++) {
+        SDL_Log("  %s\n", modes[i].name);
     }
 
-    if (argc > 1) {
-        ctx->rendname = argv[1];
+    SDL_Log("Renderers:\n");
+    for (i = 0; i < SDL_GetNumRenderDrivers(); i++) {
+        if (SDL_GetRenderDriverInfo(i, &ri) == 0) {
+            SDL_Log("  %s\n", ri.name);
+        }
     }
 }
 
-static void initContext(Context *ctx, int argc, char **argv)
+/* Returns 1 if the arguments were parsed, 0 to quit with success, -1 on error */
+static int checkParameters(Context *ctx, int argc, char **argv)
 {
+    int i;
+
+    for (i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        const char *value = (i + 1 < argc) ? argv[i + 1] : NULL;
+        int consumed = 1;
+
+        if (SDL_strcmp(arg, "--help") == 0 || SDL_strcmp(arg, "-h") == 0) {
+            printUsage(argv[0]);
+            return 0;
+        } else if (SDL_strcmp(arg, "--list") == 0) {
+            printList();
+            return 0;
+        } else if (SDL_strcmp(arg, "--windowed") == 0) {
+            ctx->fullscreen = SDL_FALSE;
+            consumed = 0;
+        } else if (!value) {
+            SDL_Log("Missing value or unknown option: %s\n", arg);
+            printUsage(argv[0]);
+            return -1;
+        } else if (SDL_strcmp(arg, "--renderer") == 0) {
+            ctx->rendname = value;
+        } else if (SDL_strcmp(arg, "--tests") == 0) {
+            ctx->testnames = value;
+        } else if (SDL_strcmp(arg, "--modes") == 0) {
+            ctx->modenames = value;
+        } else if (SDL_strcmp(arg, "--width") == 0) {
+            ctx->width = SDL_atoi(value);
+        } else if (SDL_strcmp(arg, "--height") == 0) {
+            ctx->height = SDL_atoi(value);
+        } else if (SDL_strcmp(arg, "--objects") == 0) {
+            ctx->objects = SDL_atoi(value);
+        } else if (SDL_strcmp(arg, "--rectsize") == 0) {
+            ctx->rectsize = SDL_atoi(value);
+        } else if (SDL_strcmp(arg, "--iterations") == 0) {
+            ctx->iterations = SDL_atoi(value);
+        } else if (SDL_strcmp(arg, "--duration") == 0) {
+            ctx->duration = SDL_atof(value);
+        } else if (SDL_strcmp(arg, "--warmup") == 0) {
+            ctx->warmup = SDL_atoi(value);
+        } else if (SDL_strcmp(arg, "--repeat") == 0) {
+            ctx->repeat = SDL_atoi(value);
+        } else if (SDL_strcmp(arg, "--sleep") == 0) {
+            ctx->sleep = SDL_atoi(value);
+        } else if (SDL_strcmp(arg, "--image") == 0) {
+            ctx->imagefile = value;
+        } else if (SDL_strcmp(arg, "--output") == 0) {
+            ctx->outputfile = value;
+        } else if (SDL_strcmp(arg, "--seed") == 0) {
+            srand(SDL_atoi(value));
+        } else if (SDL_strcmp(arg, "--format") == 0) {
+            if (SDL_strcasecmp(value, "text") == 0) {
+                ctx->format = FORMAT_TEXT;
+            } else if (SDL_strcasecmp(value, "csv") == 0) {
+                ctx->format = FORMAT_CSV;
+            } else if (SDL_strcasecmp(value, "json") == 0) {
+                ctx->format = FORMAT_JSON;
+            } else {
+                SDL_Log("Unknown output format: %s\n", value);
+                return -1;
+            }
+        } else {
+            SDL_Log("Unknown option: %s\n", arg);
+            printUsage(argv[0]);
+            return -1;
+        }
+
+        i += consumed;
+    }
+
+    if (ctx->width == 0 || ctx->height == 0 || ctx->objects == 0 || ctx->repeat == 0 ||
+        (ctx->iterations == 0 && ctx->duration <= 0.0)) {
+        SDL_Log("Invalid parameters: sizes, objects, repetitions and iterations or duration must be positive\n");
+        return -1;
+    }
+
+    return 1;
+}
+
+static int initContext(Context *ctx, int argc, char **argv)
+{
+    int result;
+
     SDL_memset(ctx, 0, sizeof(Context));
 
     ctx->frequency = SDL_GetPerformanceFrequency();
@@ -614,14 +1272,82 @@ static void initContext(Context *ctx, int argc, char **argv)
     ctx->height = HEIGHT;
     ctx->rectsize = RECTSIZE;
     ctx->duration = DURATION;
+    ctx->iterations = ITERATIONS;
+    ctx->warmup = WARMUP;
+    ctx->repeat = REPEAT;
     ctx->objects = OBJECTS;
     ctx->sleep = SLEEP;
     ctx->running = SDL_TRUE;
+    ctx->fullscreen = SDL_TRUE;
+    ctx->imagefile = "sample.bmp";
+    ctx->format = FORMAT_TEXT;
+    ctx->output = stdout;
+
+    result = checkParameters(ctx, argc, argv);
+
+    if (result <= 0) {
+        return result;
+    }
+
+    ctx->points = (SDL_Point *)SDL_malloc(ctx->objects * sizeof(SDL_Point));
+    ctx->rects = (SDL_Rect *)SDL_malloc(ctx->objects * sizeof(SDL_Rect));
+
+    if (!ctx->points || !ctx->rects) {
+        SDL_Log("Failed to allocate %u objects\n", ctx->objects);
+        return -1;
+    }
 
-    checkParameters(ctx, argc, argv);
+    if (ctx->outputfile) {
+        ctx->output = fopen(ctx->outputfile, "w");
 
-    SDL_Log("Parameters: width %d, height %d, renderer name '%s', duration %.3f s, objects %u, sleep %u\n",
-        ctx->width, ctx->height, ctx->rendname, ctx->duration, ctx->objects, ctx->sleep);
+        if (!ctx->output) {
+            SDL_Log("Failed to open %s\n", ctx->outputfile);
+            return -1;
+        }
+    }
+
+    SDL_Log("Parameters: width %d, height %d, renderer name '%s', iterations %u, duration %.3f s, warmup %u, repeat %u, objects %u, sleep %u\n",
+        ctx->width, ctx->height, ctx->rendname ? ctx->rendname : "(all)", ctx->iterations, ctx->duration,
+        ctx->warmup, ctx->repeat, ctx->objects, ctx->sleep);
+
+    return 1;
+}
+
+static void quitContext(Context *ctx)
+{
+    if (ctx->output && ctx->output != stdout) {
+        fclose(ctx->output);
+    }
+
+    SDL_free(ctx->points);
+    SDL_free(ctx->rects);
+    SDL_free(ctx->samples);
+}
+
+/* Used when there is no image to load, so the benchmark doesn't need any file */
+static SDL_Surface *makeImage(void)
+{
+    const int w = 128, h = 128;
+    SDL_Surface *surface = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, SDL_PIXELFORMAT_ARGB8888);
+    int x, y;
+
+    if (!surface) {
+        return NULL;
+    }
+
+    for (y = 0; y < h; y++) {
+        Uint32 *row = (Uint32 *)((Uint8 *)surface->pixels + y * surface->pitch);
+
+        for (x = 0; x < w; x++) {
+            /* Circle on a transparent background, to exercise the blend modes */
+            const int dx = x - w / 2, dy = y - h / 2;
+            const Uint32 alpha = (dx * dx + dy * dy < (w / 2) * (w / 2)) ? 0xFF : 0x00;
+
+            row[x] = (alpha << 24) | ((x * 2) << 16) | ((y * 2) << 8) | ((x + y) & 0xFF);
+        }
+    }
+
+    return surface;
 }
 
 static void checkPixelFormat(Context *ctx)
@@ -645,6 +1371,7 @@ static void testRenderer(Context *ctx)
         runTestSuite(ctx);
 
         SDL_DestroyRenderer(ctx->renderer);
+        ctx->renderer = NULL;
     } else {
         SDL_Log("Failed to create renderer: %s\n", SDL_GetError());
     }
@@ -675,10 +1402,24 @@ static void testAllRenderers(Context *ctx)
     }
 }
 
+static SDL_bool hasRendererTests(Context *ctx)
+{
+    int t;
+
+    for (t = 0; t < SDL_arraysize(tests); t++) {
+        if (tests[t].category == CATEGORY_RENDER && isSelected(ctx->testnames, tests[t].name)) {
+            return SDL_TRUE;
+        }
+    }
+
+    return SDL_FALSE;
+}
+
 int main(int argc, char **argv)
 {
     Context ctx;
     SDL_version linked;
+    int result;
 
     if (SDL_Init(SDL_INIT_VIDEO)) {
         SDL_Log("Init failed: %s\n", SDL_GetError());
@@ -693,45 +1434,66 @@ int main(int argc, char **argv)
     SDL_Log("This tool measures the speed of various 2D drawing features\n");
     SDL_Log("Press ESC key to quit\n");
 
-    initContext(&ctx, argc, argv);
+    result = initContext(&ctx, argc, argv);
+
+    if (result <= 0) {
+        quitContext(&ctx);
+        SDL_Quit();
+        return result < 0 ? 1 : 0;
+    }
 
-    ctx.surface = SDL_LoadBMP("sample.bmp");
+    ctx.surface = SDL_LoadBMP(ctx.imagefile);
+
+    if (!ctx.surface) {
+        SDL_Log("Failed do load image, using a generated one: %s\n", SDL_GetError());
+        ctx.surface = makeImage();
+    }
 
     if (ctx.surface) {
 
         SDL_Log("Image size %d*%d\n", ctx.surface->w, ctx.surface->h);
 
-        ctx.window = SDL_CreateWindow(
-            "SDL2 benchmark",
-            SDL_WINDOWPOS_CENTERED,
-            SDL_WINDOWPOS_CENTERED,
-            ctx.width,
-            ctx.height,
-            SDL_WINDOW_FULLSCREEN);
+        writeHeader(&ctx);
+
+        runSurfaceTests(&ctx);
+
+        if (ctx.running && hasRendererTests(&ctx)) {
+            ctx.window = SDL_CreateWindow(
+                "SDL2 benchmark",
+                SDL_WINDOWPOS_CENTERED,
+                SDL_WINDOWPOS_CENTERED,
+                ctx.width,
+                ctx.height,
+                ctx.fullscreen ? SDL_WINDOW_FULLSCREEN : 0);
+
+            if (ctx.window) {
 
-        if (ctx.window) {
+                checkPixelFormat(&ctx);
 
-            checkPixelFormat(&ctx);
+                if (ctx.rendname) {
+                    testSpecificRenderer(&ctx);
+                } else {
+                    testAllRenderers(&ctx);
+                }
 
-            if (ctx.rendname) {
-                testSpecificRenderer(&ctx);
+                SDL_DestroyWindow(ctx.window);
             } else {
-                testAllRenderers(&ctx);
+                SDL_Log("Failed to create window: %s\n", SDL_GetError());
             }
-
-            SDL_DestroyWindow(ctx.window);
-        } else {
-            SDL_Log("Failed to create window: %s\n", SDL_GetError());
         }
 
+        writeFooter(&ctx);
+
         SDL_FreeSurface(ctx.surface);
 
     } else {
-        SDL_Log("Failed do load image: %s\n", SDL_GetError());
+        SDL_Log("Failed to create image: %s\n", SDL_GetError());
     }
 
     SDL_Log("Bye bye\n");
 
+    quitContext(&ctx);
+
     SDL_Quit();
 
     return 0;
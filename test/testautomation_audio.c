@@ -53,6 +53,19 @@ void SDLCALL _audio_testCallback(void *userdata, Uint8 *stream, int len)
    _audio_testCallbackLength += len;
 }
 
+/* Starts a driver for tests that open devices. Earlier tests call
+   SDL_AudioQuit(), which leaves the subsystem marked as initialized but
+   without a driver, so SDL_InitSubSystem() in the fixture is not enough. */
+static int _audio_startDriver(void)
+{
+   int result = SDL_AudioInit(NULL);
+   SDLTest_AssertPass("Call to SDL_AudioInit(NULL)");
+   if (result != 0) {
+      SDLTest_Log("No audio driver: %s", SDL_GetError());
+   }
+   return result;
+}
+
 
 /* Test case functions */
 
@@ -968,6 +981,1132 @@ int audio_openCloseAudioDeviceConnected()
 }
 
 
+/* Resamples sines with SDL_ConvertAudio(), returns the converted buffer and its frame count */
+static float *
+_resampleSines(int channels, int src_rate, int dst_rate, int *frames)
+{
+  const int srcframes = src_rate / 2;
+  SDL_AudioCVT cvt;
+  float *samples;
+  int result, i, c;
+
+  result = SDL_BuildAudioCVT(&cvt, AUDIO_F32SYS, channels, src_rate, AUDIO_F32SYS, channels, dst_rate);
+  SDLTest_AssertCheck(result == 1, "Verify result value; expected: 1; got: %i", result);
+  if (result != 1) return NULL;
+
+  cvt.len = srcframes * channels * sizeof(float);
+  cvt.buf = (Uint8 *)SDL_malloc(cvt.len * cvt.len_mult);
+  SDLTest_AssertCheck(cvt.buf != NULL, "Check data buffer to convert is not NULL");
+  if (cvt.buf == NULL) return NULL;
+
+  /* A different frequency on each channel, all below the lowest Nyquist frequency */
+  samples = (float *)cvt.buf;
+  for (i = 0; i < srcframes; i++) {
+    for (c = 0; c < channels; c++) {
+      samples[i * channels + c] = 0.5f * (float)SDL_sin(2.0 * M_PI * 220.0 * (c + 1) * i / src_rate);
+    }
+  }
+
+  result = SDL_ConvertAudio(&cvt);
+  SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0; got: %i", result);
+
+  *frames = cvt.len_cvt / (channels * sizeof(float));
+  return (float *)cvt.buf;
+}
+
+/**
+ * \brief Checks the resampler output against the ideal signal, and the SIMD code paths against the C one.
+ *
+ * \sa https://wiki.libsdl.org/SDL_BuildAudioCVT
+ * \sa https://wiki.libsdl.org/SDL_ConvertAudio
+ */
+int audio_resampleQuality()
+{
+  static const int rates[][2] = {
+    { 44100, 48000 }, { 48000, 44100 }, { 22050, 48000 }, { 8000, 48000 },
+    { 48000, 8000 }, { 96000, 44100 }, { 44100, 44101 }
+  };
+  static const int channels[] = { 1, 2, 4, 6, 8 };
+  /* The resampler filter has a 80dB stopband, this is a bit above that noise level */
+  const double max_error = 0.0003;
+  int i, j, k, c;
+
+  for (i = 0; i < SDL_arraysize(rates); i++) {
+    const int src_rate = rates[i][0];
+    const int dst_rate = rates[i][1];
+
+    for (j = 0; j < SDL_arraysize(channels); j++) {
+      const int chans = channels[j];
+      float *output, *reference;
+      int frames, reference_frames;
+      double error = 0.0, difference = 0.0;
+
+      output = _resampleSines(chans, src_rate, dst_rate, &frames);
+      if (output == NULL) return TEST_ABORTED;
+
+      SDLTest_AssertCheck(frames == (int)((Sint64)(src_rate / 2) * dst_rate / src_rate),
+                          "Verify frame count; expected: %i; got: %i", (int)((Sint64)(src_rate / 2) * dst_rate / src_rate), frames);
+
+      /* The ends are resampled against silence */
+      for (k = 32; k < frames - 32; k++) {
+        for (c = 0; c < chans; c++) {
+          const double expected = 0.5 * SDL_sin(2.0 * M_PI * 220.0 * (c + 1) * k / dst_rate);
+          error = SDL_max(error, SDL_fabs(output[k * chans + c] - expected));
+        }
+      }
+      SDLTest_AssertCheck(error <= max_error,
+                          "Verify %i channels %i Hz -> %i Hz error; expected: <= %f; got: %f",
+                          chans, src_rate, dst_rate, max_error, error);
+
+      SDL_SetHint(SDL_HINT_CPU_DISABLE_FEATURES, "all");
+      reference = _resampleSines(chans, src_rate, dst_rate, &reference_frames);
+      SDL_SetHint(SDL_HINT_CPU_DISABLE_FEATURES, "");
+      if (reference == NULL) {
+        SDL_free(output);
+        return TEST_ABORTED;
+      }
+
+      SDLTest_AssertCheck(frames == reference_frames, "Verify frame count without SIMD; expected: %i; got: %i", frames, reference_frames);
+      for (k = 0; k < SDL_min(frames, reference_frames) * chans; k++) {
+        difference = SDL_max(difference, SDL_fabs(output[k] - reference[k]));
+      }
+      SDLTest_AssertCheck(difference <= 0.000001,
+                          "Verify %i channels %i Hz -> %i Hz matches the C code; expected: <= 0.000001; got: %f",
+                          chans, src_rate, dst_rate, difference);
+
+      SDL_free(output);
+      SDL_free(reference);
+    }
+  }
+
+  return TEST_COMPLETED;
+}
+
+/**
+ * \brief Resamples with every SDL_AudioResampleQuality and checks the output against the expected signal.
+ *
+ * \sa https://wiki.libsdl.org/SDL_AudioStreamSetResampleQuality
+ */
+int audio_resampleStreamQuality()
+{
+  static const struct {
+    SDL_AudioResampleQuality quality;
+    const char *hint;
+    double max_error;
+  } qualities[] = {
+    { SDL_AUDIO_RESAMPLE_NEAREST, "nearest", 0.04 },
+    { SDL_AUDIO_RESAMPLE_LINEAR, "linear", 0.0005 },
+    { SDL_AUDIO_RESAMPLE_CUBIC, "cubic", 0.00002 },
+    { SDL_AUDIO_RESAMPLE_BANDLIMITED, "bandlimited", 0.0001 },
+    { SDL_AUDIO_RESAMPLE_BANDLIMITED_HQ, "bandlimited_hq", 0.00005 }
+  };
+  const int channels = 2, src_rate = 44100, dst_rate = 48000;
+  const int srcframes = src_rate / 2;
+  const int dstframes = dst_rate / 2;
+  float *input, *output;
+  SDL_AudioStream *stream;
+  int i, k, c, result, frames;
+
+  input = (float *)SDL_malloc(srcframes * channels * sizeof(float));
+  output = (float *)SDL_malloc(dstframes * channels * sizeof(float));
+  SDLTest_AssertCheck(input != NULL && output != NULL, "Check buffers are not NULL");
+  if (input == NULL || output == NULL) {
+    SDL_free(input);
+    SDL_free(output);
+    return TEST_ABORTED;
+  }
+
+  for (k = 0; k < srcframes; k++) {
+    for (c = 0; c < channels; c++) {
+      input[k * channels + c] = 0.5f * (float)SDL_sin(2.0 * M_PI * 220.0 * (c + 1) * k / src_rate);
+    }
+  }
+
+  for (i = 0; i < SDL_arraysize(qualities); i++) {
+    double error = 0.0;
+
+    /* Even numbers select the quality from the hint, odd ones with the function */
+    SDL_SetHint(SDL_HINT_AUDIO_RESAMPLE_QUALITY, (i & 1) ? NULL : qualities[i].hint);
+    stream = SDL_NewAudioStream(AUDIO_F32SYS, channels, src_rate, AUDIO_F32SYS, channels, dst_rate);
+    SDL_SetHint(SDL_HINT_AUDIO_RESAMPLE_QUALITY, NULL);
+    SDLTest_AssertCheck(stream != NULL, "Check SDL_NewAudioStream result is not NULL");
+    if (stream == NULL) break;
+
+    if (i & 1) {
+      result = SDL_AudioStreamSetResampleQuality(stream, qualities[i].quality);
+      SDLTest_AssertPass("Call to SDL_AudioStreamSetResampleQuality(stream, %s)", qualities[i].hint);
+      SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0; got: %i", result);
+    }
+
+    /* Everything in one go, so it is resampled as one buffer */
+    result = SDL_AudioStreamPut(stream, input, srcframes * channels * sizeof(float));
+    SDLTest_AssertCheck(result == 0, "Verify SDL_AudioStreamPut result; expected: 0; got: %i", result);
+    frames = SDL_AudioStreamGet(stream, output, dstframes * channels * sizeof(float)) / (channels * sizeof(float));
+    SDLTest_AssertCheck(frames > dstframes / 2, "Verify resampled frames; expected: > %i; got: %i", dstframes / 2, frames);
+
+    for (k = 32; k < frames; k++) {
+      for (c = 0; c < channels; c++) {
+        const double expected = 0.5 * SDL_sin(2.0 * M_PI * 220.0 * (c + 1) * k / dst_rate);
+        error = SDL_max(error, SDL_fabs(output[k * channels + c] - expected));
+      }
+    }
+    SDLTest_AssertCheck(error <= qualities[i].max_error,
+                        "Verify %s resampling error; expected: <= %f; got: %f",
+                        qualities[i].hint, qualities[i].max_error, error);
+
+    SDL_FreeAudioStream(stream);
+  }
+
+  /* Negative cases */
+  result = SDL_AudioStreamSetResampleQuality(NULL, SDL_AUDIO_RESAMPLE_LINEAR);
+  SDLTest_AssertCheck(result == -1, "Verify result with NULL stream; expected: -1; got: %i", result);
+  stream = SDL_NewAudioStream(AUDIO_F32SYS, channels, src_rate, AUDIO_F32SYS, channels, dst_rate);
+  if (stream != NULL) {
+    result = SDL_AudioStreamSetResampleQuality(stream, (SDL_AudioResampleQuality)42);
+    SDLTest_AssertCheck(result == -1, "Verify result with invalid quality; expected: -1; got: %i", result);
+    SDL_FreeAudioStream(stream);
+  }
+
+  SDL_free(input);
+  SDL_free(output);
+
+  return TEST_COMPLETED;
+}
+
+
+/**
+ * \brief Queues audio on a paused playback device, past the initial queue size.
+ *
+ * \sa https://wiki.libsdl.org/SDL_QueueAudio
+ * \sa https://wiki.libsdl.org/SDL_GetQueuedAudioSize
+ * \sa https://wiki.libsdl.org/SDL_ClearQueuedAudio
+ */
+int audio_queueAudio()
+{
+  SDL_AudioSpec desired, obtained;
+  SDL_AudioDeviceID id;
+  Uint8 *data;
+  Uint32 len, total, queued;
+  int i, result;
+
+  SDL_zero(desired);
+  desired.freq = 48000;
+  desired.format = AUDIO_S16SYS;
+  desired.channels = 2;
+  desired.samples = 1024;
+  desired.callback = NULL;
+
+  if (_audio_startDriver() != 0) {
+      return TEST_SKIPPED;
+  }
+
+  id = SDL_OpenAudioDevice(NULL, 0, &desired, &obtained, 0);
+  SDLTest_AssertPass("Call to SDL_OpenAudioDevice(NULL, 0, desired, obtained, 0)");
+  if (id == 0) {
+      SDLTest_Log("No playback device to queue to: %s", SDL_GetError());
+      SDL_AudioQuit();
+      return TEST_SKIPPED;
+  }
+
+  /* Several times the initial space, in odd sizes so the queue wraps. */
+  len = obtained.size + 100;
+  data = (Uint8 *)SDL_malloc(len);
+  SDLTest_AssertCheck(data != NULL, "Check data buffer was allocated");
+  if (data == NULL) {
+      SDL_CloseAudioDevice(id);
+      SDL_AudioQuit();
+      return TEST_ABORTED;
+  }
+  SDL_memset(data, 0x11, len);
+
+  total = 0;
+  for (i = 0; i < 6; i++) {
+      result = SDL_QueueAudio(id, data, len - i);
+      total += len - i;
+      SDLTest_AssertCheck(result == 0, "Validate result from SDL_QueueAudio(%d), expected: 0, got: %d", (int)(len - i), result);
+  }
+  queued = SDL_GetQueuedAudioSize(id);
+  SDLTest_AssertCheck(queued == total, "Validate queued size, expected: %d, got: %d", (int)total, (int)queued);
+
+  SDL_ClearQueuedAudio(id);
+  queued = SDL_GetQueuedAudioSize(id);
+  SDLTest_AssertCheck(queued == 0, "Validate queued size after SDL_ClearQueuedAudio, expected: 0, got: %d", (int)queued);
+
+  result = SDL_QueueAudio(id, data, len);
+  SDLTest_AssertCheck(result == 0, "Validate result from SDL_QueueAudio after clearing, expected: 0, got: %d", result);
+  queued = SDL_GetQueuedAudioSize(id);
+  SDLTest_AssertCheck(queued == len, "Validate queued size, expected: %d, got: %d", (int)len, (int)queued);
+
+  SDL_CloseAudioDevice(id);
+  SDLTest_AssertPass("Call to SDL_CloseAudioDevice()");
+
+  /* Queueing is not allowed on devices with a callback. */
+  desired.callback = _audio_testCallback;
+  id = SDL_OpenAudioDevice(NULL, 0, &desired, &obtained, 0);
+  if (id != 0) {
+      result = SDL_QueueAudio(id, data, len);
+      SDLTest_AssertCheck(result == -1, "Validate result from SDL_QueueAudio with a callback, expected: -1, got: %d", result);
+      SDL_CloseAudioDevice(id);
+  }
+
+  SDL_free(data);
+
+  SDL_AudioQuit();
+  SDLTest_AssertPass("Call to SDL_AudioQuit()");
+
+  return TEST_COMPLETED;
+}
+
+/**
+ * \brief Clears a playback queue while the device is playing from it.
+ *
+ * \sa https://wiki.libsdl.org/SDL_QueueAudio
+ * \sa https://wiki.libsdl.org/SDL_ClearQueuedAudio
+ */
+int audio_clearQueuedAudio()
+{
+  SDL_AudioSpec desired, obtained;
+  SDL_AudioDeviceID id;
+  Uint8 *data;
+  Uint32 len, queued;
+  int i, result;
+
+  SDL_zero(desired);
+  desired.freq = 48000;
+  desired.format = AUDIO_S16SYS;
+  desired.channels = 2;
+  desired.samples = 512;
+  desired.callback = NULL;
+
+  if (_audio_startDriver() != 0) {
+      return TEST_SKIPPED;
+  }
+
+  id = SDL_OpenAudioDevice(NULL, 0, &desired, &obtained, 0);
+  SDLTest_AssertPass("Call to SDL_OpenAudioDevice(NULL, 0, desired, obtained, 0)");
+  if (id == 0) {
+      SDLTest_Log("No playback device to queue to: %s", SDL_GetError());
+      SDL_AudioQuit();
+      return TEST_SKIPPED;
+  }
+
+  /* Clearing an empty queue does nothing. */
+  SDL_ClearQueuedAudio(id);
+  SDLTest_AssertPass("Call to SDL_ClearQueuedAudio() on an empty queue");
+  queued = SDL_GetQueuedAudioSize(id);
+  SDLTest_AssertCheck(queued == 0, "Validate queued size, expected: 0, got: %d", (int)queued);
+
+  len = obtained.size * 4;
+  data = (Uint8 *)SDL_malloc(len);
+  SDLTest_AssertCheck(data != NULL, "Check data buffer was allocated");
+  if (data == NULL) {
+      SDL_CloseAudioDevice(id);
+      SDL_AudioQuit();
+      return TEST_ABORTED;
+  }
+  SDL_memset(data, 0x11, len);
+
+  /* The audio thread drains the queue while it's cleared and refilled. */
+  SDL_PauseAudioDevice(id, 0);
+  for (i = 0; i < 50; i++) {
+      result = SDL_QueueAudio(id, data, len - (i % 7));
+      if (result != 0) {
+          break;
+      }
+      if (i & 1) {
+          SDL_Delay(1);
+      }
+      SDL_ClearQueuedAudio(id);
+      queued = SDL_GetQueuedAudioSize(id);
+      if (queued != 0) {
+          break;
+      }
+  }
+  SDLTest_AssertCheck(i == 50, "Validate queueing and clearing while playing, %d of 50 rounds done", i);
+
+  result = SDL_QueueAudio(id, data, len);
+  SDLTest_AssertCheck(result == 0, "Validate result from SDL_QueueAudio after clearing, expected: 0, got: %d", result);
+  queued = SDL_GetQueuedAudioSize(id);
+  SDLTest_AssertCheck(queued <= len, "Validate queued size, expected: <= %d, got: %d", (int)len, (int)queued);
+
+  /* Closing a device with audio still queued. */
+  SDL_CloseAudioDevice(id);
+  SDLTest_AssertPass("Call to SDL_CloseAudioDevice()");
+
+  SDL_free(data);
+
+  SDL_AudioQuit();
+  SDLTest_AssertPass("Call to SDL_AudioQuit()");
+
+  return TEST_COMPLETED;
+}
+
+/**
+ * \brief Mixes streams of different formats and gains with an audio mixer.
+ *
+ * \sa https://wiki.libsdl.org/SDL_NewAudioMixer
+ * \sa https://wiki.libsdl.org/SDL_AudioMixerNewStream
+ * \sa https://wiki.libsdl.org/SDL_AudioMixerGet
+ */
+int audio_mixerStreams()
+{
+  SDL_AudioMixer *mixer;
+  SDL_AudioStream *s16, *f32, *mono;
+  Sint16 s16data[1000 * 2];
+  float f32data[500 * 2];
+  float monodata[250];
+  Sint16 output[1000 * 2];
+  int i, result, mismatches;
+
+  for (i = 0; i < SDL_arraysize(s16data); i++) {
+      s16data[i] = 8192;
+  }
+  for (i = 0; i < SDL_arraysize(f32data); i++) {
+      f32data[i] = 0.5f;
+  }
+  for (i = 0; i < SDL_arraysize(monodata); i++) {
+      monodata[i] = 1.0f;
+  }
+
+  mixer = SDL_NewAudioMixer(AUDIO_S16SYS, 2, 48000);
+  SDLTest_AssertPass("Call to SDL_NewAudioMixer(AUDIO_S16SYS, 2, 48000)");
+  SDLTest_AssertCheck(mixer != NULL, "Check result from SDL_NewAudioMixer is not NULL");
+  if (mixer == NULL) {
+      return TEST_ABORTED;
+  }
+
+  s16 = SDL_AudioMixerNewStream(mixer, AUDIO_S16SYS, 2, 48000);
+  f32 = SDL_AudioMixerNewStream(mixer, AUDIO_F32SYS, 2, 48000);
+  mono = SDL_AudioMixerNewStream(mixer, AUDIO_F32SYS, 1, 48000);
+  SDLTest_AssertCheck(s16 != NULL && f32 != NULL && mono != NULL, "Check results from SDL_AudioMixerNewStream are not NULL");
+  if (s16 == NULL || f32 == NULL || mono == NULL) {
+      SDL_FreeAudioMixer(mixer);
+      return TEST_ABORTED;
+  }
+
+  result = SDL_AudioMixerSetGain(mixer, f32, 0.5f);
+  SDLTest_AssertCheck(result == 0, "Validate result from SDL_AudioMixerSetGain, expected: 0, got: %d", result);
+  SDL_AudioStreamPut(s16, s16data, sizeof (s16data));
+  SDL_AudioStreamPut(f32, f32data, sizeof (f32data));
+  SDL_AudioStreamPut(mono, monodata, sizeof (monodata));
+
+  /* 0.25 from every stream that still has data, clipped while all three play. */
+  result = SDL_AudioMixerGet(mixer, output, sizeof (output));
+  SDLTest_AssertCheck(result == sizeof (output), "Validate result from SDL_AudioMixerGet, expected: %d, got: %d", (int) sizeof (output), result);
+  mismatches = 0;
+  for (i = 0; i < SDL_arraysize(output); i++) {
+      const int expected = (i < 250 * 2) ? 32767 : ((i < 500 * 2) ? 16384 : 8192);
+      if (SDL_abs(output[i] - expected) > 1) {
+          mismatches++;
+      }
+  }
+  SDLTest_AssertCheck(mismatches == 0, "Validate mixed samples, expected: 0 mismatches, got: %d", mismatches);
+
+  /* everything has run dry now. */
+  result = SDL_AudioMixerGet(mixer, output, sizeof (output));
+  SDLTest_AssertCheck(result == sizeof (output), "Validate result from SDL_AudioMixerGet, expected: %d, got: %d", (int) sizeof (output), result);
+  mismatches = 0;
+  for (i = 0; i < SDL_arraysize(output); i++) {
+      if (output[i] != 0) {
+          mismatches++;
+      }
+  }
+  SDLTest_AssertCheck(mismatches == 0, "Validate silence after the streams ran dry, expected: 0 mismatches, got: %d", mismatches);
+
+  result = SDL_AudioMixerGet(mixer, output, 3);
+  SDLTest_AssertCheck(result == -1, "Validate result from SDL_AudioMixerGet with a partial frame, expected: -1, got: %d", result);
+
+  SDL_AudioMixerFreeStream(mixer, f32);
+  result = SDL_AudioMixerSetGain(mixer, f32, 1.0f);
+  SDLTest_AssertCheck(result == -1, "Validate result from SDL_AudioMixerSetGain on a freed stream, expected: -1, got: %d", result);
+
+  SDL_FreeAudioMixer(mixer);
+  SDLTest_AssertPass("Call to SDL_FreeAudioMixer()");
+
+  return TEST_COMPLETED;
+}
+
+/* Mixes the same three float streams with each kernel the CPU features allow. */
+static int
+_mixFloatStreams(const float *data, int samples, float *output)
+{
+  const float gains[] = { 1.0f, 0.5f, 0.3f };
+  SDL_AudioMixer *mixer;
+  int i, result;
+
+  mixer = SDL_NewAudioMixer(AUDIO_F32SYS, 2, 48000);
+  if (mixer == NULL) {
+      return -1;
+  }
+  for (i = 0; i < SDL_arraysize(gains); i++) {
+      SDL_AudioStream *stream = SDL_AudioMixerNewStream(mixer, AUDIO_F32SYS, 2, 48000);
+      if (stream == NULL) {
+          SDL_FreeAudioMixer(mixer);
+          return -1;
+      }
+      SDL_AudioMixerSetGain(mixer, stream, gains[i]);
+      SDL_AudioStreamPut(stream, data + (i * samples), samples * sizeof (float));
+  }
+  result = SDL_AudioMixerGet(mixer, output, samples * sizeof (float));
+  SDL_FreeAudioMixer(mixer);
+  return result;
+}
+
+/**
+ * \brief Checks that an audio mixer gives the same results with and without SIMD.
+ *
+ * \sa https://wiki.libsdl.org/SDL_AudioMixerGet
+ */
+int audio_mixerStreamsSIMD()
+{
+  /* not a multiple of any vector size, so the scalar code finishes every mix. */
+  const int samples = 1003 * 2;
+  float *data, *expected, *actual;
+  double difference = 0.0;
+  int i, result;
+
+  data = (float *) SDL_malloc(samples * 3 * sizeof (float));
+  expected = (float *) SDL_malloc(samples * sizeof (float));
+  actual = (float *) SDL_malloc(samples * sizeof (float));
+  if (data == NULL || expected == NULL || actual == NULL) {
+      SDL_free(data);
+      SDL_free(expected);
+      SDL_free(actual);
+      return TEST_ABORTED;
+  }
+  /* quiet enough that the sum is never clipped. */
+  for (i = 0; i < samples * 3; i++) {
+      data[i] = (SDLTest_RandomUnitFloat() - 0.5f) * 0.5f;
+  }
+
+  SDL_SetHint(SDL_HINT_CPU_DISABLE_FEATURES, "all");
+  result = _mixFloatStreams(data, samples, expected);
+  SDLTest_AssertCheck(result == samples * sizeof (float), "Validate result without SIMD, expected: %d, got: %d", (int) (samples * sizeof (float)), result);
+
+  SDL_SetHint(SDL_HINT_CPU_DISABLE_FEATURES, "");
+  result = _mixFloatStreams(data, samples, actual);
+  SDLTest_AssertCheck(result == samples * sizeof (float), "Validate result with SIMD, expected: %d, got: %d", (int) (samples * sizeof (float)), result);
+
+  for (i = 0; i < samples; i++) {
+      difference = SDL_max(difference, SDL_fabs(expected[i] - actual[i]));
+  }
+  /* the C code may be compiled to fused multiply-adds, so allow for rounding. */
+  SDLTest_AssertCheck(difference <= 0.000001, "Verify mixed samples match the C code; expected: <= 0.000001; got: %f", difference);
+
+  SDL_free(data);
+  SDL_free(expected);
+  SDL_free(actual);
+  return TEST_COMPLETED;
+}
+
+/**
+ * \brief Checks that SDL_MixAudioFormat gives the same results with and without SIMD.
+ *
+ * \sa https://wiki.libsdl.org/SDL_MixAudioFormat
+ */
+int audio_mixAudioFormatSIMD()
+{
+  const SDL_AudioFormat formats[] = { AUDIO_U8, AUDIO_S8, AUDIO_S16LSB, AUDIO_S16MSB, AUDIO_U16LSB, AUDIO_U16MSB,
+                                      AUDIO_S32LSB, AUDIO_S32MSB, AUDIO_F32LSB, AUDIO_F32MSB };
+  const int volumes[] = { 1, 37, SDL_MIX_MAXVOLUME / 2, SDL_MIX_MAXVOLUME - 1, SDL_MIX_MAXVOLUME };
+  /* not a multiple of any vector size, so the scalar code finishes every mix. */
+  const Uint32 len = 4092;
+  Uint8 *src, *dst, *expected, *actual;
+  int f, v, mismatches;
+  Uint32 i;
+
+  src = (Uint8 *)SDL_malloc(len * 4);
+  SDLTest_AssertCheck(src != NULL, "Check data buffers were allocated");
+  if (src == NULL) {
+      return TEST_ABORTED;
+  }
+  dst = src + len;
+  expected = dst + len;
+  actual = expected + len;
+
+  for (f = 0; f < SDL_arraysize(formats); f++) {
+      const SDL_AudioFormat format = formats[f];
+
+      for (i = 0; i < len * 2; i++) {
+          src[i] = SDLTest_RandomUint8();
+      }
+      if (SDL_AUDIO_ISFLOAT(format)) {
+          /* mostly in range, with a few samples far enough out to clamp. */
+          for (i = 0; i < len * 2; i += 4) {
+              const float sample = (SDLTest_RandomUint8() == 0) ? 3.0e38f : (SDLTest_RandomUnitFloat() * 4.0f) - 2.0f;
+              const float swapped = SDL_AUDIO_ISBIGENDIAN(format) ? SDL_SwapFloatBE(sample) : SDL_SwapFloatLE(sample);
+              SDL_memcpy(src + i, &swapped, sizeof (swapped));
+          }
+      }
+
+      for (v = 0; v < SDL_arraysize(volumes); v++) {
+          SDL_SetHint(SDL_HINT_CPU_DISABLE_FEATURES, "all");
+          SDL_memcpy(expected, dst, len);
+          SDL_MixAudioFormat(expected, src, format, len, volumes[v]);
+
+          SDL_SetHint(SDL_HINT_CPU_DISABLE_FEATURES, "");
+          SDL_memcpy(actual, dst, len);
+          SDL_MixAudioFormat(actual, src, format, len, volumes[v]);
+
+          mismatches = 0;
+          for (i = 0; i < len; i++) {
+              if (expected[i] != actual[i]) {
+                  mismatches++;
+              }
+          }
+          SDLTest_AssertCheck(mismatches == 0, "Validate format 0x%.4x at volume %d, expected: 0 mismatched bytes, got: %d", format, volumes[v], mismatches);
+      }
+  }
+
+  SDL_free(src);
+
+  return TEST_COMPLETED;
+}
+
+/* Writes a WAVE file with random data of the given encoding to buf, returns its size */
+static size_t
+_buildWave(Uint8 *buf, size_t bufsize, Uint16 encoding, Uint16 channels, Uint16 bits, Uint32 blocks)
+{
+  const Sint16 coeffs[14] = { 256, 0, 512, -256, 0, 0, 192, 64, 240, 0, 460, -208, 392, -232 };
+  SDL_RWops *rw = SDL_RWFromMem(buf, (int)bufsize);
+  Uint16 blockalign, samplesperblock = 0, extsize = 0;
+  Uint32 datalen, i;
+  size_t size;
+
+  if (encoding == 0x0002) {
+    /* MS ADPCM: 7 header bytes and 16 nibbles of data per channel. */
+    blockalign = channels * 15;
+    samplesperblock = 18;
+    extsize = 32;
+  } else if (encoding == 0x0011) {
+    /* IMA ADPCM: 4 header bytes and 8 bytes of data per channel. */
+    blockalign = channels * 12;
+    samplesperblock = 17;
+    extsize = 2;
+  } else {
+    blockalign = channels * bits / 8;
+  }
+  datalen = blockalign * blocks;
+
+  SDL_WriteLE32(rw, 0x46464952); /* "RIFF" */
+  SDL_WriteLE32(rw, 4 + 8 + 18 + extsize + 8 + datalen);
+  SDL_WriteLE32(rw, 0x45564157); /* "WAVE" */
+  SDL_WriteLE32(rw, 0x20746D66); /* "fmt " */
+  SDL_WriteLE32(rw, 18 + extsize);
+  SDL_WriteLE16(rw, encoding);
+  SDL_WriteLE16(rw, channels);
+  SDL_WriteLE32(rw, 22050);
+  SDL_WriteLE32(rw, 22050 * blockalign);
+  SDL_WriteLE16(rw, blockalign);
+  SDL_WriteLE16(rw, bits);
+  SDL_WriteLE16(rw, extsize);
+  if (extsize > 0) {
+    SDL_WriteLE16(rw, samplesperblock);
+  }
+  if (encoding == 0x0002) {
+    SDL_WriteLE16(rw, 7);
+    for (i = 0; i < SDL_arraysize(coeffs); i++) {
+      SDL_WriteLE16(rw, (Uint16)coeffs[i]);
+    }
+  }
+  SDL_WriteLE32(rw, 0x61746164); /* "data" */
+  SDL_WriteLE32(rw, datalen);
+
+  size = (size_t)SDL_RWtell(rw);
+  SDL_RWclose(rw);
+
+  for (i = 0; i < datalen; i++) {
+    buf[size + i] = SDLTest_RandomUint8();
+  }
+  if (encoding == 0x0002) {
+    /* The block headers need valid coefficient indices. */
+    for (i = 0; i < datalen; i += blockalign) {
+      SDL_memset(buf + size + i, SDLTest_RandomIntegerInRange(0, 6), channels);
+    }
+  }
+
+  return size + datalen;
+}
+
+/**
+ * \brief Decodes WAVE files with a WAV stream in small pieces and with seeks, and compares against SDL_LoadWAV_RW.
+ *
+ * \sa https://wiki.libsdl.org/SDL_LoadWAV_RW
+ */
+int audio_wavStream()
+{
+  const struct { Uint16 encoding, channels, bits; } formats[] = {
+    { 0x0001, 2, 16 }, { 0x0001, 1, 24 }, { 0x0003, 2, 32 }, { 0x0007, 2, 8 }, { 0x0002, 2, 4 }, { 0x0011, 2, 4 }
+  };
+  const Uint32 blocks = 500;
+  const size_t bufsize = 128 * 1024;
+  Uint8 *wave, *expected, *actual;
+  int f, result;
+
+  wave = (Uint8 *)SDL_malloc(bufsize * 2);
+  SDLTest_AssertCheck(wave != NULL, "Check data buffers were allocated");
+  if (wave == NULL) {
+      return TEST_ABORTED;
+  }
+  actual = wave + bufsize;
+
+  for (f = 0; f < SDL_arraysize(formats); f++) {
+      const size_t wavesize = _buildWave(wave, bufsize, formats[f].encoding, formats[f].channels, formats[f].bits, blocks);
+      SDL_AudioSpec loadspec, streamspec;
+      SDL_WAVStream *stream;
+      Uint32 expectedlen;
+      Sint64 frames, seekframe;
+      int framesize, total;
+
+      if (SDL_LoadWAV_RW(SDL_RWFromConstMem(wave, (int)wavesize), 1, &loadspec, &expected, &expectedlen) == NULL) {
+          SDLTest_AssertCheck(SDL_FALSE, "Call to SDL_LoadWAV_RW() for encoding 0x%.4x failed: %s", formats[f].encoding, SDL_GetError());
+          continue;
+      }
+
+      stream = SDL_OpenWAVStream_RW(SDL_RWFromConstMem(wave, (int)wavesize), 1, &streamspec);
+      SDLTest_AssertPass("Call to SDL_OpenWAVStream_RW() for encoding 0x%.4x", formats[f].encoding);
+      SDLTest_AssertCheck(stream != NULL, "Check result from SDL_OpenWAVStream_RW is not NULL");
+      if (stream == NULL) {
+          SDL_FreeWAV(expected);
+          continue;
+      }
+      SDLTest_AssertCheck(streamspec.format == loadspec.format && streamspec.channels == loadspec.channels && streamspec.freq == loadspec.freq,
+                          "Validate stream spec matches SDL_LoadWAV_RW spec");
+
+      framesize = (SDL_AUDIO_BITSIZE(loadspec.format) / 8) * loadspec.channels;
+      frames = SDL_WAVStreamLength(stream);
+      SDLTest_AssertCheck(frames * framesize == expectedlen, "Validate stream length, expected: %d frames, got: %d", (int)(expectedlen / framesize), (int)frames);
+
+      /* Odd read sizes, so reads end in the middle of blocks and sample frames. */
+      total = 0;
+      do {
+          result = SDL_WAVStreamRead(stream, actual + total, SDL_min(1001, (int)bufsize - total));
+          total += SDL_max(result, 0);
+      } while (result > 0);
+      SDLTest_AssertCheck(result == 0, "Validate result from SDL_WAVStreamRead at the end, expected: 0, got: %d", result);
+      SDLTest_AssertCheck(total == (int)expectedlen, "Validate bytes read, expected: %d, got: %d", (int)expectedlen, total);
+      SDLTest_AssertCheck(SDL_memcmp(expected, actual, expectedlen) == 0, "Validate streamed data matches SDL_LoadWAV_RW data");
+
+      /* Into the middle of an ADPCM block, then back to the start. */
+      seekframe = frames / 3 + 5;
+      result = SDL_WAVStreamSeek(stream, seekframe);
+      SDLTest_AssertCheck(result == 0, "Validate result from SDL_WAVStreamSeek, expected: 0, got: %d", result);
+      SDLTest_AssertCheck(SDL_WAVStreamTell(stream) == seekframe, "Validate SDL_WAVStreamTell after seeking, expected: %d, got: %d", (int)seekframe, (int)SDL_WAVStreamTell(stream));
+      total = (int)((frames - seekframe) * framesize);
+      result = SDL_WAVStreamRead(stream, actual, total);
+      SDLTest_AssertCheck(result == total, "Validate result from SDL_WAVStreamRead after seeking, expected: %d, got: %d", total, result);
+      SDLTest_AssertCheck(SDL_memcmp(expected + seekframe * framesize, actual, total) == 0, "Validate data after seeking matches SDL_LoadWAV_RW data");
+
+      result = SDL_WAVStreamSeek(stream, 0);
+      SDLTest_AssertCheck(result == 0, "Validate result from SDL_WAVStreamSeek, expected: 0, got: %d", result);
+      result = SDL_WAVStreamRead(stream, actual, 100);
+      SDLTest_AssertCheck(result == 100 && SDL_memcmp(expected, actual, 100) == 0, "Validate data after seeking to the start matches SDL_LoadWAV_RW data");
+
+      result = SDL_WAVStreamSeek(stream, frames + 1);
+      SDLTest_AssertCheck(result == -1, "Validate result from SDL_WAVStreamSeek past the end, expected: -1, got: %d", result);
+
+      SDL_CloseWAVStream(stream);
+      SDLTest_AssertPass("Call to SDL_CloseWAVStream()");
+      SDL_FreeWAV(expected);
+  }
+
+  SDL_free(wave);
+
+  return TEST_COMPLETED;
+}
+
+/**
+ * \brief Decodes large ADPCM files with several threads and compares against decoding on one thread.
+ *
+ * \sa https://wiki.libsdl.org/SDL_LoadWAV_RW
+ */
+int audio_wavDecodeThreads()
+{
+  const Uint16 encodings[] = { 0x0002, 0x0011 };
+  /* complete, and with a truncated last block */
+  const size_t cuts[] = { 0, 7 };
+  const Uint32 blocks = 3000;
+  const size_t bufsize = 128 * 1024;
+  Uint8 *wave;
+  int e, c;
+
+  wave = (Uint8 *)SDL_malloc(bufsize);
+  SDLTest_AssertCheck(wave != NULL, "Check data buffer was allocated");
+  if (wave == NULL) {
+      return TEST_ABORTED;
+  }
+
+  for (e = 0; e < SDL_arraysize(encodings); e++) {
+      const size_t wavesize = _buildWave(wave, bufsize, encodings[e], 2, 4, blocks);
+
+      for (c = 0; c < SDL_arraysize(cuts); c++) {
+          SDL_AudioSpec spec;
+          Uint8 *expected, *actual;
+          Uint32 expectedlen, actuallen;
+
+          SDL_SetHint(SDL_HINT_WAVE_DECODE_THREADS, "1");
+          if (SDL_LoadWAV_RW(SDL_RWFromConstMem(wave, (int)(wavesize - cuts[c])), 1, &spec, &expected, &expectedlen) == NULL) {
+              SDLTest_AssertCheck(SDL_FALSE, "Call to SDL_LoadWAV_RW() for encoding 0x%.4x failed: %s", encodings[e], SDL_GetError());
+              continue;
+          }
+
+          SDL_SetHint(SDL_HINT_WAVE_DECODE_THREADS, "4");
+          if (SDL_LoadWAV_RW(SDL_RWFromConstMem(wave, (int)(wavesize - cuts[c])), 1, &spec, &actual, &actuallen) == NULL) {
+              SDLTest_AssertCheck(SDL_FALSE, "Call to SDL_LoadWAV_RW() with threads for encoding 0x%.4x failed: %s", encodings[e], SDL_GetError());
+              SDL_FreeWAV(expected);
+              continue;
+          }
+          SDLTest_AssertPass("Call to SDL_LoadWAV_RW() with 4 threads for encoding 0x%.4x, %d bytes cut off", encodings[e], (int)cuts[c]);
+
+          SDLTest_AssertCheck(actuallen == expectedlen, "Validate decoded length, expected: %u, got: %u", expectedlen, actuallen);
+          SDLTest_AssertCheck(actuallen == expectedlen && SDL_memcmp(expected, actual, expectedlen) == 0, "Validate data decoded with threads matches data decoded without");
+
+          SDL_FreeWAV(expected);
+          SDL_FreeWAV(actual);
+      }
+  }
+
+  SDL_SetHint(SDL_HINT_WAVE_DECODE_THREADS, NULL);
+  SDL_free(wave);
+
+  return TEST_COMPLETED;
+}
+
+/**
+ * \brief Checks the statistics of a playing device and resets them.
+ *
+ * \sa SDL_GetAudioDeviceStats
+ * \sa SDL_ResetAudioDeviceStats
+ */
+int audio_deviceStats()
+{
+  SDL_AudioSpec desired, obtained;
+  SDL_AudioDeviceStats stats;
+  SDL_AudioDeviceID id;
+  Uint32 sum;
+  int i, result;
+
+  SDL_zero(desired);
+  desired.freq = 22050;
+  desired.format = AUDIO_S16SYS;
+  desired.channels = 2;
+  desired.samples = 512;
+  desired.callback = _audio_testCallback;
+
+  if (_audio_startDriver() != 0) {
+      return TEST_SKIPPED;
+  }
+
+  id = SDL_OpenAudioDevice(NULL, 0, &desired, &obtained, 0);
+  SDLTest_AssertPass("Call to SDL_OpenAudioDevice(NULL, 0, desired, obtained, 0)");
+  if (id == 0) {
+      SDLTest_Log("No playback device to get statistics of: %s", SDL_GetError());
+      SDL_AudioQuit();
+      return TEST_SKIPPED;
+  }
+
+  SDL_PauseAudioDevice(id, 0);
+  SDL_Delay(300);
+  SDL_PauseAudioDevice(id, 1);
+
+  result = SDL_GetAudioDeviceStats(id, &stats);
+  SDLTest_AssertCheck(result == 0, "Validate result from SDL_GetAudioDeviceStats, expected: 0, got: %d", result);
+  SDLTest_AssertCheck(stats.periods > 0, "Check periods were counted, got: %u", (unsigned int)stats.periods);
+  SDLTest_AssertCheck(stats.callback.count > 0, "Check callbacks were counted, got: %u", (unsigned int)stats.callback.count);
+  SDLTest_AssertCheck(stats.wait.count == stats.periods, "Check waits, expected: %u, got: %u", (unsigned int)stats.periods, (unsigned int)stats.wait.count);
+
+  sum = 0;
+  for (i = 0; i < SDL_AUDIO_STATS_BUCKETS; i++) {
+      sum += stats.callback.histogram[i];
+  }
+  SDLTest_AssertCheck(sum == stats.callback.count, "Validate callback histogram, expected: %u, got: %u", (unsigned int)stats.callback.count, (unsigned int)sum);
+  SDLTest_AssertCheck(stats.callback.total_us >= stats.callback.max_us, "Check callback total is at least the maximum");
+
+  result = SDL_ResetAudioDeviceStats(id);
+  SDLTest_AssertCheck(result == 0, "Validate result from SDL_ResetAudioDeviceStats, expected: 0, got: %d", result);
+  SDL_CloseAudioDevice(id);
+  SDLTest_AssertPass("Call to SDL_CloseAudioDevice()");
+
+  /* The device is closed now. */
+  result = SDL_GetAudioDeviceStats(id, &stats);
+  SDLTest_AssertCheck(result == -1, "Validate result from SDL_GetAudioDeviceStats on a closed device, expected: -1, got: %d", result);
+  result = SDL_ResetAudioDeviceStats(id);
+  SDLTest_AssertCheck(result == -1, "Validate result from SDL_ResetAudioDeviceStats on a closed device, expected: -1, got: %d", result);
+
+  SDL_AudioQuit();
+  SDLTest_AssertPass("Call to SDL_AudioQuit()");
+
+  return TEST_COMPLETED;
+}
+
+/* Writes a sequence that continues from call to call, so the files of the
+   disk driver can be checked buffer for buffer. */
+void SDLCALL _audio_diskTimingCallback(void *userdata, Uint8 *stream, int len)
+{
+  Uint8 *next = (Uint8 *)userdata;
+  int i;
+
+  for (i = 0; i < len; i++) {
+      stream[i] = (*next)++;
+  }
+  _audio_testCallbackCounter++;
+}
+
+/* Reads back and removes a file the disk driver wrote. */
+static Uint8 *
+_audio_diskLoadFile(const char *file, size_t *len)
+{
+  SDL_RWops *rw;
+  Uint8 *data = NULL;
+
+  *len = 0;
+  rw = SDL_RWFromFile(file, "rb");
+  if (rw != NULL) {
+      const Sint64 size = SDL_RWsize(rw);
+      data = (Uint8 *)SDL_malloc((size_t)size + 1);
+      if (data != NULL) {
+          *len = SDL_RWread(rw, data, 1, (size_t)size);
+      }
+      SDL_RWclose(rw);
+  }
+  SDLTest_AssertCheck(data != NULL, "Check '%s' was written", file);
+  remove(file);
+
+  return data;
+}
+
+/* Plays buffers to a file with the disk driver, in lock-step with
+   SDL_AdvanceAudioDevice() or as fast as possible, and returns its contents.
+   Queued audio is only played in lock-step, as that's the only way the
+   file doesn't depend on how fast the audio is queued. */
+static Uint8 *
+_audio_diskTimingRun(const char *timing, SDL_bool queued, const char *file, int buffers, size_t *len)
+{
+  SDL_AudioSpec desired, obtained;
+  SDL_AudioDeviceID id;
+  Uint8 next = 0;
+  int result, i;
+
+  *len = 0;
+  SDL_SetHint(SDL_HINT_AUDIO_DISK_TIMING, timing);
+
+  SDL_zero(desired);
+  desired.freq = 22050;
+  desired.format = AUDIO_S16SYS;
+  desired.channels = 1;
+  desired.samples = 256;
+  desired.callback = queued ? NULL : _audio_diskTimingCallback;
+  desired.userdata = queued ? NULL : &next;
+
+  id = SDL_OpenAudioDevice(file, 0, &desired, &obtained, 0);
+  SDLTest_AssertCheck(id != 0, "Validate result from SDL_OpenAudioDevice('%s') with '%s' timing", file, timing);
+  if (id == 0) {
+      SDL_SetHint(SDL_HINT_AUDIO_DISK_TIMING, "");
+      return NULL;
+  }
+
+  if (queued) {
+      Uint8 buffer[256 * 2];
+
+      for (i = 0; i < buffers; i++) {
+          _audio_diskTimingCallback(&next, buffer, sizeof(buffer));
+          result = SDL_QueueAudio(id, buffer, sizeof(buffer));
+          SDLTest_AssertCheck(result == 0, "Validate result from SDL_QueueAudio, expected: 0, got: %d", result);
+      }
+  }
+
+  _audio_testCallbackCounter = 0;
+  SDL_PauseAudioDevice(id, 0);
+  if (SDL_strcmp(timing, "manual") == 0) {
+      result = SDL_AdvanceAudioDevice(id, buffers);
+      SDLTest_AssertCheck(result == 0, "Validate result from SDL_AdvanceAudioDevice(%d), expected: 0, got: %d", buffers, result);
+  } else {
+      result = SDL_AdvanceAudioDevice(id, buffers);
+      SDLTest_AssertCheck(result == -1, "Validate result from SDL_AdvanceAudioDevice on its own clock, expected: -1, got: %d", result);
+
+      /* 2 seconds of audio would take at most a few milliseconds. */
+      for (i = 0; (i < 1000) && (_audio_testCallbackCounter < buffers); i++) {
+          SDL_Delay(1);
+      }
+      SDLTest_AssertCheck(i < 1000, "Check %d buffers were played before their time", buffers);
+  }
+  SDL_CloseAudioDevice(id);
+  SDL_SetHint(SDL_HINT_AUDIO_DISK_TIMING, "");
+
+  return _audio_diskLoadFile(file, len);
+}
+
+/**
+ * \brief Renders to files with the disk driver, faster than realtime.
+ *
+ * \sa SDL_AdvanceAudioDevice
+ * \sa SDL_HINT_AUDIO_DISK_TIMING
+ */
+int audio_diskTiming()
+{
+  const int buffers = 172;
+  const size_t buffer_len = 256 * 2;
+  Uint8 *manual, *fast, *queued;
+  size_t manual_len, fast_len, queued_len, i;
+  Uint32 start, elapsed;
+  int result;
+
+  /* Switch drivers, but keep the subsystem initialized. */
+  result = SDL_AudioInit("disk");
+  SDLTest_AssertPass("Call to SDL_AudioInit('disk')");
+  if (result != 0) {
+      SDLTest_Log("No disk audio driver: %s", SDL_GetError());
+      SDL_AudioInit(NULL);
+      return TEST_SKIPPED;
+  }
+
+  /* About 2 seconds of audio, played in a fraction of that. */
+  start = SDL_GetTicks();
+  manual = _audio_diskTimingRun("manual", SDL_FALSE, "testdiskaudio-manual.raw", buffers, &manual_len);
+  elapsed = SDL_GetTicks() - start;
+  SDLTest_AssertCheck(elapsed < 1000, "Check lock-step rendering ran faster than realtime, took %d ms", (int)elapsed);
+  fast = _audio_diskTimingRun("fast", SDL_FALSE, "testdiskaudio-fast.raw", buffers, &fast_len);
+  queued = _audio_diskTimingRun("manual", SDL_TRUE, "testdiskaudio-queued.raw", buffers, &queued_len);
+
+  /* Exactly what was asked for in lock-step, at least that much otherwise. */
+  SDLTest_AssertCheck(manual_len == buffers * buffer_len, "Validate lock-step file size, expected: %d, got: %d", (int)(buffers * buffer_len), (int)manual_len);
+  SDLTest_AssertCheck(fast_len >= buffers * buffer_len, "Validate fast file size, expected: >= %d, got: %d", (int)(buffers * buffer_len), (int)fast_len);
+  if (manual && fast && (manual_len == buffers * buffer_len) && (fast_len >= manual_len)) {
+      for (i = 0; i < manual_len; i++) {
+          if ((manual[i] != (Uint8)i) || (fast[i] != manual[i])) {
+              break;
+          }
+      }
+      SDLTest_AssertCheck(i == manual_len, "Validate files are the same, matched: %d of %d bytes", (int)i, (int)manual_len);
+  }
+
+  /* Queued audio in lock-step gives the same file as the callback. */
+  SDLTest_AssertCheck(queued_len == manual_len, "Validate queued file size, expected: %d, got: %d", (int)manual_len, (int)queued_len);
+  if (manual && queued && (queued_len == manual_len)) {
+      SDLTest_AssertCheck(SDL_memcmp(queued, manual, manual_len) == 0, "Validate queued file is the same as the lock-step file");
+  }
+
+  SDL_free(manual);
+  SDL_free(fast);
+  SDL_free(queued);
+
+  result = SDL_AudioInit(NULL);
+  SDLTest_AssertCheck(result == 0, "Validate result from SDL_AudioInit(NULL), expected: 0, got: %d", result);
+
+  return TEST_COMPLETED;
+}
+
+/* Writes a mono F32 sawtooth that continues from call to call. */
+void SDLCALL _audio_diskConversionCallback(void *userdata, Uint8 *stream, int len)
+{
+  Uint32 *next = (Uint32 *)userdata;
+  float *samples = (float *)stream;
+  int i;
+
+  for (i = 0; i < len / (int)sizeof(float); i++) {
+      samples[i] = (float)((int)((*next)++ % 97) - 48) / 64.0f;
+  }
+}
+
+/**
+ * \brief Checks a playback device that converts its callback's audio gives
+ *  the same output as SDL_AudioStreamPut/SDL_AudioStreamGet.
+ *
+ * \sa SDL_HINT_AUDIO_DISK_SPEC
+ * \sa SDL_NewAudioStream
+ */
+int audio_diskConversion()
+{
+  /* Format only, resampling, and resampling with more channels. */
+  const struct {
+      const char *spec;
+      int freq;
+      Uint8 channels;
+  } cases[] = {
+      { "S16LSB", 22050, 1 },
+      { "S16LSB,48000", 48000, 1 },
+      { "S16LSB,44100,2", 44100, 2 }
+  };
+  const char *file = "testdiskaudio-conversion.raw";
+  const int buffers = 50;
+  SDL_AudioSpec desired, obtained;
+  SDL_AudioDeviceID id;
+  SDL_AudioStream *stream;
+  Uint8 callback_buffer[256 * sizeof(float)];
+  Uint8 *played, *expected;
+  size_t played_len, expected_len;
+  Uint32 next;
+  int result, i;
+
+  /* Switch drivers, but keep the subsystem initialized. */
+  result = SDL_AudioInit("disk");
+  SDLTest_AssertPass("Call to SDL_AudioInit('disk')");
+  if (result != 0) {
+      SDLTest_Log("No disk audio driver: %s", SDL_GetError());
+      SDL_AudioInit(NULL);
+      return TEST_SKIPPED;
+  }
+
+  for (i = 0; i < SDL_arraysize(cases); i++) {
+      SDL_SetHint(SDL_HINT_AUDIO_DISK_TIMING, "manual");
+      SDL_SetHint(SDL_HINT_AUDIO_DISK_SPEC, cases[i].spec);
+
+      SDL_zero(desired);
+      desired.freq = 22050;
+      desired.format = AUDIO_F32SYS;
+      desired.channels = 1;
+      desired.samples = 256;
+      desired.callback = _audio_diskConversionCallback;
+      desired.userdata = &next;
+
+      next = 0;
+      id = SDL_OpenAudioDevice(file, 0, &desired, &obtained, 0);
+      SDLTest_AssertCheck(id != 0, "Validate result from SDL_OpenAudioDevice with '%s'", cases[i].spec);
+      SDL_SetHint(SDL_HINT_AUDIO_DISK_SPEC, "");
+      SDL_SetHint(SDL_HINT_AUDIO_DISK_TIMING, "");
+      if (id == 0) {
+          continue;
+      }
+
+      SDL_PauseAudioDevice(id, 0);
+      result = SDL_AdvanceAudioDevice(id, buffers);
+      SDLTest_AssertCheck(result == 0, "Validate result from SDL_AdvanceAudioDevice(%d), expected: 0, got: %d", buffers, result);
+      SDL_CloseAudioDevice(id);
+
+      played = _audio_diskLoadFile(file, &played_len);
+      expected_len = (size_t)buffers * 256 * 2 * cases[i].channels;
+      SDLTest_AssertCheck(played_len == expected_len, "Validate file size with '%s', expected: %d, got: %d", cases[i].spec, (int)expected_len, (int)played_len);
+
+      /* The same callbacks, converted by a stream of our own. */
+      stream = SDL_NewAudioStream(AUDIO_F32SYS, 1, 22050, AUDIO_S16LSB, cases[i].channels, cases[i].freq);
+      SDLTest_AssertCheck(stream != NULL, "Validate result from SDL_NewAudioStream");
+      expected = (Uint8 *)SDL_malloc(expected_len);
+      if (stream && expected) {
+          next = 0;
+          while (SDL_AudioStreamAvailable(stream) < (int)expected_len) {
+              _audio_diskConversionCallback(&next, callback_buffer, sizeof(callback_buffer));
+              if (SDL_AudioStreamPut(stream, callback_buffer, sizeof(callback_buffer)) < 0) {
+                  break;
+              }
+          }
+          result = SDL_AudioStreamGet(stream, expected, (int)expected_len);
+          SDLTest_AssertCheck(result == (int)expected_len, "Validate result from SDL_AudioStreamGet, expected: %d, got: %d", (int)expected_len, result);
+
+          if (played && (played_len == expected_len) && (result == (int)expected_len)) {
+              SDLTest_AssertCheck(SDL_memcmp(played, expected, expected_len) == 0, "Validate device output with '%s' is the same as SDL_AudioStreamGet", cases[i].spec);
+          }
+      }
+
+      SDL_FreeAudioStream(stream);
+      SDL_free(expected);
+      SDL_free(played);
+  }
+
+  result = SDL_AudioInit(NULL);
+  SDLTest_AssertCheck(result == 0, "Validate result from SDL_AudioInit(NULL), expected: 0, got: %d", result);
+
+  return TEST_COMPLETED;
+}
 
 /* ================= Test Case References ================== */
 
@@ -1022,11 +2161,49 @@ static const SDLTest_TestCaseReference audioTest14 =
 static const SDLTest_TestCaseReference audioTest15 =
         { (SDLTest_TestCaseFp)audio_pauseUnpauseAudio, "audio_pauseUnpauseAudio", "Pause and Unpause audio for various audio specs while testing callback.", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference audioTest16 =
+        { (SDLTest_TestCaseFp)audio_resampleQuality, "audio_resampleQuality", "Checks the resampler output against the expected signal.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest17 =
+        { (SDLTest_TestCaseFp)audio_resampleStreamQuality, "audio_resampleStreamQuality", "Resamples a stream with each quality level.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest18 =
+        { (SDLTest_TestCaseFp)audio_queueAudio, "audio_queueAudio", "Queues, counts and clears audio on a playback device.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest19 =
+        { (SDLTest_TestCaseFp)audio_mixerStreams, "audio_mixerStreams", "Mixes streams of different formats and gains with an audio mixer.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest20 =
+        { (SDLTest_TestCaseFp)audio_mixAudioFormatSIMD, "audio_mixAudioFormatSIMD", "Compares SDL_MixAudioFormat with and without SIMD for every format.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest21 =
+        { (SDLTest_TestCaseFp)audio_wavStream, "audio_wavStream", "Compares WAV streams with seeking against SDL_LoadWAV_RW.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest22 =
+        { (SDLTest_TestCaseFp)audio_wavDecodeThreads, "audio_wavDecodeThreads", "Compares ADPCM decoding with and without threads.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest23 =
+        { (SDLTest_TestCaseFp)audio_deviceStats, "audio_deviceStats", "Checks and resets the statistics of a playing device.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest24 =
+        { (SDLTest_TestCaseFp)audio_diskTiming, "audio_diskTiming", "Renders to files with the disk driver in lock-step, as fast as possible and from a queue.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest25 =
+        { (SDLTest_TestCaseFp)audio_clearQueuedAudio, "audio_clearQueuedAudio", "Clears a playback queue while the device is playing from it.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest26 =
+        { (SDLTest_TestCaseFp)audio_mixerStreamsSIMD, "audio_mixerStreamsSIMD", "Compares an audio mixer with and without SIMD.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest27 =
+        { (SDLTest_TestCaseFp)audio_diskConversion, "audio_diskConversion", "Compares a converting playback device with SDL_AudioStream.", TEST_ENABLED };
+
 /* Sequence of Audio test cases */
 static const SDLTest_TestCaseReference *audioTests[] =  {
     &audioTest1, &audioTest2, &audioTest3, &audioTest4, &audioTest5, &audioTest6,
     &audioTest7, &audioTest8, &audioTest9, &audioTest10, &audioTest11,
-    &audioTest12, &audioTest13, &audioTest14, &audioTest15, NULL
+    &audioTest12, &audioTest13, &audioTest14, &audioTest15, &audioTest16, &audioTest17,
+    &audioTest18, &audioTest19, &audioTest20, &audioTest21, &audioTest22, &audioTest23, &audioTest24,
+    &audioTest25, &audioTest26, &audioTest27, NULL
 };
 
 /* Audio test suite (global) */
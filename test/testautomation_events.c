@@ -175,6 +175,115 @@ events_addDelEventWatchWithUserdata(void *arg)
 }
 
 
+/**
+ * @brief Pushes several user events and drains them with one batched poll.
+ *
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_PollEvents
+ */
+int
+events_pushAndPollEventsBatch(void *arg)
+{
+   SDL_Event event;
+   SDL_Event events[8];
+   int result;
+   int i;
+
+   /* Start with an empty queue */
+   SDL_PumpEvents();
+   SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+
+   /* Push a few user events, with the code recording their order */
+   for (i = 0; i < 5; ++i) {
+      SDL_zero(event);
+      event.type = SDL_USEREVENT;
+      event.user.code = i;
+      SDL_PushEvent(&event);
+   }
+   SDLTest_AssertPass("Call to SDL_PushEvent()");
+
+   /* Drain part of the queue */
+   result = SDL_PollEvents(events, 3, SDL_FALSE);
+   SDLTest_AssertPass("Call to SDL_PollEvents(events, 3, SDL_FALSE)");
+   SDLTest_AssertCheck(result == 3, "Check result from SDL_PollEvents, expected: 3, got: %d", result);
+   for (i = 0; i < 3 && i < result; ++i) {
+      SDLTest_AssertCheck(events[i].type == SDL_USEREVENT && events[i].user.code == i,
+                          "Check event %d, expected user code: %d, got: %d", i, i, events[i].user.code);
+   }
+
+   /* Drain the rest, asking for more than is available */
+   result = SDL_PollEvents(events, SDL_arraysize(events), SDL_FALSE);
+   SDLTest_AssertPass("Call to SDL_PollEvents(events, 8, SDL_FALSE)");
+   SDLTest_AssertCheck(result == 2, "Check result from SDL_PollEvents, expected: 2, got: %d", result);
+   for (i = 0; i < 2 && i < result; ++i) {
+      SDLTest_AssertCheck(events[i].type == SDL_USEREVENT && events[i].user.code == i + 3,
+                          "Check event %d, expected user code: %d, got: %d", i, i + 3, events[i].user.code);
+   }
+
+   /* Invalid parameters */
+   result = SDL_PollEvents(NULL, 1, SDL_FALSE);
+   SDLTest_AssertPass("Call to SDL_PollEvents(NULL, 1, SDL_FALSE)");
+   SDLTest_AssertCheck(result == -1, "Check result from SDL_PollEvents, expected: -1, got: %d", result);
+   result = SDL_PollEvents(events, 0, SDL_TRUE);
+   SDLTest_AssertPass("Call to SDL_PollEvents(events, 0, SDL_TRUE)");
+   SDLTest_AssertCheck(result == 0, "Check result from SDL_PollEvents, expected: 0, got: %d", result);
+
+   return TEST_COMPLETED;
+}
+
+
+/**
+ * @brief Checks that consecutive mouse motion is merged when SDL_HINT_EVENT_COALESCE_MOTION is set.
+ *
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_GetNumCoalescedEvents
+ */
+int
+events_coalesceMotion(void *arg)
+{
+   SDL_Event event;
+   SDL_Event events[8];
+   int initial, result;
+   int i;
+
+   SDL_PumpEvents();
+   SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+   SDL_SetHint(SDL_HINT_EVENT_COALESCE_MOTION, "1");
+   SDLTest_AssertPass("Call to SDL_SetHint(SDL_HINT_EVENT_COALESCE_MOTION, \"1\")");
+   initial = SDL_GetNumCoalescedEvents();
+
+   /* Three moves of the same mouse, then a move of another mouse */
+   for (i = 0; i < 4; ++i) {
+      SDL_zero(event);
+      event.type = SDL_MOUSEMOTION;
+      event.motion.which = (i < 3) ? 1 : 2;
+      event.motion.x = 10 * (i + 1);
+      event.motion.y = 20 * (i + 1);
+      event.motion.xrel = 10;
+      event.motion.yrel = 20;
+      SDL_PushEvent(&event);
+   }
+   SDLTest_AssertPass("Call to SDL_PushEvent()");
+
+   result = SDL_GetNumCoalescedEvents() - initial;
+   SDLTest_AssertCheck(result == 2, "Check coalesced event count, expected: 2, got: %d", result);
+
+   result = SDL_PeepEvents(events, SDL_arraysize(events), SDL_GETEVENT, SDL_MOUSEMOTION, SDL_MOUSEMOTION);
+   SDLTest_AssertPass("Call to SDL_PeepEvents()");
+   SDLTest_AssertCheck(result == 2, "Check number of motion events, expected: 2, got: %d", result);
+   if (result == 2) {
+      SDLTest_AssertCheck(events[0].motion.x == 30 && events[0].motion.y == 60,
+                          "Check merged position, expected: 30,60, got: %d,%d", events[0].motion.x, events[0].motion.y);
+      SDLTest_AssertCheck(events[0].motion.xrel == 30 && events[0].motion.yrel == 60,
+                          "Check merged motion, expected: 30,60, got: %d,%d", events[0].motion.xrel, events[0].motion.yrel);
+      SDLTest_AssertCheck(events[1].motion.which == 2, "Check second event device, expected: 2, got: %d", (int)events[1].motion.which);
+   }
+
+   SDL_SetHint(SDL_HINT_EVENT_COALESCE_MOTION, "0");
+   SDLTest_AssertPass("Call to SDL_SetHint(SDL_HINT_EVENT_COALESCE_MOTION, \"0\")");
+
+   return TEST_COMPLETED;
+}
+
+
 /* ================= Test References ================== */
 
 /* Events test cases */
@@ -187,9 +296,15 @@ static const SDLTest_TestCaseReference eventsTest2 =
 static const SDLTest_TestCaseReference eventsTest3 =
         { (SDLTest_TestCaseFp)events_addDelEventWatchWithUserdata, "events_addDelEventWatchWithUserdata", "Adds and deletes an event watch function with userdata", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference eventsTest4 =
+        { (SDLTest_TestCaseFp)events_pushAndPollEventsBatch, "events_pushAndPollEventsBatch", "Pushes user events and polls them in a batch", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference eventsTest5 =
+        { (SDLTest_TestCaseFp)events_coalesceMotion, "events_coalesceMotion", "Merges consecutive mouse motion events", TEST_ENABLED };
+
 /* Sequence of Events test cases */
 static const SDLTest_TestCaseReference *eventsTests[] =  {
-    &eventsTest1, &eventsTest2, &eventsTest3, NULL
+    &eventsTest1, &eventsTest2, &eventsTest3, &eventsTest4, &eventsTest5, NULL
 };
 
 /* Events test suite (global) */
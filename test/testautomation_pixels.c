@@ -7,6 +7,25 @@
 #include "SDL.h"
 #include "SDL_test.h"
 
+/* Pitch of a tightly packed image, the Y plane pitch for planar YUV formats */
+static int
+_pixels_convertPitch(Uint32 format, int width)
+{
+  switch (format) {
+  case SDL_PIXELFORMAT_YV12:
+  case SDL_PIXELFORMAT_IYUV:
+  case SDL_PIXELFORMAT_NV12:
+  case SDL_PIXELFORMAT_NV21:
+    return width;
+  case SDL_PIXELFORMAT_YUY2:
+  case SDL_PIXELFORMAT_UYVY:
+  case SDL_PIXELFORMAT_YVYU:
+    return 4 * ((width + 1) / 2);
+  default:
+    return width * SDL_BYTESPERPIXEL(format);
+  }
+}
+
 /* Test case functions */
 
 /* Definition of all RGB formats used to test pixel conversions */
@@ -225,6 +244,101 @@ pixels_allocFreeFormat(void *arg)
   return TEST_COMPLETED;
 }
 
+/* Allocates and frees the RGB formats over and over, from several threads */
+static int SDLCALL
+_pixels_allocFormatThread(void *arg)
+{
+  SDL_PixelFormat *held = (SDL_PixelFormat *)arg;
+  int i, j, errors = 0;
+
+  for (i = 0; i < 1000; i++) {
+    for (j = 0; j < _numRGBPixelFormats; j++) {
+      SDL_PixelFormat *format;
+
+      if (SDL_ISPIXELFORMAT_INDEXED(_RGBPixelFormats[j])) {
+        continue;
+      }
+      format = SDL_AllocFormat(_RGBPixelFormats[j]);
+      if (format == NULL || format->format != _RGBPixelFormats[j]) {
+        ++errors;
+      }
+      if (format && _RGBPixelFormats[j] == held->format && format != held) {
+        ++errors;
+      }
+      SDL_FreeFormat(format);
+    }
+  }
+  return errors;
+}
+
+/**
+ * @brief Call to SDL_AllocFormat and SDL_FreeFormat from several threads
+ *
+ * @sa http://wiki.libsdl.org/SDL_AllocFormat
+ * @sa http://wiki.libsdl.org/SDL_FreeFormat
+ */
+int
+pixels_allocFormatThreads(void *arg)
+{
+  SDL_Thread *threads[4];
+  SDL_PixelFormat *held, *again, *paletted;
+  SDL_Palette *palette = NULL;
+  int i, errors, result;
+
+  held = SDL_AllocFormat(SDL_PIXELFORMAT_ARGB8888);
+  SDLTest_AssertPass("Call to SDL_AllocFormat()");
+  SDLTest_AssertCheck(held != NULL, "Verify result is not NULL");
+  if (held == NULL) {
+    return TEST_ABORTED;
+  }
+
+  again = SDL_AllocFormat(SDL_PIXELFORMAT_ARGB8888);
+  SDLTest_AssertCheck(again == held, "Verify the same RGB format is shared");
+  SDLTest_AssertCheck(held->refcount >= 2, "Verify refcount; expected: >= 2, got: %i", held->refcount);
+  SDL_FreeFormat(again);
+  SDLTest_AssertCheck(held->refcount >= 1, "Verify refcount after SDL_FreeFormat; expected: >= 1, got: %i", held->refcount);
+
+  /* The threads share a format with a palette too, which has to outlive
+     the references they drop */
+  paletted = SDL_AllocFormat(SDL_PIXELFORMAT_RGB565);
+  SDLTest_AssertCheck(paletted != NULL, "Verify result is not NULL");
+  if (paletted) {
+    palette = SDL_AllocPalette(256);
+    SDLTest_AssertPass("Call to SDL_AllocPalette()");
+  }
+  if (palette) {
+    result = SDL_SetPixelFormatPalette(paletted, palette);
+    SDLTest_AssertPass("Call to SDL_SetPixelFormatPalette() with a shared format");
+    SDLTest_AssertCheck(result == 0, "Verify result; expected: 0, got: %i", result);
+    SDLTest_AssertCheck(paletted->palette == palette, "Verify shared format has the palette");
+    SDL_FreePalette(palette);
+  }
+
+  for (i = 0; i < SDL_arraysize(threads); i++) {
+    threads[i] = SDL_CreateThread(_pixels_allocFormatThread, "AllocFormat", held);
+    SDLTest_AssertCheck(threads[i] != NULL, "Verify thread %i was created", i);
+  }
+  for (i = 0; i < SDL_arraysize(threads); i++) {
+    if (threads[i]) {
+      SDL_WaitThread(threads[i], &errors);
+      SDLTest_AssertCheck(errors == 0, "Verify thread %i results; expected: 0 errors, got: %i", i, errors);
+    }
+  }
+
+  SDLTest_AssertCheck(held->format == SDL_PIXELFORMAT_ARGB8888, "Verify held format is intact");
+  SDLTest_AssertCheck(held->BytesPerPixel == 4, "Verify held format BytesPerPixel; expected: 4, got: %u", held->BytesPerPixel);
+  if (palette) {
+    SDLTest_AssertCheck(paletted->palette == palette && palette->refcount == 1, "Verify shared format kept its palette");
+  }
+  if (paletted) {
+    SDL_FreeFormat(paletted);
+  }
+  SDL_FreeFormat(held);
+  SDLTest_AssertPass("Call to SDL_FreeFormat()");
+
+  return TEST_COMPLETED;
+}
+
 /**
  * @brief Call to SDL_GetPixelFormatName
  *
@@ -502,6 +616,300 @@ pixels_calcGammaRamp(void *arg)
   return TEST_COMPLETED;
 }
 
+/**
+ * @brief Check that SDL_ConvertPixels gives the same result with SDL_HINT_CONVERT_PIXELS_THREADS
+ *
+ * @sa http://wiki.libsdl.org/SDL_ConvertPixels
+ */
+int
+pixels_convertPixelsThreads(void *arg)
+{
+  /* Odd sizes, so the last band gets the leftover rows and columns */
+  const int width = 1023;
+  const int height = 771;
+  const size_t size = 4 * (width + 2) * (height + 2);
+  const Uint32 conversions[][2] = {
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB565 },
+    { SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_ABGR8888 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_YV12 },
+    { SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_NV12 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_YUY2 },
+    { SDL_PIXELFORMAT_YV12, SDL_PIXELFORMAT_ARGB8888 },
+    { SDL_PIXELFORMAT_NV12, SDL_PIXELFORMAT_RGB24 },
+    { SDL_PIXELFORMAT_YUY2, SDL_PIXELFORMAT_ARGB8888 },
+    { SDL_PIXELFORMAT_YUY2, SDL_PIXELFORMAT_YUY2 },
+    { SDL_PIXELFORMAT_YUY2, SDL_PIXELFORMAT_UYVY },
+    { SDL_PIXELFORMAT_IYUV, SDL_PIXELFORMAT_YVYU },
+    { SDL_PIXELFORMAT_UYVY, SDL_PIXELFORMAT_NV21 },
+  };
+  Uint8 *src, *serial, *threaded;
+  Uint32 seed = 1;
+  size_t i;
+  int j, result;
+
+  src = (Uint8 *)SDL_malloc(size);
+  serial = (Uint8 *)SDL_calloc(1, size);
+  threaded = (Uint8 *)SDL_calloc(1, size);
+  SDLTest_AssertCheck(src && serial && threaded, "Validate buffers were allocated");
+  if (!src || !serial || !threaded) {
+    SDL_free(src);
+    SDL_free(serial);
+    SDL_free(threaded);
+    return TEST_ABORTED;
+  }
+  for (i = 0; i < size; i++) {
+    seed = seed * 1103515245 + 12345;
+    src[i] = (Uint8)(seed >> 16);
+  }
+
+  for (j = 0; j < SDL_arraysize(conversions); j++) {
+    const Uint32 src_format = conversions[j][0];
+    const Uint32 dst_format = conversions[j][1];
+    const int src_pitch = _pixels_convertPitch(src_format, width);
+    const int dst_pitch = _pixels_convertPitch(dst_format, width);
+
+    SDL_SetHint(SDL_HINT_CONVERT_PIXELS_THREADS, "1");
+    result = SDL_ConvertPixels(width, height, src_format, src, src_pitch, dst_format, serial, dst_pitch);
+    SDLTest_AssertPass("Call to SDL_ConvertPixels(%s -> %s) on one thread",
+                       SDL_GetPixelFormatName(src_format), SDL_GetPixelFormatName(dst_format));
+    SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0, got: %i", result);
+
+    SDL_SetHint(SDL_HINT_CONVERT_PIXELS_THREADS, "4");
+    result = SDL_ConvertPixels(width, height, src_format, src, src_pitch, dst_format, threaded, dst_pitch);
+    SDLTest_AssertPass("Call to SDL_ConvertPixels(%s -> %s) on four threads",
+                       SDL_GetPixelFormatName(src_format), SDL_GetPixelFormatName(dst_format));
+    SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0, got: %i", result);
+
+    SDLTest_AssertCheck(SDL_memcmp(serial, threaded, size) == 0, "Verify threaded output matches serial output");
+  }
+
+  SDL_SetHint(SDL_HINT_CONVERT_PIXELS_THREADS, NULL);
+  SDL_free(src);
+  SDL_free(serial);
+  SDL_free(threaded);
+
+  return TEST_COMPLETED;
+}
+
+/**
+ * @brief Check that repeated SDL_ConvertPixels calls give the same result, while
+ *        more format pairs are used than SDL remembers blitters for
+ *
+ * @sa http://wiki.libsdl.org/SDL_ConvertPixels
+ */
+int
+pixels_convertPixelsRepeated(void *arg)
+{
+  const Uint32 formats[] = {
+    SDL_PIXELFORMAT_RGB332, SDL_PIXELFORMAT_RGB444, SDL_PIXELFORMAT_ARGB4444,
+    SDL_PIXELFORMAT_ARGB1555, SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_BGR565,
+    SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_BGR24, SDL_PIXELFORMAT_RGB888,
+    SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGRA8888,
+  };
+  const int width = 37;
+  const int height = 13;
+  const int pitch = width * 4;
+  Uint32 src[37 * 13];
+  Uint32 first[SDL_arraysize(formats)][37 * 13];
+  Uint32 converted[37 * 13];
+  Uint32 back[37 * 13];
+  int i, j, pass, result;
+
+  for (i = 0; i < width * height; i++) {
+    src[i] = SDLTest_RandomUint32();
+  }
+
+  for (pass = 0; pass < 3; pass++) {
+    for (j = 0; j < SDL_arraysize(formats); j++) {
+      SDL_memset(converted, 0, sizeof(converted));
+      result = SDL_ConvertPixels(width, height, SDL_PIXELFORMAT_ARGB8888, src, pitch, formats[j], converted, pitch);
+      SDLTest_AssertCheck(result == 0, "Verify result of converting to %s; expected: 0, got: %i", SDL_GetPixelFormatName(formats[j]), result);
+      result = SDL_ConvertPixels(width, height, formats[j], converted, pitch, SDL_PIXELFORMAT_ARGB8888, back, pitch);
+      SDLTest_AssertCheck(result == 0, "Verify result of converting from %s; expected: 0, got: %i", SDL_GetPixelFormatName(formats[j]), result);
+
+      if (pass == 0) {
+        SDL_memcpy(first[j], back, sizeof(back));
+      } else {
+        SDLTest_AssertCheck(SDL_memcmp(first[j], back, sizeof(back)) == 0,
+                            "Verify pass %i through %s matches the first pass", pass, SDL_GetPixelFormatName(formats[j]));
+      }
+    }
+  }
+  SDLTest_AssertPass("Call to SDL_ConvertPixels() with %i format pairs", (int) SDL_arraysize(formats) * 2);
+
+  return TEST_COMPLETED;
+}
+
+/**
+ * @brief Check that the SIMD YUV to RGB conversions match the C ones
+ *
+ * @sa http://wiki.libsdl.org/SDL_ConvertPixels
+ */
+int
+pixels_convertYUVToRGB(void *arg)
+{
+  /* Not a multiple of the SIMD block width, with an odd last line */
+  const int width = 104;
+  const int height = 7;
+  const size_t size = 4 * (width + 2) * (height + 2);
+  const Uint32 src_formats[] = {
+    SDL_PIXELFORMAT_YV12, SDL_PIXELFORMAT_IYUV, SDL_PIXELFORMAT_NV12, SDL_PIXELFORMAT_NV21,
+    SDL_PIXELFORMAT_YUY2, SDL_PIXELFORMAT_UYVY, SDL_PIXELFORMAT_YVYU,
+  };
+  const Uint32 dst_formats[] = {
+    SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_BGR565, SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_BGR24,
+    SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGBX8888, SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGRX8888,
+    SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGRA8888,
+  };
+  /* Compared with the C code, which is what's left with all CPU features disabled */
+  const char *disabled[] = { "", "avx2" };
+  Uint8 *src, *expected, *actual;
+  Uint32 seed = 1;
+  size_t i;
+  int j, k, d, result;
+
+  src = (Uint8 *)SDL_malloc(size);
+  expected = (Uint8 *)SDL_calloc(1, size);
+  actual = (Uint8 *)SDL_calloc(1, size);
+  SDLTest_AssertCheck(src && expected && actual, "Validate buffers were allocated");
+  if (!src || !expected || !actual) {
+    SDL_free(src);
+    SDL_free(expected);
+    SDL_free(actual);
+    return TEST_ABORTED;
+  }
+  /* Keep to values that the C code's clamping table and the 16 bit SIMD math both handle */
+  for (i = 0; i < size; i++) {
+    seed = seed * 1103515245 + 12345;
+    src[i] = (Uint8)(72 + (seed >> 16) % 113);
+  }
+
+  for (j = 0; j < SDL_arraysize(src_formats); j++) {
+    const int src_pitch = _pixels_convertPitch(src_formats[j], width);
+
+    for (k = 0; k < SDL_arraysize(dst_formats); k++) {
+      const int dst_pitch = _pixels_convertPitch(dst_formats[k], width);
+
+      SDL_memset(expected, 0, size);
+      SDL_SetHint(SDL_HINT_CPU_DISABLE_FEATURES, "all");
+      result = SDL_ConvertPixels(width, height, src_formats[j], src, src_pitch, dst_formats[k], expected, dst_pitch);
+      SDLTest_AssertCheck(result == 0, "Verify result of converting %s -> %s without SIMD; expected: 0, got: %i",
+                          SDL_GetPixelFormatName(src_formats[j]), SDL_GetPixelFormatName(dst_formats[k]), result);
+
+      for (d = 0; d < SDL_arraysize(disabled); d++) {
+        SDL_memset(actual, 0, size);
+        SDL_SetHint(SDL_HINT_CPU_DISABLE_FEATURES, disabled[d]);
+        result = SDL_ConvertPixels(width, height, src_formats[j], src, src_pitch, dst_formats[k], actual, dst_pitch);
+        SDLTest_AssertCheck(result == 0, "Verify result of converting %s -> %s with '%s' disabled; expected: 0, got: %i",
+                            SDL_GetPixelFormatName(src_formats[j]), SDL_GetPixelFormatName(dst_formats[k]), disabled[d], result);
+        SDLTest_AssertCheck(SDL_memcmp(expected, actual, size) == 0, "Verify %s -> %s with '%s' disabled matches the C code",
+                            SDL_GetPixelFormatName(src_formats[j]), SDL_GetPixelFormatName(dst_formats[k]), disabled[d]);
+      }
+    }
+  }
+  SDLTest_AssertPass("Call to SDL_ConvertPixels() with %i format pairs", (int) (SDL_arraysize(src_formats) * SDL_arraysize(dst_formats)));
+
+  SDL_SetHint(SDL_HINT_CPU_DISABLE_FEATURES, "");
+  SDL_free(src);
+  SDL_free(expected);
+  SDL_free(actual);
+
+  return TEST_COMPLETED;
+}
+
+/**
+ * @brief Check that RGB to YUV conversions match with and without SIMD, and
+ *        when the pixels are converted to ARGB8888 first
+ *
+ * @sa http://wiki.libsdl.org/SDL_ConvertPixels
+ */
+int
+pixels_convertRGBToYUV(void *arg)
+{
+  /* Not a multiple of the SIMD block width, with an odd last column and row */
+  const int width = 83;
+  const int height = 7;
+  const size_t size = 4 * (width + 2) * (height + 2);
+  const Uint32 src_formats[] = {
+    SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888,
+  };
+  const Uint32 dst_formats[] = {
+    SDL_PIXELFORMAT_YV12, SDL_PIXELFORMAT_IYUV, SDL_PIXELFORMAT_NV12, SDL_PIXELFORMAT_NV21,
+    SDL_PIXELFORMAT_YUY2, SDL_PIXELFORMAT_UYVY, SDL_PIXELFORMAT_YVYU,
+  };
+  const SDL_YUV_CONVERSION_MODE modes[] = {
+    SDL_YUV_CONVERSION_JPEG, SDL_YUV_CONVERSION_BT601, SDL_YUV_CONVERSION_BT709,
+  };
+  const char *disabled[] = { "", "avx2" };
+  const SDL_YUV_CONVERSION_MODE mode = SDL_GetYUVConversionMode();
+  Uint8 *src, *argb, *expected, *actual;
+  Uint32 seed = 1;
+  size_t i;
+  int j, k, m, d, result;
+
+  src = (Uint8 *)SDL_malloc(size);
+  argb = (Uint8 *)SDL_malloc(size);
+  expected = (Uint8 *)SDL_malloc(size);
+  actual = (Uint8 *)SDL_malloc(size);
+  SDLTest_AssertCheck(src && argb && expected && actual, "Validate buffers were allocated");
+  if (!src || !argb || !expected || !actual) {
+    SDL_free(src);
+    SDL_free(argb);
+    SDL_free(expected);
+    SDL_free(actual);
+    return TEST_ABORTED;
+  }
+  for (i = 0; i < size; i++) {
+    seed = seed * 1103515245 + 12345;
+    src[i] = (Uint8)(seed >> 16);
+  }
+
+  for (m = 0; m < SDL_arraysize(modes); m++) {
+    SDL_SetYUVConversionMode(modes[m]);
+    for (j = 0; j < SDL_arraysize(src_formats); j++) {
+      const int pitch = width * 4;
+
+      /* The C code, from pixels converted to ARGB8888 first */
+      SDL_SetHint(SDL_HINT_CPU_DISABLE_FEATURES, "all");
+      result = SDL_ConvertPixels(width, height, src_formats[j], src, pitch, SDL_PIXELFORMAT_ARGB8888, argb, pitch);
+      SDLTest_AssertCheck(result == 0, "Verify result of converting %s -> SDL_PIXELFORMAT_ARGB8888; expected: 0, got: %i",
+                          SDL_GetPixelFormatName(src_formats[j]), result);
+
+      for (k = 0; k < SDL_arraysize(dst_formats); k++) {
+        const int dst_pitch = _pixels_convertPitch(dst_formats[k], width);
+
+        SDL_memset(expected, 0, size);
+        SDL_SetHint(SDL_HINT_CPU_DISABLE_FEATURES, "all");
+        result = SDL_ConvertPixels(width, height, SDL_PIXELFORMAT_ARGB8888, argb, pitch, dst_formats[k], expected, dst_pitch);
+        SDLTest_AssertCheck(result == 0, "Verify result of converting SDL_PIXELFORMAT_ARGB8888 -> %s without SIMD; expected: 0, got: %i",
+                            SDL_GetPixelFormatName(dst_formats[k]), result);
+
+        for (d = 0; d < SDL_arraysize(disabled); d++) {
+          SDL_memset(actual, 0, size);
+          SDL_SetHint(SDL_HINT_CPU_DISABLE_FEATURES, disabled[d]);
+          result = SDL_ConvertPixels(width, height, src_formats[j], src, pitch, dst_formats[k], actual, dst_pitch);
+          SDLTest_AssertCheck(result == 0, "Verify result of converting %s -> %s with '%s' disabled; expected: 0, got: %i",
+                              SDL_GetPixelFormatName(src_formats[j]), SDL_GetPixelFormatName(dst_formats[k]), disabled[d], result);
+          SDLTest_AssertCheck(SDL_memcmp(expected, actual, size) == 0, "Verify %s -> %s in mode %i with '%s' disabled matches the C code",
+                              SDL_GetPixelFormatName(src_formats[j]), SDL_GetPixelFormatName(dst_formats[k]), (int) modes[m], disabled[d]);
+        }
+      }
+    }
+  }
+  SDLTest_AssertPass("Call to SDL_ConvertPixels() with %i format pairs in %i modes",
+                     (int) (SDL_arraysize(src_formats) * SDL_arraysize(dst_formats)), (int) SDL_arraysize(modes));
+
+  SDL_SetHint(SDL_HINT_CPU_DISABLE_FEATURES, "");
+  SDL_SetYUVConversionMode(mode);
+  SDL_free(src);
+  SDL_free(argb);
+  SDL_free(expected);
+  SDL_free(actual);
+
+  return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Pixels test cases */
@@ -517,9 +925,24 @@ static const SDLTest_TestCaseReference pixelsTest3 =
 static const SDLTest_TestCaseReference pixelsTest4 =
         { (SDLTest_TestCaseFp)pixels_getPixelFormatName, "pixels_getPixelFormatName", "Call to SDL_GetPixelFormatName", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference pixelsTest5 =
+        { (SDLTest_TestCaseFp)pixels_convertPixelsThreads, "pixels_convertPixelsThreads", "Call to SDL_ConvertPixels with SDL_HINT_CONVERT_PIXELS_THREADS", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference pixelsTest6 =
+        { (SDLTest_TestCaseFp)pixels_convertPixelsRepeated, "pixels_convertPixelsRepeated", "Repeated calls to SDL_ConvertPixels with many format pairs", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference pixelsTest7 =
+        { (SDLTest_TestCaseFp)pixels_allocFormatThreads, "pixels_allocFormatThreads", "Call to SDL_AllocFormat and SDL_FreeFormat from several threads", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference pixelsTest8 =
+        { (SDLTest_TestCaseFp)pixels_convertYUVToRGB, "pixels_convertYUVToRGB", "Call to SDL_ConvertPixels from YUV to RGB with and without SIMD", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference pixelsTest9 =
+        { (SDLTest_TestCaseFp)pixels_convertRGBToYUV, "pixels_convertRGBToYUV", "Call to SDL_ConvertPixels from RGB to YUV with and without SIMD", TEST_ENABLED };
+
 /* Sequence of Pixels test cases */
 static const SDLTest_TestCaseReference *pixelsTests[] =  {
-    &pixelsTest1, &pixelsTest2, &pixelsTest3, &pixelsTest4, NULL
+    &pixelsTest1, &pixelsTest2, &pixelsTest3, &pixelsTest4, &pixelsTest5, &pixelsTest6, &pixelsTest7, &pixelsTest8, &pixelsTest9, NULL
 };
 
 /* Pixels test suite (global) */
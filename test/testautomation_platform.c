@@ -197,6 +197,13 @@ int platform_testHasFunctions (void *arg)
    ret = SDL_HasAVX();
    SDLTest_AssertPass("SDL_HasAVX()");
 
+   /* Only SDL's own code paths leave out disabled features */
+   ret = SDL_HasSSE2();
+   SDL_SetHint(SDL_HINT_CPU_DISABLE_FEATURES, "all");
+   SDLTest_AssertPass("Call to SDL_SetHint(SDL_HINT_CPU_DISABLE_FEATURES, \"all\")");
+   SDLTest_AssertCheck(SDL_HasSSE2() == ret, "Check SDL_HasSSE2() ignores SDL_HINT_CPU_DISABLE_FEATURES");
+   SDL_SetHint(SDL_HINT_CPU_DISABLE_FEATURES, "");
+
    return TEST_COMPLETED;
 }
 
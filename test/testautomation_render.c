@@ -1062,6 +1062,284 @@ _clearScreen(void)
    return 0;
 }
 
+/**
+ * @brief Draws the same scene with a software renderer on a surface. Helper function.
+ */
+static SDL_Surface *
+_renderSoftwareScene(const char *threads)
+{
+   SDL_Surface *target, *face;
+   SDL_Renderer *swrenderer;
+   SDL_Texture *tface;
+   SDL_Rect rect;
+   SDL_Point points[64];
+   int i;
+
+   SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_THREADS, threads);
+   target = SDL_CreateRGBSurface(0, 320, 240, 32,
+                                 RENDER_COMPARE_RMASK, RENDER_COMPARE_GMASK,
+                                 RENDER_COMPARE_BMASK, RENDER_COMPARE_AMASK);
+   SDLTest_AssertCheck(target != NULL, "Verify result from SDL_CreateRGBSurface is not NULL");
+   if (target == NULL) {
+      return NULL;
+   }
+   swrenderer = SDL_CreateSoftwareRenderer(target);
+   SDLTest_AssertCheck(swrenderer != NULL, "Verify result from SDL_CreateSoftwareRenderer is not NULL");
+   face = SDLTest_ImageFace();
+   tface = (swrenderer && face) ? SDL_CreateTextureFromSurface(swrenderer, face) : NULL;
+   SDLTest_AssertCheck(tface != NULL, "Verify test face texture is not NULL");
+   SDL_FreeSurface(face);
+   if (tface == NULL) {
+      if (swrenderer) {
+         SDL_DestroyRenderer(swrenderer);
+      }
+      SDL_FreeSurface(target);
+      return NULL;
+   }
+
+   SDL_SetRenderDrawColor(swrenderer, 16, 32, 48, SDL_ALPHA_OPAQUE);
+   SDL_RenderClear(swrenderer);
+
+   /* Opaque and blended rectangles spanning several bands */
+   for (i = 0; i < 8; ++i) {
+      rect.x = i * 37;
+      rect.y = i * 23;
+      rect.w = 60;
+      rect.h = 90;
+      SDL_SetRenderDrawBlendMode(swrenderer, (i & 1) ? SDL_BLENDMODE_BLEND : SDL_BLENDMODE_NONE);
+      SDL_SetRenderDrawColor(swrenderer, (Uint8)(i * 30), 200, (Uint8)(255 - i * 30), 128);
+      SDL_RenderFillRect(swrenderer, &rect);
+   }
+
+   /* Points */
+   for (i = 0; i < SDL_arraysize(points); ++i) {
+      points[i].x = (i * 41) % 320;
+      points[i].y = (i * 17) % 240;
+   }
+   SDL_SetRenderDrawBlendMode(swrenderer, SDL_BLENDMODE_NONE);
+   SDL_SetRenderDrawColor(swrenderer, 255, 255, 0, SDL_ALPHA_OPAQUE);
+   SDL_RenderDrawPoints(swrenderer, points, SDL_arraysize(points));
+
+   /* Copies with color and alpha modulation, and a clip rectangle */
+   rect.x = 10;
+   rect.y = 10;
+   rect.w = 280;
+   rect.h = 200;
+   SDL_RenderSetClipRect(swrenderer, &rect);
+   SDL_SetTextureBlendMode(tface, SDL_BLENDMODE_BLEND);
+   for (i = 0; i < 12; ++i) {
+      rect.x = i * 25 - 20;
+      rect.y = i * 19 - 10;
+      SDL_QueryTexture(tface, NULL, NULL, &rect.w, &rect.h);
+      SDL_SetTextureColorMod(tface, 255, (Uint8)(255 - i * 20), (Uint8)(i * 20));
+      SDL_SetTextureAlphaMod(tface, (Uint8)(100 + i * 10));
+      if (i & 1) {
+         SDL_RenderCopyEx(swrenderer, tface, NULL, &rect, i * 30.0, NULL, (SDL_RendererFlip)(i & 3));
+      } else {
+         SDL_RenderCopy(swrenderer, tface, NULL, &rect);
+      }
+   }
+   SDL_RenderSetClipRect(swrenderer, NULL);
+   SDL_RenderFlush(swrenderer);
+
+   SDL_DestroyTexture(tface);
+   SDL_DestroyRenderer(swrenderer);
+   SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_THREADS, NULL);
+
+   return target;
+}
+
+/**
+ * @brief Tests that the threaded software renderer matches the single threaded one.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_CreateSoftwareRenderer
+ */
+int
+render_testSoftwareThreads(void *arg)
+{
+   SDL_Surface *reference, *threaded;
+   int ret;
+
+   reference = _renderSoftwareScene("0");
+   threaded = _renderSoftwareScene("4");
+   if (reference != NULL && threaded != NULL) {
+      ret = SDLTest_CompareSurfaces(threaded, reference, 0);
+      SDLTest_AssertCheck(ret == 0, "Validate result from SDLTest_CompareSurfaces, expected: 0, got: %i", ret);
+   }
+   SDL_FreeSurface(reference);
+   SDL_FreeSurface(threaded);
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Draws a rotated texture before and after changing its pixels. Helper function.
+ */
+static SDL_Surface *
+_renderRotatedTexture(Uint32 first, Uint32 second)
+{
+   SDL_Surface *target;
+   SDL_Renderer *swrenderer;
+   SDL_Texture *texture;
+   SDL_Rect rect;
+   Uint32 pixels[32 * 24];
+   int i, pass;
+
+   target = SDL_CreateRGBSurface(0, 160, 120, 32,
+                                 RENDER_COMPARE_RMASK, RENDER_COMPARE_GMASK,
+                                 RENDER_COMPARE_BMASK, RENDER_COMPARE_AMASK);
+   SDLTest_AssertCheck(target != NULL, "Verify result from SDL_CreateRGBSurface is not NULL");
+   if (target == NULL) {
+      return NULL;
+   }
+   swrenderer = SDL_CreateSoftwareRenderer(target);
+   SDLTest_AssertCheck(swrenderer != NULL, "Verify result from SDL_CreateSoftwareRenderer is not NULL");
+   texture = swrenderer ? SDL_CreateTexture(swrenderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, 32, 24) : NULL;
+   SDLTest_AssertCheck(texture != NULL, "Verify result from SDL_CreateTexture is not NULL");
+   if (texture == NULL) {
+      if (swrenderer) {
+         SDL_DestroyRenderer(swrenderer);
+      }
+      SDL_FreeSurface(target);
+      return NULL;
+   }
+
+   for (pass = 0; pass < 3; ++pass) {
+      /* The first two passes draw the same thing, the last one new pixels */
+      if (pass != 1) {
+         for (i = 0; i < SDL_arraysize(pixels); ++i) {
+            pixels[i] = (pass == 0) ? first : second;
+         }
+         SDL_UpdateTexture(texture, NULL, pixels, 32 * sizeof(Uint32));
+      }
+
+      SDL_SetRenderDrawColor(swrenderer, 0, 0, 0, SDL_ALPHA_OPAQUE);
+      SDL_RenderClear(swrenderer);
+      for (i = 0; i < 4; ++i) {
+         rect.x = 10 + i * 35;
+         rect.y = 20 + i * 15;
+         rect.w = 32 + i * 4;
+         rect.h = 24;
+         SDL_SetTextureBlendMode(texture, (i & 1) ? SDL_BLENDMODE_BLEND : SDL_BLENDMODE_NONE);
+         SDL_SetTextureAlphaMod(texture, (i & 2) ? 128 : 255);
+         SDL_RenderCopyEx(swrenderer, texture, NULL, &rect, 30.0 * (i + 1), NULL, SDL_FLIP_NONE);
+      }
+      SDL_RenderFlush(swrenderer);
+   }
+
+   SDL_DestroyTexture(texture);
+   SDL_DestroyRenderer(swrenderer);
+
+   return target;
+}
+
+/**
+ * @brief Tests that rotated copies follow changes to the texture pixels.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderCopyEx
+ */
+int
+render_testCopyExUpdate(void *arg)
+{
+   SDL_Surface *updated, *reference;
+   int ret;
+
+   updated = _renderRotatedTexture(0xFF2040C0, 0x80E0A010);
+   reference = _renderRotatedTexture(0x80E0A010, 0x80E0A010);
+   if (updated != NULL && reference != NULL) {
+      ret = SDLTest_CompareSurfaces(updated, reference, 0);
+      SDLTest_AssertCheck(ret == 0, "Validate result from SDLTest_CompareSurfaces, expected: 0, got: %i", ret);
+   }
+   SDL_FreeSurface(updated);
+   SDL_FreeSurface(reference);
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Draws rotated copies with both scale modes, with some CPU features disabled. Helper function.
+ */
+static SDL_Surface *
+_renderRotations(const char *disabled)
+{
+   SDL_Surface *target, *face;
+   SDL_Renderer *swrenderer;
+   SDL_Texture *tface;
+   SDL_Rect rect;
+   int i;
+
+   SDL_SetHint(SDL_HINT_CPU_DISABLE_FEATURES, disabled);
+   target = SDL_CreateRGBSurface(0, 320, 240, 32,
+                                 RENDER_COMPARE_RMASK, RENDER_COMPARE_GMASK,
+                                 RENDER_COMPARE_BMASK, RENDER_COMPARE_AMASK);
+   SDLTest_AssertCheck(target != NULL, "Verify result from SDL_CreateRGBSurface is not NULL");
+   if (target == NULL) {
+      return NULL;
+   }
+   swrenderer = SDL_CreateSoftwareRenderer(target);
+   SDLTest_AssertCheck(swrenderer != NULL, "Verify result from SDL_CreateSoftwareRenderer is not NULL");
+   face = SDLTest_ImageFace();
+   tface = (swrenderer && face) ? SDL_CreateTextureFromSurface(swrenderer, face) : NULL;
+   SDLTest_AssertCheck(tface != NULL, "Verify test face texture is not NULL");
+   SDL_FreeSurface(face);
+   if (tface == NULL) {
+      if (swrenderer) {
+         SDL_DestroyRenderer(swrenderer);
+      }
+      SDL_FreeSurface(target);
+      SDL_SetHint(SDL_HINT_CPU_DISABLE_FEATURES, "");
+      return NULL;
+   }
+
+   SDL_SetRenderDrawColor(swrenderer, 0, 0, 0, SDL_ALPHA_OPAQUE);
+   SDL_RenderClear(swrenderer);
+   SDL_SetTextureBlendMode(tface, SDL_BLENDMODE_BLEND);
+   for (i = 0; i < 16; ++i) {
+      rect.x = (i % 4) * 80;
+      rect.y = (i / 4) * 60;
+      rect.w = 40 + i * 3;
+      rect.h = 30 + i;
+      SDL_SetTextureScaleMode(tface, (i & 1) ? SDL_ScaleModeLinear : SDL_ScaleModeNearest);
+      SDL_RenderCopyEx(swrenderer, tface, NULL, &rect, 13.0 + i * 23.7, NULL, (SDL_RendererFlip)((i >> 1) & 3));
+   }
+   SDL_RenderFlush(swrenderer);
+
+   SDL_DestroyTexture(tface);
+   SDL_DestroyRenderer(swrenderer);
+   SDL_SetHint(SDL_HINT_CPU_DISABLE_FEATURES, "");
+
+   return target;
+}
+
+/**
+ * @brief Tests that the SIMD code paths for rotated copies match the C code.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderCopyEx
+ */
+int
+render_testCopyExSIMD(void *arg)
+{
+   const char *disabled[] = { "avx2", "" };
+   SDL_Surface *reference, *result;
+   int i, ret;
+
+   reference = _renderRotations("all");
+   for (i = 0; reference != NULL && i < SDL_arraysize(disabled); ++i) {
+      result = _renderRotations(disabled[i]);
+      if (result != NULL) {
+         ret = SDLTest_CompareSurfaces(result, reference, 0);
+         SDLTest_AssertCheck(ret == 0, "Validate result from SDLTest_CompareSurfaces with '%s' disabled, expected: 0, got: %i", disabled[i], ret);
+      }
+      SDL_FreeSurface(result);
+   }
+   SDL_FreeSurface(reference);
+
+   return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Render test cases */
@@ -1089,9 +1367,18 @@ static const SDLTest_TestCaseReference renderTest6 =
 static const SDLTest_TestCaseReference renderTest7 =
         {  (SDLTest_TestCaseFp)render_testBlitBlend, "render_testBlitBlend", "Tests blitting with blending", TEST_DISABLED };
 
+static const SDLTest_TestCaseReference renderTest8 =
+        { (SDLTest_TestCaseFp)render_testSoftwareThreads, "render_testSoftwareThreads", "Tests the threaded software renderer against the single threaded one", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference renderTest9 =
+        { (SDLTest_TestCaseFp)render_testCopyExUpdate, "render_testCopyExUpdate", "Tests rotated copies of a texture after updating it", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference renderTest10 =
+        { (SDLTest_TestCaseFp)render_testCopyExSIMD, "render_testCopyExSIMD", "Tests rotated copies with and without SIMD", TEST_ENABLED };
+
 /* Sequence of Render test cases */
 static const SDLTest_TestCaseReference *renderTests[] =  {
-    &renderTest1, &renderTest2, &renderTest3, &renderTest4, &renderTest5, &renderTest6, &renderTest7, NULL
+    &renderTest1, &renderTest2, &renderTest3, &renderTest4, &renderTest5, &renderTest6, &renderTest7, &renderTest8, &renderTest9, &renderTest10, NULL
 };
 
 /* Render test suite (global) */
@@ -595,6 +595,347 @@ surface_testBlitBlendLoop(void *arg) {
 
 }
 
+/* Fills a surface with random pixels */
+static void
+_fillRandomPixels(SDL_Surface *surface)
+{
+   int x, y;
+
+   for (y = 0; y < surface->h; y++) {
+      Uint8 *row = (Uint8 *)surface->pixels + y * surface->pitch;
+      for (x = 0; x < surface->w * surface->format->BytesPerPixel; x++) {
+         row[x] = (Uint8)SDLTest_RandomUint8();
+      }
+   }
+}
+
+/* Returns the largest difference between color components of two 32-bit surfaces */
+static int
+_maxComponentDifference(SDL_Surface *a, SDL_Surface *b)
+{
+   int x, y, maxdiff = 0;
+
+   for (y = 0; y < a->h; y++) {
+      const Uint8 *pa = (const Uint8 *)a->pixels + y * a->pitch;
+      const Uint8 *pb = (const Uint8 *)b->pixels + y * b->pitch;
+      for (x = 0; x < a->w * 4; x++) {
+         maxdiff = SDL_max(maxdiff, SDL_abs(pa[x] - pb[x]));
+      }
+   }
+   return maxdiff;
+}
+
+/**
+ * @brief Tests bilinear stretching of 32 and 16-bit surfaces.
+ *
+ * Every SIMD path must give the same result, and the 16-bit scaler must keep
+ * copies exact and interpolate between the source colors.
+ */
+int
+surface_testSoftStretchLinear(void *arg)
+{
+   static const struct { int w, h; } sizes[] = { { 150, 97 }, { 31, 20 }, { 67, 43 }, { 5, 200 } };
+   SDL_Surface *src, *dst, *ref;
+   Uint16 *pixels;
+   int i, x, ret, diff;
+
+   /* 32-bit: SIMD paths against each other, and against the scalar code */
+   src = SDL_CreateRGBSurfaceWithFormat(0, 67, 43, 32, SDL_PIXELFORMAT_ARGB8888);
+   SDLTest_AssertCheck(src != NULL, "Verify source surface is not NULL");
+   if (src == NULL) {
+      return TEST_ABORTED;
+   }
+   _fillRandomPixels(src);
+   for (i = 0; i < SDL_arraysize(sizes); i++) {
+      dst = SDL_CreateRGBSurfaceWithFormat(0, sizes[i].w, sizes[i].h, 32, SDL_PIXELFORMAT_ARGB8888);
+      ref = SDL_CreateRGBSurfaceWithFormat(0, sizes[i].w, sizes[i].h, 32, SDL_PIXELFORMAT_ARGB8888);
+      SDLTest_AssertCheck(dst != NULL && ref != NULL, "Verify destination surfaces are not NULL");
+      if (dst == NULL || ref == NULL) {
+         SDL_FreeSurface(dst);
+         SDL_FreeSurface(ref);
+         break;
+      }
+
+      SDL_SetHint(SDL_HINT_CPU_DISABLE_FEATURES, "avx2");
+      ret = SDL_SoftStretchLinear(src, NULL, ref, NULL);
+      SDLTest_AssertCheck(ret == 0, "Verify result from SDL_SoftStretchLinear without AVX2, expected: 0, got: %i", ret);
+
+      SDL_SetHint(SDL_HINT_CPU_DISABLE_FEATURES, "");
+      ret = SDL_SoftStretchLinear(src, NULL, dst, NULL);
+      SDLTest_AssertCheck(ret == 0, "Verify result from SDL_SoftStretchLinear, expected: 0, got: %i", ret);
+      ret = SDLTest_CompareSurfaces(dst, ref, 0);
+      SDLTest_AssertCheck(ret == 0, "Validate %dx%d result against the result without AVX2, expected: 0, got: %i", sizes[i].w, sizes[i].h, ret);
+
+      SDL_SetHint(SDL_HINT_CPU_DISABLE_FEATURES, "all");
+      ret = SDL_SoftStretchLinear(src, NULL, ref, NULL);
+      SDLTest_AssertCheck(ret == 0, "Verify result from SDL_SoftStretchLinear without SIMD, expected: 0, got: %i", ret);
+      diff = _maxComponentDifference(dst, ref);
+      SDLTest_AssertCheck(diff <= 1, "Validate %dx%d result against the scalar code, expected difference <= 1, got: %i", sizes[i].w, sizes[i].h, diff);
+      SDL_SetHint(SDL_HINT_CPU_DISABLE_FEATURES, "");
+
+      SDL_FreeSurface(dst);
+      SDL_FreeSurface(ref);
+   }
+   SDL_FreeSurface(src);
+
+   /* 16-bit: a copy at the same size is exact */
+   src = SDL_CreateRGBSurfaceWithFormat(0, 67, 43, 16, SDL_PIXELFORMAT_RGB565);
+   dst = SDL_CreateRGBSurfaceWithFormat(0, 67, 43, 16, SDL_PIXELFORMAT_RGB565);
+   SDLTest_AssertCheck(src != NULL && dst != NULL, "Verify 16-bit surfaces are not NULL");
+   if (src == NULL || dst == NULL) {
+      SDL_FreeSurface(src);
+      SDL_FreeSurface(dst);
+      return TEST_ABORTED;
+   }
+   _fillRandomPixels(src);
+   ret = SDL_SoftStretchLinear(src, NULL, dst, NULL);
+   SDLTest_AssertCheck(ret == 0, "Verify result from SDL_SoftStretchLinear on RGB565, expected: 0, got: %i", ret);
+   ret = SDLTest_CompareSurfaces(dst, src, 0);
+   SDLTest_AssertCheck(ret == 0, "Validate RGB565 copy, expected: 0, got: %i", ret);
+   SDL_FreeSurface(dst);
+
+   /* 16-bit: SIMD and scalar code give the same result */
+   for (i = 0; i < SDL_arraysize(sizes); i++) {
+      dst = SDL_CreateRGBSurfaceWithFormat(0, sizes[i].w, sizes[i].h, 16, SDL_PIXELFORMAT_RGB565);
+      ref = SDL_CreateRGBSurfaceWithFormat(0, sizes[i].w, sizes[i].h, 16, SDL_PIXELFORMAT_RGB565);
+      SDLTest_AssertCheck(dst != NULL && ref != NULL, "Verify destination surfaces are not NULL");
+      if (dst == NULL || ref == NULL) {
+         SDL_FreeSurface(dst);
+         SDL_FreeSurface(ref);
+         break;
+      }
+
+      SDL_SetHint(SDL_HINT_CPU_DISABLE_FEATURES, "all");
+      ret = SDL_SoftStretchLinear(src, NULL, ref, NULL);
+      SDLTest_AssertCheck(ret == 0, "Verify result from SDL_SoftStretchLinear on RGB565 without SIMD, expected: 0, got: %i", ret);
+      SDL_SetHint(SDL_HINT_CPU_DISABLE_FEATURES, "");
+      ret = SDL_SoftStretchLinear(src, NULL, dst, NULL);
+      SDLTest_AssertCheck(ret == 0, "Verify result from SDL_SoftStretchLinear on RGB565, expected: 0, got: %i", ret);
+      ret = SDL_memcmp(dst->pixels, ref->pixels, dst->h * dst->pitch);
+      SDLTest_AssertCheck(ret == 0, "Validate %dx%d RGB565 result against the scalar code, expected: 0, got: %i", sizes[i].w, sizes[i].h, ret);
+
+      SDL_FreeSurface(dst);
+      SDL_FreeSurface(ref);
+   }
+   SDL_FreeSurface(src);
+
+   /* 16-bit: stretching black to white gives a gradient with no overflow between channels */
+   src = SDL_CreateRGBSurfaceWithFormat(0, 2, 1, 16, SDL_PIXELFORMAT_ARGB1555);
+   dst = SDL_CreateRGBSurfaceWithFormat(0, 16, 1, 16, SDL_PIXELFORMAT_ARGB1555);
+   SDLTest_AssertCheck(src != NULL && dst != NULL, "Verify 16-bit surfaces are not NULL");
+   if (src == NULL || dst == NULL) {
+      SDL_FreeSurface(src);
+      SDL_FreeSurface(dst);
+      return TEST_ABORTED;
+   }
+   pixels = (Uint16 *)src->pixels;
+   pixels[0] = 0x8000;
+   pixels[1] = 0xFFFF;
+   ret = SDL_SoftStretchLinear(src, NULL, dst, NULL);
+   SDLTest_AssertCheck(ret == 0, "Verify result from SDL_SoftStretchLinear on ARGB1555, expected: 0, got: %i", ret);
+   pixels = (Uint16 *)dst->pixels;
+   SDLTest_AssertCheck(pixels[0] == 0x8000 && pixels[dst->w - 1] == 0xFFFF,
+                       "Validate ARGB1555 gradient ends, expected: 0x8000 and 0xffff, got: 0x%.4x and 0x%.4x", pixels[0], pixels[dst->w - 1]);
+   for (x = 1; x < dst->w; x++) {
+      const Uint16 p0 = pixels[x - 1], p1 = pixels[x];
+      const int gray = p1 & 0x1F;
+      if ((p1 & 0x8000) == 0 || ((p1 >> 5) & 0x1F) != gray || ((p1 >> 10) & 0x1F) != gray || gray < (p0 & 0x1F)) {
+         SDLTest_AssertCheck(SDL_FALSE, "Validate ARGB1555 gradient at %d, got: 0x%.4x after 0x%.4x", x, p1, p0);
+         break;
+      }
+   }
+   SDL_FreeSurface(src);
+   SDL_FreeSurface(dst);
+
+   return TEST_COMPLETED;
+}
+
+/* Blits src onto a copy of dst with the given CPU features disabled, stretching it if scaled is set */
+static SDL_Surface *
+_blitWithoutFeatures(SDL_Surface *src, SDL_Surface *dst, const char *features, SDL_bool scaled)
+{
+   SDL_Surface *result = SDL_ConvertSurface(dst, dst->format, 0);
+   int ret;
+
+   if (result == NULL) {
+      return NULL;
+   }
+   SDL_SetHint(SDL_HINT_CPU_DISABLE_FEATURES, features);
+   if (scaled) {
+      ret = SDL_BlitScaled(src, NULL, result, NULL);
+   } else {
+      ret = SDL_BlitSurface(src, NULL, result, NULL);
+   }
+   SDL_SetHint(SDL_HINT_CPU_DISABLE_FEATURES, "");
+   SDLTest_AssertCheck(ret == 0, "Verify result from SDL_BlitSurface with \"%s\" disabled, expected: 0, got: %i", features, ret);
+   return result;
+}
+
+/**
+ * @brief Tests the SIMD alpha blitters against each other and against the C blitters.
+ *
+ * The 565 blitters must match the C code exactly. The RGB blitters round like
+ * the MMX code, which is off by up to 2 from the C code with pixel alpha and
+ * by 1 with surface alpha.
+ */
+int
+surface_testBlitAlphaSIMD(void *arg)
+{
+   static const struct {
+      Uint32 src_format;
+      Uint32 dst_format;
+      SDL_bool surface_alpha;
+      int tolerance;
+   } cases[] = {
+      { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, SDL_FALSE, 2 },
+      { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ABGR8888, SDL_FALSE, 2 },
+      { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, SDL_TRUE, 1 },
+      { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB565, SDL_FALSE, 0 },
+      { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR565, SDL_FALSE, 0 },
+      { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB565, SDL_TRUE, 0 },
+      { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB565, SDL_TRUE, 0 },
+      { SDL_PIXELFORMAT_RGBX8888, SDL_PIXELFORMAT_BGR565, SDL_TRUE, 0 },
+   };
+   SDL_Surface *src, *dst, *simd, *sse2, *ref;
+   int i, x, ret, diff;
+
+   for (i = 0; i < SDL_arraysize(cases); i++) {
+      const char *src_name = SDL_GetPixelFormatName(cases[i].src_format);
+      const char *dst_name = SDL_GetPixelFormatName(cases[i].dst_format);
+
+      /* Odd sizes, so the rows end with pixels that don't fill a register */
+      src = SDL_CreateRGBSurfaceWithFormat(0, 67, 43, 32, cases[i].src_format);
+      dst = SDL_CreateRGBSurfaceWithFormat(0, 67, 43, 32, cases[i].dst_format);
+      SDLTest_AssertCheck(src != NULL && dst != NULL, "Verify %s and %s surfaces are not NULL", src_name, dst_name);
+      if (src == NULL || dst == NULL) {
+         SDL_FreeSurface(src);
+         SDL_FreeSurface(dst);
+         return TEST_ABORTED;
+      }
+      _fillRandomPixels(src);
+      _fillRandomPixels(dst);
+      if (cases[i].surface_alpha) {
+         SDL_SetSurfaceAlphaMod(src, 0x9d);
+      } else {
+         /* Fully transparent and opaque runs take their own paths */
+         Uint32 *pixels = (Uint32 *)src->pixels;
+         for (x = 0; x < src->w; x++) {
+            pixels[x] &= ~src->format->Amask;
+            pixels[src->pitch / 4 + x] |= src->format->Amask;
+         }
+      }
+      SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND);
+
+      /* All the results are kept, so each blit builds its own blit map */
+      simd = _blitWithoutFeatures(src, dst, "", SDL_FALSE);
+      sse2 = _blitWithoutFeatures(src, dst, "avx2", SDL_FALSE);
+      ref = _blitWithoutFeatures(src, dst, "all", SDL_FALSE);
+      if (simd != NULL && sse2 != NULL && ref != NULL) {
+         ret = SDLTest_CompareSurfaces(simd, sse2, 0);
+         SDLTest_AssertCheck(ret == 0, "Validate %s to %s blend against the result without AVX2, expected: 0, got: %i", src_name, dst_name, ret);
+         if (SDL_BYTESPERPIXEL(cases[i].dst_format) == 2) {
+            diff = SDL_memcmp(simd->pixels, ref->pixels, simd->h * simd->pitch);
+         } else {
+            diff = _maxComponentDifference(simd, ref);
+         }
+         SDLTest_AssertCheck(diff <= cases[i].tolerance, "Validate %s to %s blend against the C code, expected difference <= %i, got: %i",
+                             src_name, dst_name, cases[i].tolerance, diff);
+      }
+
+      SDL_FreeSurface(ref);
+      SDL_FreeSurface(sse2);
+      SDL_FreeSurface(simd);
+      SDL_FreeSurface(dst);
+      SDL_FreeSurface(src);
+   }
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests the SIMD versions of the generated blitters against the C versions.
+ *
+ * All the modulate and blend combinations between the 8888 formats must give
+ * exactly the same result.
+ */
+int
+surface_testBlitAutoSIMD(void *arg)
+{
+   static const Uint32 src_formats[] = {
+      SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888,
+      SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGRA8888
+   };
+   static const Uint32 dst_formats[] = {
+      SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888
+   };
+   static const struct {
+      SDL_BlendMode mode;
+      SDL_bool color_mod;
+      Uint8 alpha_mod;
+      SDL_bool scaled;
+   } cases[] = {
+      { SDL_BLENDMODE_NONE, SDL_TRUE, 0xA0, SDL_FALSE },
+      { SDL_BLENDMODE_BLEND, SDL_TRUE, 0xA0, SDL_FALSE },
+      { SDL_BLENDMODE_ADD, SDL_FALSE, 0xFF, SDL_FALSE },
+      { SDL_BLENDMODE_ADD, SDL_TRUE, 0x60, SDL_FALSE },
+      { SDL_BLENDMODE_MOD, SDL_TRUE, 0xFF, SDL_FALSE },
+      { SDL_BLENDMODE_MUL, SDL_FALSE, 0xC8, SDL_FALSE },
+      { SDL_BLENDMODE_NONE, SDL_FALSE, 0x80, SDL_TRUE },
+      { SDL_BLENDMODE_BLEND, SDL_TRUE, 0xFF, SDL_TRUE },
+      { SDL_BLENDMODE_MUL, SDL_TRUE, 0x40, SDL_TRUE },
+   };
+   SDL_Surface *src, *dst, *simd, *sse41, *ref;
+   int i, j, k, ret;
+
+   for (i = 0; i < SDL_arraysize(src_formats); i++) {
+      for (j = 0; j < SDL_arraysize(dst_formats); j++) {
+         const char *src_name = SDL_GetPixelFormatName(src_formats[i]);
+         const char *dst_name = SDL_GetPixelFormatName(dst_formats[j]);
+
+         /* Odd sizes, so the rows end with pixels that don't fill a register */
+         src = SDL_CreateRGBSurfaceWithFormat(0, 67, 43, 32, src_formats[i]);
+         dst = SDL_CreateRGBSurfaceWithFormat(0, 101, 60, 32, dst_formats[j]);
+         SDLTest_AssertCheck(src != NULL && dst != NULL, "Verify %s and %s surfaces are not NULL", src_name, dst_name);
+         if (src == NULL || dst == NULL) {
+            SDL_FreeSurface(src);
+            SDL_FreeSurface(dst);
+            return TEST_ABORTED;
+         }
+         _fillRandomPixels(src);
+         _fillRandomPixels(dst);
+
+         for (k = 0; k < SDL_arraysize(cases); k++) {
+            SDL_SetSurfaceBlendMode(src, cases[k].mode);
+            if (cases[k].color_mod) {
+               SDL_SetSurfaceColorMod(src, 0x80, 0xC0, 0x33);
+            } else {
+               SDL_SetSurfaceColorMod(src, 0xFF, 0xFF, 0xFF);
+            }
+            SDL_SetSurfaceAlphaMod(src, cases[k].alpha_mod);
+
+            /* All the results are kept, so each blit builds its own blit map */
+            simd = _blitWithoutFeatures(src, dst, "", cases[k].scaled);
+            sse41 = _blitWithoutFeatures(src, dst, "avx2", cases[k].scaled);
+            ref = _blitWithoutFeatures(src, dst, "all", cases[k].scaled);
+            if (simd != NULL && sse41 != NULL && ref != NULL) {
+               ret = SDLTest_CompareSurfaces(sse41, ref, 0);
+               SDLTest_AssertCheck(ret == 0, "Validate %s to %s case %d without AVX2 against the C code, expected: 0, got: %i", src_name, dst_name, k, ret);
+               ret = SDLTest_CompareSurfaces(simd, ref, 0);
+               SDLTest_AssertCheck(ret == 0, "Validate %s to %s case %d against the C code, expected: 0, got: %i", src_name, dst_name, k, ret);
+            }
+            SDL_FreeSurface(ref);
+            SDL_FreeSurface(sse41);
+            SDL_FreeSurface(simd);
+         }
+
+         SDL_FreeSurface(dst);
+         SDL_FreeSurface(src);
+      }
+   }
+
+   return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Surface test cases */
@@ -637,11 +978,21 @@ static const SDLTest_TestCaseReference surfaceTest11 =
 static const SDLTest_TestCaseReference surfaceTest12 =
         { (SDLTest_TestCaseFp)surface_testBlitBlendMod, "surface_testBlitBlendMod", "Tests blitting routines with mod blending mode.", TEST_ENABLED};
 
+static const SDLTest_TestCaseReference surfaceTest13 =
+        { (SDLTest_TestCaseFp)surface_testSoftStretchLinear, "surface_testSoftStretchLinear", "Tests bilinear stretching of 32 and 16-bit surfaces.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest14 =
+        { (SDLTest_TestCaseFp)surface_testBlitAlphaSIMD, "surface_testBlitAlphaSIMD", "Tests the SIMD alpha blitters against the C blitters.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest15 =
+        { (SDLTest_TestCaseFp)surface_testBlitAutoSIMD, "surface_testBlitAutoSIMD", "Tests the SIMD generated blitters against the C blitters.", TEST_ENABLED};
+
 /* Sequence of Surface test cases */
 static const SDLTest_TestCaseReference *surfaceTests[] =  {
     &surfaceTest1, &surfaceTest2, &surfaceTest3, &surfaceTest4, &surfaceTest5,
     &surfaceTest6, &surfaceTest7, &surfaceTest8, &surfaceTest9, &surfaceTest10,
-    &surfaceTest11, &surfaceTest12, NULL
+    &surfaceTest11, &surfaceTest12, &surfaceTest13, &surfaceTest14,
+    &surfaceTest15, NULL
 };
 
 /* Surface test suite (global) */
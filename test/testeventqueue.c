@@ -0,0 +1,150 @@
+/*
+  Copyright (C) 1997-2020 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Stress test for the event queue: several threads push events while the
+   main thread polls them, checking that nothing is lost or reordered.
+   Each run is done with the lock-free queue and with the locked list
+   (SDL_HINT_EVENT_QUEUE_LOCKFREE), so the throughput can be compared.
+
+   Usage: testeventqueue [producers] [events per producer]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define MAX_PRODUCERS 32
+
+typedef struct
+{
+    Uint32 type;
+    int index;
+    int count;
+} ProducerData;
+
+static int SDLCALL
+RunProducer(void *data)
+{
+    ProducerData *producer = (ProducerData *)data;
+    SDL_Event event;
+    int i;
+
+    SDL_zero(event);
+    event.type = producer->type;
+    event.user.code = producer->index;
+    for (i = 0; i < producer->count; ++i) {
+        event.user.data1 = (void *)(uintptr_t)i;
+        while (SDL_PushEvent(&event) < 0) {
+            /* Queue is full, give the consumer a chance to catch up */
+            SDL_Delay(0);
+        }
+    }
+    return 0;
+}
+
+static SDL_bool
+RunTest(SDL_bool lockfree, int num_producers, int events_per_producer)
+{
+    ProducerData producers[MAX_PRODUCERS];
+    SDL_Thread *threads[MAX_PRODUCERS];
+    int next_expected[MAX_PRODUCERS];
+    const int total = num_producers * events_per_producer;
+    int received = 0;
+    SDL_bool ok = SDL_TRUE;
+    Uint32 type;
+    Uint64 start, end;
+    double seconds;
+    SDL_Event event;
+    int i;
+
+    SDL_SetHint(SDL_HINT_EVENT_QUEUE_LOCKFREE, lockfree ? "1" : "0");
+    if (SDL_Init(SDL_INIT_EVENTS) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return SDL_FALSE;
+    }
+
+    type = SDL_RegisterEvents(1);
+    start = SDL_GetPerformanceCounter();
+
+    for (i = 0; i < num_producers; ++i) {
+        char name[32];
+
+        producers[i].type = type;
+        producers[i].index = i;
+        producers[i].count = events_per_producer;
+        next_expected[i] = 0;
+        SDL_snprintf(name, sizeof(name), "Producer%d", i);
+        threads[i] = SDL_CreateThread(RunProducer, name, &producers[i]);
+    }
+
+    while (received < total) {
+        if (!SDL_PollEvent(&event)) {
+            continue;
+        }
+        if (event.type != type) {
+            continue;
+        }
+        if (event.user.code < 0 || event.user.code >= num_producers ||
+            (int)(uintptr_t)event.user.data1 != next_expected[event.user.code]) {
+            SDL_Log("Event out of order: producer %d, got %d\n",
+                    event.user.code, (int)(uintptr_t)event.user.data1);
+            ok = SDL_FALSE;
+            if (event.user.code < 0 || event.user.code >= num_producers) {
+                continue;
+            }
+        }
+        next_expected[event.user.code] = (int)(uintptr_t)event.user.data1 + 1;
+        ++received;
+    }
+
+    for (i = 0; i < num_producers; ++i) {
+        SDL_WaitThread(threads[i], NULL);
+    }
+
+    end = SDL_GetPerformanceCounter();
+    seconds = (double)(end - start) / SDL_GetPerformanceFrequency();
+
+    SDL_Log("%-9s %d producers, %d events: %.3f seconds, %.0f events/second%s\n",
+            lockfree ? "lock-free" : "locked", num_producers, total, seconds,
+            seconds > 0.0 ? total / seconds : 0.0, ok ? "" : " (FAILED)");
+
+    SDL_Quit();
+    return ok;
+}
+
+int
+main(int argc, char *argv[])
+{
+    int num_producers = 4;
+    int events_per_producer = 250000;
+    SDL_bool ok = SDL_TRUE;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        num_producers = SDL_atoi(argv[1]);
+    }
+    if (argc > 2) {
+        events_per_producer = SDL_atoi(argv[2]);
+    }
+    if (num_producers < 1 || num_producers > MAX_PRODUCERS || events_per_producer < 1) {
+        SDL_Log("Usage: %s [producers (1-%d)] [events per producer]\n", argv[0], MAX_PRODUCERS);
+        return 1;
+    }
+
+    ok &= RunTest(SDL_FALSE, num_producers, events_per_producer);
+    ok &= RunTest(SDL_TRUE, num_producers, events_per_producer);
+
+    return ok ? 0 : 1;
+}